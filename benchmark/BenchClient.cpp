@@ -0,0 +1,486 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <stdint.h>
+#include <chrono>
+#include <thread>
+
+#include "BenchClient.h"
+#include "base/Common.h"
+#include "base/Constants.h"
+#include "base/Error.h"
+#include "base/Metrics.h"
+#include "base/Protocol.h"
+
+/*!
+ * Constructor
+ * @param sock_path - unix-domain socket of the connector
+ * @param id - prefix for request ids of this client
+ */
+BenchClient::BenchClient(const std::string &sock_path, unsigned int id)
+    : _sock_path(sock_path), _work_group("WORKGROUP"), _user_name("bench"), _password("bench"),
+      _id(id), _sequence(0), _reconnects(0), _receive_timeout(0), _keep_alive(false),
+      _single_round_trip(false), _inline_upload(false), _first_response(0), _sock(NULL)
+{
+}
+
+/*!
+ * Destructor
+ */
+BenchClient::~BenchClient()
+{
+    Disconnect();
+}
+
+/*!
+ * Connect to the connector, retrying while it starts up
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::Connect()
+{
+    Disconnect();
+    for (int waited = 0; waited < BENCH_CONNECT_TIMEOUT; waited += BENCH_CONNECT_RETRY)
+    {
+        _sock = ALLOCATE(UnixDomainSocket);
+        if (!ALLOCATED(_sock))
+        {
+            return SMB_ALLOCATION_FAILED;
+        }
+        if (_sock->Create() == SMB_SUCCESS && _sock->Connect(_sock_path.c_str()) == SMB_SUCCESS)
+        {
+            if (_receive_timeout > 0)
+            {
+                struct timeval tv;
+                tv.tv_sec = _receive_timeout / 1000;
+                tv.tv_usec = (_receive_timeout % 1000) * 1000;
+                setsockopt(_sock->GetFD(), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+            }
+            return SMB_SUCCESS;
+        }
+        Disconnect();
+        std::this_thread::sleep_for(std::chrono::milliseconds(BENCH_CONNECT_RETRY));
+    }
+    return SMB_ERROR;
+}
+
+void BenchClient::Disconnect()
+{
+    if (_sock != NULL)
+    {
+        _sock->Close();
+        FREE(_sock);
+        _sock = NULL;
+    }
+}
+
+/*!
+ * Fill command (and credentials) of a request
+ * @param msg - message to be filled
+ * @param cmd - command
+ * @param url - url to be sent in SmbDetails, NULL for none
+ */
+void BenchClient::init_message(Message &msg, int cmd, const std::string *url)
+{
+    /* numeric like the request ids of real clients, upload uses it to name the temporary file */
+    char request_id[SHORT_BUFFER_SIZE];
+    snprintf(request_id, sizeof(request_id), "%u%09lu", _id + 1, _sequence);
+
+    msg.Clear();
+    msg.mutable_command()->set_requestid(request_id);
+    msg.mutable_command()->set_cmd(cmd);
+    if (url != NULL)
+    {
+        SmbDetails *details = msg.mutable_requestpacket()->mutable_smbdetails();
+        details->set_workgroup(_work_group);
+        details->set_username(_user_name);
+        details->set_password(_password);
+        details->set_url(*url);
+    }
+}
+
+/*!
+ * Send framed message
+ * @param msg - message
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::Send(const Message &msg)
+{
+    std::string buffer(HEADER_SIZE, '\0');
+    uint32_t len = htonl(msg.ByteSize());
+    buffer[0] = VERSION;
+    memcpy(&buffer[LENGTH_OFFSET], &len, LEN_SIZE);
+    msg.AppendToString(&buffer);
+
+    size_t sent = 0;
+    while (sent < buffer.size())
+    {
+        int ret = _sock->Send(buffer.data() + sent, buffer.size() - sent);
+        if (ret <= 0)
+        {
+            return SMB_ERROR;
+        }
+        sent += ret;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Receive one framed message
+ * @param msg - message (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * SMB_EOF - connection closed before header
+ * Otherwise - failure
+ */
+int BenchClient::Receive(Message &msg)
+{
+    char header[HEADER_SIZE];
+    std::string payload;
+    size_t received = 0;
+
+    while (received < HEADER_SIZE)
+    {
+        int ret = _sock->Read(header + received, HEADER_SIZE - received);
+        if (ret <= 0)
+        {
+            return (received == 0 && ret == SMB_EOF) ? SMB_EOF : SMB_ERROR;
+        }
+        received += ret;
+    }
+
+    uint32_t len = 0;
+    memcpy(&len, header + LENGTH_OFFSET, LEN_SIZE);
+    payload.resize(ntohl(len));
+    received = 0;
+    while (received < payload.size())
+    {
+        int ret = _sock->Read(&payload[received], payload.size() - received);
+        if (ret <= 0)
+        {
+            return SMB_ERROR;
+        }
+        received += ret;
+    }
+
+    return msg.ParseFromString(payload) ? SMB_SUCCESS : SMB_ERROR;
+}
+
+/*!
+ * Start a session, connector closes connections it cannot serve yet
+ * (still cleaning up previous session) right after accept, those are retried.
+ * In keep-alive mode the open session is used when the connector still has it.
+ * @param req - first request
+ * @param resp - first response (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::Begin(Message &req, Message &resp)
+{
+    if (_keep_alive && _sock != NULL)
+    {
+        if (Send(req) == SMB_SUCCESS && Receive(resp) == SMB_SUCCESS)
+        {
+            _first_response = Metrics::Now();
+            return SMB_SUCCESS;
+        }
+        _reconnects++;
+    }
+    for (int waited = 0; waited < BENCH_CONNECT_TIMEOUT; waited += BENCH_CONNECT_RETRY)
+    {
+        if (Connect() != SMB_SUCCESS || Send(req) != SMB_SUCCESS)
+        {
+            return SMB_ERROR;
+        }
+        int ret = Receive(resp);
+        if (ret != SMB_EOF)
+        {
+            _first_response = Metrics::Now();
+            return ret;
+        }
+        _reconnects++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(BENCH_CONNECT_RETRY));
+    }
+    return SMB_ERROR;
+}
+
+/*!
+ * Operation done, session is kept open for the next operation in keep-alive mode
+ * @param ret - result of operation
+ * @return
+ * ret
+ */
+int BenchClient::end(int ret)
+{
+    if (!_keep_alive || ret != SMB_SUCCESS)
+    {
+        Disconnect();
+    }
+    return ret;
+}
+
+/*!
+ * Single request/response operation
+ * @param url - resource
+ * @param cmd - request command
+ * @param resp_cmd - expected response command
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::simple_request(const std::string &url, int cmd, int resp_cmd)
+{
+    Message req, resp;
+    _sequence++;
+    init_message(req, cmd, &url);
+    int ret = Begin(req, resp);
+    if (ret == SMB_SUCCESS && (int) resp.command().cmd() != resp_cmd)
+    {
+        ret = SMB_ERROR;
+    }
+    return end(ret);
+}
+
+/*!
+ * List directory
+ * @param url - directory
+ * @param page_size - entries per response
+ * @param entries - number of entries received (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::List(const std::string &url, unsigned int page_size, size_t &entries)
+{
+    Message req, resp;
+    _sequence++;
+    entries = 0;
+    init_message(req, GET_STRUCTURE_INIT_REQ, &url);
+    FolderStructureRequest *list = req.mutable_requestpacket()->mutable_folderstructurerequest();
+    list->set_pagesize(page_size);
+    list->set_showhiddenfiles(true);
+    list->set_showonlyfolders(false);
+
+    int ret = Begin(req, resp);
+    while (ret == SMB_SUCCESS && resp.command().cmd() == GET_STRUCTURE_INIT_RESP)
+    {
+        entries += resp.responsepacket().folderstructureresponse().fileinformation_size();
+        ret = Receive(resp);
+    }
+    if (ret == SMB_SUCCESS && resp.command().cmd() != GET_STRUCTURE_END_RESP)
+    {
+        ret = SMB_ERROR;
+    }
+    return end(ret);
+}
+
+/*!
+ * Download complete file
+ * @param url - file
+ * @param chunk_size - requested chunk size
+ * @param bytes - bytes received (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::Download(const std::string &url, unsigned int chunk_size, size_t &bytes)
+{
+    Message req, resp;
+    _sequence++;
+    bytes = 0;
+    init_message(req, DOWNLOAD_INIT_REQ, &url);
+    if (_single_round_trip)
+    {
+        /* whole file, connector clips the range to the file size */
+        RangeDownloadRequest *range = req.mutable_requestpacket()->mutable_rangedownloadrequest();
+        range->set_start(0);
+        range->set_end(UINT64_MAX);
+        range->set_chunksize(chunk_size);
+    }
+
+    int ret = Begin(req, resp);
+    if (ret != SMB_SUCCESS || resp.command().cmd() != DOWNLOAD_INIT_RESP)
+    {
+        return end(SMB_ERROR);
+    }
+
+    uint64_t size = resp.responsepacket().downloadinitresponse().fileinformation().size();
+    if (!_single_round_trip)
+    {
+        init_message(req, DOWNLOAD_DATA_REQ, NULL);
+        RangeDownloadRequest *range = req.mutable_requestpacket()->mutable_rangedownloadrequest();
+        range->set_start(0);
+        range->set_end(size > 0 ? size - 1 : 0);
+        range->set_chunksize(chunk_size);
+        ret = Send(req);
+    }
+
+    while (ret == SMB_SUCCESS && (ret = Receive(resp)) == SMB_SUCCESS
+           && resp.command().cmd() == DOWNLOAD_DATA_RESP)
+    {
+        bytes += resp.responsepacket().downloaddataresponse().data().size();
+    }
+    if (ret == SMB_SUCCESS && (resp.command().cmd() != DOWNLOAD_END_RESP || bytes != size))
+    {
+        ret = SMB_ERROR;
+    }
+    return end(ret);
+}
+
+/*!
+ * Upload file
+ * @param url - file
+ * @param data - content
+ * @param chunk_size - bytes per UPLOAD_DATA_REQ
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::Upload(const std::string &url, const std::string &data, size_t chunk_size)
+{
+    Message req, resp;
+    _sequence++;
+    init_message(req, UPLOAD_INIT_REQ, &url);
+    if (_inline_upload && data.size() <= chunk_size)
+    {
+        UploadRequestData *inline_data = req.mutable_requestpacket()->mutable_uploadrequestdata();
+        inline_data->set_data(data);
+        inline_data->set_last(true);
+        int ret = Begin(req, resp);
+        if (ret == SMB_SUCCESS && resp.command().cmd() != UPLOAD_END_RESP)
+        {
+            ret = SMB_ERROR;
+        }
+        return end(ret);
+    }
+
+    int ret = Begin(req, resp);
+    if (ret != SMB_SUCCESS || resp.command().cmd() != UPLOAD_INIT_RESP)
+    {
+        return end(SMB_ERROR);
+    }
+
+    for (size_t offset = 0; ret == SMB_SUCCESS && offset < data.size(); offset += chunk_size)
+    {
+        init_message(req, UPLOAD_DATA_REQ, NULL);
+        req.mutable_requestpacket()->mutable_uploadrequestdata()->set_data(data.data() + offset,
+                                                                          MIN(chunk_size, data.size() - offset));
+        ret = Send(req);
+    }
+
+    if (ret == SMB_SUCCESS)
+    {
+        init_message(req, UPLOAD_END_REQ, NULL);
+        ret = Send(req);
+    }
+    if (ret == SMB_SUCCESS)
+    {
+        ret = Receive(resp);
+    }
+    if (ret == SMB_SUCCESS && resp.command().cmd() != UPLOAD_END_RESP)
+    {
+        ret = SMB_ERROR;
+    }
+    return end(ret);
+}
+
+int BenchClient::AddFolder(const std::string &url)
+{
+    return simple_request(url, ADD_FOLDER_INIT_REQ, ADD_FOLDER_INIT_RESP);
+}
+
+int BenchClient::Delete(const std::string &url)
+{
+    return simple_request(url, DELETE_INIT_REQ, DELETE_INIT_RESP);
+}
+
+/*!
+ * Copy file on the server, destination is replaced
+ * @param url - file
+ * @param destination - server/share/path of the copy
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BenchClient::Copy(const std::string &url, const std::string &destination)
+{
+    Message req, resp;
+    _sequence++;
+    init_message(req, COPY_REQ, &url);
+    CopyRequest *copy = req.mutable_requestpacket()->mutable_copyrequest();
+    copy->set_destination(destination);
+    copy->set_overwrite(true);
+    int ret = Begin(req, resp);
+    if (ret == SMB_SUCCESS && resp.command().cmd() != COPY_RESP)
+    {
+        ret = SMB_ERROR;
+    }
+    return end(ret);
+}
+
+/*!
+ * Fail Receive() when nothing arrives within timeout, applies to next Connect()
+ * @param timeout - milli-seconds, 0 - wait forever
+ */
+void BenchClient::SetReceiveTimeout(int timeout)
+{
+    _receive_timeout = timeout;
+}
+
+/*!
+ * Run operations one after another on the same session
+ * @param keep_alive - keep session open after an operation
+ */
+void BenchClient::SetKeepAlive(bool keep_alive)
+{
+    _keep_alive = keep_alive;
+}
+
+/*!
+ * Send download range with DOWNLOAD_INIT_REQ, data follows DOWNLOAD_INIT_RESP
+ * without another request
+ * @param single_round_trip - combine init and data request
+ */
+void BenchClient::SetSingleRoundTrip(bool single_round_trip)
+{
+    _single_round_trip = single_round_trip;
+}
+
+/*!
+ * Send files up to chunk size inline with UPLOAD_INIT_REQ
+ * @param inline_upload - single request uploads
+ */
+void BenchClient::SetInlineUpload(bool inline_upload)
+{
+    _inline_upload = inline_upload;
+}
+
+/*!
+ * Sessions restarted because connector was still busy
+ * @return
+ * reconnects
+ */
+unsigned long BenchClient::Reconnects() const
+{
+    return _reconnects;
+}
+
+/*!
+ * Time first response of last operation was received
+ * @return
+ * Metrics::Now() of first response
+ */
+uint64_t BenchClient::FirstResponse() const
+{
+    return _first_response;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef BENCH_CLIENT_H_
+#define BENCH_CLIENT_H_
+
+#include <stdint.h>
+#include <string>
+
+#include "protocol_buffers/common.pb.h"
+#include "socket/UnixDomainSocket.h"
+
+#define BENCH_CONNECT_TIMEOUT   10000   //milli-seconds to wait for connector to accept
+#define BENCH_CONNECT_RETRY     1       //milli-seconds between connect attempts
+
+/*
+ * Synchronous smb-connector client used by the benchmark driver.
+ * Every operation is one session: connect, exchange packets, disconnect,
+ * just like Client does in client mode. In keep-alive mode the session
+ * stays open and the next operation is sent on it.
+ */
+class BenchClient
+{
+private:
+    std::string _sock_path;
+    std::string _work_group;
+    std::string _user_name;
+    std::string _password;
+    unsigned int _id;
+    unsigned long _sequence;
+    unsigned long _reconnects;
+    int _receive_timeout;
+    bool _keep_alive;
+    bool _single_round_trip;
+    bool _inline_upload;
+    uint64_t _first_response;   //first response of last operation received, Metrics::Now()
+    UnixDomainSocket *_sock;
+
+    void init_message(Message &msg, int cmd, const std::string *url);
+    int end(int ret);
+    int simple_request(const std::string &url, int cmd, int resp_cmd);
+
+public:
+    BenchClient(const std::string &sock_path, unsigned int id);
+    ~BenchClient();
+
+    /* raw session, used to replay captured frames */
+    int Connect();
+    void Disconnect();
+    int Send(const Message &msg);
+    int Receive(Message &msg);
+    int Begin(Message &req, Message &resp);
+    void SetReceiveTimeout(int timeout);
+    void SetKeepAlive(bool keep_alive);
+    void SetSingleRoundTrip(bool single_round_trip);
+    void SetInlineUpload(bool inline_upload);
+
+    int List(const std::string &url, unsigned int page_size, size_t &entries);
+    int Download(const std::string &url, unsigned int chunk_size, size_t &bytes);
+    int Upload(const std::string &url, const std::string &data, size_t chunk_size);
+    int AddFolder(const std::string &url);
+    int Delete(const std::string &url);
+    int Copy(const std::string &url, const std::string &destination);
+
+    unsigned long Reconnects() const;
+    uint64_t FirstResponse() const;
+};
+
+#endif //BENCH_CLIENT_H_
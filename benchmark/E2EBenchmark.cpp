@@ -0,0 +1,775 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+/*
+ * End-to-end benchmark driver.
+ * Starts smb-connector servers (subprocesses, or one in-process server) on a
+ * stand-in storage backend and drives concurrent sessions of list, download,
+ * upload, mkdir and delete through the unix-domain socket protocol.
+ * Reports throughput and latency percentiles as JSON and optionally fails when
+ * results regress past a stored baseline.
+ */
+
+#include <getopt.h>
+#include <signal.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <atomic>
+#include <thread>
+
+#include "BenchClient.h"
+#include "base/Common.h"
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Log4Cpp.h"
+#include "base/Metrics.h"
+#include "base/Trace.h"
+#include "core/Server.h"
+
+#define BENCH_USAGE \
+"\t\t-c, --connector    - smbconnector binary started per session (default: ./smbconnector)\n" \
+"\t\t-i, --in_process   - run one connector in-process instead (single session)\n" \
+"\t\t-s, --sessions     - concurrent sessions (default: 4)\n" \
+"\t\t-d, --duration     - measured seconds (default: 10)\n" \
+"\t\t-W, --warmup       - seconds run before measuring (default: 1)\n" \
+"\t\t-o, --ops          - comma separated operations: list,download,upload,mkdir,delete,tree_upload,copy\n" \
+"\t\t                     (default: all but tree_upload and copy)\n" \
+"\t\t-f, --file_size    - bytes per downloaded/uploaded file (default: 1048576)\n" \
+"\t\t-n, --list_files   - entries in listed directory (default: 100)\n" \
+"\t\t-a, --page_size    - entries per list response (default: 50)\n" \
+"\t\t-k, --chunk_size   - bytes per download/upload data packet (default: 61440)\n" \
+"\t\t-K, --keep_alive   - run operations of a session on one connection\n" \
+"\t\t-R, --single_rtt   - send download range along with DOWNLOAD_INIT_REQ\n" \
+"\t\t-U, --inline_upload - send files up to chunk_size inline with UPLOAD_INIT_REQ\n" \
+"\t\t-D, --known_dirs   - known_dirs of the connector, folders remembered per session\n" \
+"\t\t-B, --backend      - storage backend memory or posix (default: memory)\n" \
+"\t\t-r, --storage_root - root directory for posix backend (default: <work_dir>/storage)\n" \
+"\t\t-L, --latency      - injected storage latency in micro-seconds (default: 0)\n" \
+"\t\t-b, --bandwidth    - injected storage bandwidth in bytes per second (default: unlimited)\n" \
+"\t\t-w, --work_dir     - directory for sockets, logs and configuration (default: /tmp/smbconnector_e2e)\n" \
+"\t\t-T, --trace_dir    - enable connector phase tracing, Chrome trace JSON per request in this directory\n" \
+"\t\t-O, --output       - write JSON results to file (default: stdout)\n" \
+"\t\t-C, --compare      - baseline JSON, exit with 2 when results regress\n" \
+"\t\t-t, --tolerance    - allowed regression in percent (default: 10)\n"
+
+#define BENCH_OP_LIST       0
+#define BENCH_OP_DOWNLOAD   1
+#define BENCH_OP_UPLOAD     2
+#define BENCH_OP_MKDIR      3
+#define BENCH_OP_DELETE     4
+#define BENCH_OP_TREE_UPLOAD 5  //small files spread over a folder tree
+#define BENCH_OP_COPY       6   //server side copy of the downloaded file
+#define BENCH_OP_MAX        7
+
+#define BENCH_TREE_FOLDERS  16  //folders of the tree, each with BENCH_TREE_SUBFOLDERS
+#define BENCH_TREE_SUBFOLDERS 4
+#define BENCH_TREE_FILE_SIZE 1024
+
+#define BENCH_SHARE         "bench/share"
+#define BENCH_REGRESSION    2
+
+int should_exit = 0;
+int dump_metrics = 0;
+int logLevel = LOG_LVL_NONE;
+Log4Cpp *logger = NULL;
+
+static const char *op_names[BENCH_OP_MAX] = {"list", "download", "upload", "mkdir", "delete", "tree_upload", "copy"};
+
+struct BenchOptions
+{
+    std::string connector;
+    bool in_process;
+    int sessions;
+    int duration;
+    int warmup;
+    bool ops[BENCH_OP_MAX];
+    size_t file_size;
+    int list_files;
+    unsigned int page_size;
+    unsigned int chunk_size;
+    bool keep_alive;
+    bool single_rtt;
+    bool inline_upload;
+    std::string known_dirs;     //empty - connector default
+    std::string backend;
+    std::string storage_root;
+    long latency;
+    unsigned long bandwidth;
+    std::string work_dir;
+    std::string trace_dir;
+    std::string output;
+    std::string compare;
+    double tolerance;
+
+    BenchOptions() : connector("./smbconnector"), in_process(false), sessions(4), duration(10), warmup(1),
+                     file_size(1048576), list_files(100), page_size(50), chunk_size(61440), keep_alive(false),
+                     single_rtt(false), inline_upload(false), backend("memory"), latency(0), bandwidth(0),
+                     work_dir("/tmp/smbconnector_e2e"), tolerance(10)
+    {
+        for (int op = 0; op < BENCH_OP_MAX; op++)
+        {
+            ops[op] = op != BENCH_OP_TREE_UPLOAD && op != BENCH_OP_COPY;
+        }
+    }
+};
+
+/*
+ * Results of one operation, shared by all sessions
+ */
+struct BenchResult
+{
+    Histogram _latency;
+    Histogram _first;           //time to first response
+    std::atomic<uint64_t> _errors;
+    std::atomic<uint64_t> _bytes;
+
+    BenchResult() : _errors(0), _bytes(0) {}
+};
+
+static BenchOptions options;
+static BenchResult results[BENCH_OP_MAX];
+static std::atomic<bool> measuring(false);
+static std::atomic<bool> running(true);
+static std::atomic<unsigned long> reconnects(0);
+
+static struct option long_options[] =
+    {
+        {"help",         no_argument,       0, 'h'},
+        {"connector",    required_argument, 0, 'c'},
+        {"in_process",   no_argument,       0, 'i'},
+        {"sessions",     required_argument, 0, 's'},
+        {"duration",     required_argument, 0, 'd'},
+        {"warmup",       required_argument, 0, 'W'},
+        {"ops",          required_argument, 0, 'o'},
+        {"file_size",    required_argument, 0, 'f'},
+        {"list_files",   required_argument, 0, 'n'},
+        {"page_size",    required_argument, 0, 'a'},
+        {"chunk_size",   required_argument, 0, 'k'},
+        {"keep_alive",   no_argument,       0, 'K'},
+        {"single_rtt",   no_argument,       0, 'R'},
+        {"inline_upload", no_argument,      0, 'U'},
+        {"known_dirs",   required_argument, 0, 'D'},
+        {"backend",      required_argument, 0, 'B'},
+        {"storage_root", required_argument, 0, 'r'},
+        {"latency",      required_argument, 0, 'L'},
+        {"bandwidth",    required_argument, 0, 'b'},
+        {"work_dir",     required_argument, 0, 'w'},
+        {"trace_dir",    required_argument, 0, 'T'},
+        {"output",       required_argument, 0, 'O'},
+        {"compare",      required_argument, 0, 'C'},
+        {"tolerance",    required_argument, 0, 't'},
+        {0, 0, 0, 0}
+    };
+
+static void print_help()
+{
+    printf("Usage: smbconnector_e2e [options]\n");
+    printf(BENCH_USAGE);
+}
+
+static int parse_ops(const char *list)
+{
+    for (int op = 0; op < BENCH_OP_MAX; op++)
+    {
+        options.ops[op] = false;
+    }
+
+    std::string ops(list);
+    size_t start = 0;
+    while (start <= ops.length())
+    {
+        size_t end = ops.find(',', start);
+        std::string name = ops.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        int op = 0;
+        while (op < BENCH_OP_MAX && name != op_names[op])
+        {
+            op++;
+        }
+        if (op == BENCH_OP_MAX)
+        {
+            fprintf(stderr, "Unknown operation '%s'\n", name.c_str());
+            return SMB_ERROR;
+        }
+        options.ops[op] = true;
+        if (end == std::string::npos)
+        {
+            break;
+        }
+        start = end + 1;
+    }
+    return SMB_SUCCESS;
+}
+
+static void process_args(int argc, char *argv[])
+{
+    while (true)
+    {
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "hc:is:d:W:o:f:n:a:k:KRUD:B:r:L:b:w:T:O:C:t:", long_options, &option_index);
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'c':
+                options.connector = optarg;
+                break;
+            case 'i':
+                options.in_process = true;
+                break;
+            case 's':
+                options.sessions = atoi(optarg);
+                break;
+            case 'd':
+                options.duration = atoi(optarg);
+                break;
+            case 'W':
+                options.warmup = atoi(optarg);
+                break;
+            case 'o':
+                if (parse_ops(optarg) != SMB_SUCCESS)
+                {
+                    exit(1);
+                }
+                break;
+            case 'f':
+                options.file_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                options.list_files = atoi(optarg);
+                break;
+            case 'a':
+                options.page_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'k':
+                options.chunk_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'K':
+                options.keep_alive = true;
+                break;
+            case 'R':
+                options.single_rtt = true;
+                break;
+            case 'U':
+                options.inline_upload = true;
+                break;
+            case 'D':
+                options.known_dirs = optarg;
+                break;
+            case 'B':
+                options.backend = optarg;
+                break;
+            case 'r':
+                options.storage_root = optarg;
+                break;
+            case 'L':
+                options.latency = atol(optarg);
+                break;
+            case 'b':
+                options.bandwidth = strtoul(optarg, NULL, 10);
+                break;
+            case 'w':
+                options.work_dir = optarg;
+                break;
+            case 'T':
+                options.trace_dir = optarg;
+                break;
+            case 'O':
+                options.output = optarg;
+                break;
+            case 'C':
+                options.compare = optarg;
+                break;
+            case 't':
+                options.tolerance = atof(optarg);
+                break;
+            case 'h':
+            default:
+                print_help();
+                exit(c == 'h' ? 0 : 1);
+        }
+    }
+
+    if (options.storage_root.empty())
+    {
+        options.storage_root = options.work_dir + "/storage";
+    }
+    if (options.in_process && options.sessions != 1)
+    {
+        /* connector state (request processor, storage client) is process wide */
+        fprintf(stderr, "In-process connector serves a single session, using 1 session\n");
+        options.sessions = 1;
+    }
+    if (options.sessions < 1 || options.duration < 1 || options.chunk_size == 0 || options.page_size == 0)
+    {
+        print_help();
+        exit(1);
+    }
+}
+
+static std::string sock_path(int session)
+{
+    return options.work_dir + "/session" + std::to_string(session) + ".sock";
+}
+
+/*!
+ * Write connector configuration for subprocesses
+ * @return
+ * configuration file path
+ */
+static std::string write_conf()
+{
+    std::string conf = options.work_dir + "/smb-connector.conf";
+    std::ofstream file(conf.c_str());
+    file << "idle_timeout 3600\n";
+    file << "log_level 1\n";
+    file << C_STORAGE_BACKEND " " << options.backend << "\n";
+    file << C_STORAGE_ROOT " " << options.storage_root << "\n";
+    file << C_STORAGE_LATENCY " " << options.latency << "\n";
+    file << C_STORAGE_BANDWIDTH " " << options.bandwidth << "\n";
+    if (!options.known_dirs.empty())
+    {
+        file << C_KNOWN_DIRS " " << options.known_dirs << "\n";
+    }
+    if (!options.trace_dir.empty())
+    {
+        file << C_TRACE " 1\n";
+        file << C_TRACE_DIR " " << options.trace_dir << "\n";
+    }
+    return conf;
+}
+
+/*!
+ * Start one connector subprocess per session
+ * @param pids - started processes (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+static int start_subprocesses(std::vector<pid_t> &pids)
+{
+    std::string conf = write_conf();
+    for (int session = 0; session < options.sessions; session++)
+    {
+        std::string sock = sock_path(session);
+        std::string log = options.work_dir + "/session" + std::to_string(session) + ".log";
+        std::string conf_arg = "--conf_file=" + conf;
+
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            perror("fork");
+            return SMB_ERROR;
+        }
+        if (pid == 0)
+        {
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+            execl(options.connector.c_str(), options.connector.c_str(), "-s", sock.c_str(), "-l", log.c_str(),
+                  conf_arg.c_str(), (char *) NULL);
+            perror("exec smbconnector");
+            _exit(127);
+        }
+        pids.push_back(pid);
+    }
+    return SMB_SUCCESS;
+}
+
+static void stop_subprocesses(std::vector<pid_t> &pids)
+{
+    for (size_t i = 0; i < pids.size(); i++)
+    {
+        kill(pids[i], SIGINT);
+    }
+    for (size_t i = 0; i < pids.size(); i++)
+    {
+        waitpid(pids[i], NULL, 0);
+    }
+}
+
+/*!
+ * Run connector in this process
+ * @param server - server (out)
+ * @return
+ * server thread
+ */
+static std::thread *start_in_process(Server *&server)
+{
+    Configuration &c = Configuration::GetInstance();
+    c.Set(C_IDLE_TIMEOUT, "3600");
+    c.Set(C_STORAGE_BACKEND, options.backend.c_str());
+    c.Set(C_STORAGE_ROOT, options.storage_root.c_str());
+    c.Set(C_STORAGE_LATENCY, std::to_string(options.latency).c_str());
+    c.Set(C_STORAGE_BANDWIDTH, std::to_string(options.bandwidth).c_str());
+    if (!options.known_dirs.empty())
+    {
+        c.Set(C_KNOWN_DIRS, options.known_dirs.c_str());
+    }
+    if (!options.trace_dir.empty())
+    {
+        Tracer::GetInstance().Init(true, options.trace_dir);
+    }
+
+    server = ALLOCATE(Server);
+    if (!ALLOCATED(server) || server->Init(sock_path(0).c_str()) != SMB_SUCCESS)
+    {
+        return NULL;
+    }
+    return ALLOCATE(std::thread, &Server::Runloop, server);
+}
+
+/*!
+ * Create files used by the session
+ * @param client - session client
+ * @param base - namespace of the session
+ * @param data - file content
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+static int seed(BenchClient &client, const std::string &base, const std::string &data)
+{
+    std::string small(1024, 's');
+    for (int i = 0; i < options.list_files; i++)
+    {
+        if (client.Upload(base + "/list/file" + std::to_string(i), small, options.chunk_size) != SMB_SUCCESS)
+        {
+            return SMB_ERROR;
+        }
+    }
+    if (client.Upload(base + "/data.bin", data, options.chunk_size) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+    return client.AddFolder(base + "/dirs");
+}
+
+/*!
+ * Run one operation, record its latency when measuring
+ * @param client - session client
+ * @param op - operation
+ * @param base - namespace of the session
+ * @param data - upload content
+ * @param iteration - iteration of the session
+ */
+static void run_op(BenchClient &client, int op, const std::string &base, const std::string &data,
+                   unsigned long iteration)
+{
+    std::string dir = base + "/dirs/dir" + std::to_string(iteration);
+    size_t bytes = 0;
+    int ret = SMB_ERROR;
+
+    if (op == BENCH_OP_DELETE && !options.ops[BENCH_OP_MKDIR])
+    {
+        /* directory to be deleted, not measured */
+        client.AddFolder(dir);
+    }
+
+    uint64_t start = Metrics::Now();
+    switch (op)
+    {
+        case BENCH_OP_LIST:
+            ret = client.List(base + "/list", options.page_size, bytes);
+            bytes = 0;
+            break;
+        case BENCH_OP_DOWNLOAD:
+            ret = client.Download(base + "/data.bin", options.chunk_size, bytes);
+            break;
+        case BENCH_OP_UPLOAD:
+            ret = client.Upload(base + "/upload.bin", data, options.chunk_size);
+            bytes = data.size();
+            break;
+        case BENCH_OP_MKDIR:
+            ret = client.AddFolder(dir);
+            break;
+        case BENCH_OP_DELETE:
+            ret = client.Delete(dir);
+            break;
+        case BENCH_OP_TREE_UPLOAD:
+            ret = client.Upload(base + "/tree/d" + std::to_string(iteration % BENCH_TREE_FOLDERS) + "/s"
+                                + std::to_string(iteration / BENCH_TREE_FOLDERS % BENCH_TREE_SUBFOLDERS) + "/file"
+                                + std::to_string(iteration), std::string(BENCH_TREE_FILE_SIZE, 't'),
+                                options.chunk_size);
+            bytes = BENCH_TREE_FILE_SIZE;
+            break;
+        case BENCH_OP_COPY:
+            ret = client.Copy(base + "/data.bin", base + "/copy.bin");
+            bytes = options.file_size;
+            break;
+    }
+    uint64_t latency = Metrics::Now() - start;
+
+    if (!measuring)
+    {
+        return;
+    }
+    if (ret != SMB_SUCCESS)
+    {
+        results[op]._errors++;
+        return;
+    }
+    results[op]._latency.Record(latency);
+    results[op]._first.Record(client.FirstResponse() > start ? client.FirstResponse() - start : 0);
+    results[op]._bytes += bytes;
+}
+
+static void session(int id, std::atomic<int> *failed)
+{
+    BenchClient client(sock_path(options.in_process ? 0 : id), id);
+    client.SetKeepAlive(options.keep_alive);
+    client.SetSingleRoundTrip(options.single_rtt);
+    client.SetInlineUpload(options.inline_upload);
+    std::string base = std::string(BENCH_SHARE) + "/session" + std::to_string(id);
+    std::string data(options.file_size, 'd');
+
+    if (seed(client, base, data) != SMB_SUCCESS)
+    {
+        fprintf(stderr, "Session %d: creating test files failed\n", id);
+        (*failed)++;
+        return;
+    }
+
+    for (unsigned long iteration = 0; running; iteration++)
+    {
+        for (int op = 0; op < BENCH_OP_MAX && running; op++)
+        {
+            if (options.ops[op])
+            {
+                run_op(client, op, base, data, iteration);
+            }
+        }
+    }
+    reconnects += client.Reconnects();
+}
+
+/*!
+ * Results as JSON
+ * @param elapsed - measured seconds
+ * @return
+ * JSON document
+ */
+static std::string report(double elapsed)
+{
+    char buffer[LONG_BUFFER_SIZE];
+    std::string out;
+    uint64_t total = 0;
+
+    snprintf(buffer, sizeof(buffer),
+             "{\"config\":{\"mode\":\"%s\",\"sessions\":%d,\"duration_sec\":%d,\"backend\":\"%s\","
+             "\"latency_us\":%ld,\"bandwidth\":%lu,\"file_size\":%lu,\"list_files\":%d,\"page_size\":%u,"
+             "\"chunk_size\":%u,\"keep_alive\":%s,\"single_rtt\":%s,\"inline_upload\":%s,\"known_dirs\":\"%s\"},",
+             options.in_process ? "in_process" : "subprocess", options.sessions, options.duration,
+             options.backend.c_str(), options.latency, options.bandwidth, (unsigned long) options.file_size,
+             options.list_files, options.page_size, options.chunk_size,
+             options.keep_alive ? "true" : "false", options.single_rtt ? "true" : "false",
+             options.inline_upload ? "true" : "false", options.known_dirs.empty() ? "default" : options.known_dirs.c_str());
+    out = buffer;
+
+    out += "\"ops\":{";
+    bool first = true;
+    for (int op = 0; op < BENCH_OP_MAX; op++)
+    {
+        if (!options.ops[op])
+        {
+            continue;
+        }
+        const Histogram &h = results[op]._latency;
+        const Histogram &f = results[op]._first;
+        total += h.Count();
+        snprintf(buffer, sizeof(buffer),
+                 "%s\"%s\":{\"count\":%lu,\"errors\":%lu,\"ops_per_sec\":%.2f,\"mb_per_sec\":%.2f,"
+                 "\"mean_us\":%lu,\"p50_us\":%lu,\"p99_us\":%lu,\"p999_us\":%lu,\"max_us\":%lu,"
+                 "\"first_p50_us\":%lu,\"first_p99_us\":%lu}",
+                 first ? "" : ",", op_names[op], (unsigned long) h.Count(), (unsigned long) results[op]._errors,
+                 h.Count() / elapsed, results[op]._bytes / elapsed / (1024 * 1024), (unsigned long) h.Mean(),
+                 (unsigned long) h.Percentile(50), (unsigned long) h.Percentile(99),
+                 (unsigned long) h.Percentile(99.9), (unsigned long) h.Max(),
+                 (unsigned long) f.Percentile(50), (unsigned long) f.Percentile(99));
+        out += buffer;
+        first = false;
+    }
+
+    snprintf(buffer, sizeof(buffer), "},\"elapsed_sec\":%.3f,\"total_ops_per_sec\":%.2f,\"reconnects\":%lu",
+             elapsed, total / elapsed, (unsigned long) reconnects);
+    out += buffer;
+
+    /* storage calls of the measured period, only known for the in-process connector */
+    if (options.in_process)
+    {
+        Metrics &metrics = Metrics::GetInstance();
+        out += ",\"smb_calls\":{";
+        for (int call = 0; call < METRIC_CALL_MAX; call++)
+        {
+            snprintf(buffer, sizeof(buffer), "%s\"%s\":%lu", call == 0 ? "" : ",",
+                     Metrics::CallName((MetricCall) call), (unsigned long) metrics.Call((MetricCall) call).Count());
+            out += buffer;
+        }
+        out += "}";
+    }
+    out += "}";
+    return out;
+}
+
+/*!
+ * Value of a numeric field of an operation in a JSON report
+ * @param json - report
+ * @param op - operation name
+ * @param field - field name
+ * @param value - value (out)
+ * @return
+ * true - found
+ * false - not found
+ */
+static bool json_value(const std::string &json, const char *op, const char *field, double &value)
+{
+    size_t ops = json.find("\"ops\":{");
+    size_t start = json.find(std::string("\"") + op + "\":{", ops == std::string::npos ? 0 : ops);
+    if (ops == std::string::npos || start == std::string::npos)
+    {
+        return false;
+    }
+    size_t end = json.find('}', start);
+    size_t pos = json.find(std::string("\"") + field + "\":", start);
+    if (pos == std::string::npos || pos > end)
+    {
+        return false;
+    }
+    value = atof(json.c_str() + pos + strlen(field) + 3);
+    return true;
+}
+
+/*!
+ * Compare results with baseline
+ * @param current - current report
+ * @return
+ * SMB_SUCCESS - no regression
+ * Otherwise - regressed
+ */
+static int compare(const std::string &current)
+{
+    std::ifstream file(options.compare.c_str());
+    std::string baseline((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (baseline.empty())
+    {
+        fprintf(stderr, "Cannot read baseline %s\n", options.compare.c_str());
+        return SMB_ERROR;
+    }
+
+    int ret = SMB_SUCCESS;
+    double factor = options.tolerance / 100.0;
+    for (int op = 0; op < BENCH_OP_MAX; op++)
+    {
+        double base_p99, base_rate, p99, rate, errors;
+        if (!options.ops[op] || !json_value(baseline, op_names[op], "p99_us", base_p99)
+            || !json_value(baseline, op_names[op], "ops_per_sec", base_rate))
+        {
+            continue;
+        }
+        json_value(current, op_names[op], "p99_us", p99);
+        json_value(current, op_names[op], "ops_per_sec", rate);
+        json_value(current, op_names[op], "errors", errors);
+
+        if (errors > 0)
+        {
+            fprintf(stderr, "REGRESSION %s: %.0f errors\n", op_names[op], errors);
+            ret = SMB_ERROR;
+        }
+        if (p99 > base_p99 * (1 + factor))
+        {
+            fprintf(stderr, "REGRESSION %s: p99 %.0f us, baseline %.0f us\n", op_names[op], p99, base_p99);
+            ret = SMB_ERROR;
+        }
+        if (rate < base_rate * (1 - factor))
+        {
+            fprintf(stderr, "REGRESSION %s: %.2f ops/sec, baseline %.2f ops/sec\n", op_names[op], rate, base_rate);
+            ret = SMB_ERROR;
+        }
+    }
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    signal(SIGPIPE, SIG_IGN);
+    process_args(argc, argv);
+    mkdir(options.work_dir.c_str(), 0755);
+
+    std::vector<pid_t> pids;
+    Server *server = NULL;
+    std::thread *server_thread = NULL;
+    if (options.in_process)
+    {
+        server_thread = start_in_process(server);
+        if (server_thread == NULL)
+        {
+            fprintf(stderr, "Starting in-process connector failed\n");
+            return 1;
+        }
+    }
+    else if (start_subprocesses(pids) != SMB_SUCCESS)
+    {
+        stop_subprocesses(pids);
+        return 1;
+    }
+
+    std::atomic<int> failed(0);
+    std::vector<std::thread *> sessions;
+    for (int id = 0; id < options.sessions; id++)
+    {
+        sessions.push_back(ALLOCATE(std::thread, session, id, &failed));
+    }
+
+    sleep(options.warmup);
+    Metrics::GetInstance().Reset();
+    measuring = true;
+    uint64_t start = Metrics::Now();
+    sleep(options.duration);
+    measuring = false;
+    double elapsed = (Metrics::Now() - start) / 1e6;
+    running = false;
+
+    for (size_t i = 0; i < sessions.size(); i++)
+    {
+        sessions[i]->join();
+        FREE(sessions[i]);
+    }
+
+    if (options.in_process)
+    {
+        should_exit = 1;
+        server_thread->join();
+        FREE(server_thread);
+        server->Quit();
+        FREE(server);
+    }
+    else
+    {
+        stop_subprocesses(pids);
+    }
+
+    std::string json = report(elapsed);
+    if (options.output.empty())
+    {
+        printf("%s\n", json.c_str());
+    }
+    else
+    {
+        std::ofstream(options.output.c_str()) << json << "\n";
+    }
+
+    if (failed > 0)
+    {
+        return 1;
+    }
+    if (!options.compare.empty() && compare(json) != SMB_SUCCESS)
+    {
+        return BENCH_REGRESSION;
+    }
+    return 0;
+}
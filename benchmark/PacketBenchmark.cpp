@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+/*
+ * Microbenchmarks for packet framing, creation and parsing and for the
+ * SessionManager queues. Results are written as JSON unless another
+ * --benchmark_format is given.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "base/Common.h"
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Log4Cpp.h"
+#include "base/Protocol.h"
+#include "core/SessionManager.h"
+#include "packet/IPacketCreator.h"
+#include "processor/DownloadProcessor.h"
+#include "processor/OpenDirReqProcessor.h"
+#include "smb/SmbClient.h"
+#include "storage/MemoryBackend.h"
+
+#define BENCH_LIST_URL  "bench/share/list"
+
+int should_exit = 0;
+int dump_metrics = 0;
+int logLevel = LOG_LVL_NONE;
+Log4Cpp *logger = NULL;
+
+static std::string request_id = "1234";
+
+/*!
+ * Message carrying payload of given size, as sent for download data
+ * @param msg - message to be filled
+ * @param size - payload size
+ */
+static void fill_data_message(Message &msg, size_t size)
+{
+    msg.mutable_command()->set_cmd(DOWNLOAD_DATA_RESP);
+    msg.mutable_command()->set_requestid(request_id);
+    msg.mutable_responsepacket()->mutable_downloaddataresponse()->set_data(std::string(size, 'd'));
+}
+
+static void BM_PutHeader(benchmark::State &state)
+{
+    Packet packet;
+    packet._pb_msg = ALLOCATE(Message);
+    fill_data_message(*packet._pb_msg, state.range(0));
+
+    for (auto _ : state)
+    {
+        packet.PutHeader();
+        benchmark::DoNotOptimize(packet._header);
+    }
+}
+BENCHMARK(BM_PutHeader)->RangeMultiplier(16)->Range(4 << 10, 1 << 20);
+
+static void BM_PutData(benchmark::State &state)
+{
+    Packet packet;
+    packet._pb_msg = ALLOCATE(Message);
+    fill_data_message(*packet._pb_msg, state.range(0));
+    packet.PutHeader();
+
+    for (auto _ : state)
+    {
+        packet.PutData();
+        benchmark::DoNotOptimize(packet._data);
+        FREE_ARR(packet._data);
+        packet._data = NULL;
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PutData)->RangeMultiplier(4)->Range(4 << 10, 1 << 20);
+
+static void BM_ParseProtoBuffer(benchmark::State &state)
+{
+    Message msg;
+    msg.mutable_command()->set_cmd(UPLOAD_DATA_REQ);
+    msg.mutable_command()->set_requestid(request_id);
+    msg.mutable_requestpacket()->mutable_uploadrequestdata()->set_data(std::string(state.range(0), 'u'));
+
+    Packet packet;
+    packet._pb_msg = &msg;
+    packet.PutHeader();
+    packet.PutData();
+    packet._pb_msg = NULL;
+
+    for (auto _ : state)
+    {
+        if (packet.ParseProtoBuffer() != SMB_SUCCESS)
+        {
+            state.SkipWithError("ParseProtoBuffer failed");
+            break;
+        }
+        FREE(packet._pb_msg);
+        packet._pb_msg = NULL;
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParseProtoBuffer)->RangeMultiplier(4)->Range(4 << 10, 1 << 20);
+
+/*
+ * Listing of a directory with state.range(0) entries on the memory backend,
+ * one page of state.range(0) entries per iteration
+ */
+static void BM_CreateGetStructureResp(benchmark::State &state)
+{
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    bool kerberos = false;
+    backend->Init(kerberos);
+    backend->AddDirectory("smb://" BENCH_LIST_URL);
+    for (int i = 0; i < state.range(0); i++)
+    {
+        backend->AddFile("smb://" BENCH_LIST_URL "/file_with_a_typical_name_" + std::to_string(i) + ".docx",
+                         std::string());
+    }
+    SmbClient *client = SmbClient::GetInstance();
+    client->SetBackend(backend);
+
+    OpenDirReqProcessor *processor = ALLOCATE(OpenDirReqProcessor);
+    processor->Init(request_id);
+    processor->SetIsDirectory(true);
+    processor->SetShowHiddenFiles(true);
+    processor->SetPageSize(state.range(0));
+    RequestProcessor::SetInstance(processor);
+
+    std::string url(BENCH_LIST_URL), work_group("WORKGROUP"), user("bench"), password("bench");
+    client->CredentialsInit(url, work_group, user, password);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        client->OpenDir();
+        Packet *packet = ALLOCATE(Packet);
+        state.ResumeTiming();
+
+        /* SMB_AGAIN - page created, more may follow */
+        int ret = processor->PacketCreator()->CreatePacket(packet, GET_STRUCTURE_INIT_RESP, NULL);
+
+        state.PauseTiming();
+        FREE(packet);
+        client->CloseDir();
+        if (ret != SMB_AGAIN)
+        {
+            state.SkipWithError("create_get_structure_resp failed");
+            break;
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    RequestProcessor::SetInstance(NULL);
+    processor->Quit();
+    FREE(processor);
+    client->SetBackend(NULL);
+}
+BENCHMARK(BM_CreateGetStructureResp)->Arg(5)->Arg(50)->Arg(500)->Arg(5000);
+
+static void BM_CreateDownloadRespData(benchmark::State &state)
+{
+    DownloadProcessor *processor = ALLOCATE(DownloadProcessor);
+    processor->Init(request_id);
+    RequestProcessor::SetInstance(processor);
+
+    std::string payload(state.range(0), 'd');
+    packet_data data;
+    data.download_upload_data.payload = &payload[0];
+    data.download_upload_data.payload_len = payload.size();
+
+    for (auto _ : state)
+    {
+        Packet packet;
+        if (processor->PacketCreator()->CreatePacket(&packet, DOWNLOAD_DATA_RESP, &data) != SMB_SUCCESS)
+        {
+            state.SkipWithError("create_download_resp_data failed");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+
+    RequestProcessor::SetInstance(NULL);
+    processor->Quit();
+    FREE(processor);
+}
+BENCHMARK(BM_CreateDownloadRespData)->RangeMultiplier(4)->Range(4 << 10, 1 << 20);
+
+/*
+ * SessionManager queues, state.range(0) packets are queued before they are dequeued
+ */
+static SessionManager *session_manager = NULL;
+
+static void session_manager_setup(const benchmark::State &state)
+{
+    should_exit = 0;
+    session_manager = ALLOCATE(SessionManager);
+}
+
+static void session_manager_teardown(const benchmark::State &state)
+{
+    should_exit = 1;
+    session_manager->Quit();
+    FREE(session_manager);
+    session_manager = NULL;
+    should_exit = 0;
+}
+
+static void BM_SessionManagerRequestQueue(benchmark::State &state)
+{
+    std::vector<Packet> packets(state.range(0));
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < packets.size(); i++)
+        {
+            session_manager->PushRequest(&packets[i]);
+        }
+        for (size_t i = 0; i < packets.size(); i++)
+        {
+            benchmark::DoNotOptimize(session_manager->PopRequest());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SessionManagerRequestQueue)->Arg(1)->Arg(64)->Setup(session_manager_setup)
+    ->Teardown(session_manager_teardown);
+
+static void BM_SessionManagerResponseQueue(benchmark::State &state)
+{
+    std::vector<Packet> packets(state.range(0));
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < packets.size(); i++)
+        {
+            session_manager->PushResponse(&packets[i]);
+        }
+        for (size_t i = 0; i < packets.size(); i++)
+        {
+            benchmark::DoNotOptimize(session_manager->PopResponse());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SessionManagerResponseQueue)->Arg(1)->Arg(64)->Setup(session_manager_setup)
+    ->Teardown(session_manager_teardown);
+
+int main(int argc, char *argv[])
+{
+    /* JSON by default so results can be tracked over time */
+    std::vector<char *> args(argv, argv + argc);
+    char json_format[] = "--benchmark_format=json";
+    bool has_format = false;
+    for (int i = 1; i < argc; i++)
+    {
+        has_format |= (strncmp(argv[i], "--benchmark_format", strlen("--benchmark_format")) == 0);
+    }
+    if (!has_format)
+    {
+        args.insert(args.begin() + 1, json_format);
+    }
+    int count = args.size();
+
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
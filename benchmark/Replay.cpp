@@ -0,0 +1,707 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+/*
+ * Session replay tool.
+ * Reads a capture written by the connector (capture 1), recreates the files the
+ * captured sessions touched on a stand-in storage backend and sends the captured
+ * request frames to a connector with the captured client think time.
+ * Latency of every response frame (time since the previous frame of the session)
+ * is compared with the capture and reported as JSON, exits with 2 when responses
+ * differ from the capture or latency regresses past the tolerance.
+ */
+
+#include <getopt.h>
+#include <signal.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <map>
+#include <set>
+#include <thread>
+
+#include "BenchClient.h"
+#include "base/Common.h"
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Log4Cpp.h"
+#include "base/Metrics.h"
+#include "base/Protocol.h"
+#include "core/Capture.h"
+#include "core/Server.h"
+
+#define REPLAY_USAGE \
+"\t\t-p, --capture      - capture file written by the connector (required)\n" \
+"\t\t-c, --connector    - smbconnector binary to replay against (default: in-process connector)\n" \
+"\t\t-x, --speed        - think time factor, 1 - captured timing, 2 - twice as fast, 0 - no wait (default: 1)\n" \
+"\t\t-B, --backend      - storage backend memory or posix (default: memory)\n" \
+"\t\t-r, --storage_root - root directory for posix backend (default: <work_dir>/storage)\n" \
+"\t\t-k, --chunk_size   - bytes per upload packet used to create files (default: 61440)\n" \
+"\t\t-w, --work_dir     - directory for socket, log and configuration (default: /tmp/smbconnector_replay)\n" \
+"\t\t-O, --output       - write JSON results to file (default: stdout)\n" \
+"\t\t-t, --tolerance    - allowed p99 latency regression in percent (default: 10)\n"
+
+#define REPLAY_RECEIVE_TIMEOUT  30000       //milli-seconds to wait for a response
+#define REPLAY_SEED_LIST_MAX    1048576     //bytes per file created for a captured listing
+#define REPLAY_SEED_DIR_FILE    "/.replay_seed"
+#define REPLAY_REGRESSION       2
+
+int should_exit = 0;
+int dump_metrics = 0;
+int logLevel = LOG_LVL_NONE;
+Log4Cpp *logger = NULL;
+
+struct ReplayOptions
+{
+    std::string capture;
+    std::string connector;
+    double speed;
+    std::string backend;
+    std::string storage_root;
+    unsigned int chunk_size;
+    std::string work_dir;
+    std::string output;
+    double tolerance;
+
+    ReplayOptions() : speed(1), backend("memory"), chunk_size(61440), work_dir("/tmp/smbconnector_replay"),
+                      tolerance(10)
+    {
+    }
+};
+
+/*
+ * Latency of one response command, captured and replayed
+ */
+struct ReplayStats
+{
+    Histogram _captured;
+    Histogram _replayed;
+};
+
+/*
+ * Frames of one captured session
+ */
+struct ReplaySession
+{
+    uint32_t _id;
+    std::vector<CaptureRecord *> _frames;
+};
+
+static ReplayOptions options;
+static std::map<int, ReplayStats> stats;
+static Histogram captured_sessions;
+static Histogram replayed_sessions;
+static unsigned long mismatches = 0;
+static unsigned long errors = 0;
+static unsigned long replayed = 0;
+
+static struct option long_options[] =
+    {
+        {"help",         no_argument,       0, 'h'},
+        {"capture",      required_argument, 0, 'p'},
+        {"connector",    required_argument, 0, 'c'},
+        {"speed",        required_argument, 0, 'x'},
+        {"backend",      required_argument, 0, 'B'},
+        {"storage_root", required_argument, 0, 'r'},
+        {"chunk_size",   required_argument, 0, 'k'},
+        {"work_dir",     required_argument, 0, 'w'},
+        {"output",       required_argument, 0, 'O'},
+        {"tolerance",    required_argument, 0, 't'},
+        {0, 0, 0, 0}
+    };
+
+static void print_help()
+{
+    printf("Usage: smbconnector_replay --capture=<file> [options]\n");
+    printf(REPLAY_USAGE);
+}
+
+static void process_args(int argc, char *argv[])
+{
+    while (true)
+    {
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "hp:c:x:B:r:k:w:O:t:", long_options, &option_index);
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'p':
+                options.capture = optarg;
+                break;
+            case 'c':
+                options.connector = optarg;
+                break;
+            case 'x':
+                options.speed = atof(optarg);
+                break;
+            case 'B':
+                options.backend = optarg;
+                break;
+            case 'r':
+                options.storage_root = optarg;
+                break;
+            case 'k':
+                options.chunk_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'w':
+                options.work_dir = optarg;
+                break;
+            case 'O':
+                options.output = optarg;
+                break;
+            case 't':
+                options.tolerance = atof(optarg);
+                break;
+            case 'h':
+            default:
+                print_help();
+                exit(c == 'h' ? 0 : 1);
+        }
+    }
+
+    if (options.storage_root.empty())
+    {
+        options.storage_root = options.work_dir + "/storage";
+    }
+    if (options.capture.empty() || options.speed < 0 || options.chunk_size == 0)
+    {
+        print_help();
+        exit(1);
+    }
+}
+
+static std::string sock_path()
+{
+    return options.work_dir + "/replay.sock";
+}
+
+/*!
+ * Start connector subprocess
+ * @return
+ * pid, -1 on failure
+ */
+static pid_t start_subprocess()
+{
+    std::string conf = options.work_dir + "/smb-connector.conf";
+    std::ofstream file(conf.c_str());
+    file << "idle_timeout 3600\n";
+    file << "log_level 1\n";
+    file << C_STORAGE_BACKEND " " << options.backend << "\n";
+    file << C_STORAGE_ROOT " " << options.storage_root << "\n";
+    file.close();
+
+    std::string sock = sock_path();
+    std::string log = options.work_dir + "/replay.log";
+    std::string conf_arg = "--conf_file=" + conf;
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        prctl(PR_SET_PDEATHSIG, SIGTERM);
+        execl(options.connector.c_str(), options.connector.c_str(), "-s", sock.c_str(), "-l", log.c_str(),
+              conf_arg.c_str(), (char *) NULL);
+        perror("exec smbconnector");
+        _exit(127);
+    }
+    if (pid < 0)
+    {
+        perror("fork");
+    }
+    return pid;
+}
+
+/*!
+ * Run connector in this process
+ * @param server - server (out)
+ * @return
+ * server thread
+ */
+static std::thread *start_in_process(Server *&server)
+{
+    Configuration &c = Configuration::GetInstance();
+    c.Set(C_IDLE_TIMEOUT, "3600");
+    c.Set(C_STORAGE_BACKEND, options.backend.c_str());
+    c.Set(C_STORAGE_ROOT, options.storage_root.c_str());
+
+    server = ALLOCATE(Server);
+    if (!ALLOCATED(server) || server->Init(sock_path().c_str()) != SMB_SUCCESS)
+    {
+        return NULL;
+    }
+    return ALLOCATE(std::thread, &Server::Runloop, server);
+}
+
+/*!
+ * Group records of capture by session, records outside of a session are dropped
+ * @param records - records of capture
+ * @param sessions - sessions in capture order (out)
+ */
+static void group_sessions(const std::vector<CaptureRecord *> &records, std::vector<ReplaySession> &sessions)
+{
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        const CaptureRecordHeader &header = records[i]->_header;
+        if (header.type == CAPTURE_SESSION_BEGIN || sessions.empty() || sessions.back()._id != header.session)
+        {
+            ReplaySession session;
+            session._id = header.session;
+            sessions.push_back(session);
+        }
+        if (header.type == CAPTURE_INBOUND || header.type == CAPTURE_OUTBOUND)
+        {
+            sessions.back()._frames.push_back(records[i]);
+        }
+    }
+}
+
+/*!
+ * Create directory and its parents, upload creates missing parents
+ * @param client - client used for seeding
+ * @param url - directory
+ */
+static void seed_directory(BenchClient &client, const std::string &url)
+{
+    if (client.Upload(url + REPLAY_SEED_DIR_FILE, std::string(), options.chunk_size) == SMB_SUCCESS)
+    {
+        client.Delete(url + REPLAY_SEED_DIR_FILE);
+    }
+}
+
+/*!
+ * First response of session with given command
+ * @param session - captured session
+ * @param cmd - response command
+ * @param from - index of request the response belongs to
+ * @return
+ * message, NULL if not found
+ */
+static const Message *find_response(const ReplaySession &session, int cmd, size_t from)
+{
+    for (size_t i = from; i < session._frames.size(); i++)
+    {
+        const CaptureRecord *record = session._frames[i];
+        if (record->_header.type == CAPTURE_OUTBOUND && (int) record->_msg.command().cmd() == cmd)
+        {
+            return &record->_msg;
+        }
+    }
+    return NULL;
+}
+
+/*!
+ * Recreate what an operation of the session expects to find on the share
+ * @param client - client used for seeding
+ * @param session - captured session
+ * @param index - index of the operation's init request
+ */
+static void seed_operation(BenchClient &client, const ReplaySession &session, size_t index)
+{
+    const Message &init = session._frames[index]->_msg;
+    std::string url = init.requestpacket().smbdetails().url();
+    const Message *resp = NULL;
+
+    switch (init.command().cmd())
+    {
+        case DOWNLOAD_INIT_REQ:
+            resp = find_response(session, DOWNLOAD_INIT_RESP, index);
+            if (resp != NULL)
+            {
+                uint64_t size = resp->responsepacket().downloadinitresponse().fileinformation().size();
+                client.Upload(url, std::string(size, 'r'), options.chunk_size);
+            }
+            break;
+        case GET_STRUCTURE_INIT_REQ:
+            seed_directory(client, url);
+            for (size_t i = index + 1; i < session._frames.size(); i++)
+            {
+                const Message &msg = session._frames[i]->_msg;
+                if (session._frames[i]->_header.type == CAPTURE_INBOUND && msg.requestpacket().has_smbdetails())
+                {
+                    /* next operation of a keep-alive session */
+                    break;
+                }
+                if (session._frames[i]->_header.type != CAPTURE_OUTBOUND
+                    || msg.command().cmd() != GET_STRUCTURE_INIT_RESP)
+                {
+                    continue;
+                }
+                const FolderStructureResponse &list = msg.responsepacket().folderstructureresponse();
+                for (int entry = 0; entry < list.fileinformation_size(); entry++)
+                {
+                    const FileInformation &info = list.fileinformation(entry);
+                    if (info.name() == "." || info.name() == "..")
+                    {
+                        continue;
+                    }
+                    if (info.isdirectory())
+                    {
+                        seed_directory(client, url + "/" + info.name());
+                    }
+                    else
+                    {
+                        client.Upload(url + "/" + info.name(), std::string(MIN(info.size(), REPLAY_SEED_LIST_MAX), 'r'),
+                                      options.chunk_size);
+                    }
+                }
+            }
+            break;
+        case DELETE_INIT_REQ:
+            resp = find_response(session, DELETE_INIT_RESP, index);
+            if (resp != NULL && !resp->responsepacket().deleteresourceresponse().fileinformation().isdirectory())
+            {
+                client.Upload(url, std::string(), options.chunk_size);
+            }
+            else
+            {
+                seed_directory(client, url);
+            }
+            break;
+        case ADD_FOLDER_INIT_REQ:
+            seed_directory(client, url.substr(0, url.rfind('/')));
+            break;
+        case TEST_CONNECTION_INIT_REQ:
+            seed_directory(client, url);
+            break;
+        default:
+            break;
+    }
+}
+
+/*!
+ * Recreate what the session expects to find on the share before it starts,
+ * failures are ignored as the captured session may have failed the same way.
+ * A keep-alive session runs several operations, those on a path an earlier
+ * operation of the session already worked on are not seeded.
+ * @param client - client used for seeding
+ * @param session - captured session
+ */
+static void seed(BenchClient &client, const ReplaySession &session)
+{
+    std::set<std::string> touched;
+    for (size_t i = 0; i < session._frames.size(); i++)
+    {
+        const CaptureRecord *record = session._frames[i];
+        if (record->_header.type != CAPTURE_INBOUND || !record->_msg.has_requestpacket()
+            || !record->_msg.requestpacket().has_smbdetails())
+        {
+            continue;
+        }
+        if (touched.insert(record->_msg.requestpacket().smbdetails().url()).second)
+        {
+            seed_operation(client, session, i);
+        }
+    }
+}
+
+/*!
+ * Wait till delay (captured micro-seconds, scaled by speed) passed since from
+ * @param from - Metrics::Now() of previous frame
+ * @param delay - captured gap
+ */
+static void think(uint64_t from, uint64_t delay)
+{
+    if (options.speed == 0)
+    {
+        return;
+    }
+    uint64_t until = from + (uint64_t) (delay / options.speed);
+    uint64_t now = Metrics::Now();
+    if (until > now)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(until - now));
+    }
+}
+
+/*!
+ * Send captured request, data that was not captured is replaced by as many filler bytes
+ * @param client - session client
+ * @param record - captured request
+ * @param connected - session started (in/out)
+ * @param pending - first response received while starting the session (out)
+ * @param sent - Metrics::Now() frame was sent (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+static int send_frame(BenchClient &client, const CaptureRecord *record, bool &connected, Message *&pending,
+                      uint64_t &sent)
+{
+    Message msg(record->_msg);
+    if (msg.has_requestpacket() && msg.requestpacket().has_uploadrequestdata()
+        && record->_header.data_mode != CAPTURE_DATA_FULL)
+    {
+        msg.mutable_requestpacket()->mutable_uploadrequestdata()->set_data(std::string(record->_header.data_len, 'r'));
+    }
+
+    if (connected)
+    {
+        sent = Metrics::Now();
+        return client.Send(msg);
+    }
+
+    /*
+     * connector closes connections it cannot serve yet (still cleaning up previous session)
+     * right after accept, like BenchClient::Begin() but connect time is not measured
+     */
+    connected = true;
+    pending = ALLOCATE(Message);
+    if (!ALLOCATED(pending))
+    {
+        return SMB_ALLOCATION_FAILED;
+    }
+    for (int waited = 0; waited < BENCH_CONNECT_TIMEOUT; waited += BENCH_CONNECT_RETRY)
+    {
+        if (client.Connect() != SMB_SUCCESS)
+        {
+            return SMB_ERROR;
+        }
+        sent = Metrics::Now();
+        int ret = client.Send(msg);
+        if (ret == SMB_SUCCESS)
+        {
+            ret = client.Receive(*pending);
+        }
+        if (ret != SMB_EOF)
+        {
+            return ret;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(BENCH_CONNECT_RETRY));
+    }
+    return SMB_ERROR;
+}
+
+/*!
+ * Replay one session, record latency of every response frame
+ * @param client - session client
+ * @param session - captured session
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+static int replay(BenchClient &client, const ReplaySession &session)
+{
+    bool connected = false;
+    Message *pending = NULL;
+    int ret = SMB_SUCCESS;
+    uint64_t previous = Metrics::Now();
+    uint64_t start = previous;
+    const CaptureRecordHeader *first = &session._frames[0]->_header;
+    const CaptureRecordHeader *last = first;
+
+    for (size_t i = 0; i < session._frames.size() && ret == SMB_SUCCESS; i++)
+    {
+        const CaptureRecord *record = session._frames[i];
+        uint64_t gap = record->_header.timestamp > last->timestamp ? record->_header.timestamp - last->timestamp : 0;
+
+        if (record->_header.type == CAPTURE_INBOUND)
+        {
+            think(previous, gap);
+            uint64_t sent = 0;
+            ret = send_frame(client, record, connected, pending, sent);
+            previous = sent;
+            if (i == 0)
+            {
+                start = sent;
+            }
+        }
+        else
+        {
+            Message resp;
+            if (pending != NULL)
+            {
+                resp.Swap(pending);
+                FREE(pending);
+                pending = NULL;
+            }
+            else
+            {
+                ret = client.Receive(resp);
+            }
+            if (ret != SMB_SUCCESS)
+            {
+                break;
+            }
+
+            uint64_t now = Metrics::Now();
+            int cmd = record->_msg.command().cmd();
+            if ((int) resp.command().cmd() != cmd)
+            {
+                fprintf(stderr, "Session %u frame %lu: expected %s received %s\n", session._id, (unsigned long) i,
+                        ProtocolCommand(cmd), ProtocolCommand(resp.command().cmd()));
+                mismatches++;
+                ret = SMB_ERROR;
+                break;
+            }
+            stats[cmd]._captured.Record(gap);
+            stats[cmd]._replayed.Record(now - previous);
+            previous = now;
+        }
+        last = &record->_header;
+    }
+
+    if (pending != NULL)
+    {
+        FREE(pending);
+    }
+    client.Disconnect();
+    if (ret == SMB_SUCCESS)
+    {
+        captured_sessions.Record(last->timestamp - first->timestamp);
+        replayed_sessions.Record(previous - start);
+    }
+    return ret;
+}
+
+/*!
+ * Latency percentiles as JSON fields
+ * @param prefix - field name prefix
+ * @param h - latency histogram
+ * @return
+ * JSON fields
+ */
+static std::string latency_fields(const char *prefix, const Histogram &h)
+{
+    char buffer[SHORT_BUFFER_SIZE * 2];
+    snprintf(buffer, sizeof(buffer), "\"%s_p50_us\":%lu,\"%s_p99_us\":%lu,\"%s_max_us\":%lu", prefix,
+             (unsigned long) h.Percentile(50), prefix, (unsigned long) h.Percentile(99), prefix,
+             (unsigned long) h.Max());
+    return buffer;
+}
+
+/*!
+ * Results as JSON, regressions are reported on stderr
+ * @param sessions - sessions in capture
+ * @param regressed - p99 latency of a response regressed (out)
+ * @return
+ * JSON document
+ */
+static std::string report(size_t sessions, bool &regressed)
+{
+    char buffer[MEDIUM_BUFFER_SIZE];
+    snprintf(buffer, sizeof(buffer),
+             "{\"config\":{\"capture\":\"%s\",\"mode\":\"%s\",\"backend\":\"%s\",\"speed\":%.2f},"
+             "\"sessions\":%lu,\"replayed\":%lu,\"errors\":%lu,\"mismatches\":%lu,\"session\":{",
+             options.capture.c_str(), options.connector.empty() ? "in_process" : "subprocess",
+             options.backend.c_str(), options.speed, (unsigned long) sessions, replayed, errors, mismatches);
+    std::string out = buffer;
+    out += latency_fields("captured", captured_sessions) + "," + latency_fields("replayed", replayed_sessions);
+    out += "},\"responses\":{";
+
+    regressed = false;
+    double factor = 1 + options.tolerance / 100.0;
+    for (std::map<int, ReplayStats>::const_iterator it = stats.begin(); it != stats.end(); ++it)
+    {
+        const Histogram &captured = it->second._captured;
+        const Histogram &replayed = it->second._replayed;
+        snprintf(buffer, sizeof(buffer), "%s\"%s\":{\"count\":%lu,", it == stats.begin() ? "" : ",",
+                 ProtocolCommand(it->first), (unsigned long) replayed.Count());
+        out += buffer + latency_fields("captured", captured) + "," + latency_fields("replayed", replayed) + "}";
+
+        if (replayed.Percentile(99) > captured.Percentile(99) * factor)
+        {
+            fprintf(stderr, "REGRESSION %s: p99 %lu us, captured %lu us\n", ProtocolCommand(it->first),
+                    (unsigned long) replayed.Percentile(99), (unsigned long) captured.Percentile(99));
+            regressed = true;
+        }
+    }
+    out += "}}";
+    return out;
+}
+
+int main(int argc, char *argv[])
+{
+    signal(SIGPIPE, SIG_IGN);
+    process_args(argc, argv);
+    mkdir(options.work_dir.c_str(), 0755);
+
+    std::vector<CaptureRecord *> records;
+    if (Capture::Read(options.capture, records) != SMB_SUCCESS && records.empty())
+    {
+        fprintf(stderr, "Cannot read capture %s\n", options.capture.c_str());
+        return 1;
+    }
+    std::vector<ReplaySession> sessions;
+    group_sessions(records, sessions);
+
+    pid_t pid = -1;
+    Server *server = NULL;
+    std::thread *server_thread = NULL;
+    if (options.connector.empty())
+    {
+        server_thread = start_in_process(server);
+        if (server_thread == NULL)
+        {
+            fprintf(stderr, "Starting in-process connector failed\n");
+            return 1;
+        }
+    }
+    else if ((pid = start_subprocess()) < 0)
+    {
+        return 1;
+    }
+
+    BenchClient seeder(sock_path(), 0);
+    BenchClient client(sock_path(), 1);
+    client.SetReceiveTimeout(REPLAY_RECEIVE_TIMEOUT);
+    uint64_t session_end = Metrics::Now();
+    for (size_t i = 0; i < sessions.size(); i++)
+    {
+        const ReplaySession &session = sessions[i];
+        if (session._frames.empty() || session._frames[0]->_header.type != CAPTURE_INBOUND)
+        {
+            continue;
+        }
+        seed(seeder, session);
+
+        /* idle time between sessions, not counting the seeding */
+        if (i > 0 && !sessions[i - 1]._frames.empty())
+        {
+            uint64_t end = sessions[i - 1]._frames.back()->_header.timestamp;
+            uint64_t begin = session._frames[0]->_header.timestamp;
+            think(session_end, begin > end ? begin - end : 0);
+        }
+        if (replay(client, session) != SMB_SUCCESS)
+        {
+            errors++;
+        }
+        replayed++;
+        session_end = Metrics::Now();
+    }
+
+    if (server_thread != NULL)
+    {
+        should_exit = 1;
+        server_thread->join();
+        FREE(server_thread);
+        server->Quit();
+        FREE(server);
+    }
+    else
+    {
+        kill(pid, SIGINT);
+        waitpid(pid, NULL, 0);
+    }
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        FREE(records[i]);
+    }
+
+    bool regressed;
+    std::string json = report(sessions.size(), regressed);
+    if (options.output.empty())
+    {
+        printf("%s\n", json.c_str());
+    }
+    else
+    {
+        std::ofstream(options.output.c_str()) << json << "\n";
+    }
+    return (regressed || errors > 0 || mismatches > 0) ? REPLAY_REGRESSION : 0;
+}
@@ -6,6 +6,7 @@
  */
 
 #include <getopt.h>
+#include <signal.h>
 #include <fstream>
 #include <sys/prctl.h>
 #include <dirent.h>
@@ -25,6 +26,9 @@
 #include "core/Client.h"
 #include "base/Log4Cpp.h"
 #include "base/Error.h"
+#include "base/Metrics.h"
+#include "base/Trace.h"
+#include "core/Capture.h"
 
 #define SMBCONNECTOR_USAGE \
 "\t\t ## Configuration options ##\n" \
@@ -42,7 +46,8 @@
 "\t ## Client mode options ##\n" \
 "\t\t-s, --socket_name  - unix-domain socket to connect to\n" \
 "\t\t-o, --op_code      - operation to be performed 1(list directory), 2(download), 3(upload),\n \
-\t\t\t\t     4(add-folder) 5(delete file/folder) 6(test-connection)\n" \
+\t\t\t\t     4(add-folder) 5(delete file/folder) 6(test-connection) 7(server stats) 8(batch stat)\n \
+\t\t\t\t     9(copy file) 10(move file/folder)\n" \
 "\t\t-u, --url          - url to SMB server with file path appended\n" \
 "\t\t-n, --user         - user-name\n" \
 "\t\t-p, --password     - password\n" \
@@ -51,6 +56,13 @@
 "\t\t-x, --is_kerberos  - enable kerberos authentication \n" \
 "\t\t-d, --show_hidden  - should show hidden folders as well during list-dir operation\n" \
 "\t\t-a, --page_size    - number of entries to be sent for list-directory operation (default: " DEFAULT_PAGE_SIZE ")\n" \
+"\t\t-r, --level        - levels of sub-folders listed by list-dir operation (default: " DEFAULT_LIST_LEVEL ", only the folder)\n" \
+"\t\t-F, --name_filter  - glob names listed by list-dir operation are matched against (default: all names)\n" \
+"\t\t-S, --sort         - sort list-dir entries by name, mtime or size, '-' prefix for descending order\n" \
+"\t\t-j, --paths        - comma separated paths relative to url stat'ed by batch stat operation\n" \
+"\t\t-D, --destination  - server/share/path the url is copied/moved to by copy/move operation\n" \
+"\t\t-O, --overwrite    - copy/move operation replaces an existing destination\n" \
+"\t\t-K, --limit        - number of entries listed by list-dir operation, first ones in sort order (default: all)\n" \
 "\t\t-t, --start_offset - start offset for range file download (default: " DEFAULT_START_OFFSET" )\n" \
 "\t\t-e, --end_offset   - end offset for range file download (default: File size)\n" \
 "\t\t-q, --out_file     - output file to wrote download data for download operation\n" \
@@ -58,6 +70,7 @@
 
 
 int should_exit = 0; //Setting this to 1 will exit all threads and bring application down
+volatile sig_atomic_t dump_metrics = 0; //Set on SIGUSR1, server writes metrics to the log (and trace, if enabled)
 int logLevel = LOG_LVL_NONE;
 
 Log4Cpp *logger = NULL;
@@ -80,6 +93,13 @@ static struct option long_options[] =
         {"show_folder",     required_argument, 0, 'f'},
         {"show_hidden",     required_argument, 0, 'd'},
         {"page_size",       required_argument, 0, 'a'},
+        {"level",           required_argument, 0, 'r'},
+        {"name_filter",     required_argument, 0, 'F'},
+        {"sort",            required_argument, 0, 'S'},
+        {"limit",           required_argument, 0, 'K'},
+        {"paths",           required_argument, 0, 'j'},
+        {"destination",     required_argument, 0, 'D'},
+        {"overwrite",       no_argument,       0, 'O'},
         {"start_offset",    required_argument, 0, 't'},
         {"end_offset",      required_argument, 0, 'e'},
         {"buff_size",       required_argument, 0, 'b'},
@@ -146,7 +166,7 @@ static void process_args(int argc, char *argv[])
     {
         /* getopt_long stores the option index here. */
         int option_index = 0;
-        int c = getopt_long(argc, argv, "hvm:s:o:l:g:u:n:p:w:f:d:a:t:e:b:i:c:q:x", long_options, &option_index);
+        int c = getopt_long(argc, argv, "hvm:s:o:l:g:u:n:p:w:f:d:a:r:F:S:K:j:D:Ot:e:b:i:c:q:x", long_options, &option_index);
 
         if (c == -1)
         {
@@ -231,6 +251,27 @@ static void process_args(int argc, char *argv[])
             case 'a':
                 config.Set(C_PAGE_SIZE, optarg);
                 break;
+            case 'r':
+                config.Set(C_LIST_LEVEL, optarg);
+                break;
+            case 'F':
+                config.Set(C_LIST_NAME_FILTER, optarg);
+                break;
+            case 'S':
+                config.Set(C_LIST_SORT, optarg);
+                break;
+            case 'K':
+                config.Set(C_LIST_LIMIT, optarg);
+                break;
+            case 'j':
+                config.Set(C_STAT_PATHS, optarg);
+                break;
+            case 'D':
+                config.Set(C_DESTINATION, optarg);
+                break;
+            case 'O':
+                config.Set(C_OVERWRITE, "1");
+                break;
             case 't':
                 config.Set(C_START_OFFSET, optarg);
                 break;
@@ -317,6 +358,11 @@ static void my_handler(int s)
     caught_signal = s;
 }
 
+static void metrics_handler(int s)
+{
+    dump_metrics = 1;
+}
+
 int main(int argc, char *argv[])
 {
 
@@ -328,6 +374,7 @@ int main(int argc, char *argv[])
     signal(SIGPIPE, SIG_IGN);
     setbuf(stdout, static_cast<char *>(NULL));
     signal(SIGINT, static_cast<__sighandler_t>(my_handler));
+    signal(SIGUSR1, static_cast<__sighandler_t>(metrics_handler));
 #ifndef _DEBUG_
     signal(SIGSEGV, static_cast<__sighandler_t>(segv_handler));
 #endif
@@ -379,6 +426,7 @@ int main(int argc, char *argv[])
     }
 
     c.DumpTable();
+    Tracer::GetInstance().Init(c.Snapshot().trace, c.Snapshot().trace_dir);
 
     if (!atoi(c[C_OP_MODE]))
     {
@@ -396,6 +444,7 @@ int main(int argc, char *argv[])
     }
     else
     {
+        Capture::GetInstance().Init(c.Snapshot().capture, c.Snapshot().capture_dir, c.Snapshot().capture_data);
         smbConnector = ALLOCATE(Server);
         if (!ALLOCATED(smbConnector))
         {
@@ -415,6 +464,18 @@ int main(int argc, char *argv[])
         chown(c[C_LOG_FILE],
               linux_user->pw_uid,
               linux_user->pw_gid);
+        if (Tracer::Enabled())
+        {
+            chown(c[C_TRACE_DIR],
+                  linux_user->pw_uid,
+                  linux_user->pw_gid);
+        }
+        if (Capture::Enabled())
+        {
+            chown(c[C_CAPTURE_DIR],
+                  linux_user->pw_uid,
+                  linux_user->pw_gid);
+        }
     }
 
     // drop user to nobody(default)
@@ -424,6 +485,7 @@ int main(int argc, char *argv[])
 
     smbConnector->Quit();
     FREE(smbConnector);
+    Capture::GetInstance().Quit();
 
     if(caught_signal != 0)
     {
@@ -434,6 +496,7 @@ int main(int argc, char *argv[])
             ALWAYS_LOG("Crash report generated in %s", crash_file);
         }
     }
+    Metrics::GetInstance().LogDump();
 
     logger->Quit();
     FREE(logger);
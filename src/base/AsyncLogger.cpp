@@ -0,0 +1,451 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <sys/syscall.h>
+
+#include "AsyncLogger.h"
+#include "base/Error.h"
+#include "processor/RequestProcessor.h"
+
+/* unique id per logger instance, used to detect stale per-thread rings */
+static std::atomic<unsigned long> instance_count(0);
+
+/*
+ * Per-thread handle to the ring registered with a logger.
+ * Marks the ring orphaned on thread exit so flusher can reclaim it.
+ */
+struct ThreadRing
+{
+    unsigned long _instance;
+    std::shared_ptr<AsyncLogRing> _ring;
+    pid_t _tid;
+
+    ThreadRing() : _instance(0), _tid((pid_t) syscall(SYS_gettid)) {}
+
+    ~ThreadRing()
+    {
+        if (_ring)
+        {
+            _ring->_orphaned.store(true, std::memory_order_release);
+        }
+    }
+};
+
+static thread_local ThreadRing thread_ring_handle;
+
+/*!
+ * Append log line of record with prefix to batch
+ * @param batch - batch
+ * @param record - log record
+ * @param prefix - formatted time, thread and priority
+ */
+static void append_line(std::string &batch, const AsyncLogRecord &record, const char *prefix)
+{
+    batch.append("[");
+    batch.append(record._id[0] != '\0' ? record._id : "ID_NOT_SET");
+    batch.append("] ");
+    batch.append(prefix);
+    batch.append(record._msg);
+    if (batch[batch.size() - 1] != '\n')
+    {
+        batch.append("\n");
+    }
+}
+
+/*!
+ * Constructor
+ */
+AsyncLogger::AsyncLogger() : _max_file_size(0), _max_backups(0), _console(false), _fd(-1), _file_size(0),
+                             _instance(++instance_count), _running(false), _dropped(0), _reported_dropped(0),
+                             _flusher(NULL)
+{
+    _start.tv_sec = 0;
+    _start.tv_nsec = 0;
+}
+
+/*!
+ * Destructor
+ */
+AsyncLogger::~AsyncLogger()
+{
+    Quit();
+}
+
+/*!
+ * Open (append) the log file
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int AsyncLogger::open_file()
+{
+    _fd = open(_file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 00644);
+    if (_fd < 0)
+    {
+        return SMB_ERROR;
+    }
+
+    struct stat st;
+    _file_size = (fstat(_fd, &st) == 0) ? st.st_size : 0;
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Rotate log file, file -> file.1 -> file.2 ... -> file.max_backups (dropped)
+ */
+void AsyncLogger::rotate()
+{
+    close(_fd);
+    _fd = -1;
+
+    for (int i = _max_backups - 1; i >= 1; i--)
+    {
+        std::string from = _file_name + "." + std::to_string(i);
+        std::string to = _file_name + "." + std::to_string(i + 1);
+        rename(from.c_str(), to.c_str());
+    }
+    if (_max_backups > 0)
+    {
+        rename(_file_name.c_str(), (_file_name + ".1").c_str());
+    }
+    else
+    {
+        unlink(_file_name.c_str());
+    }
+
+    open_file();
+}
+
+/*!
+ * Initialise logger and start the flusher
+ * @param file_name - log file
+ * @param max_file_size - size after which log file is rotated
+ * @param max_backups - number of rotated files to keep
+ * @param console - also write log lines to stdout
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int AsyncLogger::Init(const char *file_name, size_t max_file_size, int max_backups, bool console)
+{
+    _file_name = file_name;
+    _max_file_size = max_file_size;
+    _max_backups = max_backups;
+    _console = console;
+    _batch.reserve(ASYNC_LOG_BATCH_SIZE + ASYNC_LOG_RECORD_SIZE + MEDIUM_BUFFER_SIZE);
+    if (_console)
+    {
+        _console_batch.reserve(ASYNC_LOG_BATCH_SIZE + ASYNC_LOG_RECORD_SIZE + MEDIUM_BUFFER_SIZE);
+    }
+    clock_gettime(CLOCK_REALTIME, &_start);
+
+    if (open_file() != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+
+    _running = true;
+    _flusher = ALLOCATE(std::thread, &AsyncLogger::flusher, this);
+    if (!ALLOCATED(_flusher))
+    {
+        _running = false;
+        close(_fd);
+        _fd = -1;
+        return SMB_ALLOCATION_FAILED;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Returns ring of calling thread, registers a new one on first use
+ * @return
+ * ring - successful
+ * NULL - allocation failure
+ */
+AsyncLogRing *AsyncLogger::thread_ring()
+{
+    ThreadRing &handle = thread_ring_handle;
+    if (handle._instance == _instance)
+    {
+        return handle._ring.get();
+    }
+
+    std::shared_ptr<AsyncLogRing> ring(ALLOCATE(AsyncLogRing));
+    if (!ring)
+    {
+        return NULL;
+    }
+    if (handle._ring)
+    {
+        handle._ring->_orphaned.store(true, std::memory_order_release);
+    }
+    handle._ring = ring;
+    handle._instance = _instance;
+
+    std::lock_guard<std::mutex> lock(_rings_mtx);
+    _rings.push_back(ring);
+    return ring.get();
+}
+
+/*!
+ * Reserve next record in calling thread's ring, never blocks
+ * @param priority - priority name
+ * @param ring - ring of calling thread (out)
+ * @return
+ * record - to be filled and committed with ring->_head
+ * NULL - record dropped
+ */
+AsyncLogRecord *AsyncLogger::reserve(const char *priority, AsyncLogRing *&ring)
+{
+    if (!_running.load(std::memory_order_relaxed) || (ring = thread_ring()) == NULL)
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return NULL;
+    }
+
+    unsigned long head = ring->_head.load(std::memory_order_relaxed);
+    if (head - ring->_tail.load(std::memory_order_acquire) >= ASYNC_LOG_RING_SIZE)
+    {
+        /* ring full, drop instead of blocking the caller */
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return NULL;
+    }
+
+    AsyncLogRecord *record = &ring->_records[head & (ASYNC_LOG_RING_SIZE - 1)];
+    clock_gettime(CLOCK_REALTIME, &record->_time);
+    record->_priority = priority;
+    record->_tid = thread_ring_handle._tid;
+    RequestProcessor::CurrentRequestId(record->_id, sizeof(record->_id));
+    return record;
+}
+
+/*!
+ * Queue formatted log line
+ * @param priority - priority name
+ * @param format - format
+ * @param arg - arguments
+ */
+void AsyncLogger::Write(const char *priority, const char *format, va_list arg)
+{
+    AsyncLogRing *ring = NULL;
+    AsyncLogRecord *record = reserve(priority, ring);
+    if (record == NULL)
+    {
+        return;
+    }
+    vsnprintf(record->_msg, sizeof(record->_msg), format, arg);
+    ring->_head.fetch_add(1, std::memory_order_release);
+}
+
+/*!
+ * Queue log line (Used to log smbclient logs)
+ * @param priority - priority name
+ * @param msg - log message
+ */
+void AsyncLogger::Write(const char *priority, const char *msg)
+{
+    AsyncLogRing *ring = NULL;
+    AsyncLogRecord *record = reserve(priority, ring);
+    if (record == NULL)
+    {
+        return;
+    }
+    strncpy(record->_msg, msg, sizeof(record->_msg) - 1);
+    record->_msg[sizeof(record->_msg) - 1] = '\0';
+    ring->_head.fetch_add(1, std::memory_order_release);
+}
+
+/*!
+ * Format record into the pending batch, and console batch in console layout
+ * @param record - log record
+ */
+void AsyncLogger::append(const AsyncLogRecord &record)
+{
+    char prefix[MEDIUM_BUFFER_SIZE];
+    struct tm tm;
+    localtime_r(&record._time.tv_sec, &tm);
+    size_t len = strftime(prefix, sizeof(prefix), "%Y-%m-%d %H:%M:%S", &tm);
+    snprintf(prefix + len, sizeof(prefix) - len, ".%03ld %d %5s: ", record._time.tv_nsec / 1000000,
+             record._tid, record._priority);
+    append_line(_batch, record, prefix);
+
+    if (_console)
+    {
+        long ms = (record._time.tv_sec - _start.tv_sec) * 1000 + (record._time.tv_nsec - _start.tv_nsec) / 1000000;
+        snprintf(prefix, sizeof(prefix), "%5ld %d %5s: ", ms, record._tid, record._priority);
+        append_line(_console_batch, record, prefix);
+    }
+}
+
+/*!
+ * Drain all rings and write batches out, rotating file when it grows too large
+ */
+void AsyncLogger::flush()
+{
+    std::lock_guard<std::mutex> flush_lock(_flush_mtx);
+
+    /* drain without _rings_mtx, threads registering a ring must not wait for disk I/O */
+    std::vector<std::shared_ptr<AsyncLogRing> > rings;
+    {
+        std::lock_guard<std::mutex> lock(_rings_mtx);
+        rings.swap(_rings);
+    }
+
+    std::vector<std::shared_ptr<AsyncLogRing> >::iterator iter = rings.begin();
+    while (iter != rings.end())
+    {
+        AsyncLogRing *ring = iter->get();
+        bool orphaned = ring->_orphaned.load(std::memory_order_acquire);
+        unsigned long tail = ring->_tail.load(std::memory_order_relaxed);
+        unsigned long head = ring->_head.load(std::memory_order_acquire);
+
+        while (tail != head)
+        {
+            append(ring->_records[tail & (ASYNC_LOG_RING_SIZE - 1)]);
+            ring->_tail.store(++tail, std::memory_order_release);
+            if (_batch.size() >= ASYNC_LOG_BATCH_SIZE)
+            {
+                write_batch();
+            }
+        }
+
+        /* owning thread is gone and everything it logged is flushed */
+        if (orphaned)
+        {
+            iter = rings.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    {
+        /* rings registered while draining were added to _rings meanwhile */
+        std::lock_guard<std::mutex> lock(_rings_mtx);
+        _rings.insert(_rings.end(), rings.begin(), rings.end());
+    }
+
+    unsigned long dropped = _dropped.load(std::memory_order_relaxed);
+    if (dropped != _reported_dropped)
+    {
+        char msg[SHORT_BUFFER_SIZE];
+        snprintf(msg, sizeof(msg), "AsyncLogger dropped %lu log lines (total %lu)\n", dropped - _reported_dropped,
+                 dropped);
+        _batch.append(msg);
+        if (_console)
+        {
+            _console_batch.append(msg);
+        }
+        _reported_dropped = dropped;
+    }
+
+    write_batch();
+}
+
+/*!
+ * Write pending batch to log file and console
+ */
+void AsyncLogger::write_batch()
+{
+    if (_batch.empty())
+    {
+        return;
+    }
+
+    if (_console)
+    {
+        fwrite(_console_batch.data(), 1, _console_batch.size(), stdout);
+        fflush(stdout);
+        _console_batch.clear();
+    }
+
+    if (_fd >= 0)
+    {
+        size_t written = 0;
+        while (written < _batch.size())
+        {
+            ssize_t ret = write(_fd, _batch.data() + written, _batch.size() - written);
+            if (ret < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (ret <= 0)
+            {
+                break;
+            }
+            written += ret;
+        }
+        _file_size += written;
+        if (_max_file_size > 0 && _file_size >= _max_file_size)
+        {
+            rotate();
+        }
+    }
+    _batch.clear();
+}
+
+/*!
+ * Flusher thread, drains rings every ASYNC_LOG_FLUSH_INTERVAL
+ */
+void AsyncLogger::flusher()
+{
+    while (_running)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_flusher_mtx);
+            _flusher_cond.wait_for(lock, std::chrono::milliseconds(ASYNC_LOG_FLUSH_INTERVAL));
+        }
+        flush();
+    }
+    flush();
+}
+
+/*!
+ * Synchronously flush everything queued so far (e.g. before exit)
+ */
+void AsyncLogger::Flush()
+{
+    if (_running)
+    {
+        flush();
+    }
+}
+
+/*!
+ * Number of log lines dropped because a ring was full
+ * @return
+ * dropped lines
+ */
+unsigned long AsyncLogger::Dropped() const
+{
+    return _dropped.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Stop flusher after draining all rings and close log file
+ * @return
+ * SMB_SUCCESS - Sucess
+ */
+int AsyncLogger::Quit()
+{
+    if (_flusher != NULL)
+    {
+        _running = false;
+        _flusher_cond.notify_one();
+        _flusher->join();
+        FREE(_flusher);
+        _flusher = NULL;
+    }
+
+    if (_fd >= 0)
+    {
+        close(_fd);
+        _fd = -1;
+    }
+    return SMB_SUCCESS;
+}
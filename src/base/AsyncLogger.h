@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef ASYNC_LOGGER_H_
+#define ASYNC_LOGGER_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "base/Common.h"
+#include "base/Constants.h"
+
+#define ASYNC_LOG_RECORD_SIZE       512     //bytes of message kept per record, longer messages are truncated
+#define ASYNC_LOG_RING_SIZE         256     //records per thread, must be power of 2
+#define ASYNC_LOG_FLUSH_INTERVAL    50      //milliseconds
+#define ASYNC_LOG_BATCH_SIZE        (64 * 1024)
+
+/*
+ * Pre-formatted log line, filled by the logging thread
+ */
+struct AsyncLogRecord
+{
+    struct timespec _time;
+    const char *_priority;
+    pid_t _tid;
+    char _id[IDENT_BUFFER_SIZE];
+    char _msg[ASYNC_LOG_RECORD_SIZE];
+};
+
+/*
+ * Single producer (owning thread) single consumer (flusher) ring of records
+ */
+struct AsyncLogRing
+{
+    std::atomic<unsigned long> _head;  //next record to be written, updated by producer
+    std::atomic<unsigned long> _tail;  //next record to be flushed, updated by flusher
+    std::atomic<bool> _orphaned;       //owning thread exited
+    AsyncLogRecord _records[ASYNC_LOG_RING_SIZE];
+
+    AsyncLogRing() : _head(0), _tail(0), _orphaned(false) {}
+};
+
+/*
+ * Asynchronous logging backend.
+ * Every thread formats its log lines into its own lock-free ring, a background
+ * flusher drains all rings in batches, writes them to the log file (and console)
+ * and rotates the file. Console lines keep the "%5r %t %5p" layout of log4cpp. Lines are dropped (and counted) when a ring is full.
+ */
+class AsyncLogger
+{
+private:
+    std::string _file_name;
+    size_t _max_file_size;
+    int _max_backups;
+    bool _console;
+
+    int _fd;
+    size_t _file_size;
+    std::string _batch;
+    std::string _console_batch; //same lines in console layout
+    struct timespec _start;     //Init time, console lines show milli-seconds since
+
+    unsigned long _instance;
+    std::vector<std::shared_ptr<AsyncLogRing> > _rings; //shared with owning threads
+    std::mutex _rings_mtx;      //guards _rings only, never held across I/O
+    std::mutex _flush_mtx;      //serialises flushes, guards batch and log file
+
+    std::atomic<bool> _running;
+    std::atomic<unsigned long> _dropped;
+    unsigned long _reported_dropped;
+
+    std::thread *_flusher;
+    std::mutex _flusher_mtx;
+    std::condition_variable _flusher_cond;
+
+    AsyncLogRing *thread_ring();
+    AsyncLogRecord *reserve(const char *priority, AsyncLogRing *&ring);
+    void flusher();
+    void flush();
+    void write_batch();
+    void append(const AsyncLogRecord &record);
+    int open_file();
+    void rotate();
+
+public:
+    AsyncLogger();
+    ~AsyncLogger();
+
+    int Init(const char *file_name, size_t max_file_size, int max_backups, bool console);
+    void Write(const char *priority, const char *format, va_list arg);
+    void Write(const char *priority, const char *msg);
+    void Flush();
+    unsigned long Dropped() const;
+    int Quit();
+};
+
+#endif //ASYNC_LOGGER_H_
@@ -16,9 +16,10 @@ Configuration Configuration::instance;
 /*!
  * Constructor that initializes the configuration data to their default values
  */
-Configuration::Configuration()
+Configuration::Configuration() : _snapshot(NULL)
 {
     setDefaultValues();
+    publish();
 }
 
 /*!
@@ -26,7 +27,10 @@ Configuration::Configuration()
  */
 Configuration::~Configuration()
 {
-    //Destructor
+    for (std::vector<ConfigSnapshot *>::iterator iter = _snapshots.begin(); iter != _snapshots.end(); ++iter)
+    {
+        FREE(*iter);
+    }
 }
 
 /*!
@@ -47,7 +51,27 @@ void Configuration::setDefaultValues()
     _table[C_SHOW_ONLY_FOLDERS] = DEFAULT_SHOW_ONLY_FOLDERS;
     _table[C_SHOW_HIDDEN_FILES] = DEFAULT_SHOW_HIDDEN_FILES;
     _table[C_PAGE_SIZE] = DEFAULT_PAGE_SIZE;
+    _table[C_LIST_LEVEL] = DEFAULT_LIST_LEVEL;
+    _table[C_LIST_NAME_FILTER] = DEFAULT_LIST_NAME_FILTER;
+    _table[C_LIST_SORT] = DEFAULT_LIST_SORT;
+    _table[C_LIST_LIMIT] = DEFAULT_LIST_LIMIT;
+    _table[C_LIST_PREFETCH_SIZE] = DEFAULT_LIST_PREFETCH_SIZE;
+    _table[C_LIST_FIRST_PAGE] = DEFAULT_LIST_FIRST_PAGE;
+    _table[C_LIST_PAGE_BYTES] = DEFAULT_LIST_PAGE_BYTES;
+    _table[C_LIST_PAGE_TIME] = DEFAULT_LIST_PAGE_TIME;
+    _table[C_LIST_CACHE_SIZE] = DEFAULT_LIST_CACHE_SIZE;
+    _table[C_LIST_CACHE_TTL] = DEFAULT_LIST_CACHE_TTL;
+    _table[C_LIST_WORKERS] = DEFAULT_LIST_WORKERS;
+    _table[C_DELETE_WORKERS] = DEFAULT_DELETE_WORKERS;
+    _table[C_DELETE_PROGRESS_TIME] = DEFAULT_DELETE_PROGRESS_TIME;
+    _table[C_STAT_WORKERS] = DEFAULT_STAT_WORKERS;
+    _table[C_STAT_PATHS] = DEFAULT_STAT_PATHS;
+    _table[C_KNOWN_DIRS] = DEFAULT_KNOWN_DIRS;
+    _table[C_COPY_PROGRESS_TIME] = DEFAULT_COPY_PROGRESS_TIME;
+    _table[C_DESTINATION] = DEFAULT_DESTINATION;
+    _table[C_OVERWRITE] = DEFAULT_OVERWRITE;
     _table[C_BUFFER_SIZE] = DEFAULT_BUFFER_SIZE;
+    _table[C_SMALL_FILE_SIZE] = DEFAULT_SMALL_FILE_SIZE;
     _table[C_START_OFFSET] = DEFAULT_START_OFFSET;
     _table[C_END_OFFSET] = DEFAULT_END_OFFSET;
     _table[C_ACCEPT_QUEUE_SIZE] = DEFAULT_ACCEPT_QUEUE_SIZE;
@@ -55,11 +79,96 @@ void Configuration::setDefaultValues()
     _table[C_SMB_SOCK_READ_BUFFER] = DEFAULT_SMB_SOCK_READ_BUFFER;
     _table[C_SMB_SOCK_WRITE_BUFFER] = DEFAULT_SMB_SOCK_WRITE_BUFFER;
     _table[C_IDLE_TIMEOUT] = DEFAULT_IDLE_TIMEOUT;
+    _table[C_KEEP_ALIVE] = DEFAULT_KEEP_ALIVE;
     _table[C_SMB_CONF] = DEFAULT_SMB_CONF;
     _table[C_OUT_FILE] = DEFAULT_OUT_FILE;
     _table[C_CONF_FILE] = DEFAULT_CONF_FILE;
     _table[C_FILE_UPLOAD_MODE] = DEFAULT_FILE_UPLOAD_MODE;
+    _table[C_LOG_ASYNC] = DEFAULT_LOG_ASYNC;
     _table[C_IS_KERBEROS] = DEFAULT_IS_KERBEROS;
+    _table[C_STORAGE_BACKEND] = DEFAULT_STORAGE_BACKEND;
+    _table[C_STORAGE_ROOT] = DEFAULT_STORAGE_ROOT;
+    _table[C_STORAGE_LATENCY] = DEFAULT_STORAGE_LATENCY;
+    _table[C_STORAGE_BANDWIDTH] = DEFAULT_STORAGE_BANDWIDTH;
+    _table[C_STORAGE_SLOW_CALL] = DEFAULT_STORAGE_SLOW_CALL;
+    _table[C_TRACE] = DEFAULT_TRACE;
+    _table[C_TRACE_DIR] = DEFAULT_TRACE_DIR;
+    _table[C_CAPTURE] = DEFAULT_CAPTURE;
+    _table[C_CAPTURE_DIR] = DEFAULT_CAPTURE_DIR;
+    _table[C_CAPTURE_DATA] = DEFAULT_CAPTURE_DATA;
+}
+
+/*!
+ * Build typed snapshot from the table and publish it for lock-free readers.
+ * Must be called with _mtx held.
+ * Previous snapshots are retained since readers may still refer to them,
+ * the table only changes at start-up (or in tests) so this stays small.
+ */
+void Configuration::publish()
+{
+    ConfigSnapshot *snapshot = ALLOCATE(ConfigSnapshot);
+    if (!ALLOCATED(snapshot))
+    {
+        ERROR_LOG("Configuration::publish allocation failed");
+        return;
+    }
+
+    snapshot->accept_queue_size = atoi(_table[C_ACCEPT_QUEUE_SIZE].c_str());
+    snapshot->unix_sock_buffer = atoi(_table[C_UNIX_SOCK_BUFFER].c_str());
+    snapshot->smb_sock_read_buffer = atoi(_table[C_SMB_SOCK_READ_BUFFER].c_str());
+    snapshot->smb_sock_write_buffer = atoi(_table[C_SMB_SOCK_WRITE_BUFFER].c_str());
+    snapshot->op_mode = atoi(_table[C_OP_MODE].c_str());
+    snapshot->idle_timeout = atoi(_table[C_IDLE_TIMEOUT].c_str());
+    snapshot->keep_alive = atoi(_table[C_KEEP_ALIVE].c_str()) != 0;
+    snapshot->log_level = atoi(_table[C_LOG_LEVEL].c_str());
+    snapshot->file_upload_mode = atoi(_table[C_FILE_UPLOAD_MODE].c_str());
+    snapshot->op_code = atoi(_table[C_OP_CODE].c_str());
+    snapshot->show_only_folders = atoi(_table[C_SHOW_ONLY_FOLDERS].c_str()) != 0;
+    snapshot->show_hidden_files = atoi(_table[C_SHOW_HIDDEN_FILES].c_str()) != 0;
+    snapshot->page_size = atoi(_table[C_PAGE_SIZE].c_str());
+    snapshot->list_level = (unsigned int) strtoul(_table[C_LIST_LEVEL].c_str(), NULL, 10);
+    snapshot->list_prefetch_size = strtoul(_table[C_LIST_PREFETCH_SIZE].c_str(), NULL, 10);
+    snapshot->list_first_page = atoi(_table[C_LIST_FIRST_PAGE].c_str());
+    snapshot->list_page_bytes = strtoul(_table[C_LIST_PAGE_BYTES].c_str(), NULL, 10);
+    snapshot->list_page_time = strtoul(_table[C_LIST_PAGE_TIME].c_str(), NULL, 10);
+    snapshot->list_cache_size = strtoul(_table[C_LIST_CACHE_SIZE].c_str(), NULL, 10);
+    snapshot->list_cache_ttl = atol(_table[C_LIST_CACHE_TTL].c_str());
+    snapshot->list_workers = (unsigned int) strtoul(_table[C_LIST_WORKERS].c_str(), NULL, 10);
+    snapshot->delete_workers = (unsigned int) strtoul(_table[C_DELETE_WORKERS].c_str(), NULL, 10);
+    snapshot->delete_progress_time = strtoul(_table[C_DELETE_PROGRESS_TIME].c_str(), NULL, 10);
+    snapshot->stat_workers = (unsigned int) strtoul(_table[C_STAT_WORKERS].c_str(), NULL, 10);
+    snapshot->known_dirs = strtoul(_table[C_KNOWN_DIRS].c_str(), NULL, 10);
+    snapshot->copy_progress_time = strtoul(_table[C_COPY_PROGRESS_TIME].c_str(), NULL, 10);
+    snapshot->buffer_size = (unsigned int) strtoul(_table[C_BUFFER_SIZE].c_str(), NULL, 10);
+    snapshot->small_file_size = strtoul(_table[C_SMALL_FILE_SIZE].c_str(), NULL, 10);
+    snapshot->start_offset = atol(_table[C_START_OFFSET].c_str());
+    snapshot->end_offset = atol(_table[C_END_OFFSET].c_str());
+    snapshot->is_kerberos = atoi(_table[C_IS_KERBEROS].c_str()) != 0;
+    snapshot->storage_latency = atol(_table[C_STORAGE_LATENCY].c_str());
+    snapshot->storage_bandwidth = strtoul(_table[C_STORAGE_BANDWIDTH].c_str(), NULL, 10);
+    snapshot->storage_slow_call = atol(_table[C_STORAGE_SLOW_CALL].c_str());
+    snapshot->trace = atoi(_table[C_TRACE].c_str()) != 0;
+    snapshot->capture = atoi(_table[C_CAPTURE].c_str()) != 0;
+    snapshot->capture_data = atoi(_table[C_CAPTURE_DATA].c_str());
+
+    snapshot->smb_conf = _table[C_SMB_CONF];
+    snapshot->sock_name = _table[C_SOCK_NAME];
+    snapshot->log_file = _table[C_LOG_FILE];
+    snapshot->url = _table[C_URL];
+    snapshot->user_name = _table[C_USER_NAME];
+    snapshot->password = _table[C_PASSWORD];
+    snapshot->work_group = _table[C_WORK_GROUP];
+    snapshot->out_file = _table[C_OUT_FILE];
+    snapshot->conf_file = _table[C_CONF_FILE];
+    snapshot->user = _table[C_USER];
+    snapshot->group = _table[C_GROUP];
+    snapshot->storage_backend = _table[C_STORAGE_BACKEND];
+    snapshot->storage_root = _table[C_STORAGE_ROOT];
+    snapshot->trace_dir = _table[C_TRACE_DIR];
+    snapshot->capture_dir = _table[C_CAPTURE_DIR];
+
+    _snapshots.push_back(snapshot);
+    _snapshot.store(snapshot, std::memory_order_release);
 }
 
 /*!
@@ -73,6 +182,7 @@ void Configuration::Reset()
     std::lock_guard<std::mutex> lock(_mtx);
     _table.clear();
     setDefaultValues();
+    publish();
 }
 
 /*!
@@ -111,6 +221,7 @@ void Configuration::Set(const char *index, const char *value)
 
     std::lock_guard<std::mutex> lock(_mtx);
     _table[index] = value;
+    publish();
 }
 
 /*!
@@ -157,5 +268,8 @@ int Configuration::Parse()
     }
 
     conf_file.close();
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    publish();
     return SMB_SUCCESS;
 }
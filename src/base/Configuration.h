@@ -10,11 +10,87 @@
 
 #include <mutex>
 #include <map>
+#include <atomic>
 #include "Common.h"
 
 
 typedef std::map<std::string, std::string> CONFIG_MAP;
 
+/*
+ * Typed, immutable view of the configuration table.
+ * A new snapshot is built whenever the table changes and published atomically,
+ * so hot paths can read settings without taking the configuration lock.
+ */
+struct ConfigSnapshot
+{
+    /* Unix socket settings */
+    int accept_queue_size;
+    int unix_sock_buffer;
+
+    /* SMB server socket settings */
+    int smb_sock_read_buffer;
+    int smb_sock_write_buffer;
+
+    /* smb-connector mode */
+    int op_mode;
+    int idle_timeout;
+    bool keep_alive;
+    int log_level;
+    int file_upload_mode;
+
+    /* client mode settings */
+    int op_code;
+    bool show_only_folders;
+    bool show_hidden_files;
+    int page_size;
+    unsigned int list_level;
+    unsigned long list_prefetch_size;
+    int list_first_page;
+    unsigned long list_page_bytes;
+    unsigned long list_page_time;
+    unsigned long list_cache_size;
+    long list_cache_ttl;
+    unsigned int list_workers;
+    unsigned int delete_workers;
+    unsigned long delete_progress_time;
+    unsigned int stat_workers;
+    unsigned long known_dirs;
+    unsigned long copy_progress_time;
+    unsigned int buffer_size;
+    unsigned long small_file_size;
+    long start_offset;
+    long end_offset;
+    bool is_kerberos;
+
+    /* storage backend settings */
+    long storage_latency;
+    unsigned long storage_bandwidth;
+    long storage_slow_call;
+
+    /* tracing settings */
+    bool trace;
+
+    /* session capture settings */
+    bool capture;
+    int capture_data;
+
+    std::string smb_conf;
+    std::string sock_name;
+    std::string log_file;
+    std::string url;
+    std::string user_name;
+    std::string password;
+    std::string work_group;
+    std::string out_file;
+    std::string conf_file;
+    std::string user;
+    std::string group;
+    std::string storage_backend;
+    std::string storage_root;
+    std::string trace_dir;
+    std::string capture_dir;
+};
+
 class Configuration
 {
 private:
@@ -23,7 +99,11 @@ private:
     CONFIG_MAP _table;
     std::mutex _mtx;
 
+    std::atomic<const ConfigSnapshot *> _snapshot;
+    std::vector<ConfigSnapshot *> _snapshots; //published snapshots, kept alive for lock-free readers
+
     void setDefaultValues();
+    void publish();
     Configuration();
     virtual ~Configuration();
 
@@ -40,6 +120,16 @@ public:
         return _table[index].c_str();
     }
 
+    /*!
+     * Current configuration snapshot, lock-free
+     * @return
+     * typed configuration values
+     */
+    const ConfigSnapshot &Snapshot() const
+    {
+        return *_snapshot.load(std::memory_order_acquire);
+    }
+
     void Reset();
     void DumpTable();
     void Set(const char *index, const char *value);
@@ -64,12 +154,30 @@ public:
 /* smb-connector mode */
 #define C_OP_MODE       "op_mode"
 #define C_IDLE_TIMEOUT  "idle_timeout"
+#define C_KEEP_ALIVE    "keep_alive"
 
 /* server mode settings */
 #define C_SOCK_NAME     "sock_name"
 #define C_LOG_FILE      "log_file"
 #define C_LOG_LEVEL     "log_level"
 #define C_FILE_UPLOAD_MODE "file_upload_mode"
+#define C_LOG_ASYNC     "log_async"
+
+/* storage backend settings */
+#define C_STORAGE_BACKEND       "storage_backend"
+#define C_STORAGE_ROOT          "storage_root"
+#define C_STORAGE_LATENCY       "storage_latency"
+#define C_STORAGE_BANDWIDTH     "storage_bandwidth"
+#define C_STORAGE_SLOW_CALL     "storage_slow_call"
+
+/* tracing settings */
+#define C_TRACE                 "trace"
+#define C_TRACE_DIR             "trace_dir"
+
+/* session capture settings */
+#define C_CAPTURE               "capture"
+#define C_CAPTURE_DIR           "capture_dir"
+#define C_CAPTURE_DATA          "capture_data"
 
 /* client mode settings */
 #define C_OP_CODE               "op_code"
@@ -82,10 +190,40 @@ public:
 #define C_SHOW_ONLY_FOLDERS     "show_folder"
 #define C_SHOW_HIDDEN_FILES     "show_hidden"
 #define C_PAGE_SIZE             "page_size"
+#define C_LIST_LEVEL            "level"             //levels listed, sub-folders are listed recursively when > 1
+#define C_LIST_NAME_FILTER      "name_filter"       //glob entry names are matched against
+#define C_LIST_SORT             "sort"              //name, mtime or size, '-' prefix for descending order
+#define C_LIST_LIMIT            "limit"             //entries listed, first ones in sort order
+#define C_LIST_PREFETCH_SIZE    "list_prefetch_size" //entries read ahead of the page being sent
+#define C_LIST_FIRST_PAGE       "list_first_page"   //entries in first page, doubled for every next page
+#define C_LIST_PAGE_BYTES       "list_page_bytes"   //page is sent once its entries reach this size
+#define C_LIST_PAGE_TIME        "list_page_time"    //page is sent once it took this long to fill
+#define C_LIST_CACHE_SIZE       "list_cache_size"   //memory for cached listings
+#define C_LIST_CACHE_TTL        "list_cache_ttl"    //cached listing is served for this long
+#define C_LIST_WORKERS          "list_workers"      //threads listing subdirectories of a recursive listing
+
+//settings for delete
+#define C_DELETE_WORKERS        "delete_workers"    //threads deleting content of a folder
+#define C_DELETE_PROGRESS_TIME  "delete_progress_time" //progress of a folder delete is sent this often
+
+//settings for batch stat
+#define C_STAT_WORKERS          "stat_workers"      //threads stat'ing paths of a batch stat request
+#define C_STAT_PATHS            "paths"             //comma separated paths of client batch stat request
+
+//settings for copy/move
+#define C_COPY_PROGRESS_TIME    "copy_progress_time" //progress of a copy is sent this often
+#define C_DESTINATION           "destination"       //server/share/path client copy/move request copies to
+#define C_OVERWRITE             "overwrite"         //client copy/move request replaces an existing destination
+
+//settings for upload
+#define C_KNOWN_DIRS            "known_dirs"        //folders remembered per session, not created again by uploads
 
 //buffer-queue size for download/upload operation
 #define C_BUFFER_SIZE           "buff_size"
 
+//files smaller than this are downloaded with a single read
+#define C_SMALL_FILE_SIZE       "small_file_size"
+
 //settings for download
 #define C_START_OFFSET          "start_offset"
 #define C_END_OFFSET            "end_offset"
@@ -115,11 +253,26 @@ public:
 
 #define DEFAULT_OP_MODE             "1"
 #define DEFAULT_IDLE_TIMEOUT        "300" //seconds
+#define DEFAULT_KEEP_ALIVE          "1"
 
 #define DEFAULT_SOCK_NAME           "smb-connector"
 #define DEFAULT_LOG_FILE            "/var/log/vmware/content-gateway/smb-connector/smbconnector.log"
 #define DEFAULT_LOG_LEVEL           "0"
 #define DEFAULT_FILE_UPLOAD_MODE    "0"
+#define DEFAULT_LOG_ASYNC           "1"
+
+#define DEFAULT_STORAGE_BACKEND     "smb"
+#define DEFAULT_STORAGE_ROOT        "/tmp/smb-connector-storage"
+#define DEFAULT_STORAGE_LATENCY     "0" //micro-seconds
+#define DEFAULT_STORAGE_BANDWIDTH   "0" //bytes per second, 0 - unlimited
+#define DEFAULT_STORAGE_SLOW_CALL   "500000" //micro-seconds, 0 - off
+
+#define DEFAULT_TRACE               "0"
+#define DEFAULT_TRACE_DIR           "/tmp/smb-connector-trace"
+
+#define DEFAULT_CAPTURE             "0"
+#define DEFAULT_CAPTURE_DIR         "/tmp/smb-connector-capture"
+#define DEFAULT_CAPTURE_DATA        "0" //0 - elided, 1 - hashed, 2 - full
 
 #define DEFAULT_OP_CODE             "0"
 #define DEFAULT_URL                 ""
@@ -130,8 +283,29 @@ public:
 #define DEFAULT_SHOW_ONLY_FOLDERS   "0"
 #define DEFAULT_SHOW_HIDDEN_FILES   "1"
 #define DEFAULT_PAGE_SIZE           "5"
+#define DEFAULT_LIST_LEVEL          "1"
+#define DEFAULT_LIST_NAME_FILTER    "" //any name
+#define DEFAULT_LIST_SORT           "" //directory order
+#define DEFAULT_LIST_LIMIT          "0" //all entries
+#define DEFAULT_LIST_PREFETCH_SIZE  "1048576" //1MB, 0 - off
+#define DEFAULT_LIST_FIRST_PAGE     "16" //0 - off, every page has page_size entries
+#define DEFAULT_LIST_PAGE_BYTES     "61440" //60KB, 0 - off
+#define DEFAULT_LIST_PAGE_TIME      "100000" //micro-seconds, 0 - off
+#define DEFAULT_LIST_CACHE_SIZE     "16777216" //16MB, 0 - off
+#define DEFAULT_LIST_CACHE_TTL      "10" //seconds
+#define DEFAULT_LIST_WORKERS        "8"
+
+#define DEFAULT_DELETE_WORKERS      "8"
+#define DEFAULT_DELETE_PROGRESS_TIME "1000000" //micro-seconds, 0 - off
+#define DEFAULT_STAT_WORKERS        "8"
+#define DEFAULT_STAT_PATHS          ""
+#define DEFAULT_KNOWN_DIRS          "4096" //0 - off
+#define DEFAULT_COPY_PROGRESS_TIME  "1000000" //micro-seconds, 0 - off
+#define DEFAULT_DESTINATION         ""
+#define DEFAULT_OVERWRITE           "0"
 
 #define DEFAULT_BUFFER_SIZE         "10"
+#define DEFAULT_SMALL_FILE_SIZE     "65536" //64KB, 0 - off
 
 #define DEFAULT_START_OFFSET        "0"
 #define DEFAULT_END_OFFSET          "0"
@@ -16,9 +16,11 @@
  */
 std::string CustomLayout::format(const log4cpp::LoggingEvent &event)
 {
-    if (RequestProcessor::GetInstance() != NULL && RequestProcessor::GetInstance()->RequestId().length() > 0)
+    char id[IDENT_BUFFER_SIZE];
+    RequestProcessor::CurrentRequestId(id, sizeof(id));
+    if (id[0] != '\0')
     {
-        return "[" + RequestProcessor::GetInstance()->RequestId() + "] " + log4cpp::PatternLayout::format(event);
+        return "[" + std::string(id) + "] " + log4cpp::PatternLayout::format(event);
     }
 
     return "[ID_NOT_SET] " + log4cpp::PatternLayout::format(event);
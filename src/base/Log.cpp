@@ -62,6 +62,31 @@ void Log_smbclient(void *ptr, int level, const char *msg)
     }
 }
 
+/*!
+ * Check if a rate limited log line may be written now
+ * @param interval_ms - minimum interval between two log lines
+ * @param suppressed - number of log lines suppressed since the last one written (out)
+ * @return
+ * true - log line to be written
+ * false - log line suppressed
+ */
+bool LogRateLimit::Allow(long interval_ms, unsigned long &suppressed)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    long now = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+
+    long next = _next.load(std::memory_order_relaxed);
+    if (now < next || !_next.compare_exchange_strong(next, now + interval_ms, std::memory_order_relaxed))
+    {
+        _suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+    return true;
+}
+
 /*!
  * Used to generate log file name based on request-id
  */
@@ -9,6 +9,7 @@
 #define LOG_H_
 
 #include <time.h>
+#include <atomic>
 #include "base/Common.h"
 #include "base/Constants.h"
 
@@ -29,23 +30,58 @@
 #define SAMBA_DBG_INFO      5
 #define SAMBA_DBG_DEBUG     10
 
+/*
+ * Highest log level compiled in, log sites above it are compiled out
+ * regardless of the runtime logLevel (constant-false branch).
+ * Debug builds keep everything, release builds keep up to INFO.
+ * Can be overridden at build time, e.g. -DLOG_LVL_COMPILED=4
+ */
+#ifndef LOG_LVL_COMPILED
+#if defined(_DEBUG_)
+#define LOG_LVL_COMPILED    LOG_LVL_DUMP
+#else
+#define LOG_LVL_COMPILED    LOG_LVL_INFO
+#endif
+#endif
+
+//Default interval for rate limited logging
+#define LOG_RATE_LIMIT_INTERVAL     1000 //milliseconds
+
 extern int logLevel;
 
 void Log(int level, const char *format, ...);
 void Log_smbclient(void *ptr, int level, const char *msg);
 void generate_log_file_name();
 
+/*
+ * Per log-site rate limiter, allows one line per interval and
+ * counts the suppressed ones. Constant initialised so it can be
+ * used as a function local static without guard.
+ */
+class LogRateLimit
+{
+private:
+    std::atomic<long> _next;
+    std::atomic<unsigned long> _suppressed;
+
+public:
+    constexpr LogRateLimit() : _next(0), _suppressed(0) {}
+    bool Allow(long interval_ms, unsigned long &suppressed);
+};
+
+#define LOG_ENABLED(LEVEL) (LOG_LVL_COMPILED >= (LEVEL) && logLevel >= (LEVEL))
+
 #define DEBUG_LOG(...) do\
-{if (logLevel >= LOG_LVL_DEBUG)    Log(LOG_LVL_DEBUG, __VA_ARGS__);} while (0)
+{if (LOG_ENABLED(LOG_LVL_DEBUG))    Log(LOG_LVL_DEBUG, __VA_ARGS__);} while (0)
 
 #define INFO_LOG(...) do\
-{if (logLevel >= LOG_LVL_INFO)     Log(LOG_LVL_INFO, __VA_ARGS__);} while (0)
+{if (LOG_ENABLED(LOG_LVL_INFO))     Log(LOG_LVL_INFO, __VA_ARGS__);} while (0)
 
 #define WARNING_LOG(...) do\
-{if (logLevel >= LOG_LVL_WARNING)  Log(LOG_LVL_WARNING, __VA_ARGS__);} while (0)
+{if (LOG_ENABLED(LOG_LVL_WARNING))  Log(LOG_LVL_WARNING, __VA_ARGS__);} while (0)
 
 #define ERROR_LOG(...) do\
-{if (logLevel >= LOG_LVL_ERROR)    Log(LOG_LVL_ERROR, __VA_ARGS__);} while (0)
+{if (LOG_ENABLED(LOG_LVL_ERROR))    Log(LOG_LVL_ERROR, __VA_ARGS__);} while (0)
 
 #define ALWAYS_LOG(...) do\
 {if (logLevel >= LOG_LVL_ALWAYS)     Log(LOG_LVL_ALWAYS, __VA_ARGS__);} while (0)
@@ -57,4 +93,27 @@ void generate_log_file_name();
 #define TRACE_LOG(...)
 #endif
 
+/*
+ * Rate limited logging for per-chunk/per-packet events,
+ * logs at most one line per INTERVAL_MS from the call site and
+ * reports how many were suppressed in between.
+ */
+#define RATE_LIMITED_LOG(LEVEL, INTERVAL_MS, ...) do\
+{\
+    if (LOG_ENABLED(LEVEL))\
+    {\
+        static LogRateLimit _rate_limit;\
+        unsigned long _suppressed = 0;\
+        if (_rate_limit.Allow(INTERVAL_MS, _suppressed))\
+        {\
+            if (_suppressed > 0)\
+                Log(LEVEL, "(%lu similar log lines suppressed)", _suppressed);\
+            Log(LEVEL, __VA_ARGS__);\
+        }\
+    }\
+} while (0)
+
+#define DEBUG_LOG_RATE_LIMITED(...) RATE_LIMITED_LOG(LOG_LVL_DEBUG, LOG_RATE_LIMIT_INTERVAL, __VA_ARGS__)
+#define INFO_LOG_RATE_LIMITED(...)  RATE_LIMITED_LOG(LOG_LVL_INFO, LOG_RATE_LIMIT_INTERVAL, __VA_ARGS__)
+
 #endif //LOG_H_
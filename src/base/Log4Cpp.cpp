@@ -20,6 +20,7 @@ Log4Cpp::Log4Cpp()
     _ostream_appender = NULL;
     _file_appender = NULL;
     _category = NULL;
+    _async_logger = NULL;
 }
 
 /*!
@@ -86,6 +87,19 @@ int Log4Cpp::Init()
         return SMB_ERROR;
     }
 
+    if (atoi(c[C_LOG_ASYNC]))
+    {
+        _async_logger = ALLOCATE(AsyncLogger);
+        if (ALLOCATED(_async_logger)
+            && _async_logger->Init(c[C_LOG_FILE], LOG_FILE_MAX_SIZE, LOG_FILE_MAX_BACKUPS, true) == SMB_SUCCESS)
+        {
+            return SMB_SUCCESS;
+        }
+        printf("Cannot start async logger, fall back to log4cpp\n");
+        FREE(_async_logger);
+        _async_logger = NULL;
+    }
+
     CustomLayout *ostream_layout = new CustomLayout();
     ostream_layout->setConversionPattern("%5r %t %5p: %m%n");
 
@@ -93,7 +107,8 @@ int Log4Cpp::Init()
     file_layout->setConversionPattern("%d{%Y-%m-%d %H:%M:%S.%l} %t %5p: %m%n");
 
     _ostream_appender = new log4cpp::OstreamAppender("console", &std::cout);
-    _file_appender = new log4cpp::RollingFileAppender("file", c[C_LOG_FILE], 10 * 1024 * 1024, 5, false, 00644);
+    _file_appender = new log4cpp::RollingFileAppender("file", c[C_LOG_FILE], LOG_FILE_MAX_SIZE, LOG_FILE_MAX_BACKUPS,
+                                                      false, 00644);
     _ostream_appender->setLayout(ostream_layout);
     _file_appender->setLayout(file_layout);
 
@@ -108,6 +123,59 @@ int Log4Cpp::Init()
 
 }
 
+/*!
+ * Priority name (as printed by log4cpp) for logging level
+ * @param level - logging level
+ * @return
+ * name - level is logged
+ * NULL - level not logged
+ */
+static const char *level_name(int level)
+{
+    switch (level)
+    {
+        case LOG_LVL_ERROR:
+            return "ERROR";
+        case LOG_LVL_WARNING:
+            return "WARN";
+        case LOG_LVL_INFO:
+        case LOG_LVL_ALWAYS:
+            return "INFO";
+        case LOG_LVL_DEBUG:
+        case LOG_LVL_TRACE:
+        case LOG_LVL_DUMP:
+            return "DEBUG";
+        default:
+            return NULL;
+    }
+}
+
+/*!
+ * Priority name (as printed by log4cpp) for smbclient logging level
+ * @param level - samba debug level
+ * @return
+ * name - level is logged
+ * NULL - level not logged
+ */
+static const char *samba_level_name(int level)
+{
+    switch (level)
+    {
+        case SAMBA_DBG_ERR:
+            return "ERROR";
+        case SAMBA_DBG_WARNING:
+            return "WARN";
+        case SAMBA_DBG_NOTICE:
+            return "NOTICE";
+        case SAMBA_DBG_INFO:
+            return "INFO";
+        case SAMBA_DBG_DEBUG:
+            return "DEBUG";
+        default:
+            return NULL;
+    }
+}
+
 /*!
  * Dumps log to console as well as log file
  * @param level - logging level
@@ -118,6 +186,16 @@ int Log4Cpp::Init()
  */
 void Log4Cpp::Write(int level, const char *format, va_list arg)
 {
+    if (_async_logger)
+    {
+        const char *priority = level_name(level);
+        if (priority)
+        {
+            _async_logger->Write(priority, format, arg);
+        }
+        return;
+    }
+
     if (level == LOG_LVL_ERROR)
     {
         _category->logva(log4cpp::Priority::ERROR, format, arg);
@@ -155,6 +233,16 @@ void Log4Cpp::Write(int level, const char *format, va_list arg)
  */
 void Log4Cpp::Write(int level, const char *msg)
 {
+    if (_async_logger)
+    {
+        const char *priority = samba_level_name(level);
+        if (priority)
+        {
+            _async_logger->Write(priority, msg);
+        }
+        return;
+    }
+
     if (level == SAMBA_DBG_ERR)
     {
         _category->log(log4cpp::Priority::ERROR, msg);
@@ -184,6 +272,34 @@ void Log4Cpp::Write(int level, const char *msg)
  */
 int Log4Cpp::Quit()
 {
+    if (_async_logger)
+    {
+        _async_logger->Quit();
+        FREE(_async_logger);
+        _async_logger = NULL;
+        return SMB_SUCCESS;
+    }
     log4cpp::Category::shutdown();
     return SMB_SUCCESS;
+}
+
+/*!
+ * Flush queued log lines (async logging only)
+ */
+void Log4Cpp::Flush()
+{
+    if (_async_logger)
+    {
+        _async_logger->Flush();
+    }
+}
+
+/*!
+ * Number of log lines dropped by async logger
+ * @return
+ * dropped log lines
+ */
+unsigned long Log4Cpp::Dropped() const
+{
+    return _async_logger ? _async_logger->Dropped() : 0;
 }
\ No newline at end of file
@@ -15,6 +15,10 @@
 #include <log4cpp/Priority.hh>
 
 #include "CustomLayout.h"
+#include "AsyncLogger.h"
+
+#define LOG_FILE_MAX_SIZE       (10 * 1024 * 1024)
+#define LOG_FILE_MAX_BACKUPS    5
 
 class Log4Cpp
 {
@@ -22,6 +26,7 @@ private:
     log4cpp::Appender *_ostream_appender;
     log4cpp::Appender *_file_appender;
     log4cpp::Category *_category;
+    AsyncLogger *_async_logger;
 
     int create_directory(const char *file_name);
 
@@ -32,6 +37,8 @@ public:
     int Init();
     void Write(int level, const char *format, va_list arg);
     void Write(int level, const char *msg);
+    void Flush();
+    unsigned long Dropped() const;
     int Quit();
 };
 
@@ -0,0 +1,667 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "Metrics.h"
+#include "base/Log.h"
+#include "base/Log4Cpp.h"
+
+extern Log4Cpp *logger;
+
+Metrics Metrics::instance;
+
+static const char *op_names[METRIC_OP_MAX] =
+    {"list_dir", "download", "upload", "add_folder", "delete", "test_connection", "batch_stat", "copy",
+     "move"};
+
+static const char *counter_names[METRIC_COUNTER_MAX] = {"requests", "bytes", "chunks", "errors", "cache_hits",
+                                                             "cache_misses"};
+
+static const char *latency_names[METRIC_LATENCY_MAX] = {"open", "first_byte", "chunk", "total"};
+
+static const char *gauge_names[METRIC_GAUGE_MAX] = {"request_queue", "response_queue"};
+
+static const char *call_names[METRIC_CALL_MAX] =
+    {"open", "read", "write", "lseek", "fstat", "close", "opendir", "readdir", "readdirplus", "closedir", "stat",
+     "mkdir", "unlink", "rename", "rmdir", "splice"};
+
+/*!
+ * Constructor
+ */
+Histogram::Histogram()
+{
+    Reset();
+}
+
+/*!
+ * Bucket for a value, exact below HISTOGRAM_SUB_BUCKETS,
+ * HISTOGRAM_SUB_BUCKETS linear sub-buckets per power of 2 above
+ * @param value - value to be recorded
+ * @return
+ * bucket index
+ */
+int Histogram::BucketIndex(uint64_t value)
+{
+    if (value < HISTOGRAM_SUB_BUCKETS)
+    {
+        return (int) value;
+    }
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - HISTOGRAM_SUB_BUCKET_BITS;
+    return (shift + 1) * HISTOGRAM_SUB_BUCKETS + (int) ((value >> shift) & (HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+/*!
+ * Highest value that falls into bucket
+ * @param index - bucket index
+ * @return
+ * value
+ */
+uint64_t Histogram::BucketValue(int index)
+{
+    if (index < HISTOGRAM_SUB_BUCKETS)
+    {
+        return (uint64_t) index;
+    }
+    int shift = index / HISTOGRAM_SUB_BUCKETS - 1;
+    uint64_t lower = (uint64_t) (HISTOGRAM_SUB_BUCKETS + index % HISTOGRAM_SUB_BUCKETS) << shift;
+    return lower + ((uint64_t) 1 << shift) - 1;
+}
+
+/*!
+ * Record a value
+ * @param value - value to be recorded
+ */
+void Histogram::Record(uint64_t value)
+{
+    _buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = _min.load(std::memory_order_relaxed);
+    while (value < current && !_min.compare_exchange_weak(current, value, std::memory_order_relaxed));
+    current = _max.load(std::memory_order_relaxed);
+    while (value > current && !_max.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+uint64_t Histogram::Count() const
+{
+    return _count.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::Min() const
+{
+    return Count() ? _min.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t Histogram::Max() const
+{
+    return _max.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::Mean() const
+{
+    uint64_t count = Count();
+    return count ? _sum.load(std::memory_order_relaxed) / count : 0;
+}
+
+/*!
+ * Value at percentile, reported as upper bound of its bucket (capped to max)
+ * @param percentile - 0 to 100
+ * @return
+ * value
+ */
+uint64_t Histogram::Percentile(double percentile) const
+{
+    uint64_t count = Count();
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t) (percentile / 100.0 * count + 0.5);
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return MIN(BucketValue(i), Max());
+        }
+    }
+    return Max();
+}
+
+void Histogram::Reset()
+{
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        _buckets[i].store(0, std::memory_order_relaxed);
+    }
+    _count.store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+    _min.store(UINT64_MAX, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+/*!
+ * Constructor
+ */
+Gauge::Gauge() : _value(0), _max(0)
+{
+}
+
+void Gauge::Set(int64_t value)
+{
+    _value.store(value, std::memory_order_relaxed);
+    int64_t current = _max.load(std::memory_order_relaxed);
+    while (value > current && !_max.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+int64_t Gauge::Value() const
+{
+    return _value.load(std::memory_order_relaxed);
+}
+
+int64_t Gauge::Max() const
+{
+    return _max.load(std::memory_order_relaxed);
+}
+
+void Gauge::Reset()
+{
+    _value.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+/*!
+ * Constructor
+ */
+CallStats::CallStats()
+{
+    Reset();
+}
+
+/*!
+ * Record one call
+ * @param usec - latency in micro-seconds
+ * @param bytes - bytes transferred
+ * @param failed - call failed
+ * @param slow - call took longer than slow call threshold
+ */
+void CallStats::Record(uint64_t usec, uint64_t bytes, bool failed, bool slow)
+{
+    _count.fetch_add(1, std::memory_order_relaxed);
+    if (bytes)
+    {
+        _bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    if (failed)
+    {
+        _errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (slow)
+    {
+        _slow.fetch_add(1, std::memory_order_relaxed);
+    }
+    _latency.Record(usec);
+}
+
+uint64_t CallStats::Count() const
+{
+    return _count.load(std::memory_order_relaxed);
+}
+
+uint64_t CallStats::Bytes() const
+{
+    return _bytes.load(std::memory_order_relaxed);
+}
+
+uint64_t CallStats::Errors() const
+{
+    return _errors.load(std::memory_order_relaxed);
+}
+
+uint64_t CallStats::Slow() const
+{
+    return _slow.load(std::memory_order_relaxed);
+}
+
+const Histogram &CallStats::Latency() const
+{
+    return _latency;
+}
+
+void CallStats::Reset()
+{
+    _count.store(0, std::memory_order_relaxed);
+    _bytes.store(0, std::memory_order_relaxed);
+    _errors.store(0, std::memory_order_relaxed);
+    _slow.store(0, std::memory_order_relaxed);
+    _latency.Reset();
+}
+
+/*!
+ * Constructor
+ */
+Metrics::Metrics()
+{
+    Reset();
+}
+
+/*!
+ * Destructor
+ */
+Metrics::~Metrics()
+{
+    for (std::map<std::string, ShareStats *>::iterator iter = _shares.begin(); iter != _shares.end(); ++iter)
+    {
+        FREE(iter->second);
+    }
+}
+
+/*!
+ * Monotonic clock
+ * @return
+ * micro-seconds
+ */
+uint64_t Metrics::Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*!
+ * Increment counter
+ * @param op - operation
+ * @param counter - counter
+ * @param value - increment
+ */
+void Metrics::Count(MetricOp op, MetricCounter counter, uint64_t value)
+{
+    _counters[op][counter].fetch_add(value, std::memory_order_relaxed);
+}
+
+/*!
+ * Record latency
+ * @param op - operation
+ * @param latency - latency type
+ * @param usec - latency in micro-seconds
+ */
+void Metrics::Record(MetricOp op, MetricLatency latency, uint64_t usec)
+{
+    _latencies[op][latency].Record(usec);
+}
+
+/*!
+ * Record latency from start till now
+ * @param op - operation
+ * @param latency - latency type
+ * @param start - start time as returned by Now()
+ */
+void Metrics::RecordSince(MetricOp op, MetricLatency latency, uint64_t start)
+{
+    uint64_t now = Now();
+    _latencies[op][latency].Record(now > start ? now - start : 0);
+}
+
+/*!
+ * Set gauge
+ * @param gauge - gauge
+ * @param value - current value
+ */
+void Metrics::SetGauge(MetricGauge gauge, int64_t value)
+{
+    _gauges[gauge].Set(value);
+}
+
+/*!
+ * Storage call statistics of a server/share, created on first use
+ * @param name - server/share
+ * @return
+ * share statistics, valid for process lifetime
+ * NULL - METRIC_SHARES_MAX shares already tracked
+ */
+ShareStats *Metrics::Share(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(_shares_mtx);
+    std::map<std::string, ShareStats *>::iterator iter = _shares.find(name);
+    if (iter != _shares.end())
+    {
+        return iter->second;
+    }
+    if (_shares.size() >= METRIC_SHARES_MAX)
+    {
+        return NULL;
+    }
+    ShareStats *share = ALLOCATE(ShareStats);
+    if (!ALLOCATED(share))
+    {
+        return NULL;
+    }
+    share->_name = name;
+    _shares[name] = share;
+    return share;
+}
+
+/*!
+ * Record storage call
+ * @param call - storage call
+ * @param share - server/share statistics, may be NULL
+ * @param usec - latency in micro-seconds
+ * @param bytes - bytes transferred
+ * @param err - errno of failed call, 0 if successful
+ * @param slow - call took longer than slow call threshold
+ */
+void Metrics::RecordCall(MetricCall call, ShareStats *share, uint64_t usec, uint64_t bytes, int err, bool slow)
+{
+    _calls[call].Record(usec, bytes, err != 0, slow);
+    if (err != 0)
+    {
+        int index = (err > 0 && err < METRIC_ERRNO_MAX) ? err : METRIC_ERRNO_MAX - 1;
+        _call_errnos[call][index].fetch_add(1, std::memory_order_relaxed);
+    }
+    if (share)
+    {
+        share->_calls[call].Record(usec, bytes, err != 0, slow);
+    }
+}
+
+uint64_t Metrics::Counter(MetricOp op, MetricCounter counter) const
+{
+    return _counters[op][counter].load(std::memory_order_relaxed);
+}
+
+const Histogram &Metrics::Latency(MetricOp op, MetricLatency latency) const
+{
+    return _latencies[op][latency];
+}
+
+const Gauge &Metrics::GetGauge(MetricGauge gauge) const
+{
+    return _gauges[gauge];
+}
+
+const CallStats &Metrics::Call(MetricCall call) const
+{
+    return _calls[call];
+}
+
+/*!
+ * Failed calls by errno
+ * @param call - storage call
+ * @param err - errno, values from METRIC_ERRNO_MAX - 1 up share one counter
+ * @return
+ * count
+ */
+uint64_t Metrics::CallErrno(MetricCall call, int err) const
+{
+    int index = (err > 0 && err < METRIC_ERRNO_MAX) ? err : METRIC_ERRNO_MAX - 1;
+    return _call_errnos[call][index].load(std::memory_order_relaxed);
+}
+
+const char *Metrics::CallName(MetricCall call)
+{
+    return call_names[call];
+}
+
+/*!
+ * Dump metrics of one operation as JSON object
+ * @param op - operation
+ * @param out - string to append to
+ */
+void Metrics::dump_op(int op, std::string &out) const
+{
+    char buffer[MEDIUM_BUFFER_SIZE];
+
+    snprintf(buffer, sizeof(buffer), "\"%s\":{", op_names[op]);
+    out += buffer;
+    for (int counter = 0; counter < METRIC_COUNTER_MAX; counter++)
+    {
+        snprintf(buffer, sizeof(buffer), "\"%s\":%lu,", counter_names[counter],
+                 (unsigned long) Counter((MetricOp) op, (MetricCounter) counter));
+        out += buffer;
+    }
+    out += "\"latency_us\":{";
+    for (int latency = 0; latency < METRIC_LATENCY_MAX; latency++)
+    {
+        const Histogram &h = _latencies[op][latency];
+        snprintf(buffer, sizeof(buffer),
+                 "%s\"%s\":{\"count\":%lu,\"min\":%lu,\"mean\":%lu,\"p50\":%lu,\"p90\":%lu,\"p99\":%lu,"
+                 "\"p999\":%lu,\"max\":%lu}",
+                 latency ? "," : "", latency_names[latency], (unsigned long) h.Count(), (unsigned long) h.Min(),
+                 (unsigned long) h.Mean(), (unsigned long) h.Percentile(50), (unsigned long) h.Percentile(90),
+                 (unsigned long) h.Percentile(99), (unsigned long) h.Percentile(99.9), (unsigned long) h.Max());
+        out += buffer;
+    }
+    out += "}}";
+}
+
+/*!
+ * Dump storage calls that have been made as JSON members
+ * @param calls - METRIC_CALL_MAX call statistics
+ * @param out - string to append to
+ */
+void Metrics::dump_calls(const CallStats *calls, std::string &out)
+{
+    char buffer[MEDIUM_BUFFER_SIZE];
+    bool first = true;
+
+    for (int call = 0; call < METRIC_CALL_MAX; call++)
+    {
+        const CallStats &c = calls[call];
+        if (c.Count() == 0)
+        {
+            continue;
+        }
+        const Histogram &h = c.Latency();
+        snprintf(buffer, sizeof(buffer),
+                 "%s\"%s\":{\"count\":%lu,\"bytes\":%lu,\"errors\":%lu,\"slow\":%lu,"
+                 "\"latency_us\":{\"mean\":%lu,\"p50\":%lu,\"p99\":%lu,\"p999\":%lu,\"max\":%lu}}",
+                 first ? "" : ",", call_names[call], (unsigned long) c.Count(), (unsigned long) c.Bytes(),
+                 (unsigned long) c.Errors(), (unsigned long) c.Slow(), (unsigned long) h.Mean(),
+                 (unsigned long) h.Percentile(50), (unsigned long) h.Percentile(99),
+                 (unsigned long) h.Percentile(99.9), (unsigned long) h.Max());
+        out += buffer;
+        first = false;
+    }
+}
+
+/*!
+ * Dump all metrics as JSON
+ * @param out - output string
+ */
+void Metrics::Dump(std::string &out) const
+{
+    char buffer[MEDIUM_BUFFER_SIZE];
+
+    snprintf(buffer, sizeof(buffer), "{\"uptime_sec\":%lu,\"log_dropped\":%lu,\"ops\":{",
+             (unsigned long) ((Now() - _start) / 1000000), logger ? logger->Dropped() : 0UL);
+    out = buffer;
+
+    for (int op = 0; op < METRIC_OP_MAX; op++)
+    {
+        if (op)
+        {
+            out += ",";
+        }
+        dump_op(op, out);
+    }
+
+    out += "},\"gauges\":{";
+    for (int gauge = 0; gauge < METRIC_GAUGE_MAX; gauge++)
+    {
+        snprintf(buffer, sizeof(buffer), "%s\"%s\":{\"current\":%ld,\"max\":%ld}", gauge ? "," : "",
+                 gauge_names[gauge], (long) _gauges[gauge].Value(), (long) _gauges[gauge].Max());
+        out += buffer;
+    }
+
+    out += "},\"storage_calls\":{";
+    dump_calls(_calls, out);
+
+    out += "},\"storage_errnos\":{";
+    bool first = true;
+    for (int call = 0; call < METRIC_CALL_MAX; call++)
+    {
+        for (int err = 1; err < METRIC_ERRNO_MAX; err++)
+        {
+            uint64_t count = _call_errnos[call][err].load(std::memory_order_relaxed);
+            if (count == 0)
+            {
+                continue;
+            }
+            snprintf(buffer, sizeof(buffer), "%s\"%s:%d\":%lu", first ? "" : ",", call_names[call], err,
+                     (unsigned long) count);
+            out += buffer;
+            first = false;
+        }
+    }
+
+    out += "},\"storage_shares\":{";
+    std::lock_guard<std::mutex> lock(_shares_mtx);
+    first = true;
+    for (std::map<std::string, ShareStats *>::const_iterator iter = _shares.begin(); iter != _shares.end(); ++iter)
+    {
+        out += first ? "\"" : ",\"";
+        for (size_t i = 0; i < iter->first.length(); i++)
+        {
+            char ch = iter->first[i];
+            if (ch == '"' || ch == '\\')
+            {
+                out += '\\';
+            }
+            if ((unsigned char) ch >= 0x20)
+            {
+                out += ch;
+            }
+        }
+        out += "\":{";
+        dump_calls(iter->second->_calls, out);
+        out += "}";
+        first = false;
+    }
+    out += "}}";
+}
+
+/*!
+ * Write metrics to the log, one line per operation that has seen requests
+ * (a complete dump does not fit in a single log line)
+ */
+void Metrics::LogDump() const
+{
+    ALWAYS_LOG("Metrics uptime %lu sec, request queue %ld (max %ld), response queue %ld (max %ld)",
+               (unsigned long) ((Now() - _start) / 1000000),
+               (long) _gauges[METRIC_GAUGE_REQUEST_QUEUE].Value(), (long) _gauges[METRIC_GAUGE_REQUEST_QUEUE].Max(),
+               (long) _gauges[METRIC_GAUGE_RESPONSE_QUEUE].Value(),
+               (long) _gauges[METRIC_GAUGE_RESPONSE_QUEUE].Max());
+
+    for (int op = 0; op < METRIC_OP_MAX; op++)
+    {
+        if (Counter((MetricOp) op, METRIC_REQUESTS) == 0)
+        {
+            continue;
+        }
+        ALWAYS_LOG("Metrics %s requests %lu bytes %lu chunks %lu errors %lu cache hits %lu misses %lu", op_names[op],
+                   (unsigned long) Counter((MetricOp) op, METRIC_REQUESTS),
+                   (unsigned long) Counter((MetricOp) op, METRIC_BYTES),
+                   (unsigned long) Counter((MetricOp) op, METRIC_CHUNKS),
+                   (unsigned long) Counter((MetricOp) op, METRIC_ERRORS),
+                   (unsigned long) Counter((MetricOp) op, METRIC_CACHE_HITS),
+                   (unsigned long) Counter((MetricOp) op, METRIC_CACHE_MISSES));
+        for (int latency = 0; latency < METRIC_LATENCY_MAX; latency++)
+        {
+            const Histogram &h = _latencies[op][latency];
+            if (h.Count() == 0)
+            {
+                continue;
+            }
+            ALWAYS_LOG("Metrics %s %s latency(us) count %lu min %lu mean %lu p50 %lu p90 %lu p99 %lu p999 %lu max %lu",
+                       op_names[op], latency_names[latency], (unsigned long) h.Count(), (unsigned long) h.Min(),
+                       (unsigned long) h.Mean(), (unsigned long) h.Percentile(50), (unsigned long) h.Percentile(90),
+                       (unsigned long) h.Percentile(99), (unsigned long) h.Percentile(99.9),
+                       (unsigned long) h.Max());
+        }
+    }
+
+    for (int call = 0; call < METRIC_CALL_MAX; call++)
+    {
+        const CallStats &c = _calls[call];
+        if (c.Count() == 0)
+        {
+            continue;
+        }
+        const Histogram &h = c.Latency();
+        ALWAYS_LOG("Metrics storage %s calls %lu bytes %lu errors %lu slow %lu latency(us) mean %lu p50 %lu p99 %lu "
+                   "max %lu", call_names[call], (unsigned long) c.Count(), (unsigned long) c.Bytes(),
+                   (unsigned long) c.Errors(), (unsigned long) c.Slow(), (unsigned long) h.Mean(),
+                   (unsigned long) h.Percentile(50), (unsigned long) h.Percentile(99), (unsigned long) h.Max());
+    }
+
+    std::lock_guard<std::mutex> lock(_shares_mtx);
+    for (std::map<std::string, ShareStats *>::const_iterator iter = _shares.begin(); iter != _shares.end(); ++iter)
+    {
+        for (int call = 0; call < METRIC_CALL_MAX; call++)
+        {
+            const CallStats &c = iter->second->_calls[call];
+            if (c.Count() == 0)
+            {
+                continue;
+            }
+            ALWAYS_LOG("Metrics storage %s %s calls %lu errors %lu slow %lu latency(us) mean %lu p99 %lu max %lu",
+                       iter->first.c_str(), call_names[call], (unsigned long) c.Count(), (unsigned long) c.Errors(),
+                       (unsigned long) c.Slow(), (unsigned long) c.Latency().Mean(),
+                       (unsigned long) c.Latency().Percentile(99), (unsigned long) c.Latency().Max());
+        }
+    }
+}
+
+/*!
+ * Reset all metrics
+ */
+void Metrics::Reset()
+{
+    for (int op = 0; op < METRIC_OP_MAX; op++)
+    {
+        for (int counter = 0; counter < METRIC_COUNTER_MAX; counter++)
+        {
+            _counters[op][counter].store(0, std::memory_order_relaxed);
+        }
+        for (int latency = 0; latency < METRIC_LATENCY_MAX; latency++)
+        {
+            _latencies[op][latency].Reset();
+        }
+    }
+    for (int gauge = 0; gauge < METRIC_GAUGE_MAX; gauge++)
+    {
+        _gauges[gauge].Reset();
+    }
+    for (int call = 0; call < METRIC_CALL_MAX; call++)
+    {
+        _calls[call].Reset();
+        for (int err = 0; err < METRIC_ERRNO_MAX; err++)
+        {
+            _call_errnos[call][err].store(0, std::memory_order_relaxed);
+        }
+    }
+    {
+        /* shares are kept, open handles refer to them */
+        std::lock_guard<std::mutex> lock(_shares_mtx);
+        for (std::map<std::string, ShareStats *>::iterator iter = _shares.begin(); iter != _shares.end(); ++iter)
+        {
+            for (int call = 0; call < METRIC_CALL_MAX; call++)
+            {
+                iter->second->_calls[call].Reset();
+            }
+        }
+    }
+    _start = Now();
+}
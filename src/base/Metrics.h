@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+
+#include "base/Common.h"
+
+/* Histogram precision, 2^HISTOGRAM_SUB_BUCKET_BITS sub-buckets per power of 2 (~12.5% error) */
+#define HISTOGRAM_SUB_BUCKET_BITS   3
+#define HISTOGRAM_SUB_BUCKETS       (1 << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_BUCKETS           ((64 - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKETS)
+
+/* errno values counted per storage call, larger values share the last slot */
+#define METRIC_ERRNO_MAX            136
+
+/* Servers/shares storage calls are kept for, calls to further shares are only counted in totals */
+#define METRIC_SHARES_MAX           64
+
+/* Operations metrics are kept for */
+enum MetricOp
+{
+    METRIC_OP_LIST_DIR,
+    METRIC_OP_DOWNLOAD,
+    METRIC_OP_UPLOAD,
+    METRIC_OP_ADD_FOLDER,
+    METRIC_OP_DELETE,
+    METRIC_OP_TEST_CONNECTION,
+    METRIC_OP_BATCH_STAT,
+    METRIC_OP_COPY,
+    METRIC_OP_MOVE,
+    METRIC_OP_MAX
+};
+
+enum MetricCounter
+{
+    METRIC_REQUESTS,
+    METRIC_BYTES,
+    METRIC_CHUNKS,
+    METRIC_ERRORS,
+    METRIC_CACHE_HITS,
+    METRIC_CACHE_MISSES,
+    METRIC_COUNTER_MAX
+};
+
+/* Latencies are recorded in micro-seconds */
+enum MetricLatency
+{
+    METRIC_LAT_OPEN,        //open file/directory on SMB server
+    METRIC_LAT_FIRST_BYTE,  //request received till first data chunk queued
+    METRIC_LAT_CHUNK,       //single read/write on SMB server
+    METRIC_LAT_TOTAL,       //complete operation
+    METRIC_LATENCY_MAX
+};
+
+enum MetricGauge
+{
+    METRIC_GAUGE_REQUEST_QUEUE,
+    METRIC_GAUGE_RESPONSE_QUEUE,
+    METRIC_GAUGE_MAX
+};
+
+/* Storage backend (libsmbclient) calls */
+enum MetricCall
+{
+    METRIC_CALL_OPEN,
+    METRIC_CALL_READ,
+    METRIC_CALL_WRITE,
+    METRIC_CALL_LSEEK,
+    METRIC_CALL_FSTAT,
+    METRIC_CALL_CLOSE,
+    METRIC_CALL_OPENDIR,
+    METRIC_CALL_READDIR,
+    METRIC_CALL_READDIRPLUS,
+    METRIC_CALL_CLOSEDIR,
+    METRIC_CALL_STAT,
+    METRIC_CALL_MKDIR,
+    METRIC_CALL_UNLINK,
+    METRIC_CALL_RENAME,
+    METRIC_CALL_RMDIR,
+    METRIC_CALL_SPLICE,
+    METRIC_CALL_MAX
+};
+
+/*
+ * Lock-free log-linear histogram (HDR style)
+ */
+class Histogram
+{
+private:
+    std::atomic<uint64_t> _buckets[HISTOGRAM_BUCKETS];
+    std::atomic<uint64_t> _count;
+    std::atomic<uint64_t> _sum;
+    std::atomic<uint64_t> _min;
+    std::atomic<uint64_t> _max;
+
+public:
+    Histogram();
+
+    static int BucketIndex(uint64_t value);
+    static uint64_t BucketValue(int index);
+
+    void Record(uint64_t value);
+    uint64_t Count() const;
+    uint64_t Min() const;
+    uint64_t Max() const;
+    uint64_t Mean() const;
+    uint64_t Percentile(double percentile) const;
+    void Reset();
+};
+
+/*
+ * Gauge with current and high-water mark
+ */
+class Gauge
+{
+private:
+    std::atomic<int64_t> _value;
+    std::atomic<int64_t> _max;
+
+public:
+    Gauge();
+
+    void Set(int64_t value);
+    int64_t Value() const;
+    int64_t Max() const;
+    void Reset();
+};
+
+/*
+ * Count, bytes, failures, slow calls and latency of one storage call
+ */
+class CallStats
+{
+private:
+    std::atomic<uint64_t> _count;
+    std::atomic<uint64_t> _bytes;
+    std::atomic<uint64_t> _errors;
+    std::atomic<uint64_t> _slow;
+    Histogram _latency;
+
+public:
+    CallStats();
+
+    void Record(uint64_t usec, uint64_t bytes, bool failed, bool slow);
+    uint64_t Count() const;
+    uint64_t Bytes() const;
+    uint64_t Errors() const;
+    uint64_t Slow() const;
+    const Histogram &Latency() const;
+    void Reset();
+};
+
+/*
+ * Storage calls of one server/share
+ */
+struct ShareStats
+{
+    std::string _name;
+    CallStats _calls[METRIC_CALL_MAX];
+};
+
+/*
+ * Process wide transfer metrics
+ */
+class Metrics
+{
+private:
+    static Metrics instance;
+
+    std::atomic<uint64_t> _counters[METRIC_OP_MAX][METRIC_COUNTER_MAX];
+    Histogram _latencies[METRIC_OP_MAX][METRIC_LATENCY_MAX];
+    Gauge _gauges[METRIC_GAUGE_MAX];
+    CallStats _calls[METRIC_CALL_MAX];
+    std::atomic<uint64_t> _call_errnos[METRIC_CALL_MAX][METRIC_ERRNO_MAX];
+    std::map<std::string, ShareStats *> _shares;
+    mutable std::mutex _shares_mtx;
+    uint64_t _start;
+
+    Metrics();
+    ~Metrics();
+    Metrics(Metrics &instance);
+    Metrics &operator=(Metrics &instance);
+
+    void dump_op(int op, std::string &out) const;
+    static void dump_calls(const CallStats *calls, std::string &out);
+
+public:
+    static Metrics &GetInstance()
+    {
+        return instance;
+    }
+
+    static uint64_t Now();
+
+    void Count(MetricOp op, MetricCounter counter, uint64_t value = 1);
+    void Record(MetricOp op, MetricLatency latency, uint64_t usec);
+    void RecordSince(MetricOp op, MetricLatency latency, uint64_t start);
+    void SetGauge(MetricGauge gauge, int64_t value);
+    ShareStats *Share(const std::string &name);
+    void RecordCall(MetricCall call, ShareStats *share, uint64_t usec, uint64_t bytes, int err, bool slow);
+
+    uint64_t Counter(MetricOp op, MetricCounter counter) const;
+    const Histogram &Latency(MetricOp op, MetricLatency latency) const;
+    const Gauge &GetGauge(MetricGauge gauge) const;
+    const CallStats &Call(MetricCall call) const;
+    uint64_t CallErrno(MetricCall call, int err) const;
+    static const char *CallName(MetricCall call);
+
+    void Dump(std::string &out) const;
+    void LogDump() const;
+    void Reset();
+};
+
+#endif //METRICS_H_
@@ -64,6 +64,8 @@ const char *ProtocolCommand(int c)
             return "DELETE_INIT_RESP";
         case DELETE_ERROR_RESP:
             return "DELETE_ERROR_RESP";
+        case DELETE_PROGRESS_RESP:
+            return "DELETE_PROGRESS_RESP";
 
         case TEST_CONNECTION_INIT_REQ:
             return "TEST_CONNECTION_INIT_REQ";
@@ -72,6 +74,40 @@ const char *ProtocolCommand(int c)
         case TEST_CONNECTION_ERROR_RESP:
             return "TEST_CONNECTION_ERROR_RESP";
 
+        case STATS_REQ:
+            return "STATS_REQ";
+        case STATS_RESP:
+            return "STATS_RESP";
+        case STATS_ERROR_RESP:
+            return "STATS_ERROR_RESP";
+
+        case BATCH_STAT_REQ:
+            return "BATCH_STAT_REQ";
+        case BATCH_STAT_RESP:
+            return "BATCH_STAT_RESP";
+        case BATCH_STAT_END_RESP:
+            return "BATCH_STAT_END_RESP";
+        case BATCH_STAT_ERROR_RESP:
+            return "BATCH_STAT_ERROR_RESP";
+
+        case COPY_REQ:
+            return "COPY_REQ";
+        case COPY_RESP:
+            return "COPY_RESP";
+        case COPY_ERROR_RESP:
+            return "COPY_ERROR_RESP";
+        case COPY_PROGRESS_RESP:
+            return "COPY_PROGRESS_RESP";
+
+        case MOVE_REQ:
+            return "MOVE_REQ";
+        case MOVE_RESP:
+            return "MOVE_RESP";
+        case MOVE_ERROR_RESP:
+            return "MOVE_ERROR_RESP";
+        case MOVE_PROGRESS_RESP:
+            return "MOVE_PROGRESS_RESP";
+
         default:
             return "INVALID_COMMAND";
     }
@@ -43,6 +43,26 @@
 #define DELETE_INIT_REQ             51
 #define DELETE_INIT_RESP            52
 #define DELETE_ERROR_RESP           53
+#define DELETE_PROGRESS_RESP        54
+
+#define STATS_REQ                   61
+#define STATS_RESP                  62
+#define STATS_ERROR_RESP            63
+
+#define BATCH_STAT_REQ              71
+#define BATCH_STAT_RESP             72
+#define BATCH_STAT_END_RESP         73
+#define BATCH_STAT_ERROR_RESP       74
+
+#define COPY_REQ                    81
+#define COPY_RESP                   82
+#define COPY_ERROR_RESP             83
+#define COPY_PROGRESS_RESP          84
+
+#define MOVE_REQ                    91
+#define MOVE_RESP                   92
+#define MOVE_ERROR_RESP             93
+#define MOVE_PROGRESS_RESP          94
 
 const char *ProtocolCommand(int c);
 #endif //PROTOCOL_H_
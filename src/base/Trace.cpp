@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include "Trace.h"
+#include "base/Error.h"
+#include "base/Log.h"
+#include "processor/RequestProcessor.h"
+
+Tracer Tracer::instance;
+std::atomic<bool> Tracer::enabled(false);
+
+static thread_local pid_t trace_tid = (pid_t) syscall(SYS_gettid);
+
+/*!
+ * Append string to JSON output with quotes and escaping
+ * @param out - string to append to
+ * @param value - value to be escaped
+ */
+static void append_json_string(std::string &out, const char *value)
+{
+    out += '"';
+    for (const char *p = value; *p; p++)
+    {
+        if (*p == '"' || *p == '\\')
+        {
+            out += '\\';
+            out += *p;
+        }
+        else if ((unsigned char) *p < 0x20)
+        {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned char) *p);
+            out += buffer;
+        }
+        else
+        {
+            out += *p;
+        }
+    }
+    out += '"';
+}
+
+/*!
+ * Constructor
+ */
+Tracer::Tracer()
+{
+    Reset();
+}
+
+/*!
+ * Initialise tracer
+ * @param enable - record spans
+ * @param dir - directory trace files are written to, created if missing
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int Tracer::Init(bool enable, const std::string &dir)
+{
+    _dir = dir;
+    if (enable && mkdir(_dir.c_str(), 00755) != 0 && errno != EEXIST)
+    {
+        ERROR_LOG("Tracer::Init unable to create %s, errno %d", _dir.c_str(), errno);
+        return SMB_ERROR;
+    }
+    SetEnabled(enable);
+    return SMB_SUCCESS;
+}
+
+void Tracer::SetEnabled(bool enable)
+{
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+/*!
+ * Record a completed span for current thread and request
+ * @param name - span name, must outlive the tracer (string literal)
+ * @param start - start time as returned by Metrics::Now()
+ * @param duration - micro-seconds
+ * @param bytes - bytes transferred, -1 if not applicable
+ */
+void Tracer::Record(const char *name, uint64_t start, uint64_t duration, int64_t bytes)
+{
+    uint64_t position = _next.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent &event = _events[position & (TRACE_RING_SIZE - 1)];
+
+    event._seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    event._name = name;
+    event._tid = trace_tid;
+    event._start = start;
+    event._duration = duration;
+    event._bytes = bytes;
+    RequestProcessor::CurrentRequestId(event._request_id, sizeof(event._request_id));
+
+    event._seq.store(position + 1, std::memory_order_release);
+}
+
+/*!
+ * Dump buffered spans as Chrome trace event JSON
+ * Spans being written while dumping are skipped.
+ * @param out - output string
+ * @param request_id - only spans of this request, all if NULL
+ * @return
+ * number of spans written
+ */
+size_t Tracer::Dump(std::string &out, const char *request_id) const
+{
+    char buffer[MEDIUM_BUFFER_SIZE];
+    size_t count = 0;
+    int pid = getpid();
+
+    snprintf(buffer, sizeof(buffer), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"smbconnector\"}}", pid);
+    out = buffer;
+
+    for (int i = 0; i < TRACE_RING_SIZE; i++)
+    {
+        const TraceEvent &event = _events[i];
+        uint64_t seq = event._seq.load(std::memory_order_acquire);
+        if (seq == 0)
+        {
+            continue;
+        }
+
+        TraceEvent copy;
+        copy._name = event._name;
+        copy._tid = event._tid;
+        copy._start = event._start;
+        copy._duration = event._duration;
+        copy._bytes = event._bytes;
+        memcpy(copy._request_id, event._request_id, sizeof(copy._request_id));
+        copy._request_id[sizeof(copy._request_id) - 1] = '\0';
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event._seq.load(std::memory_order_relaxed) != seq)
+        {
+            continue; //overwritten while copying
+        }
+        if (request_id && strcmp(request_id, copy._request_id) != 0)
+        {
+            continue;
+        }
+
+        snprintf(buffer, sizeof(buffer), ",{\"name\":\"%s\",\"cat\":\"smb\",\"ph\":\"X\",\"ts\":%lu,\"dur\":%lu,"
+            "\"pid\":%d,\"tid\":%d,\"args\":{\"requestId\":", copy._name, (unsigned long) copy._start,
+                 (unsigned long) copy._duration, pid, (int) copy._tid);
+        out += buffer;
+        append_json_string(out, copy._request_id);
+        if (copy._bytes >= 0)
+        {
+            snprintf(buffer, sizeof(buffer), ",\"bytes\":%ld", (long) copy._bytes);
+            out += buffer;
+        }
+        out += "}}";
+        count++;
+    }
+    out += "]}";
+    return count;
+}
+
+/*!
+ * Write buffered spans to trace directory, trace_<request-id>.json for a request,
+ * trace_<pid>_<time>.json for all spans. Nothing is written if there are no spans.
+ * @param request_id - only spans of this request, all if NULL
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int Tracer::Write(const char *request_id) const
+{
+    std::string out;
+    if (Dump(out, request_id) == 0)
+    {
+        return SMB_SUCCESS;
+    }
+
+    std::string path = _dir + "/trace_";
+    if (request_id)
+    {
+        for (const char *p = request_id; *p; p++)
+        {
+            path += (isalnum((unsigned char) *p) || *p == '-' || *p == '_') ? *p : '_';
+        }
+    }
+    else
+    {
+        char buffer[SHORT_BUFFER_SIZE];
+        snprintf(buffer, sizeof(buffer), "%d_%lu", getpid(), (unsigned long) Metrics::Now());
+        path += buffer;
+    }
+    path += ".json";
+
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == NULL)
+    {
+        ERROR_LOG("Tracer::Write unable to open %s, errno %d", path.c_str(), errno);
+        return SMB_ERROR;
+    }
+    size_t written = fwrite(out.data(), 1, out.size(), file);
+    fclose(file);
+    if (written != out.size())
+    {
+        ERROR_LOG("Tracer::Write short write to %s", path.c_str());
+        return SMB_ERROR;
+    }
+    DEBUG_LOG("Tracer::Write trace written to %s", path.c_str());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Drop all buffered spans
+ */
+void Tracer::Reset()
+{
+    for (int i = 0; i < TRACE_RING_SIZE; i++)
+    {
+        _events[i]._seq.store(0, std::memory_order_relaxed);
+    }
+    _next.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+
+#include "base/Common.h"
+#include "base/Constants.h"
+#include "base/Metrics.h"
+
+/* Number of spans kept in memory, power of 2, oldest are overwritten */
+#define TRACE_RING_SIZE     (1 << 14)
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b)  TRACE_CONCAT_(a, b)
+
+/*
+ * Time the enclosing scope, name must be a string literal
+ */
+#define TRACE_SPAN(name)    TraceSpan TRACE_CONCAT(trace_span_, __LINE__)(name)
+
+/*
+ * One completed span
+ * _seq is 0 while the slot is being written, otherwise ring position + 1
+ */
+struct TraceEvent
+{
+    std::atomic<uint64_t> _seq;
+    const char *_name;
+    char _request_id[IDENT_BUFFER_SIZE];
+    pid_t _tid;
+    uint64_t _start;    //micro-seconds, Metrics::Now()
+    uint64_t _duration; //micro-seconds
+    int64_t _bytes;     //bytes transferred, -1 if not applicable
+};
+
+/*
+ * Process wide span recorder, lock-free ring of the last TRACE_RING_SIZE spans.
+ * Spans are exported as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev).
+ */
+class Tracer
+{
+private:
+    static Tracer instance;
+    static std::atomic<bool> enabled;
+
+    TraceEvent _events[TRACE_RING_SIZE];
+    std::atomic<uint64_t> _next;
+    std::string _dir;
+
+    Tracer();
+    Tracer(Tracer &instance);
+    Tracer &operator=(Tracer &instance);
+
+public:
+    static Tracer &GetInstance()
+    {
+        return instance;
+    }
+
+    /*!
+     * Checked before a span is started, the only cost when tracing is off
+     */
+    static bool Enabled()
+    {
+        return __builtin_expect(enabled.load(std::memory_order_relaxed), 0);
+    }
+
+    int Init(bool enable, const std::string &dir);
+    void SetEnabled(bool enable);
+
+    void Record(const char *name, uint64_t start, uint64_t duration, int64_t bytes = -1);
+    size_t Dump(std::string &out, const char *request_id = NULL) const;
+    int Write(const char *request_id = NULL) const;
+    void Reset();
+};
+
+/*
+ * RAII span, records from construction till destruction when tracing is on
+ */
+class TraceSpan
+{
+private:
+    const char *_name;
+    uint64_t _start;
+    int64_t _bytes;
+
+    TraceSpan(TraceSpan &span);
+    TraceSpan &operator=(TraceSpan &span);
+
+public:
+    explicit TraceSpan(const char *name) : _name(NULL), _start(0), _bytes(-1)
+    {
+        if (Tracer::Enabled())
+        {
+            _name = name;
+            _start = Metrics::Now();
+        }
+    }
+
+    ~TraceSpan()
+    {
+        if (_name)
+        {
+            Tracer::GetInstance().Record(_name, _start, Metrics::Now() - _start, _bytes);
+        }
+    }
+
+    void SetBytes(int64_t bytes)
+    {
+        _bytes = bytes;
+    }
+};
+
+#endif //TRACE_H_
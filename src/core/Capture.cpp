@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <sys/stat.h>
+
+#include "Capture.h"
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Metrics.h"
+
+#define FNV_OFFSET_BASIS    14695981039346656037ULL
+#define FNV_PRIME           1099511628211ULL
+
+Capture Capture::instance;
+std::atomic<bool> Capture::enabled(false);
+
+/*!
+ * Constructor
+ */
+Capture::Capture() : _file(NULL), _data_mode(CAPTURE_DATA_ELIDE), _session(0), _in_session(false), _start(0)
+{
+}
+
+/*!
+ * Start capturing into a new file in dir
+ * @param enable - capture sessions
+ * @param dir - directory for capture files, created if missing
+ * @param data_mode - CaptureDataMode
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int Capture::Init(bool enable, const std::string &dir, int data_mode)
+{
+    if (!enable)
+    {
+        return SMB_SUCCESS;
+    }
+    if (mkdir(dir.c_str(), 00755) != 0 && errno != EEXIST)
+    {
+        ERROR_LOG("Capture::Init unable to create %s, errno %d", dir.c_str(), errno);
+        return SMB_ERROR;
+    }
+    char name[SHORT_BUFFER_SIZE];
+    snprintf(name, sizeof(name), "/capture_%d_%lu" CAPTURE_FILE_EXT, getpid(), (unsigned long) time(NULL));
+    return Open(dir + name, data_mode);
+}
+
+/*!
+ * Start capturing into file
+ * @param path - capture file, truncated
+ * @param data_mode - CaptureDataMode
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int Capture::Open(const std::string &path, int data_mode)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_file != NULL)
+    {
+        fclose(_file);
+    }
+    _file = fopen(path.c_str(), "wb");
+    if (_file == NULL)
+    {
+        ERROR_LOG("Capture::Open unable to open %s, errno %d", path.c_str(), errno);
+        enabled.store(false, std::memory_order_relaxed);
+        return SMB_ERROR;
+    }
+
+    CaptureFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    header.version = CAPTURE_VERSION;
+    header.data_mode = data_mode;
+    fwrite(&header, sizeof(header), 1, _file);
+
+    _data_mode = data_mode;
+    _session = 0;
+    _in_session = false;
+    _start = Metrics::Now();
+    enabled.store(true, std::memory_order_relaxed);
+    INFO_LOG("Capture::Open capturing sessions to %s", path.c_str());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Stop capturing, close file
+ */
+void Capture::Quit()
+{
+    EndSession();
+    std::lock_guard<std::mutex> lock(_mtx);
+    enabled.store(false, std::memory_order_relaxed);
+    if (_file != NULL)
+    {
+        fclose(_file);
+        _file = NULL;
+    }
+}
+
+/*!
+ * FNV-1a hash of data
+ * @param data - data
+ * @param len - length
+ * @return
+ * hash
+ */
+uint64_t Capture::Hash(const char *data, size_t len)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= (unsigned char) data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/*!
+ * Append record
+ * @param type - CaptureRecordType
+ * @param timestamp - Metrics::Now() of event
+ * @param msg - message, NULL for session begin/end
+ * @param data_len - upload/download data bytes
+ * @param data_hash - hash of data (CAPTURE_DATA_HASH)
+ * @param frame_len - payload length of frame
+ */
+void Capture::write_record(int type, uint64_t timestamp, const Message *msg, uint64_t data_len, uint64_t data_hash,
+                           uint32_t frame_len)
+{
+    std::string serialized;
+    if (msg != NULL)
+    {
+        msg->SerializeToString(&serialized);
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_file == NULL)
+    {
+        return;
+    }
+    CaptureRecordHeader header;
+    memset(&header, 0, sizeof(header));
+    header.type = type;
+    header.data_mode = _data_mode;
+    header.session = _session;
+    header.timestamp = timestamp > _start ? timestamp - _start : 0;
+    header.data_len = data_len;
+    header.data_hash = data_hash;
+    header.frame_len = frame_len;
+    header.msg_len = serialized.size();
+    if (fwrite(&header, sizeof(header), 1, _file) != 1
+        || (header.msg_len && fwrite(serialized.data(), header.msg_len, 1, _file) != 1))
+    {
+        ERROR_LOG("Capture::write_record write failed, errno %d, capture stopped", errno);
+        fclose(_file);
+        _file = NULL;
+        enabled.store(false, std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * Record frame, password is redacted and data handled as per data mode.
+ * Message is modified while being written and restored afterwards.
+ * @param type - CAPTURE_INBOUND or CAPTURE_OUTBOUND
+ * @param packet - frame with parsed/created message
+ * @param timestamp - Metrics::Now() of event
+ */
+void Capture::write_frame(int type, Packet *packet, uint64_t timestamp)
+{
+    Message *msg = packet->_pb_msg;
+    if (msg == NULL)
+    {
+        return;
+    }
+
+    /* upload data stays in _data (_payload), download data is in the message */
+    std::string *field = NULL;
+    if (msg->has_responsepacket() && msg->responsepacket().has_downloaddataresponse())
+    {
+        field = msg->mutable_responsepacket()->mutable_downloaddataresponse()->mutable_data();
+    }
+    else if (msg->has_requestpacket() && msg->requestpacket().has_uploadrequestdata())
+    {
+        field = msg->mutable_requestpacket()->mutable_uploadrequestdata()->mutable_data();
+    }
+
+    std::string data;
+    const char *bytes = NULL;
+    size_t len = 0;
+    if (field != NULL)
+    {
+        field->swap(data);
+        bytes = packet->_payload ? packet->_payload : data.data();
+        len = packet->_payload ? packet->_payload_len : data.size();
+        if (_data_mode == CAPTURE_DATA_FULL)
+        {
+            field->assign(bytes, len);
+        }
+    }
+
+    std::string password;
+    SmbDetails *details = NULL;
+    if (msg->has_requestpacket() && msg->requestpacket().has_smbdetails())
+    {
+        details = msg->mutable_requestpacket()->mutable_smbdetails();
+        details->mutable_password()->swap(password);
+        details->set_password(CAPTURE_REDACTED);
+    }
+
+    write_record(type, timestamp, msg, len, (_data_mode == CAPTURE_DATA_HASH) ? Hash(bytes, len) : 0,
+                 packet->GetLength());
+
+    if (details != NULL)
+    {
+        details->mutable_password()->swap(password);
+    }
+    if (field != NULL)
+    {
+        field->clear();
+        field->swap(data);
+    }
+}
+
+/*!
+ * New client connection
+ */
+void Capture::BeginSession()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _session++;
+        _in_session = true;
+    }
+    write_record(CAPTURE_SESSION_BEGIN, Metrics::Now(), NULL, 0, 0, 0);
+}
+
+/*!
+ * Client connection closed, flushes the file
+ */
+void Capture::EndSession()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (!_in_session)
+        {
+            return;
+        }
+        _in_session = false;
+    }
+    write_record(CAPTURE_SESSION_END, Metrics::Now(), NULL, 0, 0, 0);
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_file != NULL)
+    {
+        fflush(_file);
+    }
+}
+
+/*!
+ * Record request frame, called once parsed
+ * @param packet - request
+ */
+void Capture::Inbound(Packet *packet)
+{
+    write_frame(CAPTURE_INBOUND, packet, packet->_timestamp ? packet->_timestamp : Metrics::Now());
+}
+
+/*!
+ * Record response frame, called once completely sent
+ * @param packet - response
+ */
+void Capture::Outbound(Packet *packet)
+{
+    write_frame(CAPTURE_OUTBOUND, packet, Metrics::Now());
+}
+
+/*!
+ * Read capture file
+ * @param path - capture file
+ * @param records - records in file order (out), owned by caller
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int Capture::Read(const std::string &path, std::vector<CaptureRecord *> &records)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == NULL)
+    {
+        return SMB_OPEN_FAILED;
+    }
+
+    CaptureFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC))
+        || header.version != CAPTURE_VERSION)
+    {
+        fclose(file);
+        return SMB_ERROR;
+    }
+
+    int ret = SMB_SUCCESS;
+    std::string buffer;
+    while (true)
+    {
+        CaptureRecordHeader record_header;
+        size_t read = fread(&record_header, sizeof(record_header), 1, file);
+        if (read != 1)
+        {
+            ret = feof(file) ? SMB_SUCCESS : SMB_ERROR;
+            break;
+        }
+        buffer.resize(record_header.msg_len);
+        if (record_header.msg_len && fread(&buffer[0], record_header.msg_len, 1, file) != 1)
+        {
+            /* truncated by a connector that did not exit cleanly, keep what was read */
+            break;
+        }
+        CaptureRecord *record = ALLOCATE(CaptureRecord);
+        if (!ALLOCATED(record))
+        {
+            ret = SMB_ALLOCATION_FAILED;
+            break;
+        }
+        record->_header = record_header;
+        if (record_header.msg_len && !record->_msg.ParseFromString(buffer))
+        {
+            FREE(record);
+            ret = SMB_ERROR;
+            break;
+        }
+        records.push_back(record);
+    }
+    fclose(file);
+    return ret;
+}
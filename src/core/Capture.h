@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "packet/Packet.h"
+
+/*
+ * Capture file: header followed by records, host byte order.
+ * Record: CaptureRecordHeader followed by msg_len bytes of serialized Message
+ * (password redacted, data bytes handled as per data mode).
+ */
+#define CAPTURE_MAGIC       "SMBCCAP"
+#define CAPTURE_MAGIC_SIZE  8
+#define CAPTURE_VERSION     1
+#define CAPTURE_REDACTED    "REDACTED"
+#define CAPTURE_FILE_EXT    ".smbcap"
+
+enum CaptureRecordType
+{
+    CAPTURE_SESSION_BEGIN = 1,
+    CAPTURE_INBOUND,            //frame received from client
+    CAPTURE_OUTBOUND,           //frame sent to client
+    CAPTURE_SESSION_END
+};
+
+/* What is kept of upload/download data */
+enum CaptureDataMode
+{
+    CAPTURE_DATA_ELIDE = 0,     //length only
+    CAPTURE_DATA_HASH,          //length and FNV-1a hash
+    CAPTURE_DATA_FULL           //data
+};
+
+struct CaptureFileHeader
+{
+    char magic[CAPTURE_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t data_mode;
+};
+
+struct CaptureRecordHeader
+{
+    uint8_t type;
+    uint8_t data_mode;
+    uint16_t reserved;
+    uint32_t session;
+    uint64_t timestamp;     //micro-seconds since capture start
+    uint64_t data_len;      //upload/download data bytes in frame
+    uint64_t data_hash;     //CAPTURE_DATA_HASH only
+    uint32_t frame_len;     //original payload length from frame header
+    uint32_t msg_len;
+};
+
+/*
+ * Record read back from a capture file
+ */
+struct CaptureRecord
+{
+    CaptureRecordHeader _header;
+    Message _msg;
+};
+
+/*
+ * Records every frame of every session served by the connector
+ * to capture_dir/capture_<pid>_<time>.smbcap
+ */
+class Capture
+{
+private:
+    static Capture instance;
+    static std::atomic<bool> enabled;
+
+    FILE *_file;
+    std::mutex _mtx;
+    int _data_mode;
+    uint32_t _session;
+    bool _in_session;
+    uint64_t _start;
+
+    Capture();
+    Capture(Capture &instance);
+    Capture &operator=(Capture &instance);
+
+    void write_record(int type, uint64_t timestamp, const Message *msg, uint64_t data_len, uint64_t data_hash,
+                      uint32_t frame_len);
+    void write_frame(int type, Packet *packet, uint64_t timestamp);
+
+public:
+    static Capture &GetInstance()
+    {
+        return instance;
+    }
+
+    static bool Enabled()
+    {
+        return __builtin_expect(enabled.load(std::memory_order_relaxed), 0);
+    }
+
+    int Init(bool enable, const std::string &dir, int data_mode);
+    int Open(const std::string &path, int data_mode);
+    void Quit();
+
+    void BeginSession();
+    void EndSession();
+    void Inbound(Packet *packet);
+    void Outbound(Packet *packet);
+
+    static uint64_t Hash(const char *data, size_t len);
+    static int Read(const std::string &path, std::vector<CaptureRecord *> &records);
+};
+
+#endif //CAPTURE_H_
@@ -16,6 +16,9 @@
 #include "processor/AddFolderProcessor.h"
 #include "processor/DeleteProcessor.h"
 #include "processor/TestConnection.h"
+#include "processor/StatsProcessor.h"
+#include "processor/BatchStatProcessor.h"
+#include "processor/CopyProcessor.h"
 
 #define MAX_LEN 1000
 
@@ -25,6 +28,46 @@
 #define ADD_FOLDER  4
 #define DEL         5
 #define LIST_SHARE  6
+#define STATS       7
+#define BATCH_STAT  8
+#define COPY        9
+#define MOVE        10
+
+/*!
+ * Listing filter from client mode settings
+ * @param c - configuration
+ * @return
+ * filter
+ */
+static ListFilter list_filter(Configuration &c)
+{
+    ListFilter filter;
+    filter._pattern = c[C_LIST_NAME_FILTER];
+    filter._limit = (uint32_t) strtoul(c[C_LIST_LIMIT], NULL, 10);
+    const char *sort = c[C_LIST_SORT];
+    if (*sort == '-')
+    {
+        filter._descending = true;
+        sort++;
+    }
+    if (strcmp(sort, "name") == 0)
+    {
+        filter._sort = LIST_SORT_NAME;
+    }
+    else if (strcmp(sort, "mtime") == 0)
+    {
+        filter._sort = LIST_SORT_MODIFIED_TIME;
+    }
+    else if (strcmp(sort, "size") == 0)
+    {
+        filter._sort = LIST_SORT_SIZE;
+    }
+    else if (*sort != '\0')
+    {
+        WARNING_LOG("Invalid sort '%s', listing in directory order", c[C_LIST_SORT]);
+    }
+    return filter;
+}
 
 
 /*!
@@ -67,6 +110,9 @@ int Client::Init(const char *path, int op_code)
                 atoi(c[C_SHOW_HIDDEN_FILES]));
             static_cast<OpenDirReqProcessor *>(RequestProcessor::GetInstance())->SetShowOnlyFolders(
                 atoi(c[C_SHOW_ONLY_FOLDERS]));
+            static_cast<OpenDirReqProcessor *>(RequestProcessor::GetInstance())->SetLevel(
+                c.Snapshot().list_level);
+            static_cast<OpenDirReqProcessor *>(RequestProcessor::GetInstance())->SetFilter(list_filter(c));
             break;
         case DOWNLOAD:
             RequestProcessor::SetInstance(new DownloadProcessor);
@@ -79,10 +125,40 @@ int Client::Init(const char *path, int op_code)
             break;
         case DEL:
             RequestProcessor::SetInstance(new DeleteProcessor);
+            static_cast<DeleteProcessor *>(RequestProcessor::GetInstance())->SetProgress(true);
             break;
         case LIST_SHARE:
             RequestProcessor::SetInstance(new TestConnection);
             break;
+        case STATS:
+            RequestProcessor::SetInstance(new StatsProcessor);
+            break;
+        case BATCH_STAT:
+        {
+            std::vector<std::string> paths;
+            std::string list = c[C_STAT_PATHS];
+            size_t start = 0;
+            while (start <= list.size())
+            {
+                size_t end = list.find(',', start);
+                if (end == std::string::npos)
+                {
+                    end = list.size();
+                }
+                paths.push_back(list.substr(start, end - start));
+                start = end + 1;
+            }
+            RequestProcessor::SetInstance(new BatchStatProcessor);
+            static_cast<BatchStatProcessor *>(RequestProcessor::GetInstance())->SetPaths(paths);
+        }
+            break;
+        case COPY:
+        case MOVE:
+            RequestProcessor::SetInstance(new CopyProcessor(op_code == MOVE));
+            static_cast<CopyProcessor *>(RequestProcessor::GetInstance())->SetDestination(c[C_DESTINATION]);
+            static_cast<CopyProcessor *>(RequestProcessor::GetInstance())->SetOverwrite(atoi(c[C_OVERWRITE]));
+            static_cast<CopyProcessor *>(RequestProcessor::GetInstance())->SetProgress(true);
+            break;
         default:
             ERROR_LOG("Invalid operation");
             exit(1);
@@ -144,6 +220,18 @@ int Client::Init(const char *path, int op_code)
         case LIST_SHARE:
             RequestProcessor::GetInstance()->PacketCreator()->CreatePacket(req, TEST_CONNECTION_INIT_REQ, NULL);
             break;
+        case STATS:
+            RequestProcessor::GetInstance()->PacketCreator()->CreatePacket(req, STATS_REQ, NULL);
+            break;
+        case BATCH_STAT:
+            RequestProcessor::GetInstance()->PacketCreator()->CreatePacket(req, BATCH_STAT_REQ, NULL);
+            break;
+        case COPY:
+            RequestProcessor::GetInstance()->PacketCreator()->CreatePacket(req, COPY_REQ, NULL);
+            break;
+        case MOVE:
+            RequestProcessor::GetInstance()->PacketCreator()->CreatePacket(req, MOVE_REQ, NULL);
+            break;
         default:
             return SMB_ERROR;
     }
@@ -225,11 +313,7 @@ int Client::Quit()
     FREE(_sock);
     _sock = NULL;
     _sessionManager.Quit();
-    if (RequestProcessor::GetInstance() != NULL)
-    {
-        RequestProcessor::GetInstance()->Quit();
-        FREE(RequestProcessor::GetInstance());
-        RequestProcessor::SetInstance(NULL);
-    }
+    _sessionManager.QuitProcessor();
+    SmbClient::GetInstance()->Quit();
     return SMB_SUCCESS;
 }
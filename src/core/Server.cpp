@@ -5,12 +5,17 @@
  *
  */
 
+#include <signal.h>
+
 #include "Server.h"
 #include "base/Error.h"
 #include "base/Log.h"
+#include "base/Metrics.h"
+#include "base/Trace.h"
 #include "processor/RequestProcessor.h"
 
 extern int should_exit;
+extern volatile sig_atomic_t dump_metrics;
 
 /*!
  * Constructor
@@ -39,8 +44,8 @@ Server::~Server()
  */
 bool Server::timer_expired()
 {
-    Configuration &c = Configuration::GetInstance();
-    return (_end.tv_sec - _start.tv_sec) >= atoi(c[C_IDLE_TIMEOUT]);
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    return (_end.tv_sec - _start.tv_sec) >= c.idle_timeout;
 }
 
 /*!
@@ -87,6 +92,17 @@ void Server::Runloop()
          */
         ret = _epoll.WaitForEvent(1);
 
+        /* SIGUSR1 received */
+        if (dump_metrics)
+        {
+            dump_metrics = 0;
+            Metrics::GetInstance().LogDump();
+            if (Tracer::Enabled())
+            {
+                Tracer::GetInstance().Write();
+            }
+        }
+
         /* check if idle-timeout is expired */
         clock_gettime(CLOCK_REALTIME, &_end);
         if (timer_expired())
@@ -142,7 +158,7 @@ void Server::Runloop()
                         || _event_list[i].type & EVENT_HUP)
                     {
                         INFO_LOG("Socket closed");
-                        while(_event_list[i].data == _client_sock)
+                        while (i < event_count && _event_list[i].data == _client_sock)
                         {
                             DEBUG_LOG("Handling %s event for client socket",
                                       _event_list[i].type & EVENT_ERROR ? "EVENT_ERROR" :
@@ -152,6 +168,9 @@ void Server::Runloop()
                             i++;
                         }
                         CleanUp();
+                        /* i is at the next unhandled event (e.g. a new connection on the edge-triggered
+                         * listen socket), step back so the loop increment does not skip it */
+                        i--;
                         continue;
                     }
                     if (_event_list[i].type & EVENT_READ)
@@ -174,7 +193,8 @@ void Server::Runloop()
 }
 
 /*!
- * Cleans up resource once a request is served
+ * Cleans up resource once client connection is closed,
+ * releases the storage context kept across operations of the session
  * @return
  * SMB_SUCCESS - if successful
  * Otherwise - failure
@@ -192,12 +212,8 @@ int Server::CleanUp()
         _client_sock = NULL;
     }
 
-    if (RequestProcessor::GetInstance() != NULL)
-    {
-        RequestProcessor::GetInstance()->Quit();
-        FREE(RequestProcessor::GetInstance());
-        RequestProcessor::SetInstance(NULL);
-    }
+    _sessionManager.QuitProcessor();
+    SmbClient::GetInstance()->Quit();
     return SMB_SUCCESS;
 }
 
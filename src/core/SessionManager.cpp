@@ -8,12 +8,18 @@
 #include "base/Log.h"
 #include "base/Error.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
+#include "base/Trace.h"
+#include "core/Capture.h"
 #include "processor/OpenDirReqProcessor.h"
 #include "processor/DownloadProcessor.h"
 #include "processor/UploadProcessor.h"
 #include "processor/AddFolderProcessor.h"
 #include "processor/DeleteProcessor.h"
 #include "processor/TestConnection.h"
+#include "processor/StatsProcessor.h"
+#include "processor/BatchStatProcessor.h"
+#include "processor/CopyProcessor.h"
 #include "Server.h"
 
 extern int should_exit;
@@ -26,6 +32,8 @@ SessionManager::SessionManager()
     _buff_size = 0;
     _processor_thread = NULL;
     _is_ready = false;
+    _keep_alive = false;
+    _operations = 0;
     _processor_thread = ALLOCATE(std::thread, &SessionManager::process_request, this);
 }
 
@@ -50,7 +58,8 @@ int SessionManager::process_request()
     {
         std::unique_lock<std::mutex> lk(_reader_lock);
         TRACE_LOG("SessionManager::process_request Going for wait");
-        if (_reader_cond.wait_for(lk, std::chrono::seconds(5)) == std::cv_status::no_timeout)
+        /* predicate avoids losing a signal sent while the previous request was being processed */
+        if (_reader_cond.wait_for(lk, std::chrono::seconds(5), [this] { return should_exit || request_ready(); }))
         {
             ResetTimer();
         }
@@ -68,6 +77,7 @@ int SessionManager::process_request()
                     break;
                 }
                 _req_queue.pop_front();
+                Metrics::GetInstance().SetGauge(METRIC_GAUGE_REQUEST_QUEUE, _req_queue.size());
             }
 
             /* Parse Packet */
@@ -80,6 +90,17 @@ int SessionManager::process_request()
                 break;
             }
 
+            if (Capture::Enabled())
+            {
+                Capture::GetInstance().Inbound(packet);
+            }
+
+            /* Keep-alive session, first packet of next operation ends the previous one */
+            if (_keep_alive && RequestProcessor::GetInstance() != NULL && is_init_request(packet->GetCMD()))
+            {
+                QuitProcessor();
+            }
+
             /* Initialise Processor */
             if (RequestProcessor::GetInstance() == NULL && InitProcessor(packet) != SMB_SUCCESS)
             {
@@ -90,7 +111,12 @@ int SessionManager::process_request()
             }
 
             /* Process Packet */
-            if (RequestProcessor::GetInstance()->ProcessRequest(packet) != SMB_SUCCESS)
+            int ret;
+            {
+                TRACE_SPAN("ProcessRequest");
+                ret = RequestProcessor::GetInstance()->ProcessRequest(packet);
+            }
+            if (ret != SMB_SUCCESS)
             {
                 ERROR_LOG("SessionManager::process_request Process Packet failed, closing connection");
                 FREE(packet);
@@ -106,6 +132,30 @@ int SessionManager::process_request()
     return SMB_SUCCESS;
 }
 
+/*!
+ * Check if a complete request is waiting at the head of request queue
+ * @return
+ * true
+ * false
+ */
+bool SessionManager::request_ready()
+{
+    std::lock_guard<std::mutex> scoped_lock(_req_queue_mtx);
+    return !_req_queue.empty() && _req_queue.front() != NULL && _req_queue.front()->_complete;
+}
+
+/*!
+ * Check if a response is waiting in response queue
+ * @return
+ * true
+ * false
+ */
+bool SessionManager::response_ready()
+{
+    std::lock_guard<std::mutex> scoped_lock(_res_queue_mtx);
+    return !_res_queue.empty();
+}
+
 /*!
  * Signals process_request thread to process a request
  */
@@ -127,10 +177,16 @@ int SessionManager::Init(ISmbConnector *smbConnector)
 {
     DEBUG_LOG("SessionManager::Init");
     assert(smbConnector != NULL);
-    Configuration &c = Configuration::GetInstance();
-    _buff_size = (unsigned int) std::stoul(c[C_BUFFER_SIZE]);
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    _buff_size = c.buffer_size;
+    _keep_alive = c.keep_alive;
+    _operations = 0;
     _smbConnector = smbConnector;
     _sock = _smbConnector->GetSocket();
+    if (Capture::Enabled())
+    {
+        Capture::GetInstance().BeginSession();
+    }
     return SMB_SUCCESS;
 }
 
@@ -145,6 +201,33 @@ bool SessionManager::IsReady()
     return _is_ready;
 }
 
+/*!
+ * Check if command starts an operation
+ * @param cmd - command
+ * @return
+ * true
+ * false
+ */
+bool SessionManager::is_init_request(int cmd)
+{
+    switch (cmd)
+    {
+        case GET_STRUCTURE_INIT_REQ:
+        case DOWNLOAD_INIT_REQ:
+        case UPLOAD_INIT_REQ:
+        case ADD_FOLDER_INIT_REQ:
+        case DELETE_INIT_REQ:
+        case TEST_CONNECTION_INIT_REQ:
+        case STATS_REQ:
+        case BATCH_STAT_REQ:
+        case COPY_REQ:
+        case MOVE_REQ:
+            return true;
+        default:
+            return false;
+    }
+}
+
 /*!
  * Initialises appropriate module
  * @param packet - first packet with command
@@ -180,6 +263,22 @@ int SessionManager::InitProcessor(Packet *packet)
             DEBUG_LOG("Init TestConnection");
             RequestProcessor::SetInstance(ALLOCATE(TestConnection));
             break;
+        case STATS_REQ:
+            DEBUG_LOG("Init StatsProcessor");
+            RequestProcessor::SetInstance(ALLOCATE(StatsProcessor));
+            break;
+        case BATCH_STAT_REQ:
+            DEBUG_LOG("Init BatchStatProcessor");
+            RequestProcessor::SetInstance(ALLOCATE(BatchStatProcessor));
+            break;
+        case COPY_REQ:
+            DEBUG_LOG("Init CopyProcessor");
+            RequestProcessor::SetInstance(ALLOCATE(CopyProcessor));
+            break;
+        case MOVE_REQ:
+            DEBUG_LOG("Init CopyProcessor for move");
+            RequestProcessor::SetInstance(ALLOCATE(CopyProcessor, true));
+            break;
         default:
             DEBUG_LOG("Invalid Packet type, cannot initialise processor");
             return SMB_ERROR;
@@ -193,9 +292,31 @@ int SessionManager::InitProcessor(Packet *packet)
     RequestProcessor::GetInstance()->SetSessionManager(this);
     std::string request_id(packet->GetID());
     RequestProcessor::GetInstance()->Init(request_id);
+    _operations++;
+    DEBUG_LOG("SessionManager::InitProcessor operation %u of session", _operations);
     return SMB_SUCCESS;
 }
 
+/*!
+ * Quit and free processor of finished operation,
+ * storage context is kept till SmbClient::Quit()
+ */
+void SessionManager::QuitProcessor()
+{
+    RequestProcessor *processor = RequestProcessor::GetInstance();
+    if (processor == NULL)
+    {
+        return;
+    }
+    if (Tracer::Enabled())
+    {
+        Tracer::GetInstance().Write(processor->RequestId().c_str());
+    }
+    processor->Quit();
+    RequestProcessor::SetInstance(NULL);
+    FREE(processor);
+}
+
 /*!
  * Process read event on socket
  * @return
@@ -205,10 +326,10 @@ int SessionManager::ProcessReadEvent()
 {
     int ret;
     INFO_LOG("Got a read event");
-    Configuration &c = Configuration::GetInstance();
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
     while (!should_exit)
     {
-        char buffer[atoi(c[C_UNIX_SOCK_BUFFER])];
+        char buffer[c.unix_sock_buffer];
         int len = 0;
 
         Packet *request = GetLastRequest();
@@ -237,13 +358,13 @@ int SessionManager::ProcessReadEvent()
         }
 
         int remaining_data = request->GetLength() - request->_p_len;
-        DEBUG_LOG("remaining_data %d, len from header %d, p-len %d", remaining_data, request->GetLength(),
-                  request->_p_len);
+        DEBUG_LOG_RATE_LIMITED("remaining_data %d, len from header %d, p-len %d", remaining_data,
+                               request->GetLength(), request->_p_len);
         ret = _sock->Read(buffer, remaining_data > (int) sizeof(buffer) ? sizeof(buffer) : remaining_data);
 
         if (ret == SMB_AGAIN)
         {
-            DEBUG_LOG("SessionManager::ProcessReadEvent Read fail, try again");
+            DEBUG_LOG_RATE_LIMITED("SessionManager::ProcessReadEvent Read fail, try again");
             break;
         }
         else if (ret == 0 || ret == SMB_EOF || ret == SMB_RESET || ret < 0)
@@ -254,11 +375,15 @@ int SessionManager::ProcessReadEvent()
 
         memcpy(request->_data + request->_p_len, buffer, ret);
         request->_p_len += ret;
-        DEBUG_LOG("_p_len %d", request->_p_len);
+        DEBUG_LOG_RATE_LIMITED("_p_len %d", request->_p_len);
 
         if (request->_p_len == request->GetLength())
         {
             TRACE_LOG("SessionManager::ProcessReadEvent Got a request, signal processor, ready-packet %p", request);
+            if (Capture::Enabled())
+            {
+                request->_timestamp = Metrics::Now();
+            }
             request->_complete = true;
             signal_process_request();
         }
@@ -278,22 +403,25 @@ int SessionManager::ProcessWriteEvent()
     TRACE_LOG("Got a write event");
     if (!_write_mtx.try_lock())
     {
-        DEBUG_LOG("SessionManager::ProcessWriteEvent Data already being sent");
+        DEBUG_LOG_RATE_LIMITED("SessionManager::ProcessWriteEvent Data already being sent");
         return SMB_SUCCESS;
     }
+    TRACE_SPAN("ProcessWriteEvent");
+    bool drained = false;
     while (!should_exit)
     {
         int sent = 0;
         Packet *res = PopResponse();
         if (res)
         {
-            DEBUG_LOG("SessionManager::ProcessWriteEvent Sending data");
+            DEBUG_LOG_RATE_LIMITED("SessionManager::ProcessWriteEvent Sending data");
             if (!res->_hdr_sent)
             {
                 sent = _sock->Send(res->_header + res->_p_len, HEADER_SIZE);
                 if (sent == SMB_AGAIN)
                 {
-                    DEBUG_LOG("SessionManager::ProcessWriteEvent SMB_AGAIN try again to send the header");
+                    DEBUG_LOG_RATE_LIMITED(
+                        "SessionManager::ProcessWriteEvent SMB_AGAIN try again to send the header");
                     PushResponseAgain(res);
                     break;
                 }
@@ -306,13 +434,14 @@ int SessionManager::ProcessWriteEvent()
                 }
                 if (sent == HEADER_SIZE)
                 {
-                    DEBUG_LOG("SessionManager::ProcessWriteEvent Header sent");
+                    DEBUG_LOG_RATE_LIMITED("SessionManager::ProcessWriteEvent Header sent");
                     res->_hdr_sent = true;
                     res->_p_len += HEADER_SIZE;
                 }
                 else
                 {
-                    DEBUG_LOG("SessionManager::ProcessWriteEvent keep trying till whole header is sent");
+                    DEBUG_LOG_RATE_LIMITED(
+                        "SessionManager::ProcessWriteEvent keep trying till whole header is sent");
                     res->_p_len += sent;
                     PushResponseAgain(res);
                     break;
@@ -320,12 +449,12 @@ int SessionManager::ProcessWriteEvent()
             }
             int data_to_sent = res->GetLength() - (res->_p_len - HEADER_SIZE);
             int start_offset = res->_p_len - HEADER_SIZE;
-            DEBUG_LOG("Data offset %d, size from header %d, data_to_sent %d", start_offset, res->GetLength(),
-                      data_to_sent);
+            DEBUG_LOG_RATE_LIMITED("Data offset %d, size from header %d, data_to_sent %d", start_offset,
+                                   res->GetLength(), data_to_sent);
             sent = _sock->Send(res->_data + start_offset, data_to_sent);
             if (sent == SMB_AGAIN)
             {
-                DEBUG_LOG("SessionManager::ProcessWriteEvent SMB_AGAIN try again to send the data");
+                DEBUG_LOG_RATE_LIMITED("SessionManager::ProcessWriteEvent SMB_AGAIN try again to send the data");
                 PushResponseAgain(res);
                 break;
             }
@@ -341,6 +470,10 @@ int SessionManager::ProcessWriteEvent()
 
             if (res->_p_len == (HEADER_SIZE + res->GetLength()))
             {
+                if (Capture::Enabled())
+                {
+                    Capture::GetInstance().Outbound(res);
+                }
                 FREE(res);
             }
             else
@@ -353,10 +486,18 @@ int SessionManager::ProcessWriteEvent()
         else
         {
             TRACE_LOG("SessionManager::ProcessWriteEvent No data available for writing");
+            drained = true;
             break;
         }
     }
     _write_mtx.unlock();
+
+    /* response pushed by another thread after the queue was found empty but before unlock
+     * was skipped by that thread's try_lock, no write event may follow to send it */
+    if (drained && !should_exit && response_ready())
+    {
+        return ProcessWriteEvent();
+    }
     return SMB_SUCCESS;
 }
 
@@ -371,6 +512,10 @@ int SessionManager::CleanUp()
     std::lock_guard<std::mutex> lk(_reader_lock);
     FreeAllResponse();
     FreeAllRequest();
+    if (Capture::Enabled())
+    {
+        Capture::GetInstance().EndSession();
+    }
     return SMB_SUCCESS;
 }
 
@@ -400,8 +545,10 @@ int SessionManager::Quit()
  */
 void SessionManager::PushResponse(Packet *response)
 {
+    TRACE_SPAN("EnqueueResponse");
     std::lock_guard<std::mutex> scoped_lock(_res_queue_mtx);
     _res_queue.push_back(response);
+    Metrics::GetInstance().SetGauge(METRIC_GAUGE_RESPONSE_QUEUE, _res_queue.size());
 }
 
 /*!
@@ -429,6 +576,7 @@ Packet *SessionManager::PopResponse()
     }
     Packet *res = _res_queue.front();
     _res_queue.pop_front();
+    Metrics::GetInstance().SetGauge(METRIC_GAUGE_RESPONSE_QUEUE, _res_queue.size());
     return res;
 }
 
@@ -464,8 +612,10 @@ void SessionManager::FreeAllResponse()
  */
 void SessionManager::PushRequest(Packet *req)
 {
+    TRACE_SPAN("EnqueueRequest");
     std::lock_guard<std::mutex> scoped_lock(_req_queue_mtx);
     _req_queue.push_back(req);
+    Metrics::GetInstance().SetGauge(METRIC_GAUGE_REQUEST_QUEUE, _req_queue.size());
 }
 
 /*!
@@ -490,6 +640,7 @@ Packet *SessionManager::PopRequest()
     {
         Packet *res = _req_queue.front();
         _req_queue.pop_front();
+        Metrics::GetInstance().SetGauge(METRIC_GAUGE_REQUEST_QUEUE, _req_queue.size());
         return res;
     }
     TRACE_LOG("SessionManager::PopRequest Empty queue");
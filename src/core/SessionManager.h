@@ -30,11 +30,16 @@ private:
     std::mutex _write_mtx;
     std::thread *_processor_thread;
     bool _is_ready;
+    bool _keep_alive;
+    unsigned int _operations;   //operations served in this session
     std::mutex _reader_lock;
     std::condition_variable _reader_cond;
 
     int process_request();
+    bool request_ready();
+    bool response_ready();
     void signal_process_request();
+    static bool is_init_request(int cmd);
 
 public:
     SessionManager();
@@ -43,6 +48,7 @@ public:
     int Init(ISmbConnector *smbConnector);
     bool IsReady();
     int InitProcessor(Packet *packet);
+    void QuitProcessor();
     int ProcessReadEvent();
     int ProcessWriteEvent();
     int CleanUp();
@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Protocol.h"
+#include "BatchStatPacketCreator.h"
+
+/*!
+ * Constructor
+ */
+BatchStatPacketCreator::BatchStatPacketCreator()
+{
+    //Empty Constructor
+}
+
+/*!
+ * Destructor
+ */
+BatchStatPacketCreator::~BatchStatPacketCreator()
+{
+    //Empty Destructor
+}
+
+/*!
+ * Creates BATCH_STAT_REQ packet
+ * @param packet - request packet
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BatchStatPacketCreator::create_batch_stat_req(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketCreator::create_batch_stat_req");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    BatchStatProcessor *_processor = dynamic_cast<BatchStatProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_req invalid RequestProcessor");
+        FREE(packet->_pb_msg);
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    if (!ALLOCATED(cmd))
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_req, memory allocation failed");
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+    cmd->set_cmd(BATCH_STAT_REQ);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+    CreateCredentialPacket(packet);
+
+    BatchStatRequest *req = packet->_pb_msg->mutable_requestpacket()->mutable_batchstatrequest();
+    const std::vector<std::string> &paths = _processor->Paths();
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        req->add_paths(paths[i]);
+    }
+
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_req packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates BATCH_STAT_RESP packet
+ * @param packet - response packet
+ * @param results - results of stat'ed paths
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BatchStatPacketCreator::create_batch_stat_resp(Packet *packet, const BatchStatResults *results)
+{
+    DEBUG_LOG("BatchStatPacketCreator::create_batch_stat_resp");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    BatchStatProcessor *_processor = dynamic_cast<BatchStatProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_resp invalid RequestProcessor");
+        FREE(packet->_pb_msg);
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    ResponsePacket *resp = ALLOCATE(ResponsePacket);
+    BatchStatResponse *statResp = ALLOCATE(BatchStatResponse);
+    if (!ALLOCATED(cmd) || !ALLOCATED(resp) || !ALLOCATED(statResp))
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_resp, memory allocation failed");
+        FREE(cmd);
+        FREE(resp);
+        FREE(statResp);
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    /* Command */
+    cmd->set_cmd(BATCH_STAT_RESP);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    /* Entries */
+    const std::vector<std::string> &paths = _processor->Paths();
+    for (size_t i = 0; i < results->size(); i++)
+    {
+        const BatchStatResult &result = (*results)[i];
+        BatchStatEntry *entry = statResp->add_entries();
+        entry->set_index(result._index);
+        entry->set_code(result._error);
+        if (result._error == 0)
+        {
+            FileInformation *f_info = entry->mutable_fileinformation();
+            f_info->set_name(paths[result._index]);
+            f_info->set_isdirectory(S_ISDIR(result._st.st_mode));
+            f_info->set_size(result._st.st_size);
+            f_info->set_modifiedtime(result._st.st_mtim.tv_sec*SEC_TO_MS + result._st.st_mtim.tv_nsec*NANO_TO_MS);
+        }
+    }
+    resp->set_allocated_batchstatresponse(statResp);
+
+    /* ResponsePacket */
+    packet->_pb_msg->set_allocated_responsepacket(resp);
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_resp packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates BATCH_STAT_END_RESP packet
+ * @param packet - response packet
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BatchStatPacketCreator::create_batch_stat_end(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketCreator::create_batch_stat_end");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    BatchStatProcessor *_processor = dynamic_cast<BatchStatProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_end invalid RequestProcessor");
+        FREE(packet->_pb_msg);
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    if (!ALLOCATED(cmd))
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_end, memory allocation failed");
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    /* Command */
+    cmd->set_cmd(BATCH_STAT_END_RESP);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("BatchStatPacketCreator::create_batch_stat_end packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates packet with corresponding op_code
+ * @param packet - packet to be filled
+ * @param op_code - operation code
+ * @param data - BatchStatResults for BATCH_STAT_RESP
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int BatchStatPacketCreator::CreatePacket(Packet *packet, int op_code, void *data)
+{
+    DEBUG_LOG("BatchStatPacketCreator::CreatePacket");
+
+    if (packet == NULL)
+    {
+        ERROR_LOG("BatchStatPacketCreator::CreatePacket, NULL packet");
+        return SMB_ERROR;
+    }
+
+    packet->_pb_msg = ALLOCATE(Message);
+    if (!ALLOCATED(packet->_pb_msg))
+    {
+        ERROR_LOG("BatchStatPacketCreator::CreatePacket, memory allocation failed");
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    switch (op_code)
+    {
+        case BATCH_STAT_REQ:
+            return create_batch_stat_req(packet);
+        case BATCH_STAT_RESP:
+        {
+            if (data == NULL)
+            {
+                ERROR_LOG("BatchStatPacketCreator::CreatePacket, data missing for BATCH_STAT_RESP");
+                FREE(packet->_pb_msg);
+                return SMB_ERROR;
+            }
+            return create_batch_stat_resp(packet, static_cast<const BatchStatResults *>(data));
+        }
+        case BATCH_STAT_END_RESP:
+            return create_batch_stat_end(packet);
+        default:
+            ERROR_LOG("Invalid op_code");
+            FREE(packet->_pb_msg);
+            return SMB_ERROR;
+    }
+}
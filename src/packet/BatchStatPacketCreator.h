@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef BATCH_STAT_PACKET_CREATOR_H_
+#define BATCH_STAT_PACKET_CREATOR_H_
+
+#include "IPacketCreator.h"
+#include "processor/BatchStatProcessor.h"
+
+class BatchStatPacketCreator: public IPacketCreator
+{
+private:
+    int create_batch_stat_req(Packet *packet);
+    int create_batch_stat_resp(Packet *packet, const BatchStatResults *results);
+    int create_batch_stat_end(Packet *packet);
+
+public:
+    explicit BatchStatPacketCreator();
+    virtual ~BatchStatPacketCreator();
+    virtual int CreatePacket(Packet *packet, int op_code, void *data);
+};
+
+
+#endif //BATCH_STAT_PACKET_CREATOR_H_
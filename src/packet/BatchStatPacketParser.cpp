@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Protocol.h"
+#include "BatchStatPacketParser.h"
+
+/*!
+ * Constructor
+ */
+BatchStatPacketParser::BatchStatPacketParser()
+{
+    //Empty Constructor
+}
+
+/*!
+ * Destructor
+ */
+BatchStatPacketParser::~BatchStatPacketParser()
+{
+    //Empty Destructor
+}
+
+/*!
+ * Parse BATCH_STAT_REQ packet
+ * @param packet - request packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int BatchStatPacketParser::parse_batch_stat_req(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketParser::parse_batch_stat_req");
+    assert(packet->_pb_msg != NULL);
+    packet->Dump();
+    parse_credentials(packet);
+
+    BatchStatProcessor *_processor = dynamic_cast<BatchStatProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("BatchStatPacketParser::parse_batch_stat_req invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+
+    const BatchStatRequest &req = packet->_pb_msg->requestpacket().batchstatrequest();
+    std::vector<std::string> paths(req.paths().begin(), req.paths().end());
+    _processor->SetPaths(paths);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse BATCH_STAT_RESP packet
+ * @param packet - response packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int BatchStatPacketParser::parse_batch_stat_resp(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketParser::parse_batch_stat_resp");
+    assert(packet->_pb_msg != NULL);
+    packet->Dump();
+    const BatchStatResponse &resp = packet->_pb_msg->responsepacket().batchstatresponse();
+    for (int i = 0; i < resp.entries_size(); i++)
+    {
+        const BatchStatEntry &entry = resp.entries(i);
+        if (entry.code() != 0)
+        {
+            INFO_LOG("\t[%u] error %d", entry.index(), entry.code());
+            continue;
+        }
+        INFO_LOG("\t[%u] %s IsDirectory %d Size %lu ModifiedTime %lu", entry.index(),
+                 entry.fileinformation().name().c_str(), entry.fileinformation().isdirectory(),
+                 entry.fileinformation().size(), entry.fileinformation().modifiedtime());
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse BATCH_STAT_END_RESP packet
+ * @param packet - response packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ */
+int BatchStatPacketParser::parse_batch_stat_end(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketParser::parse_batch_stat_end");
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse BATCH_STAT_ERROR_RESP packet
+ * @param packet - response packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ */
+int BatchStatPacketParser::parse_batch_stat_error(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketParser::parse_batch_stat_error");
+    parse_status(packet->_pb_msg->status());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse credentials
+ * @param packet - request packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int BatchStatPacketParser::parse_credentials(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketParser::parse_credentials");
+    return IPacketParser::parse_credentials(packet);
+}
+
+/*!
+ * Parse error/status message
+ * @param status
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int BatchStatPacketParser::parse_status(const Status &status)
+{
+    DEBUG_LOG("BatchStatPacketParser::parse_status");
+    IPacketParser::parse_status(status);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Verify Request-ID
+ * @param packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int BatchStatPacketParser::verify_request_id(Packet *packet)
+{
+    return IPacketParser::verify_request_id(packet);
+}
+
+/*!
+ * Parse packet for batch stat module
+ * @param packet - incoming packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int BatchStatPacketParser::ParsePacket(Packet *packet)
+{
+    DEBUG_LOG("BatchStatPacketParser::ParsePacket");
+    assert(packet);
+    int ret;
+
+    if (verify_request_id(packet) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+
+    switch (packet->GetCMD())
+    {
+        case BATCH_STAT_REQ:
+            ret = parse_batch_stat_req(packet);
+            break;
+        case BATCH_STAT_RESP:
+            ret = parse_batch_stat_resp(packet);
+            break;
+        case BATCH_STAT_END_RESP:
+            ret = parse_batch_stat_end(packet);
+            break;
+        case BATCH_STAT_ERROR_RESP:
+            ret = parse_batch_stat_error(packet);
+            break;
+        default:
+            ret = SMB_ERROR;
+            ERROR_LOG("Invalid Command type");
+    }
+    return ret;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef BATCH_STAT_PACKET_PARSER_H_
+#define BATCH_STAT_PACKET_PARSER_H_
+
+#include "IPacketParser.h"
+#include "processor/BatchStatProcessor.h"
+
+class BatchStatPacketParser: public IPacketParser
+{
+private:
+    int parse_batch_stat_req(Packet *packet);
+    int parse_batch_stat_resp(Packet *packet);
+    int parse_batch_stat_end(Packet *packet);
+    int parse_batch_stat_error(Packet *packet);
+
+    virtual int parse_credentials(Packet *packet);
+    virtual int parse_status(const Status &status);
+    virtual int verify_request_id(Packet *packet);
+
+public:
+    explicit BatchStatPacketParser();
+    virtual ~BatchStatPacketParser();
+    virtual int ParsePacket(Packet *packet);
+};
+
+
+#endif //BATCH_STAT_PACKET_PARSER_H_
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Protocol.h"
+#include "CopyPacketCreator.h"
+
+/*!
+ * Constructor
+ */
+CopyPacketCreator::CopyPacketCreator()
+{
+    //Empty Constructor
+}
+
+/*!
+ * Destructor
+ */
+CopyPacketCreator::~CopyPacketCreator()
+{
+    //Empty Destructor
+}
+
+/*!
+ * Creates COPY_REQ/MOVE_REQ packet
+ * @param packet - request packet
+ * @param op_code - COPY_REQ or MOVE_REQ
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int CopyPacketCreator::create_copy_req(Packet *packet, int op_code)
+{
+    DEBUG_LOG("CopyPacketCreator::create_copy_req");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    CopyProcessor *_processor = dynamic_cast<CopyProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_req invalid RequestProcessor");
+        FREE(packet->_pb_msg);
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    if (!ALLOCATED(cmd))
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_req, memory allocation failed");
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+    cmd->set_cmd(op_code);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+    CreateCredentialPacket(packet);
+
+    CopyRequest *req = packet->_pb_msg->mutable_requestpacket()->mutable_copyrequest();
+    req->set_destination(_processor->Destination());
+    if (_processor->Overwrite())
+    {
+        req->set_overwrite(true);
+    }
+    if (_processor->Progress())
+    {
+        req->set_progress(true);
+    }
+
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_req packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates COPY_RESP/MOVE_RESP packet
+ * @param packet - response packet
+ * @param op_code - COPY_RESP or MOVE_RESP
+ * @param result - stat of the destination
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int CopyPacketCreator::create_copy_resp(Packet *packet, int op_code, const CopyResult *result)
+{
+    DEBUG_LOG("CopyPacketCreator::create_copy_resp");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    CopyProcessor *_processor = dynamic_cast<CopyProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_resp invalid RequestProcessor");
+        FREE(packet->_pb_msg);
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    ResponsePacket *resp = ALLOCATE(ResponsePacket);
+    CopyResponse *copyResp = ALLOCATE(CopyResponse);
+    FileInformation *fInfo = ALLOCATE(FileInformation);
+    if (!ALLOCATED(cmd) || !ALLOCATED(resp) || !ALLOCATED(copyResp) || !ALLOCATED(fInfo))
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_resp, memory allocation failed");
+        FREE(cmd);
+        FREE(resp);
+        FREE(copyResp);
+        FREE(fInfo);
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    /* Command */
+    cmd->set_cmd(op_code);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    /* File info */
+    fInfo->set_name(_processor->Destination());
+    fInfo->set_isdirectory(S_ISDIR(result->_st.st_mode));
+    fInfo->set_size(result->_st.st_size);
+    fInfo->set_modifiedtime(result->_st.st_mtim.tv_sec*SEC_TO_MS + result->_st.st_mtim.tv_nsec*NANO_TO_MS);
+    copyResp->set_allocated_fileinformation(fInfo);
+    copyResp->set_serverside(result->_server_side);
+    resp->set_allocated_copyresponse(copyResp);
+
+    /* ResponsePacket */
+    packet->_pb_msg->set_allocated_responsepacket(resp);
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_resp packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates COPY_PROGRESS_RESP/MOVE_PROGRESS_RESP packet
+ * @param packet - response packet
+ * @param op_code - COPY_PROGRESS_RESP or MOVE_PROGRESS_RESP
+ * @param progress - bytes copied so far
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int CopyPacketCreator::create_copy_progress(Packet *packet, int op_code, const CopyProgress *progress)
+{
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    CopyProcessor *_processor = dynamic_cast<CopyProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_progress invalid RequestProcessor");
+        FREE(packet->_pb_msg);
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    ResponsePacket *resp = ALLOCATE(ResponsePacket);
+    CopyProgressResponse *progResp = ALLOCATE(CopyProgressResponse);
+    if (!ALLOCATED(cmd) || !ALLOCATED(resp) || !ALLOCATED(progResp))
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_progress, memory allocation failed");
+        FREE(cmd);
+        FREE(resp);
+        FREE(progResp);
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    /* Command */
+    cmd->set_cmd(op_code);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    /* Progress */
+    progResp->set_bytes(progress->_bytes);
+    progResp->set_total(progress->_total);
+    progResp->set_serverside(progress->_server_side);
+    resp->set_allocated_copyprogressresponse(progResp);
+
+    /* ResponsePacket */
+    packet->_pb_msg->set_allocated_responsepacket(resp);
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("CopyPacketCreator::create_copy_progress packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates packet with corresponding op_code
+ * @param packet - packet to be filled
+ * @param op_code - operation code
+ * @param data - operation specific data
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int CopyPacketCreator::CreatePacket(Packet *packet, int op_code, void *data)
+{
+    DEBUG_LOG("CopyPacketCreator::CreatePacket");
+
+    if (packet == NULL)
+    {
+        ERROR_LOG("CopyPacketCreator::CreatePacket, NULL packet");
+        return SMB_ERROR;
+    }
+
+    packet->_pb_msg = ALLOCATE(Message);
+    if (!ALLOCATED(packet->_pb_msg))
+    {
+        ERROR_LOG("CopyPacketCreator::CreatePacket, memory allocation failed");
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    switch (op_code)
+    {
+        case COPY_REQ:
+        case MOVE_REQ:
+            return create_copy_req(packet, op_code);
+        case COPY_RESP:
+        case MOVE_RESP:
+        {
+            if (data == NULL)
+            {
+                ERROR_LOG("CopyPacketCreator::CreatePacket, data missing for %s", ProtocolCommand(op_code));
+                FREE(packet->_pb_msg);
+                return SMB_ERROR;
+            }
+            return create_copy_resp(packet, op_code, static_cast<const CopyResult *>(data));
+        }
+        case COPY_PROGRESS_RESP:
+        case MOVE_PROGRESS_RESP:
+        {
+            if (data == NULL)
+            {
+                ERROR_LOG("CopyPacketCreator::CreatePacket, data missing for %s", ProtocolCommand(op_code));
+                FREE(packet->_pb_msg);
+                return SMB_ERROR;
+            }
+            return create_copy_progress(packet, op_code, static_cast<const CopyProgress *>(data));
+        }
+        default:
+            ERROR_LOG("Invalid op_code");
+            FREE(packet->_pb_msg);
+            return SMB_ERROR;
+    }
+}
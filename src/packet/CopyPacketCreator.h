@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef COPY_PACKET_CREATOR_H_
+#define COPY_PACKET_CREATOR_H_
+
+#include "IPacketCreator.h"
+#include "processor/CopyProcessor.h"
+
+class CopyPacketCreator: public IPacketCreator
+{
+private:
+    int create_copy_req(Packet *packet, int op_code);
+    int create_copy_resp(Packet *packet, int op_code, const CopyResult *result);
+    int create_copy_progress(Packet *packet, int op_code, const CopyProgress *progress);
+
+public:
+    explicit CopyPacketCreator();
+    virtual ~CopyPacketCreator();
+    virtual int CreatePacket(Packet *packet, int op_code, void *data);
+};
+
+
+#endif //COPY_PACKET_CREATOR_H_
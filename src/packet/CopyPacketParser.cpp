@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Protocol.h"
+#include "CopyPacketParser.h"
+
+/*!
+ * Constructor
+ */
+CopyPacketParser::CopyPacketParser()
+{
+    //Empty Constructor
+}
+
+/*!
+ * Destructor
+ */
+CopyPacketParser::~CopyPacketParser()
+{
+    //Empty Destructor
+}
+
+/*!
+ * Parse COPY_REQ/MOVE_REQ packet
+ * @param packet - request packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int CopyPacketParser::parse_copy_req(Packet *packet)
+{
+    DEBUG_LOG("CopyPacketParser::parse_copy_req");
+    assert(packet->_pb_msg != NULL);
+    packet->Dump();
+    parse_credentials(packet);
+
+    CopyProcessor *_processor = dynamic_cast<CopyProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("CopyPacketParser::parse_copy_req invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+
+    const CopyRequest &req = packet->_pb_msg->requestpacket().copyrequest();
+    _processor->SetDestination(req.destination());
+    _processor->SetOverwrite(req.overwrite());
+    _processor->SetProgress(req.progress());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse COPY_RESP/MOVE_RESP packet
+ * @param packet - response packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int CopyPacketParser::parse_copy_resp(Packet *packet)
+{
+    DEBUG_LOG("CopyPacketParser::parse_copy_resp");
+    assert(packet->_pb_msg != NULL);
+    packet->Dump();
+    const CopyResponse &resp = packet->_pb_msg->responsepacket().copyresponse();
+    INFO_LOG("CopyPacketParser::parse_copy_resp %s Size %lu ModifiedTime %lu ServerSide %d",
+             resp.fileinformation().name().c_str(), resp.fileinformation().size(),
+             resp.fileinformation().modifiedtime(), resp.serverside());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse COPY_ERROR_RESP/MOVE_ERROR_RESP packet
+ * @param packet - response packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ */
+int CopyPacketParser::parse_copy_error(Packet *packet)
+{
+    DEBUG_LOG("CopyPacketParser::parse_copy_error");
+    parse_status(packet->_pb_msg->status());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse COPY_PROGRESS_RESP/MOVE_PROGRESS_RESP packet
+ * @param packet - response packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ */
+int CopyPacketParser::parse_copy_progress(Packet *packet)
+{
+    DEBUG_LOG("CopyPacketParser::parse_copy_progress");
+    assert(packet->_pb_msg != NULL);
+    packet->Dump();
+    const CopyProgressResponse &progress = packet->_pb_msg->responsepacket().copyprogressresponse();
+    INFO_LOG("CopyPacketParser::parse_copy_progress %lu of %lu bytes%s", progress.bytes(), progress.total(),
+             progress.serverside() ? " (server side)" : "");
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse credentials
+ * @param packet - request packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int CopyPacketParser::parse_credentials(Packet *packet)
+{
+    DEBUG_LOG("CopyPacketParser::parse_credentials");
+    return IPacketParser::parse_credentials(packet);
+}
+
+/*!
+ * Parse error/status message
+ * @param status
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int CopyPacketParser::parse_status(const Status &status)
+{
+    DEBUG_LOG("CopyPacketParser::parse_status");
+    IPacketParser::parse_status(status);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Verify Request-ID
+ * @param packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int CopyPacketParser::verify_request_id(Packet *packet)
+{
+    return IPacketParser::verify_request_id(packet);
+}
+
+/*!
+ * Parse packet for copy/move module
+ * @param packet - incoming packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int CopyPacketParser::ParsePacket(Packet *packet)
+{
+    DEBUG_LOG("CopyPacketParser::ParsePacket");
+    assert(packet);
+    int ret;
+
+    if (verify_request_id(packet) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+
+    switch (packet->GetCMD())
+    {
+        case COPY_REQ:
+        case MOVE_REQ:
+            ret = parse_copy_req(packet);
+            break;
+        case COPY_RESP:
+        case MOVE_RESP:
+            ret = parse_copy_resp(packet);
+            break;
+        case COPY_ERROR_RESP:
+        case MOVE_ERROR_RESP:
+            ret = parse_copy_error(packet);
+            break;
+        case COPY_PROGRESS_RESP:
+        case MOVE_PROGRESS_RESP:
+            ret = parse_copy_progress(packet);
+            break;
+        default:
+            ret = SMB_ERROR;
+            ERROR_LOG("Invalid Command type");
+    }
+    return ret;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef COPY_PACKET_PARSER_H_
+#define COPY_PACKET_PARSER_H_
+
+#include "IPacketParser.h"
+#include "processor/CopyProcessor.h"
+
+class CopyPacketParser: public IPacketParser
+{
+private:
+    int parse_copy_req(Packet *packet);
+    int parse_copy_resp(Packet *packet);
+    int parse_copy_error(Packet *packet);
+    int parse_copy_progress(Packet *packet);
+
+    virtual int parse_credentials(Packet *packet);
+    virtual int parse_status(const Status &status);
+    virtual int verify_request_id(Packet *packet);
+
+public:
+    explicit CopyPacketParser();
+    virtual ~CopyPacketParser();
+    virtual int ParsePacket(Packet *packet);
+};
+
+
+#endif //COPY_PACKET_PARSER_H_
@@ -57,6 +57,10 @@ int DeletePacketCreator::create_delete_req(Packet *packet)
     cmd->set_requestid(_processor->RequestId());
     packet->_pb_msg->set_allocated_command(cmd);
     CreateCredentialPacket(packet);
+    if (_processor->Progress())
+    {
+        packet->_pb_msg->mutable_requestpacket()->mutable_deleterequest()->set_progress(true);
+    }
 
     packet->PutHeader();
     if (packet->PutData() != SMB_SUCCESS)
@@ -126,6 +130,73 @@ int DeletePacketCreator::create_delete_resp(Packet *packet, packet_data *data)
     return SMB_SUCCESS;
 }
 
+/*!
+ * Creates DELETE_PROGRESS_RESP packet
+ * @param packet - request packet
+ * @param progress - progress of folder delete, failures are sent with the summary only
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int DeletePacketCreator::create_delete_progress(Packet *packet, const DeleteProgress *progress)
+{
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    DeleteProcessor *_processor = dynamic_cast<DeleteProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("DeletePacketCreator::create_delete_progress invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    ResponsePacket *resp = ALLOCATE(ResponsePacket);
+    DeleteProgressResponse *progResp = ALLOCATE(DeleteProgressResponse);
+    if (!ALLOCATED(cmd) || !ALLOCATED(resp) || !ALLOCATED(progResp))
+    {
+        ERROR_LOG("DeletePacketCreator::create_delete_progress, memory allocation failed");
+        FREE(cmd);
+        FREE(resp);
+        FREE(progResp);
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    /* Command */
+    cmd->set_cmd(DELETE_PROGRESS_RESP);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    /* Progress */
+    progResp->set_files(progress->_files);
+    progResp->set_folders(progress->_folders);
+    progResp->set_failed(progress->_failed);
+    if (progress->_done)
+    {
+        progResp->set_summary(true);
+        for (size_t i = 0; i < progress->_failures.size(); i++)
+        {
+            DeleteFailureEntry *failure = progResp->add_failures();
+            failure->set_name(progress->_failures[i]._name);
+            failure->set_code(progress->_failures[i]._error);
+        }
+    }
+    resp->set_allocated_deleteprogressresponse(progResp);
+
+    /* ResponsePacket */
+    packet->_pb_msg->set_allocated_responsepacket(resp);
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("DeletePacketCreator::create_delete_progress packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
 /*!
  * Creates packet with corresponding op_code
  * @param packet - packet to be filled
@@ -165,6 +236,16 @@ int DeletePacketCreator::CreatePacket(Packet *packet, int op_code, void *data)
             }
             return create_delete_resp(packet, static_cast<packet_data *>(data));
         }
+        case DELETE_PROGRESS_RESP:
+        {
+            if (data == NULL)
+            {
+                ERROR_LOG("DeletePacketCreator::CreatePacket, data missing for DELETE_PROGRESS_RESP");
+                FREE(packet->_pb_msg);
+                return SMB_ERROR;
+            }
+            return create_delete_progress(packet, static_cast<const DeleteProgress *>(data));
+        }
         default:
             ERROR_LOG("Invalid op_code");
             FREE(packet->_pb_msg);
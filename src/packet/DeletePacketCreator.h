@@ -16,6 +16,7 @@ class DeletePacketCreator: public IPacketCreator
 private:
     int create_delete_req(Packet *packet);
     int create_delete_resp(Packet *packet, packet_data *data);
+    int create_delete_progress(Packet *packet, const DeleteProgress *progress);
 
 public:
     explicit DeletePacketCreator();
@@ -40,6 +40,14 @@ int DeletePacketParser::parse_delete_req(Packet *packet)
     assert(packet->_data != NULL);
     packet->Dump();
     parse_credentials(packet);
+
+    DeleteProcessor *_processor = dynamic_cast<DeleteProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("DeletePacketParser::parse_delete_req invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+    _processor->SetProgress(packet->_pb_msg->requestpacket().deleterequest().progress());
     return SMB_SUCCESS;
 }
 
@@ -74,6 +82,28 @@ int DeletePacketParser::parse_delete_error(Packet *packet)
     return SMB_SUCCESS;
 }
 
+/*!
+ * Parse DELETE_PROGRESS_RESP
+ * @param packet - packet to be parsed
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int DeletePacketParser::parse_delete_progress(Packet *packet)
+{
+    DEBUG_LOG("DeletePacketParser::parse_delete_progress");
+    assert(packet->_pb_msg != NULL);
+    packet->Dump();
+    const DeleteProgressResponse &progress = packet->_pb_msg->responsepacket().deleteprogressresponse();
+    INFO_LOG("DeletePacketParser::parse_delete_progress files: %lu folders: %lu failed: %lu%s",
+             progress.files(), progress.folders(), progress.failed(), progress.summary() ? " (summary)" : "");
+    for (int i = 0; i < progress.failures_size(); i++)
+    {
+        INFO_LOG("\t%s %d", progress.failures(i).name().c_str(), progress.failures(i).code());
+    }
+    return SMB_SUCCESS;
+}
+
 /*!
  * Parse credentials
  * @param packet - request packet
@@ -142,6 +172,9 @@ int DeletePacketParser::ParsePacket(Packet *packet)
         case DELETE_ERROR_RESP:
             ret = parse_delete_error(packet);
             break;
+        case DELETE_PROGRESS_RESP:
+            ret = parse_delete_progress(packet);
+            break;
         default:
             ret = SMB_ERROR;
             ERROR_LOG("Invalid Command type");
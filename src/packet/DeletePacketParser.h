@@ -17,6 +17,7 @@ private:
     int parse_delete_req(Packet *packet);
     int parse_delete_resp(Packet *packet);
     int parse_delete_error(Packet *packet);
+    int parse_delete_progress(Packet *packet);
 
     virtual int parse_credentials(Packet *packet);
     virtual int parse_status(const Status &status);
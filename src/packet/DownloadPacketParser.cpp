@@ -28,7 +28,8 @@ DownloadPacketParser::~DownloadPacketParser()
 
 /*!
  *
- * Parse DOWNLOAD_INIT_REQ Packet
+ * Parse DOWNLOAD_INIT_REQ Packet, range sent along with credentials
+ * requests single round-trip download (no DOWNLOAD_DATA_REQ follows)
  * @param packet - packet to be parsed
  * @return
  *      SMB_SUCCESS - Successful
@@ -39,7 +40,24 @@ int DownloadPacketParser::parse_download_req_init(Packet *packet)
     DEBUG_LOG("DownloadPacketParser::parse_download_req_init");
     assert(packet->_pb_msg != NULL);
     parse_credentials(packet);
-    return SMB_SUCCESS;
+    if (!packet->_pb_msg->requestpacket().has_rangedownloadrequest())
+    {
+        return SMB_SUCCESS;
+    }
+
+    DownloadProcessor *_processor = dynamic_cast<DownloadProcessor *>(RequestProcessor::GetInstance());
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("DownloadPacketParser::parse_download_req_init invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+
+    int ret = parse_download_req_data(packet);
+    if (ret == SMB_SUCCESS)
+    {
+        _processor->SetSingleRoundTrip(true);
+    }
+    return ret;
 }
 
 /*!
@@ -8,6 +8,7 @@
 #include "base/Error.h"
 #include "base/Log.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
 #include "OpenDirPacketCreator.h"
 
 
@@ -71,6 +72,45 @@ int OpenDirPacketCreator::create_get_structure_req(Packet *packet)
     f_req->set_pagesize(_processor->PageSize());
     f_req->set_showonlyfolders(_processor->ShowOnlyFolders());
     f_req->set_showhiddenfiles(_processor->ShowHiddenFiles());
+    if (_processor->Level() > 1)
+    {
+        f_req->set_level(_processor->Level());
+    }
+    const ListFilter &filter = _processor->Filter();
+    if (!filter._pattern.empty())
+    {
+        f_req->set_namepattern(filter._pattern);
+    }
+    if (!filter._prefix.empty())
+    {
+        f_req->set_nameprefix(filter._prefix);
+    }
+    if (filter._min_mtime > 0)
+    {
+        f_req->set_minmodifiedtime(filter._min_mtime);
+    }
+    if (filter._max_mtime < UINT64_MAX)
+    {
+        f_req->set_maxmodifiedtime(filter._max_mtime);
+    }
+    if (filter._min_size > 0)
+    {
+        f_req->set_minsize(filter._min_size);
+    }
+    if (filter._max_size < UINT64_MAX)
+    {
+        f_req->set_maxsize(filter._max_size);
+    }
+    if (filter._sort != LIST_SORT_NONE)
+    {
+        f_req->set_sortby(filter._sort == LIST_SORT_NAME ? SORT_NAME :
+                          filter._sort == LIST_SORT_SIZE ? SORT_SIZE : SORT_MODIFIED_TIME);
+        f_req->set_descending(filter._descending);
+    }
+    if (filter._limit > 0)
+    {
+        f_req->set_limit(filter._limit);
+    }
     req->set_allocated_folderstructurerequest(f_req);
 
     packet->PutHeader();
@@ -141,23 +181,16 @@ int OpenDirPacketCreator::create_get_structure_resp(Packet *packet)
     }
     else
     {
-        for (int i = 0; i < _processor->PageSize(); ++i)
+        int entries = _processor->NextPageEntries();
+        size_t page_bytes = 0;
+        uint64_t page_start = Metrics::Now();
+        for (int i = 0; i < entries; ++i)
         {
             if (!_processor->FetchShare())
             {
+                /* tmp files, folders-only, hidden files and request filters are applied by the processor */
                 ptr = _processor->GetFileInfo();
 
-                /* filter smb-connector created tmp files */
-                /* Perform a check for folder */
-                /* Perform a check for hidden files */
-                if (ptr && (strcmp(ptr->name, ".smbconnector") == 0 ||
-                    (!(ptr->attrs & FILE_ATTRIBUTE_DIRECTORY) && _processor->ShowOnlyFolders()) ||
-                    (ptr->attrs & FILE_ATTRIBUTE_HIDDEN && !_processor->ShowHiddenFiles())))
-                {
-                    --i;
-                    continue;
-                }
-
                 if (ptr)
                 {
                     f_info = f_resp->add_fileinformation();
@@ -167,6 +200,11 @@ int OpenDirPacketCreator::create_get_structure_resp(Packet *packet)
                     f_info->set_size(ptr->size);
                     f_info->set_createtime(ptr->btime_ts.tv_sec*SEC_TO_MS + ptr->btime_ts.tv_nsec*NANO_TO_MS);
                     f_info->set_modifiedtime(ptr->mtime_ts.tv_sec*SEC_TO_MS + ptr->mtime_ts.tv_nsec*NANO_TO_MS);
+                    page_bytes += f_info->ByteSize();
+                    if (_processor->PageFull(page_bytes, page_start))
+                    {
+                        break;
+                    }
                 }
                 else if (i > 0)
                 {
@@ -189,6 +227,11 @@ int OpenDirPacketCreator::create_get_structure_resp(Packet *packet)
                     f_info = f_resp->add_fileinformation();
                     f_info->set_name(dirent->name, dirent->namelen);
                     f_info->set_resourcetype(dirent->smbc_type);
+                    page_bytes += f_info->ByteSize();
+                    if (_processor->PageFull(page_bytes, page_start))
+                    {
+                        break;
+                    }
                 }
                 else if (i > 0)
                 {
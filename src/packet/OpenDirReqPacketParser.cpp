@@ -58,6 +58,40 @@ int OpenDirPacketParser::parse_get_structure_req(Packet *packet)
     _processor->SetShowOnlyFolders(packet->_pb_msg->requestpacket().folderstructurerequest().showonlyfolders());
     _processor->SetShowHiddenFiles(packet->_pb_msg->requestpacket().folderstructurerequest().showhiddenfiles());
     _processor->SetPageSize(packet->_pb_msg->requestpacket().folderstructurerequest().pagesize());
+    _processor->SetLevel(packet->_pb_msg->requestpacket().folderstructurerequest().level());
+
+    const FolderStructureRequest &f_req = packet->_pb_msg->requestpacket().folderstructurerequest();
+    ListFilter filter;
+    filter._pattern = f_req.namepattern();
+    filter._prefix = f_req.nameprefix();
+    filter._min_mtime = f_req.minmodifiedtime();
+    if (f_req.has_maxmodifiedtime())
+    {
+        filter._max_mtime = f_req.maxmodifiedtime();
+    }
+    filter._min_size = f_req.minsize();
+    if (f_req.has_maxsize())
+    {
+        filter._max_size = f_req.maxsize();
+    }
+    switch (f_req.sortby())
+    {
+        case SORT_NAME:
+            filter._sort = LIST_SORT_NAME;
+            break;
+        case SORT_MODIFIED_TIME:
+            filter._sort = LIST_SORT_MODIFIED_TIME;
+            break;
+        case SORT_SIZE:
+            filter._sort = LIST_SORT_SIZE;
+            break;
+        default:
+            filter._sort = LIST_SORT_NONE;
+            break;
+    }
+    filter._descending = f_req.descending();
+    filter._limit = f_req.limit();
+    _processor->SetFilter(filter);
 
     /* if the url has '/'
      * the we need to fetch the details about the file or folder
@@ -11,10 +11,25 @@
 #include "base/Log.h"
 #include "base/Protocol.h"
 
+#include <google/protobuf/wire_format.h>
+
+using google::protobuf::internal::WireFormat;
+using google::protobuf::internal::WireFormatLite;
+
+/*
+ * Field path of the upload payload (Message.requestPacket.uploadRequestData.data),
+ * which is left in _data instead of being copied into the protobuf object
+ */
+static const int payload_path[] = {Message::kRequestPacketFieldNumber,
+                                   RequestPacket::kUploadRequestDataFieldNumber,
+                                   UploadRequestData::kDataFieldNumber};
+#define PAYLOAD_PATH_DEPTH (sizeof(payload_path) / sizeof(payload_path[0]))
+
 /*!
  * Constructor
  */
-Packet::Packet() : _complete(false), _hdr_sent(false), _p_len(0), _data(NULL), _pb_msg(NULL)
+Packet::Packet() : _complete(false), _hdr_sent(false), _p_len(0), _data(NULL), _pb_msg(NULL),
+                   _payload(NULL), _payload_len(0), _timestamp(0)
 {
     memset(_header, 0, HEADER_SIZE);
 }
@@ -110,11 +125,14 @@ int Packet::ParseProtoBuffer()
         return SMB_ALLOCATION_FAILED;
     }
 
-    if (!_pb_msg->ParseFromArray(_data, GetLength()))
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t *>(_data), GetLength());
+    if (!parse_aliased(&input, _pb_msg, 0) || !input.ConsumedEntireMessage() || !_pb_msg->IsInitialized())
     {
         ERROR_LOG("Packet::ParseProtoBuffer Cannot parse Message");
         FREE(_pb_msg);
         _pb_msg = NULL;
+        _payload = NULL;
+        _payload_len = 0;
         return SMB_ERROR;
     }
     else
@@ -124,6 +142,70 @@ int Packet::ParseProtoBuffer()
     }
 }
 
+/*!
+ * Merge fields from input into msg, except the upload payload bytes field which
+ * is only located (_payload, _payload_len) inside _data and skipped
+ * @param input - stream over _data
+ * @param msg - message to be filled
+ * @param depth - current index in payload_path
+ * @return
+ * true - successful
+ * false - malformed input
+ */
+bool Packet::parse_aliased(google::protobuf::io::CodedInputStream *input, google::protobuf::Message *msg,
+                           unsigned int depth)
+{
+    const google::protobuf::Reflection *reflection = msg->GetReflection();
+    uint32_t tag;
+
+    while ((tag = input->ReadTag()) != 0)
+    {
+        const google::protobuf::FieldDescriptor *field =
+            msg->GetDescriptor()->FindFieldByNumber(WireFormatLite::GetTagFieldNumber(tag));
+
+        if (field == NULL || field->number() != payload_path[depth]
+            || WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+        {
+            if (!WireFormat::ParseAndMergeField(tag, field, msg, input))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        uint32_t len = 0;
+        if (!input->ReadVarint32(&len))
+        {
+            return false;
+        }
+
+        if (depth == PAYLOAD_PATH_DEPTH - 1)
+        {
+            int offset = input->CurrentPosition();
+            if (!input->Skip(len))
+            {
+                return false;
+            }
+            /* mark the (required) field as present, payload itself stays in _data */
+            reflection->SetString(msg, field, std::string());
+            _payload = _data + offset;
+            _payload_len = len;
+        }
+        else
+        {
+            google::protobuf::io::CodedInputStream::Limit limit = input->PushLimit(len);
+            if (!parse_aliased(input, reflection->MutableMessage(msg, field), depth + 1)
+                || !input->ConsumedEntireMessage())
+            {
+                return false;
+            }
+            input->PopLimit(limit);
+        }
+    }
+
+    return true;
+}
+
 /*!
  * Reset packet and clear all member variables
  * @return
@@ -142,6 +224,9 @@ int Packet::Reset()
         FREE(_pb_msg);
         _pb_msg = NULL;
     }
+    _payload = NULL;
+    _payload_len = 0;
+    _timestamp = 0;
     _p_len = 0;
     _complete = false;
     memset(_header, 0, HEADER_SIZE);
@@ -12,6 +12,8 @@
 #include "base/Constants.h"
 #include "protocol_buffers/common.pb.h"
 
+#include <google/protobuf/io/coded_stream.h>
+
 struct Packet
 {
     bool _complete;
@@ -20,6 +22,9 @@ struct Packet
     unsigned int _p_len; //received/sent payload-length
     char *_data;
     Message *_pb_msg;
+    char *_payload; //upload payload, points into _data (not owned)
+    unsigned int _payload_len;
+    uint64_t _timestamp; //Metrics::Now() request was completely received, set while capturing
 
     Packet();
     ~Packet();
@@ -32,6 +37,8 @@ struct Packet
     int PutData();
 
     int ParseProtoBuffer();
+    bool parse_aliased(google::protobuf::io::CodedInputStream *input, google::protobuf::Message *msg,
+                       unsigned int depth);
 
     int Reset();
     void Dump();
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Metrics.h"
+#include "base/Protocol.h"
+#include "StatsPacketCreator.h"
+
+/*!
+ * Constructor
+ */
+StatsPacketCreator::StatsPacketCreator()
+{
+    //Constructor
+}
+
+/*!
+ * Destructor
+ */
+StatsPacketCreator::~StatsPacketCreator()
+{
+    //Destructor
+}
+
+/*!
+ * Creates STATS_REQ packet
+ * @param packet - request packet
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int StatsPacketCreator::create_stats_req(Packet *packet)
+{
+    DEBUG_LOG("StatsPacketCreator::create_stats_req");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    RequestProcessor *_processor = RequestProcessor::GetInstance();
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("StatsPacketCreator::create_stats_req invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    if (!ALLOCATED(cmd))
+    {
+        ERROR_LOG("StatsPacketCreator::create_stats_req, memory allocation failed");
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+    cmd->set_cmd(STATS_REQ);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("StatsPacketCreator::create_stats_req packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates STATS_RESP packet with current metrics
+ * @param packet - response packet
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int StatsPacketCreator::create_stats_resp(Packet *packet)
+{
+    DEBUG_LOG("StatsPacketCreator::create_stats_resp");
+    assert(packet != NULL);
+    assert(packet->_pb_msg != NULL);
+
+    RequestProcessor *_processor = RequestProcessor::GetInstance();
+    if (IS_NULL(_processor))
+    {
+        ERROR_LOG("StatsPacketCreator::create_stats_resp invalid RequestProcessor");
+        return SMB_ERROR;
+    }
+
+    Command *cmd = ALLOCATE(Command);
+    ResponsePacket *resp = ALLOCATE(ResponsePacket);
+    StatsResponse *s_resp = ALLOCATE(StatsResponse);
+    if (!ALLOCATED(cmd) || !ALLOCATED(resp) || !ALLOCATED(s_resp))
+    {
+        ERROR_LOG("StatsPacketCreator::create_stats_resp, memory allocation failed");
+        FREE(cmd);
+        FREE(resp);
+        FREE(s_resp);
+        FREE(packet->_pb_msg);
+        return SMB_ALLOCATION_FAILED;
+    }
+    cmd->set_cmd(STATS_RESP);
+    cmd->set_requestid(_processor->RequestId());
+    packet->_pb_msg->set_allocated_command(cmd);
+
+    std::string stats;
+    Metrics::GetInstance().Dump(stats);
+    s_resp->set_stats(stats);
+    resp->set_allocated_statsresponse(s_resp);
+    packet->_pb_msg->set_allocated_responsepacket(resp);
+
+    /*Construct Packet */
+    packet->PutHeader();
+    if (packet->PutData() != SMB_SUCCESS)
+    {
+        ERROR_LOG("StatsPacketCreator::create_stats_resp packet creation failed");
+        FREE(packet->_pb_msg); /*pb will take care of freeing up all resources contained in it */
+        return SMB_ERROR;
+    }
+    packet->Dump();
+
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Creates packet for stats module
+ * @param packet - out packet
+ * @param op_code - operation code
+ * @param data - additional data
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int StatsPacketCreator::CreatePacket(Packet *packet, int op_code, void *data)
+{
+    DEBUG_LOG("StatsPacketCreator::CreatePacket");
+    if (packet == NULL)
+    {
+        ERROR_LOG("StatsPacketCreator::CreatePacket, NULL packet");
+        return SMB_ERROR;
+    }
+
+    packet->_pb_msg = ALLOCATE(Message);
+    if (!ALLOCATED(packet->_pb_msg))
+    {
+        ERROR_LOG("StatsPacketCreator::CreatePacket, memory allocation failed");
+        return SMB_ALLOCATION_FAILED;
+    }
+
+    switch (op_code)
+    {
+        case STATS_REQ:
+            return create_stats_req(packet);
+        case STATS_RESP:
+            return create_stats_resp(packet);
+        default:
+            ERROR_LOG("invalid op_code");
+            FREE(packet->_pb_msg);
+            break;
+    }
+    return SMB_ERROR;
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef STATS_PACKET_CREATOR_H_
+#define STATS_PACKET_CREATOR_H_
+
+#include "IPacketCreator.h"
+#include "processor/StatsProcessor.h"
+
+class StatsPacketCreator: public IPacketCreator
+{
+private:
+    int create_stats_req(Packet *packet);
+    int create_stats_resp(Packet *packet);
+
+public:
+    explicit StatsPacketCreator();
+    virtual ~StatsPacketCreator();
+    int CreatePacket(Packet *packet, int op_code, void *data);
+};
+
+
+#endif //STATS_PACKET_CREATOR_H_
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "StatsPacketParser.h"
+#include "base/Log.h"
+#include "Packet.h"
+#include "base/Error.h"
+#include "base/Protocol.h"
+
+/*!
+ * Constructor
+ */
+StatsPacketParser::StatsPacketParser()
+{
+    //Constructor
+}
+
+/*!
+ * Destructor
+ */
+StatsPacketParser::~StatsPacketParser()
+{
+    //Destructor
+}
+
+/*!
+ * Parse stats request packet, carries no data
+ * @param packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int StatsPacketParser::parse_stats_req(Packet *packet)
+{
+    DEBUG_LOG("StatsPacketParser::parse_stats_req");
+    assert(packet->_data != NULL);
+    packet->Dump();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse stats response
+ * @param packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int StatsPacketParser::parse_stats_resp(Packet *packet)
+{
+    DEBUG_LOG("StatsPacketParser::parse_stats_resp");
+    assert(packet->_pb_msg != NULL);
+    if (!packet->_pb_msg->has_responsepacket() || !packet->_pb_msg->responsepacket().has_statsresponse())
+    {
+        ERROR_LOG("StatsPacketParser::parse_stats_resp missing stats");
+        return SMB_INVALID_PACKET;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse stats error
+ * @param packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int StatsPacketParser::parse_stats_error(Packet *packet)
+{
+    DEBUG_LOG("StatsPacketParser::parse_stats_error");
+    assert(packet->_pb_msg != NULL);
+    parse_status(packet->_pb_msg->status());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Stats are not tied to a share, no credentials required
+ * @param packet - request packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ */
+int StatsPacketParser::parse_credentials(Packet *packet)
+{
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Parse error/status msg for stats
+ * @param status
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int StatsPacketParser::parse_status(const Status &status)
+{
+    DEBUG_LOG("StatsPacketParser::parse_status");
+    IPacketParser::parse_status(status);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Verify request id
+ * @param packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int StatsPacketParser::verify_request_id(Packet *packet)
+{
+    return IPacketParser::verify_request_id(packet);
+}
+
+/*!
+ * Parse incoming packet for stats module
+ * @param packet - request packet
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ERROR - Failed
+ */
+int StatsPacketParser::ParsePacket(Packet *packet)
+{
+    DEBUG_LOG("StatsPacketParser::ParsePacket");
+    assert(packet);
+    int ret;
+
+    if (verify_request_id(packet) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+
+    switch (packet->GetCMD())
+    {
+        case STATS_REQ:
+            ret = parse_stats_req(packet);
+            break;
+        case STATS_RESP:
+            ret = parse_stats_resp(packet);
+            break;
+        case STATS_ERROR_RESP:
+            ret = parse_stats_error(packet);
+            break;
+        default:
+            ret = SMB_ERROR;
+            ERROR_LOG("Invalid Command type");
+    }
+    return ret;
+}
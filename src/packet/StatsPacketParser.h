@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef STATS_PACKET_PARSER_H_
+#define STATS_PACKET_PARSER_H_
+
+#include "IPacketParser.h"
+#include "processor/StatsProcessor.h"
+
+class StatsPacketParser : public IPacketParser
+{
+private:
+    int parse_stats_req(Packet *packet);
+    int parse_stats_resp(Packet *packet);
+    int parse_stats_error(Packet *packet);
+
+    virtual int parse_credentials(Packet *packet);
+    virtual int parse_status(const Status &status);
+    virtual int verify_request_id(Packet *packet);
+
+public:
+    explicit StatsPacketParser();
+    ~StatsPacketParser();
+    virtual int ParsePacket(Packet *packet);
+};
+
+
+#endif //STATS_PACKET_PARSER_H_
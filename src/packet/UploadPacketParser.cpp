@@ -27,7 +27,7 @@ UploadPacketParser::~UploadPacketParser()
 }
 
 /*!
- * Parse DOWNLOAD_UPLOAD_REQ_INIT packet
+ * Parse DOWNLOAD_UPLOAD_REQ_INIT packet, may carry inline data
  * @param packet- request packet
  * @return
  *      SMB_SUCCESS - Successful
@@ -39,6 +39,11 @@ int UploadPacketParser::parse_upload_req_init(Packet *packet)
     assert(packet->_pb_msg != NULL);
     packet->Dump();
     parse_credentials(packet);
+    if (packet->_pb_msg->requestpacket().has_uploadrequestdata())
+    {
+        /* inline data */
+        return parse_upload_req_data(packet);
+    }
     return SMB_SUCCESS;
 }
 
@@ -70,6 +75,13 @@ int UploadPacketParser::parse_upload_req_data(Packet *packet)
     DEBUG_LOG("UploadPacketParser::parse_upload_req_data");
     assert(packet->_data != NULL);
     packet->Dump();
+    if (packet->_payload == NULL)
+    {
+        /* packet was not parsed from wire (e.g. created locally), payload lives in the protobuf object */
+        std::string *data = packet->_pb_msg->mutable_requestpacket()->mutable_uploadrequestdata()->mutable_data();
+        packet->_payload = &(*data)[0];
+        packet->_payload_len = data->size();
+    }
     return SMB_SUCCESS;
 }
 
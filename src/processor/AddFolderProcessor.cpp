@@ -10,6 +10,7 @@
 #include "base/Error.h"
 #include "base/Log.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
 #include "packet/AddFolderPacketCreator.h"
 #include "packet/AddFolderPacketParser.h"
 
@@ -39,12 +40,18 @@ AddFolderProcessor::~AddFolderProcessor()
 int AddFolderProcessor::process_add_folder_req()
 {
     DEBUG_LOG("AddFolderProcessor::process_add_folder_req");
+    Metrics &metrics = Metrics::GetInstance();
+    uint64_t start = Metrics::Now();
+    metrics.Count(METRIC_OP_ADD_FOLDER, METRIC_REQUESTS);
+
     SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
     int ret = SmbClient::GetInstance()->CreateDirectory();
+    metrics.RecordSince(METRIC_OP_ADD_FOLDER, METRIC_LAT_TOTAL, start);
 
     if (ret != SMB_SUCCESS)
     {
         ERROR_LOG("AddFolderProcessor::process_add_folder_req add folder %s failed", _url.c_str());
+        metrics.Count(METRIC_OP_ADD_FOLDER, METRIC_ERRORS);
         ret = errno;
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, ADD_FOLDER_ERROR_RESP, ret, true);
@@ -71,8 +78,8 @@ int AddFolderProcessor::process_add_folder_req()
 int AddFolderProcessor::process_add_folder_req_resp()
 {
     DEBUG_LOG("AddFolderProcessor::process_add_folder_req_resp");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -88,8 +95,8 @@ int AddFolderProcessor::process_add_folder_req_resp()
 int AddFolderProcessor::process_add_folder_req_error()
 {
     DEBUG_LOG("AddFolderProcessor::process_add_folder_req_error");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <chrono>
+#include <future>
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Protocol.h"
+#include "base/Metrics.h"
+#include "packet/BatchStatPacketParser.h"
+#include "packet/BatchStatPacketCreator.h"
+
+/*!
+ * Constructor
+ */
+BatchStatProcessor::BatchStatProcessor() : _next(0), _completed(0), _stop(false)
+{
+    //Constructor
+}
+
+/*!
+ * Destructor
+ */
+BatchStatProcessor::~BatchStatProcessor()
+{
+    stop_workers();
+}
+
+/*!
+ * Url of path
+ * @param path - path relative to the url of the request
+ * @return
+ * smb://server/share/path
+ */
+std::string BatchStatProcessor::url(const std::string &path) const
+{
+    std::string url = "smb://" + _url;
+    size_t start = path.find_first_not_of('/');
+    if (start == std::string::npos)
+    {
+        return url;
+    }
+    if (url[url.size() - 1] != '/')
+    {
+        url += '/';
+    }
+    return url + path.substr(start);
+}
+
+/*!
+ * Process BATCH_STAT_REQ packet, paths are stat'ed and the results sent in other thread
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int BatchStatProcessor::process_batch_stat_req()
+{
+    DEBUG_LOG("BatchStatProcessor::process_batch_stat_req %lu paths", (unsigned long) _paths.size());
+    Metrics::GetInstance().Count(METRIC_OP_BATCH_STAT, METRIC_REQUESTS);
+
+    SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
+    _next = 0;
+    _completed = 0;
+    _results.clear();
+    _stop = false;
+    _async_operation = ALLOCATE(std::thread, &BatchStatProcessor::send_results_async, this);
+    if (!ALLOCATED(_async_operation))
+    {
+        ERROR_LOG("BatchStatProcessor::process_batch_stat_req allocation failed");
+        _async_operation = NULL;
+        Metrics::GetInstance().Count(METRIC_OP_BATCH_STAT, METRIC_ERRORS);
+        Packet *resp = ALLOCATE(Packet);
+        _packet_creator->CreateStatusPacket(resp, BATCH_STAT_ERROR_RESP, SMB_ALLOCATION_FAILED);
+        _sessionManager->PushResponse(resp);
+        _sessionManager->ProcessWriteEvent();
+        return SMB_ALLOCATION_FAILED;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process BATCH_STAT_RESP packet
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int BatchStatProcessor::process_batch_stat_resp()
+{
+    DEBUG_LOG("BatchStatProcessor::process_batch_stat_resp");
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process BATCH_STAT_END_RESP packet
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int BatchStatProcessor::process_batch_stat_end()
+{
+    DEBUG_LOG("BatchStatProcessor::process_batch_stat_end");
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
+    {
+        should_exit = 1;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process BATCH_STAT_ERROR_RESP packet
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int BatchStatProcessor::process_batch_stat_error()
+{
+    DEBUG_LOG("BatchStatProcessor::process_batch_stat_error");
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
+    {
+        should_exit = 1;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Sends results in pages of up to BATCH_STAT_PAGE as the workers complete them,
+ * BATCH_STAT_END_RESP follows the last page
+ * @return
+ * SMB_SUCCESS - all results sent
+ * Otherwise - failure
+ */
+int BatchStatProcessor::send_results_async()
+{
+    DEBUG_LOG("BatchStatProcessor::send_results_async");
+    Metrics &metrics = Metrics::GetInstance();
+    uint64_t start = Metrics::Now();
+    bool first_page = true;
+    start_workers();
+
+    while (!_should_exit)
+    {
+        BatchStatResults page;
+        bool done = false;
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _cv.wait_for(lock, std::chrono::milliseconds(100),
+                         [this] { return !_results.empty() || _completed == _paths.size(); });
+            while (!_results.empty() && page.size() < BATCH_STAT_PAGE)
+            {
+                page.push_back(_results.front());
+                _results.pop_front();
+            }
+            done = _results.empty() && _completed == _paths.size();
+        }
+
+        if (!page.empty())
+        {
+            Packet *resp = ALLOCATE(Packet);
+            int ret = _packet_creator->CreatePacket(resp, BATCH_STAT_RESP, &page);
+            if (ret != SMB_SUCCESS)
+            {
+                ERROR_LOG("BatchStatProcessor::send_results_async packet creation failed");
+                metrics.Count(METRIC_OP_BATCH_STAT, METRIC_ERRORS);
+                _packet_creator->CreateStatusPacket(resp, BATCH_STAT_ERROR_RESP, ret);
+                _sessionManager->PushResponse(resp);
+                _sessionManager->ProcessWriteEvent();
+                stop_workers();
+                return ret;
+            }
+            if (first_page)
+            {
+                first_page = false;
+                metrics.RecordSince(METRIC_OP_BATCH_STAT, METRIC_LAT_FIRST_BYTE, start);
+            }
+            metrics.Count(METRIC_OP_BATCH_STAT, METRIC_CHUNKS);
+            _sessionManager->PushResponse(resp);
+            if (_sessionManager->ProcessWriteEvent() != SMB_SUCCESS)
+            {
+                ERROR_LOG("BatchStatProcessor::send_results_async send failed, abort now");
+                metrics.Count(METRIC_OP_BATCH_STAT, METRIC_ERRORS);
+                stop_workers();
+                return SMB_ERROR;
+            }
+        }
+
+        if (done)
+        {
+            DEBUG_LOG("BatchStatProcessor::send_results_async, all results sent, send <end> packet");
+            Packet *resp = ALLOCATE(Packet);
+            _packet_creator->CreatePacket(resp, BATCH_STAT_END_RESP, NULL);
+            _sessionManager->PushResponse(resp);
+            _sessionManager->ProcessWriteEvent();
+            metrics.RecordSince(METRIC_OP_BATCH_STAT, METRIC_LAT_TOTAL, start);
+            break;
+        }
+    }
+
+    stop_workers();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Start workers, one per BATCH_STAT_PER_WORKER paths up to stat_workers.
+ * First worker uses the context of the session, every other worker gets
+ * a context of its own (shared when the backend is thread safe)
+ */
+void BatchStatProcessor::start_workers()
+{
+    unsigned int workers = Configuration::GetInstance().Snapshot().stat_workers;
+    size_t needed = (_paths.size() + BATCH_STAT_PER_WORKER - 1) / BATCH_STAT_PER_WORKER;
+    if (needed < workers)
+    {
+        workers = (unsigned int) needed;
+    }
+    IStorageBackend *backend = SmbClient::GetInstance()->Backend();
+
+    for (unsigned int i = 0; i < workers || (i == 0 && !_paths.empty()); i++)
+    {
+        IStorageBackend *context = i == 0 ? backend : backend->Fork();
+        if (context == NULL)
+        {
+            WARNING_LOG("BatchStatProcessor::start_workers no context for worker %u, stat with %u workers", i, i);
+            break;
+        }
+        std::thread *worker = ALLOCATE(std::thread, &BatchStatProcessor::stat_paths, this, context);
+        if (!ALLOCATED(worker))
+        {
+            WARNING_LOG("BatchStatProcessor::start_workers allocation failed, stat with %u workers", i);
+            if (context != backend)
+            {
+                FREE(context);
+            }
+            break;
+        }
+        _workers.push_back(worker);
+        if (context != backend)
+        {
+            _worker_backends.push_back(context);
+        }
+    }
+
+    if (_workers.empty() && !_paths.empty())
+    {
+        stat_paths(backend);
+    }
+}
+
+/*!
+ * Stop workers, paths not stat'ed yet are skipped
+ */
+void BatchStatProcessor::stop_workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        _workers[i]->join();
+        FREE(_workers[i]);
+    }
+    _workers.clear();
+    for (size_t i = 0; i < _worker_backends.size(); i++)
+    {
+        FREE(_worker_backends[i]);
+    }
+    _worker_backends.clear();
+}
+
+/*!
+ * Worker, stats the next path not claimed by other workers till all are done
+ * @param backend - context of this worker
+ */
+void BatchStatProcessor::stat_paths(IStorageBackend *backend)
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (!_stop && _next < _paths.size())
+    {
+        BatchStatResult result;
+        result._index = (uint32_t) _next++;
+        const std::string &path = _paths[result._index];
+        lock.unlock();
+
+        memset(&result._st, 0, sizeof(result._st));
+        result._error = 0;
+        if (!IStorageBackend::ValidPath(path))
+        {
+            result._error = EINVAL;
+        }
+        else if (backend->Stat(url(path), &result._st) != 0)
+        {
+            result._error = errno ? errno : EIO;
+        }
+
+        lock.lock();
+        _results.push_back(result);
+        _completed++;
+        _cv.notify_all();
+    }
+}
+
+/*!
+ * Initialisation
+ * @param request_id - request_id
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int BatchStatProcessor::Init(std::string &request_id)
+{
+    DEBUG_LOG("BatchStatProcessor::Init");
+    _packet_parser = new BatchStatPacketParser();
+    _packet_creator = new BatchStatPacketCreator();
+    return RequestProcessor::Init(request_id);
+}
+
+/*!
+ * Process requests from Client
+ * @param packet
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int BatchStatProcessor::ProcessRequest(Packet *packet)
+{
+    DEBUG_LOG("BatchStatProcessor::ProcessRequest");
+
+    assert(packet != NULL);
+    assert(packet->_data != NULL);
+
+    if (packet == NULL || packet->_data == NULL)
+    {
+        ERROR_LOG("BatchStatProcessor::ProcessRequest NULL packet");
+        return SMB_ERROR;
+    }
+
+    int ret = _packet_parser->ParsePacket(packet);
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("BatchStatProcessor::ProcessRequest malformed packet, send error");
+        Packet *resp = ALLOCATE(Packet);
+        _packet_creator->CreateStatusPacket(resp, BATCH_STAT_ERROR_RESP, ret);
+        _sessionManager->PushResponse(resp);
+        _sessionManager->ProcessWriteEvent();
+        return ret;
+    }
+
+    DEBUG_LOG("BatchStatProcessor::ProcessRequest Command %s", ProtocolCommand(packet->GetCMD()));
+    switch (packet->GetCMD())
+    {
+        case BATCH_STAT_REQ:
+            ret = process_batch_stat_req();
+            break;
+        case BATCH_STAT_RESP:
+            ret = process_batch_stat_resp();
+            break;
+        case BATCH_STAT_END_RESP:
+            ret = process_batch_stat_end();
+            break;
+        case BATCH_STAT_ERROR_RESP:
+            ret = process_batch_stat_error();
+            break;
+        default:
+            ERROR_LOG("Invalid command");
+            ret = SMB_INVALID_PACKET;
+            break;
+    }
+
+    return ret;
+}
+
+/*!
+ * getter for paths
+ * @return
+ */
+const std::vector<std::string> &BatchStatProcessor::Paths() const
+{
+    return _paths;
+}
+
+/*!
+ * setter for paths
+ */
+void BatchStatProcessor::SetPaths(const std::vector<std::string> &paths)
+{
+    _paths = paths;
+}
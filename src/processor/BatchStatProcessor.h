@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef BATCH_STAT_PROCESSOR_H_
+#define BATCH_STAT_PROCESSOR_H_
+
+#include <deque>
+#include <vector>
+
+#include "RequestProcessor.h"
+
+#define BATCH_STAT_PER_WORKER   16      //paths per worker, small batches are stat'ed by fewer workers
+#define BATCH_STAT_PAGE         256     //results per BATCH_STAT_RESP
+
+/*
+ * Result of one path of a batch stat request
+ */
+struct BatchStatResult
+{
+    uint32_t _index;        //position of the path in the request
+    int _error;             //errno, 0 - _st is valid
+    struct stat _st;
+};
+
+typedef std::vector<BatchStatResult> BatchStatResults;
+
+class BatchStatProcessor: public RequestProcessor
+{
+private:
+    std::vector<std::string> _paths;
+
+    /* workers stat paths in _paths order, results are sent as they complete */
+    std::vector<std::thread *> _workers;
+    std::vector<IStorageBackend *> _worker_backends;   //forked contexts of workers
+    std::mutex _mtx;
+    std::condition_variable _cv;
+    size_t _next;                   //next path to be stat'ed
+    size_t _completed;              //paths stat'ed
+    std::deque<BatchStatResult> _results;   //completed, not sent yet
+    bool _stop;
+
+    int process_batch_stat_req();
+    int process_batch_stat_resp();
+    int process_batch_stat_end();
+    int process_batch_stat_error();
+    int send_results_async();
+    void start_workers();
+    void stop_workers();
+    void stat_paths(IStorageBackend *backend);
+    std::string url(const std::string &path) const;
+
+public:
+    BatchStatProcessor();
+    virtual ~BatchStatProcessor();
+
+    virtual int Init(std::string &request_id);
+    virtual int ProcessRequest(Packet *packet);
+
+    const std::vector<std::string> &Paths() const;
+    void SetPaths(const std::vector<std::string> &paths);
+};
+
+#endif //BATCH_STAT_PROCESSOR_H_
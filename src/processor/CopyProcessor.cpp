@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <string.h>
+
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Protocol.h"
+#include "base/Metrics.h"
+#include "packet/CopyPacketParser.h"
+#include "packet/CopyPacketCreator.h"
+
+/*!
+ * Constructor
+ * @param move - true - MOVE_* commands, otherwise COPY_*
+ */
+CopyProcessor::CopyProcessor(bool move) : _move(move), _overwrite(false), _progress(false)
+{
+    //Constructor
+}
+
+/*!
+ * Destructor
+ */
+CopyProcessor::~CopyProcessor()
+{
+    //Destructor
+}
+
+/*!
+ * Command of this processor
+ * @param copy_cmd - COPY_* command
+ * @return
+ * copy_cmd for copy, the MOVE_* counterpart for move
+ */
+int CopyProcessor::Command(int copy_cmd) const
+{
+    return _move ? copy_cmd + (MOVE_REQ - COPY_REQ) : copy_cmd;
+}
+
+/*!
+ * Send COPY_PROGRESS_RESP/MOVE_PROGRESS_RESP to client
+ * @param progress - bytes copied so far
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int CopyProcessor::send_progress(const CopyProgress &progress)
+{
+    Packet *resp = ALLOCATE(Packet);
+    int ret = _packet_creator->CreatePacket(resp, Command(COPY_PROGRESS_RESP), const_cast<CopyProgress *>(&progress));
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("CopyProcessor::send_progress packet creation failed");
+        FREE(resp);
+        return ret;
+    }
+    _sessionManager->PushResponse(resp);
+    _sessionManager->ProcessWriteEvent();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Send COPY_ERROR_RESP/MOVE_ERROR_RESP to client
+ * @param status_code - error code
+ * @param smbc_status - status_code is errno
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int CopyProcessor::send_error(int status_code, bool smbc_status)
+{
+    Metrics::GetInstance().Count(_move ? METRIC_OP_MOVE : METRIC_OP_COPY, METRIC_ERRORS);
+    Packet *resp = ALLOCATE(Packet);
+    _packet_creator->CreateStatusPacket(resp, Command(COPY_ERROR_RESP), status_code, smbc_status);
+    _sessionManager->PushResponse(resp);
+    _sessionManager->ProcessWriteEvent();
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process copy/move request from client
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int CopyProcessor::process_copy_req()
+{
+    DEBUG_LOG("CopyProcessor::process_copy_req %s %s to %s", _move ? "move" : "copy", _url.c_str(),
+              _destination.c_str());
+    Metrics &metrics = Metrics::GetInstance();
+    MetricOp op = _move ? METRIC_OP_MOVE : METRIC_OP_COPY;
+    uint64_t start = Metrics::Now();
+    metrics.Count(op, METRIC_REQUESTS);
+
+    if (_destination.empty() || !IStorageBackend::ValidPath(_destination))
+    {
+        ERROR_LOG("CopyProcessor::process_copy_req invalid destination '%s'", _destination.c_str());
+        send_error(EINVAL, true);
+        return SMB_ERROR;
+    }
+
+    SmbClient *client = SmbClient::GetInstance();
+    client->CredentialsInit(_url, _work_group, _user_name, _password);
+    CopyProgress summary;
+    CopyProgressCallback progress;
+    if (_progress)
+    {
+        progress = [this](const CopyProgress &current) { send_progress(current); };
+    }
+    int ret = _move ? client->Move(_destination, _overwrite, &summary, progress)
+                    : client->Copy(_destination, _overwrite, &summary, progress);
+    int err = errno;
+    metrics.RecordSince(op, METRIC_LAT_TOTAL, start);
+    metrics.Count(op, METRIC_BYTES, summary._bytes);
+
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("CopyProcessor::process_copy_req %s %s failed", _move ? "move" : "copy", _url.c_str());
+        send_error(err, true);
+        return SMB_ERROR;
+    }
+
+    CopyResult result;
+    memset(&result._st, 0, sizeof(result._st));
+    result._server_side = summary._server_side;
+    if (client->Backend()->Stat("smb://" + _destination, &result._st) != 0)
+    {
+        WARNING_LOG("CopyProcessor::process_copy_req stat of %s failed, errno %d", _destination.c_str(), errno);
+    }
+
+    Packet *resp = ALLOCATE(Packet);
+    _packet_creator->CreatePacket(resp, Command(COPY_RESP), &result);
+    _sessionManager->PushResponse(resp);
+    _sessionManager->ProcessWriteEvent();
+
+    DEBUG_LOG("CopyProcessor::process_copy_req %s done", _url.c_str());
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process copy/move response
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int CopyProcessor::process_copy_resp()
+{
+    DEBUG_LOG("CopyProcessor::process_copy_resp");
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
+    {
+        should_exit = 1;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process error happened during copy/move
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int CopyProcessor::process_copy_error()
+{
+    DEBUG_LOG("CopyProcessor::process_copy_error");
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
+    {
+        should_exit = 1;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Initialisation
+ * @param request_id - request_id
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int CopyProcessor::Init(std::string &request_id)
+{
+    DEBUG_LOG("CopyProcessor::Init");
+    _packet_parser = new CopyPacketParser();
+    _packet_creator = new CopyPacketCreator();
+    return RequestProcessor::Init(request_id);
+}
+
+/*!
+ * Process requests from Client
+ * @param packet
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int CopyProcessor::ProcessRequest(Packet *packet)
+{
+    DEBUG_LOG("CopyProcessor::ProcessRequest");
+
+    assert(packet != NULL);
+    assert(packet->_data != NULL);
+
+    if (packet == NULL || packet->_data == NULL)
+    {
+        ERROR_LOG("CopyProcessor::ProcessRequest NULL packet");
+        return SMB_ERROR;
+    }
+
+    int ret = _packet_parser->ParsePacket(packet);
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("CopyProcessor::ProcessRequest malformed packet, send error");
+        send_error(ret, false);
+        return ret;
+    }
+
+    DEBUG_LOG("CopyProcessor::ProcessRequest Command %s", ProtocolCommand(packet->GetCMD()));
+    switch (packet->GetCMD())
+    {
+        case COPY_REQ:
+        case MOVE_REQ:
+            ret = process_copy_req();
+            break;
+        case COPY_RESP:
+        case MOVE_RESP:
+            ret = process_copy_resp();
+            break;
+        case COPY_ERROR_RESP:
+        case MOVE_ERROR_RESP:
+            ret = process_copy_error();
+            break;
+        case COPY_PROGRESS_RESP:
+        case MOVE_PROGRESS_RESP:
+            ret = SMB_SUCCESS;
+            break;
+        default:
+            ERROR_LOG("Invalid command");
+            ret = SMB_INVALID_PACKET;
+            break;
+    }
+
+    return ret;
+}
+
+/*!
+ * Processor moves, otherwise copies
+ * @return
+ * true - move
+ * false - copy
+ */
+bool CopyProcessor::Move() const
+{
+    return _move;
+}
+
+/*!
+ * getter for destination
+ * @return
+ * server/share/path
+ */
+const std::string &CopyProcessor::Destination() const
+{
+    return _destination;
+}
+
+/*!
+ * setter for destination
+ * @param destination - server/share/path
+ */
+void CopyProcessor::SetDestination(const std::string &destination)
+{
+    _destination = destination;
+}
+
+/*!
+ * Existing destination is replaced
+ * @return
+ * true - replace
+ * false - request fails with EEXIST
+ */
+bool CopyProcessor::Overwrite() const
+{
+    return _overwrite;
+}
+
+/*!
+ * setter for overwrite
+ * @param overwrite - true - replace existing destination
+ */
+void CopyProcessor::SetOverwrite(bool overwrite)
+{
+    _overwrite = overwrite;
+}
+
+/*!
+ * Progress of the copy requested
+ * @return
+ * true - progress is sent
+ * false - only the final response is sent
+ */
+bool CopyProcessor::Progress() const
+{
+    return _progress;
+}
+
+/*!
+ * Request progress of the copy
+ * @param progress - true - send progress
+ */
+void CopyProcessor::SetProgress(bool progress)
+{
+    _progress = progress;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef COPY_PROCESSOR_H_
+#define COPY_PROCESSOR_H_
+
+#include "RequestProcessor.h"
+
+/*
+ * Result of a copy/move sent with COPY_RESP/MOVE_RESP
+ */
+struct CopyResult
+{
+    struct stat _st;        //destination
+    bool _server_side;      //data was copied by the server
+};
+
+/*
+ * Copy (COPY_REQ) or move (MOVE_REQ) of the request url to the destination,
+ * data does not pass through the client
+ */
+class CopyProcessor: public RequestProcessor
+{
+private:
+    bool _move;             //MOVE_* commands, otherwise COPY_*
+    std::string _destination;   //server/share/path
+    bool _overwrite;        //existing destination is replaced
+    bool _progress;         //client asked for progress
+
+    int send_progress(const CopyProgress &progress);
+    int send_error(int status_code, bool smbc_status);
+    int process_copy_req();
+    int process_copy_resp();
+    int process_copy_error();
+
+public:
+    explicit CopyProcessor(bool move = false);
+    virtual ~CopyProcessor();
+
+    virtual int Init(std::string &request_id);
+    int ProcessRequest(Packet *packet);
+
+    int Command(int copy_cmd) const;
+
+    bool Move() const;
+    const std::string &Destination() const;
+    void SetDestination(const std::string &destination);
+    bool Overwrite() const;
+    void SetOverwrite(bool overwrite);
+    bool Progress() const;
+    void SetProgress(bool progress);
+};
+
+#endif //COPY_PROCESSOR_H_
@@ -10,13 +10,14 @@
 #include "base/Error.h"
 #include "base/Log.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
 #include "packet/DeletePacketParser.h"
 #include "packet/DeletePacketCreator.h"
 
 /*!
  * Constructor
  */
-DeleteProcessor::DeleteProcessor()
+DeleteProcessor::DeleteProcessor() : _progress(false)
 {
     //Constructor
 }
@@ -29,6 +30,28 @@ DeleteProcessor::~DeleteProcessor()
     //Destructor
 }
 
+/*!
+ * Send DELETE_PROGRESS_RESP to client
+ * @param progress - progress, summary once done
+ * @return
+ * SMB_SUCCESS - Success
+ * Otherwise - Failure
+ */
+int DeleteProcessor::send_progress(const DeleteProgress &progress)
+{
+    Packet *resp = ALLOCATE(Packet);
+    int ret = _packet_creator->CreatePacket(resp, DELETE_PROGRESS_RESP, const_cast<DeleteProgress *>(&progress));
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("DeleteProcessor::send_progress packet creation failed");
+        FREE(resp);
+        return ret;
+    }
+    _sessionManager->PushResponse(resp);
+    _sessionManager->ProcessWriteEvent();
+    return SMB_SUCCESS;
+}
+
 /*!
  * Process delete file/folder request from client
  * @return
@@ -38,14 +61,33 @@ DeleteProcessor::~DeleteProcessor()
 int DeleteProcessor::process_delete_req()
 {
     DEBUG_LOG("DeleteProcessor::process_delete_req");
+    Metrics &metrics = Metrics::GetInstance();
+    uint64_t start = Metrics::Now();
+    metrics.Count(METRIC_OP_DELETE, METRIC_REQUESTS);
+
     SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
     bool isDirectory = false;
-    int ret = SmbClient::GetInstance()->Delete(isDirectory);
+    DeleteProgress summary;
+    DeleteProgressCallback progress;
+    if (_progress)
+    {
+        progress = [this](const DeleteProgress &current) { send_progress(current); };
+    }
+    int ret = SmbClient::GetInstance()->Delete(isDirectory, &summary, progress);
+    int err = errno;
+    metrics.RecordSince(METRIC_OP_DELETE, METRIC_LAT_TOTAL, start);
+
+    if (_progress && isDirectory)
+    {
+        summary._done = true;
+        send_progress(summary);
+    }
 
     if (ret != SMB_SUCCESS)
     {
         ERROR_LOG("DeleteProcessor::process_delete_req delete %s failed", _url.c_str());
-        ret = errno;
+        metrics.Count(METRIC_OP_DELETE, METRIC_ERRORS);
+        ret = err;
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, DELETE_ERROR_RESP, ret, true);
         _sessionManager->PushResponse(resp);
@@ -71,8 +113,8 @@ int DeleteProcessor::process_delete_req()
 int DeleteProcessor::process_delete_req_resp()
 {
     DEBUG_LOG("DeleteProcessor::process_delete_req_resp");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -87,8 +129,8 @@ int DeleteProcessor::process_delete_req_resp()
 int DeleteProcessor::process_delete_req_error()
 {
     DEBUG_LOG("DeleteProcessor::process_delete_req_error");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -110,6 +152,26 @@ int DeleteProcessor::Init(std::string &request_id)
     return RequestProcessor::Init(request_id);
 }
 
+/*!
+ * Progress and summary of folder delete requested
+ * @return
+ * true - progress is sent
+ * false - only the final response is sent
+ */
+bool DeleteProcessor::Progress()
+{
+    return _progress;
+}
+
+/*!
+ * Request progress and summary of folder delete
+ * @param progress - true - send progress
+ */
+void DeleteProcessor::SetProgress(bool progress)
+{
+    _progress = progress;
+}
+
 /*!
  * Process requests from Client
  * @param packet
@@ -153,6 +215,9 @@ int DeleteProcessor::ProcessRequest(Packet *packet)
         case DELETE_ERROR_RESP:
             ret = process_delete_req_error();
             break;
+        case DELETE_PROGRESS_RESP:
+            ret = SMB_SUCCESS;
+            break;
         default:
             ERROR_LOG("Invalid command");
             break;
@@ -14,6 +14,9 @@
 class DeleteProcessor: public RequestProcessor
 {
 private:
+    bool _progress;     //client asked for progress and summary of folder delete
+
+    int send_progress(const DeleteProgress &progress);
     int process_delete_req();
     int process_delete_req_resp();
     int process_delete_req_error();
@@ -24,6 +27,9 @@ public:
 
     virtual int Init(std::string &request_id);
     int ProcessRequest(Packet *packet);
+
+    bool Progress();
+    void SetProgress(bool progress);
 };
 
 #endif //DELETE_PROCESSOR_H_
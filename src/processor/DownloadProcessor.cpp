@@ -6,16 +6,17 @@
  */
 
 #include <future>
+#include <vector>
 
+#include "base/Common.h"
 #include "base/Error.h"
 #include "base/Log.h"
 #include "base/Configuration.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
 #include "packet/DownloadPacketCreator.h"
 #include "packet/DownloadPacketParser.h"
 
-using milli = std::chrono::milliseconds;
-
 /*!
  * Constructor
  */
@@ -33,7 +34,8 @@ DownloadProcessor::~DownloadProcessor()
 }
 
 /*!
- * Process DOWNLOAD_REQ_INIT request
+ * Process DOWNLOAD_REQ_INIT request, for single round-trip download
+ * the first SMB read is issued while DOWNLOAD_INIT_RESP is being created
  * @return
  * SMB_SUCCESS    - Successful
  * Otherwise - Failed
@@ -41,12 +43,18 @@ DownloadProcessor::~DownloadProcessor()
 int DownloadProcessor::process_download_req_init()
 {
     DEBUG_LOG("DownloadProcessor::process_download_req_init");
+    Metrics &metrics = Metrics::GetInstance();
+    _start_time = Metrics::Now();
+    metrics.Count(METRIC_OP_DOWNLOAD, METRIC_REQUESTS);
+
     SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
     int ret = SmbClient::GetInstance()->DownloadInit();
+    metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_OPEN, _start_time);
     if (ret != SMB_SUCCESS)
     {
         int err = errno;
         ERROR_LOG("DownloadProcessor::process_download_req_init failed");
+        metrics.Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, DOWNLOAD_ERROR, err, true);
         _sessionManager->PushResponse(resp);
@@ -56,10 +64,35 @@ int DownloadProcessor::process_download_req_init()
     }
 
     DEBUG_LOG("DownloadProcessor::process_download_req_init success");
+    std::promise<void> init_resp_sent;
+    bool small_file = is_small_file();
+    if (_single_round_trip)
+    {
+        /* client does not know the size yet, range past end of file is clipped */
+        off_t size = SmbClient::GetInstance()->FileStat()->st_size;
+        if ((off_t) _end_offset >= size)
+        {
+            _end_offset = size > 0 ? size - 1 : 0;
+        }
+        if (!small_file)
+        {
+            _init_resp_sent = init_resp_sent.get_future();
+            if (start_download() != SMB_SUCCESS)
+            {
+                return SMB_ERROR;
+            }
+        }
+    }
+
     Packet *resp = ALLOCATE(Packet);
     _packet_creator->CreatePacket(resp, DOWNLOAD_INIT_RESP, NULL);
     _sessionManager->PushResponse(resp);
     _sessionManager->ProcessWriteEvent();
+    init_resp_sent.set_value();
+    if (_single_round_trip && small_file)
+    {
+        return start_download();
+    }
     return SMB_SUCCESS;
 }
 
@@ -72,11 +105,12 @@ int DownloadProcessor::process_download_req_init()
 int DownloadProcessor::process_download_req_init_resp()
 {
     DEBUG_LOG("DownloadProcessor::process_download_req_init_resp");
+    _start_time = Metrics::Now();
     Packet *req = ALLOCATE(Packet);
     struct packet_download_req_data param;
     param.start = _start_offset;
     param.end = _end_offset;
-    param.chunk_size = atoi(Configuration::GetInstance()[C_UNIX_SOCK_BUFFER]);
+    param.chunk_size = Configuration::GetInstance().Snapshot().unix_sock_buffer;
     _packet_creator->CreatePacket(req, DOWNLOAD_DATA_REQ, &param);
     _sessionManager->PushResponse(req);
     _sessionManager->ProcessWriteEvent();
@@ -92,11 +126,25 @@ int DownloadProcessor::process_download_req_init_resp()
 int DownloadProcessor::process_download_req_data()
 {
     DEBUG_LOG("DownloadProcessor::process_download_req_data");
+    return start_download();
+}
+
+/*!
+ * Seek to start offset and start async file download,
+ * small files are downloaded right away
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int DownloadProcessor::start_download()
+{
+    DEBUG_LOG("DownloadProcessor::start_download");
     int ret = SmbClient::GetInstance()->SetOffset(_start_offset, _end_offset);
     if (ret != SMB_SUCCESS)
     {
-        ERROR_LOG("DownloadProcessor::process_download_req_data failed");
+        ERROR_LOG("DownloadProcessor::start_download failed");
         int err = errno;
+        Metrics::GetInstance().Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, DOWNLOAD_ERROR, err, true);
         _sessionManager->PushResponse(resp);
@@ -104,7 +152,12 @@ int DownloadProcessor::process_download_req_data()
         return SMB_ERROR;
     }
 
-    DEBUG_LOG("DownloadProcessor::process_download_req_data starting async file download");
+    if (is_small_file())
+    {
+        return download_small_file();
+    }
+
+    DEBUG_LOG("DownloadProcessor::start_download starting async file download");
     _async_operation = ALLOCATE(std::thread, &DownloadProcessor::download_file_async, this);
     return SMB_SUCCESS;
 }
@@ -135,8 +188,10 @@ int DownloadProcessor::process_download_resp_end()
 {
     DEBUG_LOG("DownloadProcessor::process_download_resp_end");
     _file.close();
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    INFO_LOG("Time took for Complete Download %lu milliseconds",
+             (unsigned long) ((Metrics::Now() - _start_time) / 1000));
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -153,14 +208,99 @@ int DownloadProcessor::process_download_resp_error()
 {
     DEBUG_LOG("DownloadProcessor::process_download_resp_error");
     _file.close();
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
     return SMB_SUCCESS;
 }
 
+/*!
+ * Check if file is below small_file_size
+ * @return
+ * true - download with download_small_file()
+ * false - download with download_file_async()
+ */
+bool DownloadProcessor::is_small_file()
+{
+    unsigned long threshold = Configuration::GetInstance().Snapshot().small_file_size;
+    return threshold > 0 && (unsigned long) SmbClient::GetInstance()->FileStat()->st_size < threshold;
+}
+
+/*!
+ * Downloads small file on the request thread, exact size of the range is read
+ * (no EOF probe read) and data is queued along with DOWNLOAD_END_RESP
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int DownloadProcessor::download_small_file()
+{
+    DEBUG_LOG("DownloadProcessor::download_small_file");
+    Metrics &metrics = Metrics::GetInstance();
+    off_t size = SmbClient::GetInstance()->FileStat()->st_size;
+    off_t last = MIN((off_t) _end_offset, size - 1);
+    size_t len = (off_t) _start_offset <= last ? last - _start_offset + 1 : 0;
+
+    std::vector<char> data(len);
+    size_t read_bytes = 0;
+    uint64_t read_start = Metrics::Now();
+    while (read_bytes < len)
+    {
+        ssize_t ret = SmbClient::GetInstance()->Read(&data[read_bytes], len - read_bytes);
+        if (ret < 0)
+        {
+            ERROR_LOG("DownloadProcessor::download_small_file Download error Smb-server %s", _url.c_str());
+            int err = errno;
+            metrics.Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
+            Packet *resp = ALLOCATE(Packet);
+            _packet_creator->CreateStatusPacket(resp, DOWNLOAD_ERROR, err, true);
+            _sessionManager->PushResponse(resp);
+            _sessionManager->ProcessWriteEvent();
+            return SMB_ERROR;
+        }
+        if (ret == 0)
+        {
+            /* file shrunk since stat */
+            break;
+        }
+        read_bytes += ret;
+    }
+    metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_CHUNK, read_start);
+
+    struct packet_upload_download_data param;
+    uint64_t chunk_size = _chunk_size > 0 ? _chunk_size : read_bytes;
+    for (size_t offset = 0; offset < read_bytes; offset += chunk_size)
+    {
+        param.payload = &data[offset];
+        param.payload_len = MIN(chunk_size, read_bytes - offset);
+        Packet *resp = ALLOCATE(Packet);
+        _packet_creator->CreatePacket(resp, DOWNLOAD_DATA_RESP, &param);
+        _sessionManager->PushResponse(resp);
+        metrics.Count(METRIC_OP_DOWNLOAD, METRIC_CHUNKS);
+    }
+    if (read_bytes > 0)
+    {
+        _first_byte_sent = true;
+        metrics.Count(METRIC_OP_DOWNLOAD, METRIC_BYTES, read_bytes);
+        metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_FIRST_BYTE, _start_time);
+    }
+
+    Packet *resp = ALLOCATE(Packet);
+    _packet_creator->CreatePacket(resp, DOWNLOAD_END_RESP, NULL);
+    _sessionManager->PushResponse(resp);
+    if (_sessionManager->ProcessWriteEvent() != SMB_SUCCESS)
+    {
+        WARNING_LOG("DownloadProcessor::download_small_file Download interrupted while sending data, bail out");
+        metrics.Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
+        return SMB_ERROR;
+    }
+    metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_TOTAL, _start_time);
+    DEBUG_LOG("DownloadProcessor::download_small_file Download successful Size %lu", (unsigned long) read_bytes);
+    return SMB_SUCCESS;
+}
+
 /*!
  * Downloads the file from SMB server
  * Create response packet and stores them in response queue
@@ -171,23 +311,30 @@ int DownloadProcessor::process_download_resp_error()
 int DownloadProcessor::download_file_async()
 {
     DEBUG_LOG("DownloadProcessor::DownloadFileAsync");
-    Configuration &c = Configuration::GetInstance();
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    Metrics &metrics = Metrics::GetInstance();
     size_t sent_bytes = 0;
     struct packet_upload_download_data param;
-    static auto start = std::chrono::high_resolution_clock::now();
     while (!_should_exit)
     {
         _sessionManager->ResetTimer();
         if (_sessionManager->IsResponseSpaceAvailable())
         {
             /* start downloading the file */
-            char data[atoi(c[C_SMB_SOCK_READ_BUFFER])];
+            char data[c.smb_sock_read_buffer];
+            uint64_t read_start = Metrics::Now();
             ssize_t ret = SmbClient::GetInstance()->Read(data, sizeof(data));
+            metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_CHUNK, read_start);
+            if (_init_resp_sent.valid())
+            {
+                /* first read was speculative, DOWNLOAD_INIT_RESP goes out before any data */
+                _init_resp_sent.get();
+            }
             if (ret == SMB_SUCCESS)
             {
-                static auto finish = std::chrono::high_resolution_clock::now();
-                INFO_LOG("Time took for Complete Download %ld milliseconds",
-                          std::chrono::duration_cast<milli>(finish - start).count());
+                metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_TOTAL, _start_time);
+                INFO_LOG("Time took for Complete Download %lu milliseconds",
+                         (unsigned long) ((Metrics::Now() - _start_time) / 1000));
                 INFO_LOG("DownloadProcessor::DownloadFileAsync Download successful Size %ld", sent_bytes);
                 Packet *resp = ALLOCATE(Packet);
                 _packet_creator->CreatePacket(resp, DOWNLOAD_END_RESP, NULL);
@@ -202,6 +349,7 @@ int DownloadProcessor::download_file_async()
             else if (ret > 0)
             {
                 sent_bytes += ret;
+                metrics.Count(METRIC_OP_DOWNLOAD, METRIC_BYTES, ret);
                 DEBUG_LOG("DownloadProcessor::DownloadFileAsync received bytes: %ld from Smb-server", sent_bytes);
                 char *tmp = data;
                 while (!_should_exit && ret != 0 && tmp != NULL)
@@ -220,9 +368,16 @@ int DownloadProcessor::download_file_async()
                     param.payload_len = to_copy;
                     _packet_creator->CreatePacket(resp, DOWNLOAD_DATA_RESP, &param);
                     _sessionManager->PushResponse(resp);
+                    metrics.Count(METRIC_OP_DOWNLOAD, METRIC_CHUNKS);
+                    if (!_first_byte_sent)
+                    {
+                        _first_byte_sent = true;
+                        metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_FIRST_BYTE, _start_time);
+                    }
                     if (_sessionManager->ProcessWriteEvent() != SMB_SUCCESS)
                     {
                         WARNING_LOG("DownloadProcessor::download_file_async Download interrupted, bail out");
+                        metrics.Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
                         return SMB_ERROR;
                     }
                     tmp += to_copy;
@@ -233,6 +388,7 @@ int DownloadProcessor::download_file_async()
             {
                 ERROR_LOG("DownloadProcessor::DownloadFileAsync Download error Smb-server %s closed connection", _url.c_str());
                 int err = errno;
+                metrics.Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
                 Packet *resp = ALLOCATE(Packet);
                 _packet_creator->CreateStatusPacket(resp, DOWNLOAD_ERROR, err, true);
                 _sessionManager->PushResponse(resp);
@@ -274,6 +430,9 @@ int DownloadProcessor::Init(std::string &request_id)
     DEBUG_LOG("DownloadProcessor::Init");
     _start_offset = 0;
     _end_offset = 0;
+    _start_time = 0;
+    _first_byte_sent = false;
+    _single_round_trip = false;
     _packet_parser = new DownloadPacketParser();
     _packet_creator = new DownloadPacketCreator();
     RequestProcessor::Init(request_id);
@@ -303,6 +462,7 @@ int DownloadProcessor::ProcessRequest(Packet *request)
     if (ret != SMB_SUCCESS)
     {
         ERROR_LOG("DownloadProcessor::ProcessRequest, invalid packet");
+        Metrics::GetInstance().Count(METRIC_OP_DOWNLOAD, METRIC_ERRORS);
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, DOWNLOAD_ERROR, ret);
         _sessionManager->PushResponse(resp);
@@ -323,14 +483,10 @@ int DownloadProcessor::ProcessRequest(Packet *request)
             ret = process_download_req_data();
             break;
         case DOWNLOAD_DATA_RESP:
-            static auto start = std::chrono::high_resolution_clock::now();
             ret = process_download_resp_data(request);
             break;
         case DOWNLOAD_END_RESP:
             ret = process_download_resp_end();
-            static auto finish = std::chrono::high_resolution_clock::now();
-            INFO_LOG("Time took for Complete Download %ld milliseconds",
-                      std::chrono::duration_cast<milli>(finish - start).count());
             break;
         case DOWNLOAD_ERROR:
             ret = process_download_resp_error();
@@ -386,6 +542,34 @@ void DownloadProcessor::SetEndOffset(unsigned int _end_offset)
     DownloadProcessor::_end_offset = _end_offset;
 }
 
+/*!
+* getter function for end offset
+* @return
+* end offset
+*/
+unsigned int DownloadProcessor::EndOffset() const
+{
+    return _end_offset;
+}
+
+/*!
+* getter function for single round-trip download
+* @return
+* true - range came with DOWNLOAD_INIT_REQ
+*/
+bool DownloadProcessor::SingleRoundTrip() const
+{
+    return _single_round_trip;
+}
+
+/*!
+* setter function for single round-trip download
+*/
+void DownloadProcessor::SetSingleRoundTrip(bool single_round_trip)
+{
+    _single_round_trip = single_round_trip;
+}
+
 /*!
 * getter function for file size
 * @return
@@ -9,6 +9,7 @@
 #define DOWNLOAD_PROCESSOR_H_
 
 #include <fstream>
+#include <future>
 
 #include "RequestProcessor.h"
 
@@ -21,9 +22,16 @@ private:
     uint64_t _chunk_size;
     uint64_t _c_time;
     uint64_t _m_time;
+    uint64_t _start_time;       //request start, micro-seconds (Metrics::Now)
+    bool _first_byte_sent;
+    bool _single_round_trip;    //range came with DOWNLOAD_INIT_REQ
+    std::future<void> _init_resp_sent;
     std::ofstream _file;
 
     int process_download_req_init();
+    int start_download();
+    bool is_small_file();
+    int download_small_file();
     int process_download_req_init_resp();
     int process_download_req_data();
     int process_download_resp_data(Packet *packet);
@@ -41,6 +49,9 @@ public:
     struct stat *GetStat();
     void SetStartOffset(unsigned int _start_offset);
     void SetEndOffset(unsigned int _end_offset);
+    unsigned int EndOffset() const;
+    bool SingleRoundTrip() const;
+    void SetSingleRoundTrip(bool single_round_trip);
     int Size() const;
     void SetSize(int _size);
     const uint64_t &CreateTime() const;
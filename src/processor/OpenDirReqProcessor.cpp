@@ -5,25 +5,43 @@
  *
  */
 
+#include <algorithm>
+#include <functional>
 #include <future>
 #include "base/Error.h"
 #include "base/Log.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
 #include "packet/OpenDirPacketCreator.h"
 #include "packet/OpenDirReqPacketParser.h"
 
-
 /*!
  * Constructor
  */
 OpenDirReqProcessor::OpenDirReqProcessor()
 {
     _pageSize = 0;
+    _level = 0;
     _show_hidden_files = false;
     _show_only_folders = false;
     _fetch_share = false;
     _is_directory = true;
-
+    _start_time = 0;
+    _page_entries = 0;
+    _prefetch = NULL;
+    _list_bytes = 0;
+    _list_limit = 0;
+    _list_done = false;
+    _list_stop = false;
+    _list_error = 0;
+    _walking = 0;
+    _cache_mtime.tv_sec = 0;
+    _cache_mtime.tv_nsec = 0;
+    _cached_index = 0;
+    _cache_fill_bytes = 0;
+    _selected_index = 0;
+    _selected_ready = false;
+    _sent = 0;
 }
 
 /*!
@@ -31,7 +49,7 @@ OpenDirReqProcessor::OpenDirReqProcessor()
  */
 OpenDirReqProcessor::~OpenDirReqProcessor()
 {
-    //Destructor
+    stop_prefetch();
 }
 
 /*!
@@ -43,41 +61,33 @@ OpenDirReqProcessor::~OpenDirReqProcessor()
 int OpenDirReqProcessor::process_get_structure_req()
 {
     DEBUG_LOG("OpenDirReqProcessor::process_get_structure_req");
+    Metrics &metrics = Metrics::GetInstance();
+    _start_time = Metrics::Now();
+    _page_entries = 0;
+    _selected.clear();
+    _selected_index = 0;
+    _selected_ready = false;
+    _sent = 0;
+    _cached.reset();
+    _cached_index = 0;
+    _cache_fill.reset();
+    _cache_fill_bytes = 0;
+    metrics.Count(METRIC_OP_LIST_DIR, METRIC_REQUESTS);
+
     SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
-    int ret = SmbClient::GetInstance()->OpenDir();
+    int ret = probe();
     if (ret != SMB_SUCCESS)
     {
-        WARNING_LOG("OpenDirReqProcessor::process_get_structure_req, open as directory failed for %s", _url.c_str());
         int err = errno;
-        if (err == ENOTDIR || err == EINVAL)
-        {
-            _is_directory = false;
-            DEBUG_LOG("OpenDirReqProcessor::process_get_structure_req open it as file");
-            ret = SmbClient::GetInstance()->OpenFile(O_RDONLY);
-            if (ret != SMB_SUCCESS)
-            {
-                ERROR_LOG("OpenDirReqProcessor::process_get_structure_req open as file failed for %s", _url.c_str());
-                err = errno;
-                Packet *req = ALLOCATE(Packet);
-                _packet_creator->CreateStatusPacket(req, GET_STRUCTURE_ERROR_RESP, err, true);
-                _sessionManager->PushResponse(req);
-                _sessionManager->ProcessWriteEvent();
-                return SMB_ERROR;
-            }
-        }
-        else
-        {
-            Packet *req = ALLOCATE(Packet);
-            _packet_creator->CreateStatusPacket(req, GET_STRUCTURE_ERROR_RESP, err, true);
-            _sessionManager->PushResponse(req);
-            _sessionManager->ProcessWriteEvent();
-            return SMB_ERROR;
-        }
-    }
-    else
-    {
-        _is_directory = true;
+        ERROR_LOG("OpenDirReqProcessor::process_get_structure_req open failed for %s", _url.c_str());
+        metrics.Count(METRIC_OP_LIST_DIR, METRIC_ERRORS);
+        Packet *req = ALLOCATE(Packet);
+        _packet_creator->CreateStatusPacket(req, GET_STRUCTURE_ERROR_RESP, err, true);
+        _sessionManager->PushResponse(req);
+        _sessionManager->ProcessWriteEvent();
+        return SMB_ERROR;
     }
+    metrics.RecordSince(METRIC_OP_LIST_DIR, METRIC_LAT_OPEN, _start_time);
 
     DEBUG_LOG("OpenDirReqProcessor::process_get_structure_req start sending the list for %s", _url.c_str());
     _async_operation = ALLOCATE(std::thread, &OpenDirReqProcessor::send_list_async, this);
@@ -106,8 +116,8 @@ int OpenDirReqProcessor::process_get_structure_req_resp()
 int OpenDirReqProcessor::process_get_structure_resp_end()
 {
     DEBUG_LOG("OpenDirReqProcessor::process_get_structure_resp_end");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
         should_exit = 1;
     return SMB_SUCCESS;
 }
@@ -121,8 +131,8 @@ int OpenDirReqProcessor::process_get_structure_resp_end()
 int OpenDirReqProcessor::process_get_structure_req_error()
 {
     DEBUG_LOG("OpenDirReqProcessor::process_get_structure_req_error");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
         should_exit = 1;
     return SMB_SUCCESS;
 }
@@ -138,14 +148,25 @@ int OpenDirReqProcessor::process_get_structure_req_error()
 int OpenDirReqProcessor::send_list_async()
 {
     DEBUG_LOG("OpenDirReqProcessor::send_list_async");
+    Metrics &metrics = Metrics::GetInstance();
+    bool first_page = true;
+    start_prefetch();
     while (!_should_exit)
     {
         Packet *req = ALLOCATE(Packet);
+        uint64_t page_start = Metrics::Now();
         int ret = _packet_creator->CreatePacket(req, GET_STRUCTURE_INIT_RESP, NULL);
+        metrics.RecordSince(METRIC_OP_LIST_DIR, METRIC_LAT_CHUNK, page_start);
+        if (first_page && (ret == SMB_SUCCESS || ret == SMB_AGAIN))
+        {
+            first_page = false;
+            metrics.RecordSince(METRIC_OP_LIST_DIR, METRIC_LAT_FIRST_BYTE, _start_time);
+        }
         if (ret == SMB_SUCCESS)
         {
             if (!_is_directory)
             {
+                metrics.Count(METRIC_OP_LIST_DIR, METRIC_CHUNKS);
                 _sessionManager->PushResponse(req);
                 _sessionManager->ProcessWriteEvent();
                 req = ALLOCATE(Packet);
@@ -153,33 +174,554 @@ int OpenDirReqProcessor::send_list_async()
             /* Sent all list, Send a GET_STRUCTURE_END_RESP packet */
             DEBUG_LOG("OpenDirReqProcessor::send_list_async, all list sent, send <end> packet");
             _packet_creator->CreatePacket(req, GET_STRUCTURE_END_RESP, NULL);
+            stop_prefetch();
             SmbClient::GetInstance()->CloseDir();
             _sessionManager->PushResponse(req);
             _sessionManager->ProcessWriteEvent();
+            metrics.RecordSince(METRIC_OP_LIST_DIR, METRIC_LAT_TOTAL, _start_time);
 
             break;
         }
         else if (ret == SMB_AGAIN)
         {
             DEBUG_LOG("OpenDirReqProcessor::send_list_async, sending list for %s", _url.c_str());
+            metrics.Count(METRIC_OP_LIST_DIR, METRIC_CHUNKS);
             _sessionManager->PushResponse(req);
             if (_sessionManager->ProcessWriteEvent() != SMB_SUCCESS)
             {
                 ERROR_LOG("OpenDirReqProcessor::send_list_async send failed, abprt now");
+                metrics.Count(METRIC_OP_LIST_DIR, METRIC_ERRORS);
+                stop_prefetch();
                 return SMB_ERROR;
             }
         }
         else
         {
+            metrics.Count(METRIC_OP_LIST_DIR, METRIC_ERRORS);
             FREE(req);
+            stop_prefetch();
             SmbClient::GetInstance()->CloseDir();
             return SMB_ERROR;
         }
     }
 
+    stop_prefetch();
     return SMB_SUCCESS;
 }
 
+/*!
+ * Start reading directory entries ahead of the pages being sent,
+ * only directory listings are prefetched (not share lists or a single file).
+ * Recursive listings are always read by workers
+ */
+void OpenDirReqProcessor::start_prefetch()
+{
+    _list_limit = Configuration::GetInstance().Snapshot().list_prefetch_size;
+    if ((_list_limit == 0 && _level <= 1) || !_is_directory || _fetch_share || _cached)
+    {
+        return;
+    }
+    _list.clear();
+    _list_bytes = 0;
+    _list_done = false;
+    _list_stop = false;
+    _list_error = 0;
+    if (_level > 1)
+    {
+        start_walkers();
+        return;
+    }
+    _prefetch = ALLOCATE(std::thread, &OpenDirReqProcessor::prefetch_list, this);
+    if (!ALLOCATED(_prefetch))
+    {
+        WARNING_LOG("OpenDirReqProcessor::start_prefetch allocation failed, listing without prefetch");
+        _prefetch = NULL;
+    }
+}
+
+/*!
+ * Stop prefetch thread and drop buffered entries,
+ * must be called before the directory handle is closed
+ */
+void OpenDirReqProcessor::stop_prefetch()
+{
+    if (_prefetch == NULL && _walkers.empty())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_list_mtx);
+        _list_stop = true;
+    }
+    _list_cv.notify_all();
+    if (_prefetch != NULL)
+    {
+        _prefetch->join();
+        FREE(_prefetch);
+        _prefetch = NULL;
+    }
+    for (size_t i = 0; i < _walkers.size(); i++)
+    {
+        _walkers[i]->join();
+        FREE(_walkers[i]);
+    }
+    _walkers.clear();
+    for (size_t i = 0; i < _walker_backends.size(); i++)
+    {
+        FREE(_walker_backends[i]);
+    }
+    _walker_backends.clear();
+    _dirs.clear();
+    _list.clear();
+    _list_bytes = 0;
+}
+
+/*!
+ * Prefetch thread, reads entries from SMB server into _list
+ * till the directory is traversed, waits while list_prefetch_size bytes are buffered
+ */
+void OpenDirReqProcessor::prefetch_list()
+{
+    DEBUG_LOG("OpenDirReqProcessor::prefetch_list");
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_list_mtx);
+            if (_list_stop)
+            {
+                return;
+            }
+        }
+
+        const struct libsmb_file_info *info = SmbClient::GetInstance()->GetNextFileInfo();
+        int err = errno;
+        ListEntry entry;
+        if (info != NULL)
+        {
+            entry = ListEntry(info);
+        }
+
+        if (info == NULL)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_list_mtx);
+                _list_error = err;
+                _list_done = true;
+            }
+            _list_cv.notify_all();
+            return;
+        }
+        if (!push_entry(entry, 0))
+        {
+            return;
+        }
+    }
+}
+
+/*!
+ * Hand entry over to the sender, waits while list_prefetch_size bytes are buffered
+ * @param entry - entry, moved into the buffer
+ * @param subdir_level - entry is a directory to be listed by the workers at this level, 0 - not listed
+ * @return
+ * true - entry buffered
+ * false - listing stopped
+ */
+bool OpenDirReqProcessor::push_entry(ListEntry &entry, unsigned int subdir_level)
+{
+    std::unique_lock<std::mutex> lock(_list_mtx);
+    if (subdir_level > 0)
+    {
+        /* queued before waiting for the sender, idle workers pick it up right away */
+        _dirs.push_back(std::make_pair(entry._name, subdir_level));
+        _list_cv.notify_all();
+    }
+    _list_cv.wait(lock, [this] { return _list_bytes < _list_limit || _list_stop; });
+    if (_list_stop)
+    {
+        return false;
+    }
+    _list_bytes += entry.Bytes();
+    _list.push_back(std::move(entry));
+    lock.unlock();
+    _list_cv.notify_all();
+    return true;
+}
+
+/*!
+ * Start workers of a recursive listing. First worker lists the directory opened
+ * by the session with its context, every other worker gets a context of its own
+ * (shared when the backend is thread safe), at least one worker is started
+ */
+void OpenDirReqProcessor::start_walkers()
+{
+    unsigned int workers = Configuration::GetInstance().Snapshot().list_workers;
+    IStorageBackend *backend = SmbClient::GetInstance()->Backend();
+    if (_list_limit == 0)
+    {
+        _list_limit = 1; //entries are handed over one at a time
+    }
+    _dirs.clear();
+    _walking = 1; //directory opened by the session
+
+    for (unsigned int i = 0; i == 0 || i < workers; i++)
+    {
+        IStorageBackend *context = i == 0 ? backend : backend->Fork();
+        if (context == NULL)
+        {
+            WARNING_LOG("OpenDirReqProcessor::start_walkers no context for worker %u, listing with %u workers", i, i);
+            break;
+        }
+        std::thread *walker = ALLOCATE(std::thread, &OpenDirReqProcessor::walk_tree, this, context, i == 0);
+        if (!ALLOCATED(walker))
+        {
+            WARNING_LOG("OpenDirReqProcessor::start_walkers allocation failed, listing with %u workers", i);
+            if (context != backend)
+            {
+                FREE(context);
+            }
+            break;
+        }
+        _walkers.push_back(walker);
+        if (context != backend)
+        {
+            _walker_backends.push_back(context);
+        }
+    }
+}
+
+/*!
+ * Worker of a recursive listing, lists queued subdirectories till the tree is traversed
+ * @param backend - context of this worker
+ * @param top - list the directory opened by the session first
+ */
+void OpenDirReqProcessor::walk_tree(IStorageBackend *backend, bool top)
+{
+    DEBUG_LOG("OpenDirReqProcessor::walk_tree");
+    if (top)
+    {
+        walk_dir(backend, "", 1);
+    }
+
+    std::unique_lock<std::mutex> lock(_list_mtx);
+    if (top)
+    {
+        _walking--;
+    }
+    while (true)
+    {
+        _list_cv.wait(lock, [this] { return !_dirs.empty() || _walking == 0 || _list_stop; });
+        if (_list_stop)
+        {
+            return;
+        }
+        if (_dirs.empty())
+        {
+            /* no directory queued or being listed, tree traversed */
+            _list_done = true;
+            lock.unlock();
+            _list_cv.notify_all();
+            return;
+        }
+        std::pair<std::string, unsigned int> dir = _dirs.front();
+        _dirs.pop_front();
+        _walking++;
+        lock.unlock();
+        walk_dir(backend, dir.first, dir.second);
+        lock.lock();
+        _walking--;
+    }
+}
+
+/*!
+ * List one directory of a recursive listing, entries are named by their path
+ * relative to the listed directory. Subdirectories are queued while levels are left,
+ * hidden ones only when hidden files are shown.
+ * @param backend - context of this worker
+ * @param path - relative path, empty for the directory opened by the session
+ * @param level - level of the entries, 1 for the directory opened by the session
+ */
+void OpenDirReqProcessor::walk_dir(IStorageBackend *backend, const std::string &path, unsigned int level)
+{
+    StorageFile *dir = NULL;
+    if (!path.empty())
+    {
+        std::string url = "smb://" + _url;
+        if (url[url.size() - 1] != '/')
+        {
+            url += '/';
+        }
+        dir = backend->OpenDir(url + path);
+        if (dir == NULL)
+        {
+            WARNING_LOG("OpenDirReqProcessor::walk_dir open failed for %s, errno %d", path.c_str(), errno);
+            return;
+        }
+    }
+
+    while (true)
+    {
+        errno = 0;
+        const struct libsmb_file_info *info = dir ? backend->ReadDirPlus(dir)
+                                                  : SmbClient::GetInstance()->GetNextFileInfo();
+        if (info == NULL)
+        {
+            if (errno != 0)
+            {
+                WARNING_LOG("OpenDirReqProcessor::walk_dir read failed for %s, errno %d", path.c_str(), errno);
+            }
+            break;
+        }
+        bool dot = strcmp(info->name, ".") == 0 || strcmp(info->name, "..") == 0;
+        if (dot && dir != NULL)
+        {
+            continue;
+        }
+
+        bool descend = !dot && level < _level && (info->attrs & FILE_ATTRIBUTE_DIRECTORY)
+                       && strcmp(info->name, ".smbconnector") != 0
+                       && (_show_hidden_files || !(info->attrs & FILE_ATTRIBUTE_HIDDEN));
+        ListEntry entry(info);
+        if (!path.empty())
+        {
+            entry._name = path + '/' + entry._name;
+        }
+        if (!push_entry(entry, descend ? level + 1 : 0))
+        {
+            break;
+        }
+    }
+
+    if (dir != NULL)
+    {
+        backend->CloseDir(dir);
+    }
+}
+
+/*!
+ * Next entry buffered by the prefetch thread, waits while the buffer is empty
+ * @param complete - set when the directory was traversed without error
+ * @return
+ * struct lismb_file_info - Success, valid till the next call
+ * NULL - list traversed or prefetch stopped
+ */
+const struct libsmb_file_info *OpenDirReqProcessor::next_prefetched(bool &complete)
+{
+    std::unique_lock<std::mutex> lock(_list_mtx);
+    _list_cv.wait(lock, [this] { return !_list.empty() || _list_done || _list_stop; });
+    if (_list.empty())
+    {
+        complete = _list_done && !_list_stop && _list_error == 0;
+        return NULL;
+    }
+    _list_current = std::move(_list.front());
+    _list.pop_front();
+    _list_bytes -= _list_current.Bytes();
+    lock.unlock();
+    _list_cv.notify_all();
+
+    _list_current._info.name = &_list_current._name[0];
+    return &_list_current._info;
+}
+
+/*!
+ * Find out whether the url is a file or directory. A single stat gives the type and
+ * attributes of a file, a directory handle is opened only when entries are read from
+ * the server. Share lists and urls the server can not stat are probed by opening them
+ * @return
+ * SMB_SUCCESS - _is_directory set, directory opened unless served from the listing cache
+ * Otherwise - failure, errno set
+ */
+int OpenDirReqProcessor::probe()
+{
+    SmbClient *client = SmbClient::GetInstance();
+    _is_directory = true;
+    if (!_fetch_share)
+    {
+        if (client->Probe() == SMB_SUCCESS)
+        {
+            const struct stat *st = client->FileStat();
+            if (!S_ISDIR(st->st_mode))
+            {
+                DEBUG_LOG("OpenDirReqProcessor::probe %s is a file", _url.c_str());
+                _is_directory = false;
+                return SMB_SUCCESS;
+            }
+            return lookup_cache(*st) ? SMB_SUCCESS : client->OpenDir();
+        }
+        if (errno == ENOENT)
+        {
+            return SMB_ERROR;
+        }
+        WARNING_LOG("OpenDirReqProcessor::probe stat failed for %s, errno %d, open it instead", _url.c_str(), errno);
+    }
+
+    if (client->OpenDir() == SMB_SUCCESS)
+    {
+        return SMB_SUCCESS;
+    }
+    int err = errno;
+    if (err != ENOTDIR && err != EINVAL)
+    {
+        errno = err;
+        return SMB_ERROR;
+    }
+    DEBUG_LOG("OpenDirReqProcessor::probe open %s as file", _url.c_str());
+    _is_directory = false;
+    return client->OpenFile(O_RDONLY);
+}
+
+/*!
+ * Look the directory up in the listing cache, the stat of the probe validates the cached listing.
+ * On a miss the listing read from the server is recorded for the next request
+ * @param st - attributes of the directory, taken before listing so that a change made
+ * while listing leaves the stored mtime behind
+ * @return
+ * true - listing is served from _cached, no directory handle is opened
+ * false - list from the server
+ */
+bool OpenDirReqProcessor::lookup_cache(const struct stat &st)
+{
+    if (_level > 1 || ListCache::Limit() == 0)
+    {
+        return false;
+    }
+
+    ListCache &cache = ListCache::GetInstance();
+    _cache_key = ListCache::Key(_url, _work_group, _user_name, _password);
+    _cache_mtime = st.st_mtim;
+    _cached = cache.Lookup(_cache_key, _cache_mtime);
+    if (_cached)
+    {
+        DEBUG_LOG("OpenDirReqProcessor::lookup_cache serving cached list for %s", _url.c_str());
+        Metrics::GetInstance().Count(METRIC_OP_LIST_DIR, METRIC_CACHE_HITS);
+        return true;
+    }
+    Metrics::GetInstance().Count(METRIC_OP_LIST_DIR, METRIC_CACHE_MISSES);
+    _cache_fill = std::make_shared<ListEntries>();
+    return false;
+}
+
+/*!
+ * Record entry read from the server, complete listing is stored in the listing cache
+ * @param info - entry, NULL once the listing ended
+ * @param complete - listing ended without error
+ */
+void OpenDirReqProcessor::fill_cache(const struct libsmb_file_info *info, bool complete)
+{
+    if (!_cache_fill)
+    {
+        return;
+    }
+    if (info != NULL)
+    {
+        _cache_fill->push_back(ListEntry(info));
+        _cache_fill_bytes += _cache_fill->back().Bytes();
+        if (_cache_fill_bytes > ListCache::Limit())
+        {
+            DEBUG_LOG("OpenDirReqProcessor::fill_cache %s exceeds list_cache_size, not cached", _url.c_str());
+            _cache_fill.reset();
+        }
+        return;
+    }
+    if (complete)
+    {
+        ListCache::GetInstance().Store(_cache_key, _cache_mtime, _cache_fill, _cache_fill_bytes);
+    }
+    _cache_fill.reset();
+    _cache_fill_bytes = 0;
+}
+
+/*!
+ * Check entry against the filters of the request, smb-connector tmp files are never listed
+ * @param info - entry, named by relative path in recursive listing
+ * @return
+ * true - entry is listed
+ * false - entry is filtered
+ */
+bool OpenDirReqProcessor::match(const struct libsmb_file_info *info) const
+{
+    const char *base = strrchr(info->name, '/');
+    if (strcmp(base ? base + 1 : info->name, ".smbconnector") == 0 ||
+        (!(info->attrs & FILE_ATTRIBUTE_DIRECTORY) && _show_only_folders) ||
+        (info->attrs & FILE_ATTRIBUTE_HIDDEN && !_show_hidden_files))
+    {
+        return false;
+    }
+    return _filter.Match(info);
+}
+
+/*!
+ * Next entry of the directory, from the listing cache, the prefetch thread or the server
+ * @return
+ * struct lismb_file_info - Success, valid till the next call
+ * NULL - list traversed
+ */
+const struct libsmb_file_info *OpenDirReqProcessor::next_entry()
+{
+    if (_cached)
+    {
+        if (_cached_index >= _cached->size())
+        {
+            return NULL;
+        }
+        _list_current = (*_cached)[_cached_index++];
+        _list_current._info.name = &_list_current._name[0];
+        return &_list_current._info;
+    }
+
+    const struct libsmb_file_info *info = NULL;
+    bool complete = false;
+    if (_prefetch == NULL && _walkers.empty())
+    {
+        info = SmbClient::GetInstance()->GetNextFileInfo();
+        complete = info == NULL && errno == 0;
+    }
+    else
+    {
+        info = next_prefetched(complete);
+    }
+    fill_cache(info, complete);
+    return info;
+}
+
+/*!
+ * Read the whole listing and keep the matching entries in sort order,
+ * only the first _filter._limit entries are held (bounded heap, worst entry on top)
+ */
+void OpenDirReqProcessor::select_entries()
+{
+    const ListFilter &filter = _filter;
+    std::function<bool(const ListEntry &, const ListEntry &)> before =
+        [&filter](const ListEntry &a, const ListEntry &b) { return filter.Before(a, b); };
+    ListEntry entry;
+    const struct libsmb_file_info *info;
+    while ((info = next_entry()) != NULL)
+    {
+        if (!match(info))
+        {
+            continue;
+        }
+        entry = ListEntry(info);
+        if (_filter._limit > 0 && _selected.size() >= _filter._limit)
+        {
+            if (!before(entry, _selected.front()))
+            {
+                continue;
+            }
+            std::pop_heap(_selected.begin(), _selected.end(), before);
+            _selected.back() = std::move(entry);
+        }
+        else
+        {
+            _selected.push_back(std::move(entry));
+        }
+        std::push_heap(_selected.begin(), _selected.end(), before);
+    }
+    std::sort_heap(_selected.begin(), _selected.end(), before);
+    _selected_index = 0;
+    _selected_ready = true;
+}
+
 /*!
  * Initialise OpenDirReqProcessor
  * @param request-id - request-id
@@ -252,19 +794,47 @@ int OpenDirReqProcessor::ProcessRequest(Packet *request)
 }
 
 /*!
- * Iterate file-list for a directory and return all attributes
+ * Iterate file-list for a directory and return all attributes of the entries
+ * matching the filters of the request, in sort order when one was requested
  * @return
- * struct lismb_file_info - Success
- * NULL - list traversed
+ * struct lismb_file_info - Success, valid till the next call
+ * NULL - list traversed or limit reached
  */
 const struct libsmb_file_info *OpenDirReqProcessor::GetFileInfo()
 {
     DEBUG_LOG("OpenDirReqProcessor::GetFileInfo");
-    return SmbClient::GetInstance()->GetNextFileInfo();
+    if (_filter._sort != LIST_SORT_NONE)
+    {
+        if (!_selected_ready)
+        {
+            select_entries();
+        }
+        if (_selected_index >= _selected.size())
+        {
+            return NULL;
+        }
+        _list_current = std::move(_selected[_selected_index++]);
+        _list_current._info.name = &_list_current._name[0];
+        return &_list_current._info;
+    }
+
+    if (_filter._limit > 0 && _sent >= _filter._limit)
+    {
+        return NULL;
+    }
+    const struct libsmb_file_info *info;
+    while ((info = next_entry()) != NULL && !match(info))
+    {
+    }
+    if (info != NULL)
+    {
+        _sent++;
+    }
+    return info;
 }
 
 /*!
- * returns stat structure when queried for file
+ * returns stat structure when queried for file, as probed or as read from the opened file
  * Calling this method over a folder will return garbage data
  * @return
  * stat structure
@@ -287,6 +857,48 @@ struct smbc_dirent *OpenDirReqProcessor::GetDirent()
     return SmbClient::GetInstance()->GetNextDirent();
 }
 
+/*!
+ * Maximum entries of the next page, first page is small to get entries
+ * to the client early, every next page doubles till page size
+ * @return
+ * entries
+ */
+int OpenDirReqProcessor::NextPageEntries()
+{
+    int first_page = Configuration::GetInstance().Snapshot().list_first_page;
+    if (first_page <= 0 || _pageSize <= 0)
+    {
+        return _pageSize;
+    }
+    if (_page_entries == 0)
+    {
+        _page_entries = MIN(first_page, _pageSize);
+    }
+    else
+    {
+        _page_entries = (_page_entries <= _pageSize / 2) ? _page_entries * 2 : _pageSize;
+    }
+    return _page_entries;
+}
+
+/*!
+ * Check if page being filled should be sent before reaching its entries
+ * @param bytes - serialized size of entries in page
+ * @param page_start - time page was started, Metrics::Now()
+ * @return
+ * true - byte or time budget of page reached
+ * false - continue filling page
+ */
+bool OpenDirReqProcessor::PageFull(size_t bytes, uint64_t page_start) const
+{
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (c.list_page_bytes > 0 && bytes >= c.list_page_bytes)
+    {
+        return true;
+    }
+    return c.list_page_time > 0 && Metrics::Now() - page_start >= c.list_page_time;
+}
+
 /*!
  * getter for show_only_folder flag
  * @return
@@ -338,6 +950,40 @@ void OpenDirReqProcessor::SetPageSize(int _pageSize)
     OpenDirReqProcessor::_pageSize = _pageSize;
 }
 
+/*!
+ * getter for level
+ * @return
+ */
+unsigned int OpenDirReqProcessor::Level() const
+{
+    return _level;
+}
+
+/*!
+ * setter for level
+ */
+void OpenDirReqProcessor::SetLevel(unsigned int level)
+{
+    OpenDirReqProcessor::_level = level;
+}
+
+/*!
+ * getter for name, time and size filter
+ * @return
+ */
+const ListFilter &OpenDirReqProcessor::Filter() const
+{
+    return _filter;
+}
+
+/*!
+ * setter for name, time and size filter
+ */
+void OpenDirReqProcessor::SetFilter(const ListFilter &filter)
+{
+    OpenDirReqProcessor::_filter = filter;
+}
+
 /*!
  * Is directory
  * @return
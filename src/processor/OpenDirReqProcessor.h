@@ -8,7 +8,12 @@
 #ifndef OPENDIR_REQUEST_PROCESSOR_H_
 #define OPENDIR_REQUEST_PROCESSOR_H_
 
+#include <deque>
+#include <vector>
+
 #include "RequestProcessor.h"
+#include "smb/ListCache.h"
+#include "smb/ListFilter.h"
 
 class OpenDirReqProcessor: public RequestProcessor
 {
@@ -19,12 +24,62 @@ private:
     bool _fetch_share;
     bool _is_directory;
     int _pageSize;
+    unsigned int _level;        //levels listed, 0 or 1 - only the directory itself
+    uint64_t _start_time;       //request start, micro-seconds (Metrics::Now)
+    int _page_entries;          //entries in last page (adaptive paging), 0 - no page yet
+
+    /* listing pipeline, prefetch thread reads entries while pages are sent */
+    std::thread *_prefetch;
+    std::mutex _list_mtx;
+    std::condition_variable _list_cv;
+    std::deque<ListEntry> _list;
+    ListEntry _list_current;    //entry returned by last GetFileInfo()
+    size_t _list_bytes;         //bytes buffered in _list
+    size_t _list_limit;         //list_prefetch_size
+    bool _list_done;            //directory traversed
+    bool _list_stop;            //prefetch thread asked to stop
+    int _list_error;            //errno prefetch thread stopped with
+
+    /* recursive listing, workers list the subdirectories queued in _dirs */
+    std::vector<std::thread *> _walkers;
+    std::vector<IStorageBackend *> _walker_backends;   //forked contexts of workers
+    std::deque<std::pair<std::string, unsigned int> > _dirs; //relative path and level of entries
+    int _walking;               //directories being listed
+
+    /* listing cache, entries are served from _cached or recorded into _cache_fill */
+    std::string _cache_key;
+    struct timespec _cache_mtime;
+    std::shared_ptr<const ListEntries> _cached;
+    size_t _cached_index;
+    std::shared_ptr<ListEntries> _cache_fill;
+    size_t _cache_fill_bytes;
+
+    /* name, time and size filter, sorted listings are selected completely before the first page */
+    ListFilter _filter;
+    ListEntries _selected;      //heap of the best _filter._limit entries while selecting, then sorted
+    size_t _selected_index;
+    bool _selected_ready;
+    uint32_t _sent;             //entries returned by GetFileInfo()
 
     int process_get_structure_req();
     int process_get_structure_req_resp();
     int process_get_structure_resp_end();
     int process_get_structure_req_error();
     int send_list_async();
+    void start_prefetch();
+    void stop_prefetch();
+    void prefetch_list();
+    bool push_entry(ListEntry &entry, unsigned int subdir_level);
+    void start_walkers();
+    void walk_tree(IStorageBackend *backend, bool top);
+    void walk_dir(IStorageBackend *backend, const std::string &path, unsigned int level);
+    const struct libsmb_file_info *next_prefetched(bool &complete);
+    int probe();
+    bool lookup_cache(const struct stat &st);
+    void fill_cache(const struct libsmb_file_info *info, bool complete);
+    bool match(const struct libsmb_file_info *info) const;
+    const struct libsmb_file_info *next_entry();
+    void select_entries();
 
 public:
 
@@ -36,6 +91,8 @@ public:
     const struct libsmb_file_info *GetFileInfo();
     struct stat *GetStat();
     struct smbc_dirent *GetDirent();
+    int NextPageEntries();
+    bool PageFull(size_t bytes, uint64_t page_start) const;
 
     /* getter/setter */
     bool ShowOnlyFolders() const;
@@ -44,6 +101,10 @@ public:
     void SetShowHiddenFiles(bool show_hidden_files);
     int PageSize() const;
     void SetPageSize(int _pageSize);
+    unsigned int Level() const;
+    void SetLevel(unsigned int level);
+    const ListFilter &Filter() const;
+    void SetFilter(const ListFilter &filter);
     bool IsDirectory() const;
     void SetIsDirectory(bool is_directory);
     bool FetchShare() const;
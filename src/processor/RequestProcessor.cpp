@@ -10,6 +10,9 @@
 #include "base/Log.h"
 
 RequestProcessor *RequestProcessor::_instance = NULL;
+std::mutex RequestProcessor::_instance_lock;
+std::atomic<uint32_t> RequestProcessor::_current_id_seq(0);
+char RequestProcessor::_current_id[IDENT_BUFFER_SIZE] = {0};
 
 /*!
  * Constructor
@@ -22,6 +25,7 @@ RequestProcessor::RequestProcessor()
     _packet_parser = NULL;
     _async_operation = NULL;
     _should_exit = false;
+    _kerberos = false;
 }
 
 /*!
@@ -48,7 +52,52 @@ RequestProcessor *RequestProcessor::GetInstance()
  */
 void RequestProcessor::SetInstance(RequestProcessor *instance)
 {
+    std::lock_guard<std::mutex> lock(_instance_lock);
     _instance = instance;
+    publish_current_id();
+}
+
+/*!
+ * Copy request id of _instance to _current_id, _instance_lock must be held
+ * Readers retry while _current_id_seq is odd or changed during their copy.
+ */
+void RequestProcessor::publish_current_id()
+{
+    uint32_t seq = _current_id_seq.load(std::memory_order_relaxed);
+    _current_id_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const char *id = _instance ? _instance->_request_id.c_str() : "";
+    strncpy(_current_id, id, sizeof(_current_id) - 1);
+    _current_id[sizeof(_current_id) - 1] = '\0';
+
+    _current_id_seq.store(seq + 2, std::memory_order_release);
+}
+
+/*!
+ * Copy request id of current instance without locking and without touching
+ * the instance, which SessionManager may free while other threads log
+ * @param id - buffer, empty string if no instance or id not set
+ * @param size - size of buffer
+ */
+void RequestProcessor::CurrentRequestId(char *id, size_t size)
+{
+    size_t len = size < sizeof(_current_id) ? size : sizeof(_current_id);
+    for (;;)
+    {
+        uint32_t seq = _current_id_seq.load(std::memory_order_acquire);
+        if (seq & 1)
+        {
+            continue;
+        }
+        memcpy(id, _current_id, len);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_current_id_seq.load(std::memory_order_relaxed) == seq)
+        {
+            break;
+        }
+    }
+    id[len - 1] = '\0';
 }
 
 /*!
@@ -63,12 +112,13 @@ int RequestProcessor::Init(std::string &id)
     assert(id != "");
     DEBUG_LOG("RequestProcessor::Init");
     SmbClient::GetInstance()->Init(_kerberos);
-    _request_id = id;
+    SetRequestId(id);
     return SMB_SUCCESS;
 }
 
 /*!
- * Cleanup
+ * Cleanup once operation is over, storage context is kept for next
+ * operation of the session, SmbClient::Quit() releases it
  */
 void RequestProcessor::Quit()
 {
@@ -79,7 +129,7 @@ void RequestProcessor::Quit()
         FREE(_async_operation);
         _async_operation = NULL;
     }
-    SmbClient::GetInstance()->Quit();
+    SmbClient::GetInstance()->Reset();
 }
 
 /*!
@@ -169,7 +219,12 @@ const std::string &RequestProcessor::RequestId() const
  */
 void RequestProcessor::SetRequestId(const std::string &id)
 {
+    std::lock_guard<std::mutex> lock(_instance_lock);
     RequestProcessor::_request_id = id;
+    if (_instance == this)
+    {
+        publish_current_id();
+    }
 }
 
 /*!
@@ -8,12 +8,14 @@
 #ifndef REQUEST_PROCESSOR_H_
 #define REQUEST_PROCESSOR_H_
 
+#include <atomic>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 
 #include "smb/SmbClient.h"
 #include "base/Common.h"
+#include "base/Constants.h"
 #include "base/Configuration.h"
 #include "core/SessionManager.h"
 #include "socket/Epoll.h"
@@ -48,11 +50,17 @@ protected:
     bool _kerberos;
 
     static RequestProcessor *_instance;
+    static std::mutex _instance_lock;   //serialises writers of _instance and the current id
+    static std::atomic<uint32_t> _current_id_seq;   //odd while _current_id is being written
+    static char _current_id[IDENT_BUFFER_SIZE];     //request id of _instance, read by logging threads
+
+    static void publish_current_id();
 
 public:
     virtual ~RequestProcessor();
     static RequestProcessor *GetInstance();
     static void SetInstance(RequestProcessor *);
+    static void CurrentRequestId(char *id, size_t size);
 
     virtual int Init(std::string &id) = 0;
     virtual int ProcessRequest(Packet *) = 0;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "base/Error.h"
+#include "base/Protocol.h"
+#include "base/Log.h"
+
+#include "packet/StatsPacketCreator.h"
+#include "packet/StatsPacketParser.h"
+
+/*!
+ * Constructor
+ */
+StatsProcessor::StatsProcessor()
+{
+    //Constructor
+}
+
+/*!
+ * Destructor
+ */
+StatsProcessor::~StatsProcessor()
+{
+    //Destructor
+}
+
+/*!
+ * Process STATS_REQ packet, replies with current metrics
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int StatsProcessor::process_stats_req()
+{
+    DEBUG_LOG("StatsProcessor::process_stats_req");
+    Packet *resp = ALLOCATE(Packet);
+    int ret = _packet_creator->CreatePacket(resp, STATS_RESP, NULL);
+    if (ret != SMB_SUCCESS)
+    {
+        _packet_creator->CreateStatusPacket(resp, STATS_ERROR_RESP, ret);
+    }
+    _sessionManager->PushResponse(resp);
+    _sessionManager->ProcessWriteEvent();
+    return ret;
+}
+
+/*!
+ * Process STATS_RESP packet, prints metrics
+ * @param packet - response packet
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int StatsProcessor::process_stats_resp(Packet *packet)
+{
+    DEBUG_LOG("StatsProcessor::process_stats_resp");
+    printf("%s\n", packet->_pb_msg->responsepacket().statsresponse().stats().c_str());
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
+    {
+        should_exit = 1;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process STATS_ERROR_RESP packet
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int StatsProcessor::process_stats_error()
+{
+    DEBUG_LOG("StatsProcessor::process_stats_error");
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
+    {
+        should_exit = 1;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Initialisation
+ * @param request_id - request id
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int StatsProcessor::Init(std::string &request_id)
+{
+    DEBUG_LOG("StatsProcessor::Init");
+    _packet_parser = new StatsPacketParser();
+    _packet_creator = new StatsPacketCreator();
+    RequestProcessor::Init(request_id);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Process packet for stats module
+ * @param packet
+ * @return
+ * SMB_SUCCESS    - Successful
+ * Otherwise - Failed
+ */
+int StatsProcessor::ProcessRequest(Packet *packet)
+{
+    DEBUG_LOG("StatsProcessor::ProcessRequest");
+    assert(packet != NULL);
+    assert(packet->_data != NULL);
+
+    if (packet == NULL || packet->_data == NULL)
+    {
+        ERROR_LOG("StatsProcessor::ProcessRequest NULL packet");
+        return SMB_ERROR;
+    }
+
+    int ret = _packet_parser->ParsePacket(packet);
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("StatsProcessor::ProcessRequest, invalid packet");
+        Packet *req = ALLOCATE(Packet);
+        _packet_creator->CreateStatusPacket(req, STATS_ERROR_RESP, ret);
+        _sessionManager->PushResponse(req);
+        _sessionManager->ProcessWriteEvent();
+        return ret;
+    }
+
+    DEBUG_LOG("StatsProcessor::ProcessRequest Command %s", ProtocolCommand(packet->GetCMD()));
+    switch (packet->GetCMD())
+    {
+        case STATS_REQ:
+            ret = process_stats_req();
+            break;
+        case STATS_RESP:
+            ret = process_stats_resp(packet);
+            break;
+        case STATS_ERROR_RESP:
+            ret = process_stats_error();
+            break;
+        default:
+            ERROR_LOG("Invalid cmd");
+            ret = SMB_INVALID_PACKET;
+            break;
+    }
+
+    return ret;
+}
+
+/*!
+ * Cleanup
+ */
+void StatsProcessor::Quit()
+{
+    DEBUG_LOG("StatsProcessor::Quit");
+    RequestProcessor::Quit();
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef STATS_PROCESSOR_H_
+#define STATS_PROCESSOR_H_
+
+#include "RequestProcessor.h"
+
+class StatsProcessor: public RequestProcessor
+{
+private:
+    int process_stats_req();
+    int process_stats_resp(Packet *packet);
+    int process_stats_error();
+
+public:
+    StatsProcessor();
+    virtual ~StatsProcessor();
+
+    virtual int Init(std::string &request_id);
+    virtual int ProcessRequest(Packet *packet);
+    virtual void Quit();
+};
+
+
+#endif //STATS_PROCESSOR_H_
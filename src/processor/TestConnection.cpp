@@ -8,6 +8,7 @@
 #include "base/Error.h"
 #include "base/Protocol.h"
 #include "base/Log.h"
+#include "base/Metrics.h"
 
 #include "packet/TestConnectionPacketCreator.h"
 #include "packet/TestConnectionPacketParser.h"
@@ -36,30 +37,46 @@ TestConnection::~TestConnection()
 int TestConnection::process_test_connection_req()
 {
     DEBUG_LOG("TestConnection::process_test_connection_req");
-    SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
-    int ret = SmbClient::GetInstance()->OpenDir();
-    if (ret != SMB_SUCCESS)
-    {
-        int err = errno;
-        WARNING_LOG("TestConnection::process_test_connection_req open as directory error:%d", err);
-        if (err == ENOTDIR)
-        {
-            INFO_LOG("TestConnection::process_test_connection_req trying to open as file now");
-            ret = SmbClient::GetInstance()->OpenFile(O_RDONLY);
-        }
+    Metrics &metrics = Metrics::GetInstance();
+    uint64_t start = Metrics::Now();
+    metrics.Count(METRIC_OP_TEST_CONNECTION, METRIC_REQUESTS);
 
-        /* definitely an error */
+    SmbClient *client = SmbClient::GetInstance();
+    client->CredentialsInit(_url, _work_group, _user_name, _password);
+
+    /* a single stat answers for a file, directories are opened for their "." entry */
+    int ret = client->Probe();
+    int err = errno;
+    if (ret != SMB_SUCCESS || S_ISDIR(client->FileStat()->st_mode))
+    {
+        ret = err == ENOENT ? SMB_ERROR : client->OpenDir();
         if (ret != SMB_SUCCESS)
         {
-            ERROR_LOG("TestConnection::process_test_connection_req open failed");
-            Packet *resp = ALLOCATE(Packet);
-            _packet_creator->CreateStatusPacket(resp, TEST_CONNECTION_ERROR_RESP, err, true);
-            _sessionManager->PushResponse(resp);
-            _sessionManager->ProcessWriteEvent();
-            return SMB_ERROR;
+            err = errno;
+            WARNING_LOG("TestConnection::process_test_connection_req open as directory error:%d", err);
+            if (err == ENOTDIR)
+            {
+                INFO_LOG("TestConnection::process_test_connection_req trying to open as file now");
+                ret = client->OpenFile(O_RDONLY);
+            }
         }
     }
 
+    /* definitely an error */
+    if (ret != SMB_SUCCESS)
+    {
+        ERROR_LOG("TestConnection::process_test_connection_req open failed");
+        metrics.Count(METRIC_OP_TEST_CONNECTION, METRIC_ERRORS);
+        metrics.RecordSince(METRIC_OP_TEST_CONNECTION, METRIC_LAT_TOTAL, start);
+        Packet *resp = ALLOCATE(Packet);
+        _packet_creator->CreateStatusPacket(resp, TEST_CONNECTION_ERROR_RESP, err, true);
+        _sessionManager->PushResponse(resp);
+        _sessionManager->ProcessWriteEvent();
+        return SMB_ERROR;
+    }
+
+    metrics.RecordSince(METRIC_OP_TEST_CONNECTION, METRIC_LAT_TOTAL, start);
+
     Packet *resp = ALLOCATE(Packet);
     ret = _packet_creator->CreatePacket(resp, TEST_CONNECTION_INIT_RESP, NULL);
     if (ret != SMB_SUCCESS)
@@ -81,8 +98,8 @@ int TestConnection::process_test_connection_req()
 int TestConnection::process_test_connection_req_resp()
 {
     DEBUG_LOG("TestConnection::process_test_connection_req_resp");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -98,8 +115,8 @@ int TestConnection::process_test_connection_req_resp()
 int TestConnection::process_test_connection_req_error()
 {
     DEBUG_LOG("TestConnection::process_test_connection_req_error");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -196,7 +213,7 @@ const struct libsmb_file_info *TestConnection::GetFileInfo()
 }
 
 /*!
- * Get the file stat
+ * Get the file stat, as probed or as read from the opened file
  * @return
  * stat - Successful
  */
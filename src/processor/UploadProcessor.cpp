@@ -10,11 +10,10 @@
 #include "base/Error.h"
 #include "base/Log.h"
 #include "base/Protocol.h"
+#include "base/Metrics.h"
 #include "packet/UploadPacketCreator.h"
 #include "packet/UploadPacketParser.h"
 
-using milli = std::chrono::milliseconds;
-
 /*!
  * Constructor
  */
@@ -22,6 +21,8 @@ UploadProcessor::UploadProcessor()
 {
     _bytes_uploaded = 0;
     _upload_success = false;
+    _start_time = 0;
+    _first_byte_recorded = false;
 }
 
 /*!
@@ -33,20 +34,29 @@ UploadProcessor::~UploadProcessor()
 }
 
 /*!
- * Process UPLOAD_REQ_INIT request
+ * Process UPLOAD_REQ_INIT request. Inline data is written right away, when it
+ * is the whole file (last) upload completes without UPLOAD_INIT_RESP
+ * @param packet - request
  * @return
  * SMB_SUCCESS - Successful
  * Otherwise - failure
  */
-int UploadProcessor::process_upload_req_init()
+int UploadProcessor::process_upload_req_init(Packet *packet)
 {
     DEBUG_LOG("UploadProcessor::process_upload_req_init");
+    Metrics &metrics = Metrics::GetInstance();
+    _start_time = Metrics::Now();
+    _first_byte_recorded = false;
+    metrics.Count(METRIC_OP_UPLOAD, METRIC_REQUESTS);
+
     SmbClient::GetInstance()->CredentialsInit(_url, _work_group, _user_name, _password);
     int ret = SmbClient::GetInstance()->UploadInit(_request_id);
+    metrics.RecordSince(METRIC_OP_UPLOAD, METRIC_LAT_OPEN, _start_time);
     if (ret != SMB_SUCCESS)
     {
         ERROR_LOG("UploadProcessor::process_upload_req_init failed for %s, return error", _url.c_str());
         int err = errno;
+        metrics.Count(METRIC_OP_UPLOAD, METRIC_ERRORS);
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, UPLOAD_ERROR, err, true);
         _sessionManager->PushResponse(resp);
@@ -54,6 +64,19 @@ int UploadProcessor::process_upload_req_init()
         return SMB_ERROR;
     }
 
+    if (packet->_pb_msg->requestpacket().has_uploadrequestdata())
+    {
+        if (process_upload_req_data(packet) != SMB_SUCCESS)
+        {
+            return SMB_ERROR;
+        }
+        if (packet->_pb_msg->requestpacket().uploadrequestdata().last())
+        {
+            DEBUG_LOG("UploadProcessor::process_upload_req_init inline upload of %s", _url.c_str());
+            return process_upload_req_data_end();
+        }
+    }
+
     Packet *resp = ALLOCATE(Packet);
     _packet_creator->CreateStatusPacket(resp, UPLOAD_INIT_RESP, 0);
     _sessionManager->PushResponse(resp);
@@ -86,16 +109,18 @@ int UploadProcessor::process_upload_req_init_resp()
  */
 int UploadProcessor::process_upload_req_data(Packet *packet)
 {
-    DEBUG_LOG("UploadProcessor::process_upload_req_data");
-    int ret = SmbClient::GetInstance()->Write(
-        const_cast<char *>(packet->_pb_msg->requestpacket().uploadrequestdata().data().c_str()),
-        packet->_pb_msg->requestpacket().uploadrequestdata().data().size());
+    DEBUG_LOG_RATE_LIMITED("UploadProcessor::process_upload_req_data");
+    Metrics &metrics = Metrics::GetInstance();
+    uint64_t write_start = Metrics::Now();
+    int ret = SmbClient::GetInstance()->Write(packet->_payload, packet->_payload_len);
+    metrics.RecordSince(METRIC_OP_UPLOAD, METRIC_LAT_CHUNK, write_start);
 
     if (ret < 0)
     {
         /* smb_write failed */
         /* delete the tmp file */
         int err = errno;
+        metrics.Count(METRIC_OP_UPLOAD, METRIC_ERRORS);
         ERROR_LOG("UploadProcessor::process_upload_req_data upload failed, SmbClient-server[%s] closed connection",
                   _url.c_str());
         Packet *req = ALLOCATE(Packet);
@@ -105,8 +130,16 @@ int UploadProcessor::process_upload_req_data(Packet *packet)
         return SMB_ERROR;
     }
 
+    if (!_first_byte_recorded && ret > 0)
+    {
+        metrics.RecordSince(METRIC_OP_UPLOAD, METRIC_LAT_FIRST_BYTE, _start_time);
+        _first_byte_recorded = true;
+    }
     _bytes_uploaded += ret;
-    DEBUG_LOG("UploadProcessor::process_upload_req_data total upload so far %d", _bytes_uploaded);
+    metrics.Count(METRIC_OP_UPLOAD, METRIC_BYTES, ret);
+    metrics.Count(METRIC_OP_UPLOAD, METRIC_CHUNKS);
+    DEBUG_LOG_RATE_LIMITED("UploadProcessor::process_upload_req_data total upload so far %d",
+                           _bytes_uploaded);
     return SMB_SUCCESS;
 }
 
@@ -119,12 +152,12 @@ int UploadProcessor::process_upload_req_data(Packet *packet)
 int UploadProcessor::process_upload_req_data_error()
 {
     DEBUG_LOG("UploadProcessor::process_upload_req_data_error Upload error");
-    Configuration &c = Configuration::GetInstance();
-    if(!atoi(c[C_FILE_UPLOAD_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if(!c.file_upload_mode)
     {
     SmbClient::GetInstance()->DelTmpFile();
     }
-    if (!atoi(c[C_OP_MODE]))
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -142,8 +175,8 @@ int UploadProcessor::process_upload_req_data_end()
     DEBUG_LOG("UploadProcessor::process_upload_req_data_end");
     _bytes_uploaded = 0;
     SmbClient::GetInstance()->CloseFile();
-    Configuration &c = Configuration::GetInstance();
-    if(!atoi(c[C_FILE_UPLOAD_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if(!c.file_upload_mode)
     {
     SmbClient::GetInstance()->RestoreTmpFile(_request_id);
     }
@@ -152,6 +185,9 @@ int UploadProcessor::process_upload_req_data_end()
     _sessionManager->PushResponse(resp);
     _sessionManager->ProcessWriteEvent();
     _upload_success = true;
+    Metrics::GetInstance().RecordSince(METRIC_OP_UPLOAD, METRIC_LAT_TOTAL, _start_time);
+    DEBUG_LOG("Time took for Complete Upload %lu milliseconds",
+              (unsigned long) ((Metrics::Now() - _start_time) / 1000));
     return SMB_SUCCESS;
 }
 
@@ -164,8 +200,8 @@ int UploadProcessor::process_upload_req_data_end()
 int UploadProcessor::process_upload_req_data_resp()
 {
     DEBUG_LOG("UploadProcessor::process_upload_req_data_resp");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_OP_MODE]))
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.op_mode)
     {
         should_exit = 1;
     }
@@ -184,7 +220,7 @@ int UploadProcessor::upload_async()
     int read_bytes = 0;
     int total_bytes = 0;
     Packet *req = NULL;
-    Configuration &c = Configuration::GetInstance();
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
 
     struct packet_upload_download_data param;
 
@@ -203,7 +239,7 @@ int UploadProcessor::upload_async()
         if (_sessionManager->IsResponseSpaceAvailable())
         {
             req = ALLOCATE(Packet);
-            char buffer[atoi(c[C_SMB_SOCK_WRITE_BUFFER])];
+            char buffer[c.smb_sock_write_buffer];
             memset(buffer, 0, sizeof(buffer));
             read_bytes = (int) _file.readsome(buffer, sizeof(buffer));
             if (read_bytes <= 0)
@@ -250,6 +286,8 @@ int UploadProcessor::Init(std::string &request_id)
 {
     DEBUG_LOG("UploadProcessor::Init");
     _bytes_uploaded = 0;
+    _start_time = 0;
+    _first_byte_recorded = false;
     _packet_parser = new UploadPacketParser();
     _packet_creator = new UploadPacketCreator();
     RequestProcessor::Init(request_id);
@@ -279,6 +317,7 @@ int UploadProcessor::ProcessRequest(Packet *request)
     if (ret != SMB_SUCCESS)
     {
         ERROR_LOG("UploadProcessor::ProcessRequest packet parsing failed, return error");
+        Metrics::GetInstance().Count(METRIC_OP_UPLOAD, METRIC_ERRORS);
         Packet *resp = ALLOCATE(Packet);
         _packet_creator->CreateStatusPacket(resp, UPLOAD_ERROR, ret);
         _sessionManager->PushResponse(resp);
@@ -290,8 +329,7 @@ int UploadProcessor::ProcessRequest(Packet *request)
     switch (request->GetCMD())
     {
         case UPLOAD_INIT_REQ:
-            static auto start = std::chrono::high_resolution_clock::now();
-            ret = process_upload_req_init();
+            ret = process_upload_req_init(request);
             break;
         case UPLOAD_INIT_RESP:
             ret = process_upload_req_init_resp();
@@ -303,13 +341,8 @@ int UploadProcessor::ProcessRequest(Packet *request)
             ret = process_upload_req_data_error();
             break;
         case UPLOAD_END_REQ:
-        {
             ret = process_upload_req_data_end();
-            static auto finish = std::chrono::high_resolution_clock::now();
-            DEBUG_LOG("Time took for Complete Upload %ld milliseconds",
-                      std::chrono::duration_cast<milli>(finish - start).count());
             break;
-        }
         case UPLOAD_END_RESP:
             ret = process_upload_req_data_resp();
             break;
@@ -328,8 +361,8 @@ int UploadProcessor::ProcessRequest(Packet *request)
 void UploadProcessor::Quit()
 {
     DEBUG_LOG("UploadProcessor::Quit");
-    Configuration &c = Configuration::GetInstance();
-    if (!atoi(c[C_FILE_UPLOAD_MODE]) && !_upload_success)
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    if (!c.file_upload_mode && !_upload_success)
     {
         SmbClient::GetInstance()->DelTmpFile();
     }
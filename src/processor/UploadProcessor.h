@@ -18,8 +18,10 @@ private:
     std::ifstream _file;
     unsigned int _bytes_uploaded;
     bool _upload_success;
+    uint64_t _start_time;       //request start, micro-seconds (Metrics::Now)
+    bool _first_byte_recorded;  //first byte latency of the request recorded
 
-    int process_upload_req_init();
+    int process_upload_req_init(Packet *packet);
     int process_upload_req_init_resp();
     int process_upload_req_data(Packet *packet);
     int process_upload_req_data_error();
@@ -33,6 +33,16 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* UploadRequestData_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   UploadRequestData_reflection_ = NULL;
+const ::google::protobuf::Descriptor* DeleteRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  DeleteRequest_reflection_ = NULL;
+const ::google::protobuf::Descriptor* BatchStatRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  BatchStatRequest_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CopyRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CopyRequest_reflection_ = NULL;
+const ::google::protobuf::EnumDescriptor* SortKey_descriptor_ = NULL;
 
 }  // namespace
 
@@ -63,11 +73,14 @@ void protobuf_AssignDesc_request_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SmbDetails));
   RequestPacket_descriptor_ = file->message_type(1);
-  static const int RequestPacket_offsets_[4] = {
+  static const int RequestPacket_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, smbdetails_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, folderstructurerequest_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, rangedownloadrequest_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, uploadrequestdata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, deleterequest_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, batchstatrequest_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestPacket, copyrequest_),
   };
   RequestPacket_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -81,11 +94,20 @@ void protobuf_AssignDesc_request_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RequestPacket));
   FolderStructureRequest_descriptor_ = file->message_type(2);
-  static const int FolderStructureRequest_offsets_[4] = {
+  static const int FolderStructureRequest_offsets_[13] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, showonlyfolders_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, showhiddenfiles_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, pagesize_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, level_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, namepattern_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, nameprefix_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, minmodifiedtime_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, maxmodifiedtime_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, minsize_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, maxsize_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, sortby_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, descending_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FolderStructureRequest, limit_),
   };
   FolderStructureRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -116,8 +138,9 @@ void protobuf_AssignDesc_request_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RangeDownloadRequest));
   UploadRequestData_descriptor_ = file->message_type(4);
-  static const int UploadRequestData_offsets_[1] = {
+  static const int UploadRequestData_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UploadRequestData, data_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UploadRequestData, last_),
   };
   UploadRequestData_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -130,6 +153,54 @@ void protobuf_AssignDesc_request_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(UploadRequestData));
+  DeleteRequest_descriptor_ = file->message_type(5);
+  static const int DeleteRequest_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteRequest, progress_),
+  };
+  DeleteRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      DeleteRequest_descriptor_,
+      DeleteRequest::default_instance_,
+      DeleteRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(DeleteRequest));
+  BatchStatRequest_descriptor_ = file->message_type(6);
+  static const int BatchStatRequest_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatRequest, paths_),
+  };
+  BatchStatRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      BatchStatRequest_descriptor_,
+      BatchStatRequest::default_instance_,
+      BatchStatRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(BatchStatRequest));
+  CopyRequest_descriptor_ = file->message_type(7);
+  static const int CopyRequest_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyRequest, destination_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyRequest, overwrite_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyRequest, progress_),
+  };
+  CopyRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CopyRequest_descriptor_,
+      CopyRequest::default_instance_,
+      CopyRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CopyRequest));
+  SortKey_descriptor_ = file->enum_type(0);
 }
 
 namespace {
@@ -152,6 +223,12 @@ void protobuf_RegisterTypes(const ::std::string&) {
     RangeDownloadRequest_descriptor_, &RangeDownloadRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     UploadRequestData_descriptor_, &UploadRequestData::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    DeleteRequest_descriptor_, &DeleteRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    BatchStatRequest_descriptor_, &BatchStatRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CopyRequest_descriptor_, &CopyRequest::default_instance());
 }
 
 }  // namespace
@@ -167,6 +244,12 @@ void protobuf_ShutdownFile_request_2eproto() {
   delete RangeDownloadRequest_reflection_;
   delete UploadRequestData::default_instance_;
   delete UploadRequestData_reflection_;
+  delete DeleteRequest::default_instance_;
+  delete DeleteRequest_reflection_;
+  delete BatchStatRequest::default_instance_;
+  delete BatchStatRequest_reflection_;
+  delete CopyRequest::default_instance_;
+  delete CopyRequest_reflection_;
 }
 
 void protobuf_AddDesc_request_2eproto() {
@@ -178,18 +261,32 @@ void protobuf_AddDesc_request_2eproto() {
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
     "\n\rrequest.proto\"b\n\nSmbDetails\022\021\n\tworkgro"
     "up\030\001 \002(\t\022\020\n\010username\030\002 \002(\t\022\020\n\010password\030\003"
-    " \002(\t\022\013\n\003url\030\004 \002(\t\022\020\n\010kerberos\030\005 \001(\010\"\315\001\n\r"
+    " \002(\t\022\013\n\003url\030\004 \002(\t\022\020\n\010kerberos\030\005 \001(\010\"\304\002\n\r"
     "RequestPacket\022\037\n\nsmbDetails\030\001 \001(\0132\013.SmbD"
     "etails\0227\n\026folderStructureRequest\030\002 \001(\0132\027"
     ".FolderStructureRequest\0223\n\024rangeDownload"
     "Request\030\003 \001(\0132\025.RangeDownloadRequest\022-\n\021"
     "uploadRequestData\030\004 \001(\0132\022.UploadRequestD"
-    "ata\"k\n\026FolderStructureRequest\022\027\n\017showOnl"
+    "ata\022%\n\rdeleteRequest\030\005 \001(\0132\016.DeleteReque"
+    "st\022+\n\020batchStatRequest\030\006 \001(\0132\021.BatchStat"
+    "Request\022!\n\013copyRequest\030\007 \001(\0132\014.CopyReque"
+    "st\"\245\002\n\026FolderStructureRequest\022\027\n\017showOnl"
     "yFolders\030\001 \001(\010\022\027\n\017showHiddenFiles\030\002 \001(\010\022"
-    "\020\n\010pageSize\030\003 \002(\r\022\r\n\005level\030\004 \001(\r\"E\n\024Rang"
-    "eDownloadRequest\022\r\n\005start\030\001 \002(\004\022\013\n\003end\030\002"
-    " \002(\004\022\021\n\tchunkSize\030\003 \002(\004\"!\n\021UploadRequest"
-    "Data\022\014\n\004data\030\001 \002(\014", 538);
+    "\020\n\010pageSize\030\003 \002(\r\022\r\n\005level\030\004 \001(\r\022\023\n\013name"
+    "Pattern\030\005 \001(\t\022\022\n\nnamePrefix\030\006 \001(\t\022\027\n\017min"
+    "ModifiedTime\030\007 \001(\004\022\027\n\017maxModifiedTime\030\010 "
+    "\001(\004\022\017\n\007minSize\030\t \001(\004\022\017\n\007maxSize\030\n \001(\004\022\030\n"
+    "\006sortBy\030\013 \001(\0162\010.SortKey\022\022\n\ndescending\030\014 "
+    "\001(\010\022\r\n\005limit\030\r \001(\r\"E\n\024RangeDownloadReque"
+    "st\022\r\n\005start\030\001 \002(\004\022\013\n\003end\030\002 \002(\004\022\021\n\tchunkS"
+    "ize\030\003 \002(\004\"/\n\021UploadRequestData\022\014\n\004data\030\001"
+    " \002(\014\022\014\n\004last\030\002 \001(\010\"!\n\rDeleteRequest\022\020\n\010p"
+    "rogress\030\001 \001(\010\"!\n\020BatchStatRequest\022\r\n\005pat"
+    "hs\030\001 \003(\t\"G\n\013CopyRequest\022\023\n\013destination\030\001"
+    " \002(\t\022\021\n\toverwrite\030\002 \001(\010\022\020\n\010progress\030\003 \001("
+    "\010*N\n\007SortKey\022\r\n\tSORT_NONE\020\000\022\r\n\tSORT_NAME"
+    "\020\001\022\026\n\022SORT_MODIFIED_TIME\020\002\022\r\n\tSORT_SIZE\020"
+    "\003", 1081);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "request.proto", &protobuf_RegisterTypes);
   SmbDetails::default_instance_ = new SmbDetails();
@@ -197,11 +294,17 @@ void protobuf_AddDesc_request_2eproto() {
   FolderStructureRequest::default_instance_ = new FolderStructureRequest();
   RangeDownloadRequest::default_instance_ = new RangeDownloadRequest();
   UploadRequestData::default_instance_ = new UploadRequestData();
+  DeleteRequest::default_instance_ = new DeleteRequest();
+  BatchStatRequest::default_instance_ = new BatchStatRequest();
+  CopyRequest::default_instance_ = new CopyRequest();
   SmbDetails::default_instance_->InitAsDefaultInstance();
   RequestPacket::default_instance_->InitAsDefaultInstance();
   FolderStructureRequest::default_instance_->InitAsDefaultInstance();
   RangeDownloadRequest::default_instance_->InitAsDefaultInstance();
   UploadRequestData::default_instance_->InitAsDefaultInstance();
+  DeleteRequest::default_instance_->InitAsDefaultInstance();
+  BatchStatRequest::default_instance_->InitAsDefaultInstance();
+  CopyRequest::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_request_2eproto);
 }
 
@@ -211,6 +314,22 @@ struct StaticDescriptorInitializer_request_2eproto {
     protobuf_AddDesc_request_2eproto();
   }
 } static_descriptor_initializer_request_2eproto_;
+const ::google::protobuf::EnumDescriptor* SortKey_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return SortKey_descriptor_;
+}
+bool SortKey_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -602,7 +721,7 @@ void SmbDetails::MergeFrom(const SmbDetails& from) {
     }
     if (from.has_kerberos()) {
       set_kerberos(from.kerberos());
-  }
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -654,6 +773,9 @@ const int RequestPacket::kSmbDetailsFieldNumber;
 const int RequestPacket::kFolderStructureRequestFieldNumber;
 const int RequestPacket::kRangeDownloadRequestFieldNumber;
 const int RequestPacket::kUploadRequestDataFieldNumber;
+const int RequestPacket::kDeleteRequestFieldNumber;
+const int RequestPacket::kBatchStatRequestFieldNumber;
+const int RequestPacket::kCopyRequestFieldNumber;
 #endif  // !_MSC_VER
 
 RequestPacket::RequestPacket()
@@ -666,6 +788,9 @@ void RequestPacket::InitAsDefaultInstance() {
   folderstructurerequest_ = const_cast< ::FolderStructureRequest*>(&::FolderStructureRequest::default_instance());
   rangedownloadrequest_ = const_cast< ::RangeDownloadRequest*>(&::RangeDownloadRequest::default_instance());
   uploadrequestdata_ = const_cast< ::UploadRequestData*>(&::UploadRequestData::default_instance());
+  deleterequest_ = const_cast< ::DeleteRequest*>(&::DeleteRequest::default_instance());
+  batchstatrequest_ = const_cast< ::BatchStatRequest*>(&::BatchStatRequest::default_instance());
+  copyrequest_ = const_cast< ::CopyRequest*>(&::CopyRequest::default_instance());
 }
 
 RequestPacket::RequestPacket(const RequestPacket& from)
@@ -680,6 +805,9 @@ void RequestPacket::SharedCtor() {
   folderstructurerequest_ = NULL;
   rangedownloadrequest_ = NULL;
   uploadrequestdata_ = NULL;
+  deleterequest_ = NULL;
+  batchstatrequest_ = NULL;
+  copyrequest_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -693,6 +821,9 @@ void RequestPacket::SharedDtor() {
     delete folderstructurerequest_;
     delete rangedownloadrequest_;
     delete uploadrequestdata_;
+    delete deleterequest_;
+    delete batchstatrequest_;
+    delete copyrequest_;
   }
 }
 
@@ -731,6 +862,15 @@ void RequestPacket::Clear() {
     if (has_uploadrequestdata()) {
       if (uploadrequestdata_ != NULL) uploadrequestdata_->::UploadRequestData::Clear();
     }
+    if (has_deleterequest()) {
+      if (deleterequest_ != NULL) deleterequest_->::DeleteRequest::Clear();
+    }
+    if (has_batchstatrequest()) {
+      if (batchstatrequest_ != NULL) batchstatrequest_->::BatchStatRequest::Clear();
+    }
+    if (has_copyrequest()) {
+      if (copyrequest_ != NULL) copyrequest_->::CopyRequest::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -793,6 +933,48 @@ bool RequestPacket::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(42)) goto parse_deleteRequest;
+        break;
+      }
+
+      // optional .DeleteRequest deleteRequest = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_deleteRequest:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_deleterequest()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(50)) goto parse_batchStatRequest;
+        break;
+      }
+
+      // optional .BatchStatRequest batchStatRequest = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_batchStatRequest:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_batchstatrequest()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_copyRequest;
+        break;
+      }
+
+      // optional .CopyRequest copyRequest = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_copyRequest:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_copyrequest()));
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -839,6 +1021,24 @@ void RequestPacket::SerializeWithCachedSizes(
       4, this->uploadrequestdata(), output);
   }
 
+  // optional .DeleteRequest deleteRequest = 5;
+  if (has_deleterequest()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->deleterequest(), output);
+  }
+
+  // optional .BatchStatRequest batchStatRequest = 6;
+  if (has_batchstatrequest()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, this->batchstatrequest(), output);
+  }
+
+  // optional .CopyRequest copyRequest = 7;
+  if (has_copyrequest()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->copyrequest(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -875,6 +1075,27 @@ void RequestPacket::SerializeWithCachedSizes(
         4, this->uploadrequestdata(), target);
   }
 
+  // optional .DeleteRequest deleteRequest = 5;
+  if (has_deleterequest()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->deleterequest(), target);
+  }
+
+  // optional .BatchStatRequest batchStatRequest = 6;
+  if (has_batchstatrequest()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        6, this->batchstatrequest(), target);
+  }
+
+  // optional .CopyRequest copyRequest = 7;
+  if (has_copyrequest()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->copyrequest(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -914,6 +1135,27 @@ int RequestPacket::ByteSize() const {
           this->uploadrequestdata());
     }
 
+    // optional .DeleteRequest deleteRequest = 5;
+    if (has_deleterequest()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->deleterequest());
+    }
+
+    // optional .BatchStatRequest batchStatRequest = 6;
+    if (has_batchstatrequest()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->batchstatrequest());
+    }
+
+    // optional .CopyRequest copyRequest = 7;
+    if (has_copyrequest()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->copyrequest());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -953,6 +1195,15 @@ void RequestPacket::MergeFrom(const RequestPacket& from) {
     if (from.has_uploadrequestdata()) {
       mutable_uploadrequestdata()->::UploadRequestData::MergeFrom(from.uploadrequestdata());
     }
+    if (from.has_deleterequest()) {
+      mutable_deleterequest()->::DeleteRequest::MergeFrom(from.deleterequest());
+    }
+    if (from.has_batchstatrequest()) {
+      mutable_batchstatrequest()->::BatchStatRequest::MergeFrom(from.batchstatrequest());
+    }
+    if (from.has_copyrequest()) {
+      mutable_copyrequest()->::CopyRequest::MergeFrom(from.copyrequest());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -983,6 +1234,9 @@ bool RequestPacket::IsInitialized() const {
   if (has_uploadrequestdata()) {
     if (!this->uploadrequestdata().IsInitialized()) return false;
   }
+  if (has_copyrequest()) {
+    if (!this->copyrequest().IsInitialized()) return false;
+  }
   return true;
 }
 
@@ -992,6 +1246,9 @@ void RequestPacket::Swap(RequestPacket* other) {
     std::swap(folderstructurerequest_, other->folderstructurerequest_);
     std::swap(rangedownloadrequest_, other->rangedownloadrequest_);
     std::swap(uploadrequestdata_, other->uploadrequestdata_);
+    std::swap(deleterequest_, other->deleterequest_);
+    std::swap(batchstatrequest_, other->batchstatrequest_);
+    std::swap(copyrequest_, other->copyrequest_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -1014,6 +1271,15 @@ const int FolderStructureRequest::kShowOnlyFoldersFieldNumber;
 const int FolderStructureRequest::kShowHiddenFilesFieldNumber;
 const int FolderStructureRequest::kPageSizeFieldNumber;
 const int FolderStructureRequest::kLevelFieldNumber;
+const int FolderStructureRequest::kNamePatternFieldNumber;
+const int FolderStructureRequest::kNamePrefixFieldNumber;
+const int FolderStructureRequest::kMinModifiedTimeFieldNumber;
+const int FolderStructureRequest::kMaxModifiedTimeFieldNumber;
+const int FolderStructureRequest::kMinSizeFieldNumber;
+const int FolderStructureRequest::kMaxSizeFieldNumber;
+const int FolderStructureRequest::kSortByFieldNumber;
+const int FolderStructureRequest::kDescendingFieldNumber;
+const int FolderStructureRequest::kLimitFieldNumber;
 #endif  // !_MSC_VER
 
 FolderStructureRequest::FolderStructureRequest()
@@ -1036,6 +1302,15 @@ void FolderStructureRequest::SharedCtor() {
   showhiddenfiles_ = false;
   pagesize_ = 0u;
   level_ = 0u;
+  namepattern_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  nameprefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  minmodifiedtime_ = GOOGLE_ULONGLONG(0);
+  maxmodifiedtime_ = GOOGLE_ULONGLONG(0);
+  minsize_ = GOOGLE_ULONGLONG(0);
+  maxsize_ = GOOGLE_ULONGLONG(0);
+  sortby_ = 0;
+  descending_ = false;
+  limit_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -1044,6 +1319,12 @@ FolderStructureRequest::~FolderStructureRequest() {
 }
 
 void FolderStructureRequest::SharedDtor() {
+  if (namepattern_ != &::google::protobuf::internal::kEmptyString) {
+    delete namepattern_;
+  }
+  if (nameprefix_ != &::google::protobuf::internal::kEmptyString) {
+    delete nameprefix_;
+  }
   if (this != default_instance_) {
   }
 }
@@ -1075,6 +1356,25 @@ void FolderStructureRequest::Clear() {
     showhiddenfiles_ = false;
     pagesize_ = 0u;
     level_ = 0u;
+    if (has_namepattern()) {
+      if (namepattern_ != &::google::protobuf::internal::kEmptyString) {
+        namepattern_->clear();
+      }
+    }
+    if (has_nameprefix()) {
+      if (nameprefix_ != &::google::protobuf::internal::kEmptyString) {
+        nameprefix_->clear();
+      }
+    }
+    minmodifiedtime_ = GOOGLE_ULONGLONG(0);
+    maxmodifiedtime_ = GOOGLE_ULONGLONG(0);
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    minsize_ = GOOGLE_ULONGLONG(0);
+    maxsize_ = GOOGLE_ULONGLONG(0);
+    sortby_ = 0;
+    descending_ = false;
+    limit_ = 0u;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -1145,6 +1445,157 @@ bool FolderStructureRequest::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(42)) goto parse_namePattern;
+        break;
+      }
+
+      // optional string namePattern = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_namePattern:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_namepattern()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->namepattern().data(), this->namepattern().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(50)) goto parse_namePrefix;
+        break;
+      }
+
+      // optional string namePrefix = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_namePrefix:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_nameprefix()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->nameprefix().data(), this->nameprefix().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(56)) goto parse_minModifiedTime;
+        break;
+      }
+
+      // optional uint64 minModifiedTime = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_minModifiedTime:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &minmodifiedtime_)));
+          set_has_minmodifiedtime();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(64)) goto parse_maxModifiedTime;
+        break;
+      }
+
+      // optional uint64 maxModifiedTime = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_maxModifiedTime:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &maxmodifiedtime_)));
+          set_has_maxmodifiedtime();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(72)) goto parse_minSize;
+        break;
+      }
+
+      // optional uint64 minSize = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_minSize:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &minsize_)));
+          set_has_minsize();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(80)) goto parse_maxSize;
+        break;
+      }
+
+      // optional uint64 maxSize = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_maxSize:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &maxsize_)));
+          set_has_maxsize();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(88)) goto parse_sortBy;
+        break;
+      }
+
+      // optional .SortKey sortBy = 11;
+      case 11: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_sortBy:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::SortKey_IsValid(value)) {
+            set_sortby(static_cast< ::SortKey >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(11, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(96)) goto parse_descending;
+        break;
+      }
+
+      // optional bool descending = 12;
+      case 12: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_descending:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &descending_)));
+          set_has_descending();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(104)) goto parse_limit;
+        break;
+      }
+
+      // optional uint32 limit = 13;
+      case 13: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_limit:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &limit_)));
+          set_has_limit();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -1187,6 +1638,60 @@ void FolderStructureRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->level(), output);
   }
 
+  // optional string namePattern = 5;
+  if (has_namepattern()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->namepattern().data(), this->namepattern().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      5, this->namepattern(), output);
+  }
+
+  // optional string namePrefix = 6;
+  if (has_nameprefix()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->nameprefix().data(), this->nameprefix().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      6, this->nameprefix(), output);
+  }
+
+  // optional uint64 minModifiedTime = 7;
+  if (has_minmodifiedtime()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->minmodifiedtime(), output);
+  }
+
+  // optional uint64 maxModifiedTime = 8;
+  if (has_maxmodifiedtime()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->maxmodifiedtime(), output);
+  }
+
+  // optional uint64 minSize = 9;
+  if (has_minsize()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->minsize(), output);
+  }
+
+  // optional uint64 maxSize = 10;
+  if (has_maxsize()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(10, this->maxsize(), output);
+  }
+
+  // optional .SortKey sortBy = 11;
+  if (has_sortby()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      11, this->sortby(), output);
+  }
+
+  // optional bool descending = 12;
+  if (has_descending()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(12, this->descending(), output);
+  }
+
+  // optional uint32 limit = 13;
+  if (has_limit()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(13, this->limit(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -1215,6 +1720,62 @@ void FolderStructureRequest::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->level(), target);
   }
 
+  // optional string namePattern = 5;
+  if (has_namepattern()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->namepattern().data(), this->namepattern().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        5, this->namepattern(), target);
+  }
+
+  // optional string namePrefix = 6;
+  if (has_nameprefix()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->nameprefix().data(), this->nameprefix().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        6, this->nameprefix(), target);
+  }
+
+  // optional uint64 minModifiedTime = 7;
+  if (has_minmodifiedtime()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->minmodifiedtime(), target);
+  }
+
+  // optional uint64 maxModifiedTime = 8;
+  if (has_maxmodifiedtime()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->maxmodifiedtime(), target);
+  }
+
+  // optional uint64 minSize = 9;
+  if (has_minsize()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->minsize(), target);
+  }
+
+  // optional uint64 maxSize = 10;
+  if (has_maxsize()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->maxsize(), target);
+  }
+
+  // optional .SortKey sortBy = 11;
+  if (has_sortby()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      11, this->sortby(), target);
+  }
+
+  // optional bool descending = 12;
+  if (has_descending()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(12, this->descending(), target);
+  }
+
+  // optional uint32 limit = 13;
+  if (has_limit()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(13, this->limit(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -1250,17 +1811,79 @@ int FolderStructureRequest::ByteSize() const {
           this->level());
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional string namePattern = 5;
+    if (has_namepattern()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->namepattern());
+    }
+
+    // optional string namePrefix = 6;
+    if (has_nameprefix()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->nameprefix());
+    }
+
+    // optional uint64 minModifiedTime = 7;
+    if (has_minmodifiedtime()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->minmodifiedtime());
+    }
+
+    // optional uint64 maxModifiedTime = 8;
+    if (has_maxmodifiedtime()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->maxmodifiedtime());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional uint64 minSize = 9;
+    if (has_minsize()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->minsize());
+    }
+
+    // optional uint64 maxSize = 10;
+    if (has_maxsize()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->maxsize());
+    }
+
+    // optional .SortKey sortBy = 11;
+    if (has_sortby()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->sortby());
+    }
+
+    // optional bool descending = 12;
+    if (has_descending()) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 limit = 13;
+    if (has_limit()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->limit());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
 
 void FolderStructureRequest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
@@ -1289,6 +1912,35 @@ void FolderStructureRequest::MergeFrom(const FolderStructureRequest& from) {
     if (from.has_level()) {
       set_level(from.level());
     }
+    if (from.has_namepattern()) {
+      set_namepattern(from.namepattern());
+    }
+    if (from.has_nameprefix()) {
+      set_nameprefix(from.nameprefix());
+    }
+    if (from.has_minmodifiedtime()) {
+      set_minmodifiedtime(from.minmodifiedtime());
+    }
+    if (from.has_maxmodifiedtime()) {
+      set_maxmodifiedtime(from.maxmodifiedtime());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_minsize()) {
+      set_minsize(from.minsize());
+    }
+    if (from.has_maxsize()) {
+      set_maxsize(from.maxsize());
+    }
+    if (from.has_sortby()) {
+      set_sortby(from.sortby());
+    }
+    if (from.has_descending()) {
+      set_descending(from.descending());
+    }
+    if (from.has_limit()) {
+      set_limit(from.limit());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -1317,6 +1969,15 @@ void FolderStructureRequest::Swap(FolderStructureRequest* other) {
     std::swap(showhiddenfiles_, other->showhiddenfiles_);
     std::swap(pagesize_, other->pagesize_);
     std::swap(level_, other->level_);
+    std::swap(namepattern_, other->namepattern_);
+    std::swap(nameprefix_, other->nameprefix_);
+    std::swap(minmodifiedtime_, other->minmodifiedtime_);
+    std::swap(maxmodifiedtime_, other->maxmodifiedtime_);
+    std::swap(minsize_, other->minsize_);
+    std::swap(maxsize_, other->maxsize_);
+    std::swap(sortby_, other->sortby_);
+    std::swap(descending_, other->descending_);
+    std::swap(limit_, other->limit_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -1625,6 +2286,7 @@ void RangeDownloadRequest::Swap(RangeDownloadRequest* other) {
 
 #ifndef _MSC_VER
 const int UploadRequestData::kDataFieldNumber;
+const int UploadRequestData::kLastFieldNumber;
 #endif  // !_MSC_VER
 
 UploadRequestData::UploadRequestData()
@@ -1644,6 +2306,7 @@ UploadRequestData::UploadRequestData(const UploadRequestData& from)
 void UploadRequestData::SharedCtor() {
   _cached_size_ = 0;
   data_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  last_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -1687,6 +2350,7 @@ void UploadRequestData::Clear() {
         data_->clear();
       }
     }
+    last_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -1707,6 +2371,22 @@ bool UploadRequestData::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(16)) goto parse_last;
+        break;
+      }
+
+      // optional bool last = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_last:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &last_)));
+          set_has_last();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -1735,6 +2415,11 @@ void UploadRequestData::SerializeWithCachedSizes(
       1, this->data(), output);
   }
 
+  // optional bool last = 2;
+  if (has_last()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->last(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -1750,6 +2435,11 @@ void UploadRequestData::SerializeWithCachedSizes(
         1, this->data(), target);
   }
 
+  // optional bool last = 2;
+  if (has_last()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->last(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -1768,6 +2458,11 @@ int UploadRequestData::ByteSize() const {
           this->data());
     }
 
+    // optional bool last = 2;
+    if (has_last()) {
+      total_size += 1 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -1798,6 +2493,9 @@ void UploadRequestData::MergeFrom(const UploadRequestData& from) {
     if (from.has_data()) {
       set_data(from.data());
     }
+    if (from.has_last()) {
+      set_last(from.last());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -1823,6 +2521,7 @@ bool UploadRequestData::IsInitialized() const {
 void UploadRequestData::Swap(UploadRequestData* other) {
   if (other != this) {
     std::swap(data_, other->data_);
+    std::swap(last_, other->last_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -1838,6 +2537,725 @@ void UploadRequestData::Swap(UploadRequestData* other) {
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int DeleteRequest::kProgressFieldNumber;
+#endif  // !_MSC_VER
+
+DeleteRequest::DeleteRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void DeleteRequest::InitAsDefaultInstance() {
+}
+
+DeleteRequest::DeleteRequest(const DeleteRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void DeleteRequest::SharedCtor() {
+  _cached_size_ = 0;
+  progress_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+DeleteRequest::~DeleteRequest() {
+  SharedDtor();
+}
+
+void DeleteRequest::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void DeleteRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DeleteRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return DeleteRequest_descriptor_;
+}
+
+const DeleteRequest& DeleteRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_request_2eproto();
+  return *default_instance_;
+}
+
+DeleteRequest* DeleteRequest::default_instance_ = NULL;
+
+DeleteRequest* DeleteRequest::New() const {
+  return new DeleteRequest;
+}
+
+void DeleteRequest::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    progress_ = false;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool DeleteRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bool progress = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &progress_)));
+          set_has_progress();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void DeleteRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional bool progress = 1;
+  if (has_progress()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->progress(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* DeleteRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional bool progress = 1;
+  if (has_progress()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->progress(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int DeleteRequest::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional bool progress = 1;
+    if (has_progress()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DeleteRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const DeleteRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const DeleteRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void DeleteRequest::MergeFrom(const DeleteRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_progress()) {
+      set_progress(from.progress());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void DeleteRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DeleteRequest::CopyFrom(const DeleteRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteRequest::IsInitialized() const {
+
+  return true;
+}
+
+void DeleteRequest::Swap(DeleteRequest* other) {
+  if (other != this) {
+    std::swap(progress_, other->progress_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata DeleteRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = DeleteRequest_descriptor_;
+  metadata.reflection = DeleteRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int BatchStatRequest::kPathsFieldNumber;
+#endif  // !_MSC_VER
+
+BatchStatRequest::BatchStatRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void BatchStatRequest::InitAsDefaultInstance() {
+}
+
+BatchStatRequest::BatchStatRequest(const BatchStatRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void BatchStatRequest::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+BatchStatRequest::~BatchStatRequest() {
+  SharedDtor();
+}
+
+void BatchStatRequest::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void BatchStatRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* BatchStatRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return BatchStatRequest_descriptor_;
+}
+
+const BatchStatRequest& BatchStatRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_request_2eproto();
+  return *default_instance_;
+}
+
+BatchStatRequest* BatchStatRequest::default_instance_ = NULL;
+
+BatchStatRequest* BatchStatRequest::New() const {
+  return new BatchStatRequest;
+}
+
+void BatchStatRequest::Clear() {
+  paths_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool BatchStatRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated string paths = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_paths:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_paths()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->paths(this->paths_size() - 1).data(),
+            this->paths(this->paths_size() - 1).length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(10)) goto parse_paths;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void BatchStatRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated string paths = 1;
+  for (int i = 0; i < this->paths_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->paths(i).data(), this->paths(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->paths(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* BatchStatRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated string paths = 1;
+  for (int i = 0; i < this->paths_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->paths(i).data(), this->paths(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(1, this->paths(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int BatchStatRequest::ByteSize() const {
+  int total_size = 0;
+
+  // repeated string paths = 1;
+  total_size += 1 * this->paths_size();
+  for (int i = 0; i < this->paths_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->paths(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchStatRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const BatchStatRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BatchStatRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void BatchStatRequest::MergeFrom(const BatchStatRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  paths_.MergeFrom(from.paths_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void BatchStatRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchStatRequest::CopyFrom(const BatchStatRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchStatRequest::IsInitialized() const {
+
+  return true;
+}
+
+void BatchStatRequest::Swap(BatchStatRequest* other) {
+  if (other != this) {
+    paths_.Swap(&other->paths_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata BatchStatRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = BatchStatRequest_descriptor_;
+  metadata.reflection = BatchStatRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CopyRequest::kDestinationFieldNumber;
+const int CopyRequest::kOverwriteFieldNumber;
+const int CopyRequest::kProgressFieldNumber;
+#endif  // !_MSC_VER
+
+CopyRequest::CopyRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CopyRequest::InitAsDefaultInstance() {
+}
+
+CopyRequest::CopyRequest(const CopyRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CopyRequest::SharedCtor() {
+  _cached_size_ = 0;
+  destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  overwrite_ = false;
+  progress_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CopyRequest::~CopyRequest() {
+  SharedDtor();
+}
+
+void CopyRequest::SharedDtor() {
+  if (destination_ != &::google::protobuf::internal::kEmptyString) {
+    delete destination_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CopyRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CopyRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CopyRequest_descriptor_;
+}
+
+const CopyRequest& CopyRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_request_2eproto();
+  return *default_instance_;
+}
+
+CopyRequest* CopyRequest::default_instance_ = NULL;
+
+CopyRequest* CopyRequest::New() const {
+  return new CopyRequest;
+}
+
+void CopyRequest::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_destination()) {
+      if (destination_ != &::google::protobuf::internal::kEmptyString) {
+        destination_->clear();
+      }
+    }
+    overwrite_ = false;
+    progress_ = false;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CopyRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string destination = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_destination()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->destination().data(), this->destination().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_overwrite;
+        break;
+      }
+
+      // optional bool overwrite = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_overwrite:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &overwrite_)));
+          set_has_overwrite();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_progress;
+        break;
+      }
+
+      // optional bool progress = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_progress:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &progress_)));
+          set_has_progress();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CopyRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string destination = 1;
+  if (has_destination()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->destination().data(), this->destination().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->destination(), output);
+  }
+
+  // optional bool overwrite = 2;
+  if (has_overwrite()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->overwrite(), output);
+  }
+
+  // optional bool progress = 3;
+  if (has_progress()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->progress(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CopyRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string destination = 1;
+  if (has_destination()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->destination().data(), this->destination().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->destination(), target);
+  }
+
+  // optional bool overwrite = 2;
+  if (has_overwrite()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->overwrite(), target);
+  }
+
+  // optional bool progress = 3;
+  if (has_progress()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->progress(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CopyRequest::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string destination = 1;
+    if (has_destination()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->destination());
+    }
+
+    // optional bool overwrite = 2;
+    if (has_overwrite()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool progress = 3;
+    if (has_progress()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CopyRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CopyRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CopyRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CopyRequest::MergeFrom(const CopyRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_destination()) {
+      set_destination(from.destination());
+    }
+    if (from.has_overwrite()) {
+      set_overwrite(from.overwrite());
+    }
+    if (from.has_progress()) {
+      set_progress(from.progress());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CopyRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CopyRequest::CopyFrom(const CopyRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CopyRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  return true;
+}
+
+void CopyRequest::Swap(CopyRequest* other) {
+  if (other != this) {
+    std::swap(destination_, other->destination_);
+    std::swap(overwrite_, other->overwrite_);
+    std::swap(progress_, other->progress_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CopyRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CopyRequest_descriptor_;
+  metadata.reflection = CopyRequest_reflection_;
+  return metadata;
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 
 // @@protoc_insertion_point(global_scope)
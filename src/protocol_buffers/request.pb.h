@@ -23,6 +23,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 
@@ -36,7 +37,31 @@ class RequestPacket;
 class FolderStructureRequest;
 class RangeDownloadRequest;
 class UploadRequestData;
+class DeleteRequest;
+class BatchStatRequest;
+class CopyRequest;
+
+enum SortKey {
+  SORT_NONE = 0,
+  SORT_NAME = 1,
+  SORT_MODIFIED_TIME = 2,
+  SORT_SIZE = 3
+};
+bool SortKey_IsValid(int value);
+const SortKey SortKey_MIN = SORT_NONE;
+const SortKey SortKey_MAX = SORT_SIZE;
+const int SortKey_ARRAYSIZE = SortKey_MAX + 1;
 
+const ::google::protobuf::EnumDescriptor* SortKey_descriptor();
+inline const ::std::string& SortKey_Name(SortKey value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    SortKey_descriptor(), value);
+}
+inline bool SortKey_Parse(
+    const ::std::string& name, SortKey* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<SortKey>(
+    SortKey_descriptor(), name, value);
+}
 // ===================================================================
 
 class SmbDetails : public ::google::protobuf::Message {
@@ -167,6 +192,7 @@ class SmbDetails : public ::google::protobuf::Message {
   ::std::string* username_;
   ::std::string* password_;
   ::std::string* url_;
+  bool kerberos_;
 
   mutable int _cached_size_;
   ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
@@ -270,6 +296,33 @@ class RequestPacket : public ::google::protobuf::Message {
   inline ::UploadRequestData* release_uploadrequestdata();
   inline void set_allocated_uploadrequestdata(::UploadRequestData* uploadrequestdata);
 
+  // optional .DeleteRequest deleteRequest = 5;
+  inline bool has_deleterequest() const;
+  inline void clear_deleterequest();
+  static const int kDeleteRequestFieldNumber = 5;
+  inline const ::DeleteRequest& deleterequest() const;
+  inline ::DeleteRequest* mutable_deleterequest();
+  inline ::DeleteRequest* release_deleterequest();
+  inline void set_allocated_deleterequest(::DeleteRequest* deleterequest);
+
+  // optional .BatchStatRequest batchStatRequest = 6;
+  inline bool has_batchstatrequest() const;
+  inline void clear_batchstatrequest();
+  static const int kBatchStatRequestFieldNumber = 6;
+  inline const ::BatchStatRequest& batchstatrequest() const;
+  inline ::BatchStatRequest* mutable_batchstatrequest();
+  inline ::BatchStatRequest* release_batchstatrequest();
+  inline void set_allocated_batchstatrequest(::BatchStatRequest* batchstatrequest);
+
+  // optional .CopyRequest copyRequest = 7;
+  inline bool has_copyrequest() const;
+  inline void clear_copyrequest();
+  static const int kCopyRequestFieldNumber = 7;
+  inline const ::CopyRequest& copyrequest() const;
+  inline ::CopyRequest* mutable_copyrequest();
+  inline ::CopyRequest* release_copyrequest();
+  inline void set_allocated_copyrequest(::CopyRequest* copyrequest);
+
   // @@protoc_insertion_point(class_scope:RequestPacket)
  private:
   inline void set_has_smbdetails();
@@ -280,6 +333,12 @@ class RequestPacket : public ::google::protobuf::Message {
   inline void clear_has_rangedownloadrequest();
   inline void set_has_uploadrequestdata();
   inline void clear_has_uploadrequestdata();
+  inline void set_has_deleterequest();
+  inline void clear_has_deleterequest();
+  inline void set_has_batchstatrequest();
+  inline void clear_has_batchstatrequest();
+  inline void set_has_copyrequest();
+  inline void clear_has_copyrequest();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -287,9 +346,12 @@ class RequestPacket : public ::google::protobuf::Message {
   ::FolderStructureRequest* folderstructurerequest_;
   ::RangeDownloadRequest* rangedownloadrequest_;
   ::UploadRequestData* uploadrequestdata_;
+  ::DeleteRequest* deleterequest_;
+  ::BatchStatRequest* batchstatrequest_;
+  ::CopyRequest* copyrequest_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(7 + 31) / 32];
 
   friend void  protobuf_AddDesc_request_2eproto();
   friend void protobuf_AssignDesc_request_2eproto();
@@ -382,6 +444,79 @@ class FolderStructureRequest : public ::google::protobuf::Message {
   inline ::google::protobuf::uint32 level() const;
   inline void set_level(::google::protobuf::uint32 value);
 
+  // optional string namePattern = 5;
+  inline bool has_namepattern() const;
+  inline void clear_namepattern();
+  static const int kNamePatternFieldNumber = 5;
+  inline const ::std::string& namepattern() const;
+  inline void set_namepattern(const ::std::string& value);
+  inline void set_namepattern(const char* value);
+  inline void set_namepattern(const char* value, size_t size);
+  inline ::std::string* mutable_namepattern();
+  inline ::std::string* release_namepattern();
+  inline void set_allocated_namepattern(::std::string* namepattern);
+
+  // optional string namePrefix = 6;
+  inline bool has_nameprefix() const;
+  inline void clear_nameprefix();
+  static const int kNamePrefixFieldNumber = 6;
+  inline const ::std::string& nameprefix() const;
+  inline void set_nameprefix(const ::std::string& value);
+  inline void set_nameprefix(const char* value);
+  inline void set_nameprefix(const char* value, size_t size);
+  inline ::std::string* mutable_nameprefix();
+  inline ::std::string* release_nameprefix();
+  inline void set_allocated_nameprefix(::std::string* nameprefix);
+
+  // optional uint64 minModifiedTime = 7;
+  inline bool has_minmodifiedtime() const;
+  inline void clear_minmodifiedtime();
+  static const int kMinModifiedTimeFieldNumber = 7;
+  inline ::google::protobuf::uint64 minmodifiedtime() const;
+  inline void set_minmodifiedtime(::google::protobuf::uint64 value);
+
+  // optional uint64 maxModifiedTime = 8;
+  inline bool has_maxmodifiedtime() const;
+  inline void clear_maxmodifiedtime();
+  static const int kMaxModifiedTimeFieldNumber = 8;
+  inline ::google::protobuf::uint64 maxmodifiedtime() const;
+  inline void set_maxmodifiedtime(::google::protobuf::uint64 value);
+
+  // optional uint64 minSize = 9;
+  inline bool has_minsize() const;
+  inline void clear_minsize();
+  static const int kMinSizeFieldNumber = 9;
+  inline ::google::protobuf::uint64 minsize() const;
+  inline void set_minsize(::google::protobuf::uint64 value);
+
+  // optional uint64 maxSize = 10;
+  inline bool has_maxsize() const;
+  inline void clear_maxsize();
+  static const int kMaxSizeFieldNumber = 10;
+  inline ::google::protobuf::uint64 maxsize() const;
+  inline void set_maxsize(::google::protobuf::uint64 value);
+
+  // optional .SortKey sortBy = 11;
+  inline bool has_sortby() const;
+  inline void clear_sortby();
+  static const int kSortByFieldNumber = 11;
+  inline ::SortKey sortby() const;
+  inline void set_sortby(::SortKey value);
+
+  // optional bool descending = 12;
+  inline bool has_descending() const;
+  inline void clear_descending();
+  static const int kDescendingFieldNumber = 12;
+  inline bool descending() const;
+  inline void set_descending(bool value);
+
+  // optional uint32 limit = 13;
+  inline bool has_limit() const;
+  inline void clear_limit();
+  static const int kLimitFieldNumber = 13;
+  inline ::google::protobuf::uint32 limit() const;
+  inline void set_limit(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:FolderStructureRequest)
  private:
   inline void set_has_showonlyfolders();
@@ -392,16 +527,43 @@ class FolderStructureRequest : public ::google::protobuf::Message {
   inline void clear_has_pagesize();
   inline void set_has_level();
   inline void clear_has_level();
+  inline void set_has_namepattern();
+  inline void clear_has_namepattern();
+  inline void set_has_nameprefix();
+  inline void clear_has_nameprefix();
+  inline void set_has_minmodifiedtime();
+  inline void clear_has_minmodifiedtime();
+  inline void set_has_maxmodifiedtime();
+  inline void clear_has_maxmodifiedtime();
+  inline void set_has_minsize();
+  inline void clear_has_minsize();
+  inline void set_has_maxsize();
+  inline void clear_has_maxsize();
+  inline void set_has_sortby();
+  inline void clear_has_sortby();
+  inline void set_has_descending();
+  inline void clear_has_descending();
+  inline void set_has_limit();
+  inline void clear_has_limit();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  bool showonlyfolders_;
-  bool showhiddenfiles_;
   ::google::protobuf::uint32 pagesize_;
   ::google::protobuf::uint32 level_;
+  ::std::string* namepattern_;
+  ::std::string* nameprefix_;
+  bool showonlyfolders_;
+  bool showhiddenfiles_;
+  bool descending_;
+  int sortby_;
+  ::google::protobuf::uint64 minmodifiedtime_;
+  ::google::protobuf::uint64 maxmodifiedtime_;
+  ::google::protobuf::uint64 minsize_;
+  ::google::protobuf::uint64 maxsize_;
+  ::google::protobuf::uint32 limit_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(13 + 31) / 32];
 
   friend void  protobuf_AddDesc_request_2eproto();
   friend void protobuf_AssignDesc_request_2eproto();
@@ -580,17 +742,27 @@ class UploadRequestData : public ::google::protobuf::Message {
   inline ::std::string* release_data();
   inline void set_allocated_data(::std::string* data);
 
+  // optional bool last = 2;
+  inline bool has_last() const;
+  inline void clear_last();
+  static const int kLastFieldNumber = 2;
+  inline bool last() const;
+  inline void set_last(bool value);
+
   // @@protoc_insertion_point(class_scope:UploadRequestData)
  private:
   inline void set_has_data();
   inline void clear_has_data();
+  inline void set_has_last();
+  inline void clear_has_last();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* data_;
+  bool last_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
 
   friend void  protobuf_AddDesc_request_2eproto();
   friend void protobuf_AssignDesc_request_2eproto();
@@ -599,6 +771,284 @@ class UploadRequestData : public ::google::protobuf::Message {
   void InitAsDefaultInstance();
   static UploadRequestData* default_instance_;
 };
+// -------------------------------------------------------------------
+
+class DeleteRequest : public ::google::protobuf::Message {
+ public:
+  DeleteRequest();
+  virtual ~DeleteRequest();
+
+  DeleteRequest(const DeleteRequest& from);
+
+  inline DeleteRequest& operator=(const DeleteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DeleteRequest& default_instance();
+
+  void Swap(DeleteRequest* other);
+
+  // implements Message ----------------------------------------------
+
+  DeleteRequest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const DeleteRequest& from);
+  void MergeFrom(const DeleteRequest& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional bool progress = 1;
+  inline bool has_progress() const;
+  inline void clear_progress();
+  static const int kProgressFieldNumber = 1;
+  inline bool progress() const;
+  inline void set_progress(bool value);
+
+  // @@protoc_insertion_point(class_scope:DeleteRequest)
+ private:
+  inline void set_has_progress();
+  inline void clear_has_progress();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  bool progress_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_request_2eproto();
+  friend void protobuf_AssignDesc_request_2eproto();
+  friend void protobuf_ShutdownFile_request_2eproto();
+
+  void InitAsDefaultInstance();
+  static DeleteRequest* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class BatchStatRequest : public ::google::protobuf::Message {
+ public:
+  BatchStatRequest();
+  virtual ~BatchStatRequest();
+
+  BatchStatRequest(const BatchStatRequest& from);
+
+  inline BatchStatRequest& operator=(const BatchStatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BatchStatRequest& default_instance();
+
+  void Swap(BatchStatRequest* other);
+
+  // implements Message ----------------------------------------------
+
+  BatchStatRequest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const BatchStatRequest& from);
+  void MergeFrom(const BatchStatRequest& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string paths = 1;
+  inline int paths_size() const;
+  inline void clear_paths();
+  static const int kPathsFieldNumber = 1;
+  inline const ::std::string& paths(int index) const;
+  inline ::std::string* mutable_paths(int index);
+  inline void set_paths(int index, const ::std::string& value);
+  inline void set_paths(int index, const char* value);
+  inline void set_paths(int index, const char* value, size_t size);
+  inline ::std::string* add_paths();
+  inline void add_paths(const ::std::string& value);
+  inline void add_paths(const char* value);
+  inline void add_paths(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& paths() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_paths();
+
+  // @@protoc_insertion_point(class_scope:BatchStatRequest)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::RepeatedPtrField< ::std::string> paths_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_request_2eproto();
+  friend void protobuf_AssignDesc_request_2eproto();
+  friend void protobuf_ShutdownFile_request_2eproto();
+
+  void InitAsDefaultInstance();
+  static BatchStatRequest* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CopyRequest : public ::google::protobuf::Message {
+ public:
+  CopyRequest();
+  virtual ~CopyRequest();
+
+  CopyRequest(const CopyRequest& from);
+
+  inline CopyRequest& operator=(const CopyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CopyRequest& default_instance();
+
+  void Swap(CopyRequest* other);
+
+  // implements Message ----------------------------------------------
+
+  CopyRequest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CopyRequest& from);
+  void MergeFrom(const CopyRequest& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string destination = 1;
+  inline bool has_destination() const;
+  inline void clear_destination();
+  static const int kDestinationFieldNumber = 1;
+  inline const ::std::string& destination() const;
+  inline void set_destination(const ::std::string& value);
+  inline void set_destination(const char* value);
+  inline void set_destination(const char* value, size_t size);
+  inline ::std::string* mutable_destination();
+  inline ::std::string* release_destination();
+  inline void set_allocated_destination(::std::string* destination);
+
+  // optional bool overwrite = 2;
+  inline bool has_overwrite() const;
+  inline void clear_overwrite();
+  static const int kOverwriteFieldNumber = 2;
+  inline bool overwrite() const;
+  inline void set_overwrite(bool value);
+
+  // optional bool progress = 3;
+  inline bool has_progress() const;
+  inline void clear_progress();
+  static const int kProgressFieldNumber = 3;
+  inline bool progress() const;
+  inline void set_progress(bool value);
+
+  // @@protoc_insertion_point(class_scope:CopyRequest)
+ private:
+  inline void set_has_destination();
+  inline void clear_has_destination();
+  inline void set_has_overwrite();
+  inline void clear_has_overwrite();
+  inline void set_has_progress();
+  inline void clear_has_progress();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* destination_;
+  bool overwrite_;
+  bool progress_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_request_2eproto();
+  friend void protobuf_AssignDesc_request_2eproto();
+  friend void protobuf_ShutdownFile_request_2eproto();
+
+  void InitAsDefaultInstance();
+  static CopyRequest* default_instance_;
+};
 // ===================================================================
 
 
@@ -1064,6 +1514,120 @@ inline void RequestPacket::set_allocated_uploadrequestdata(::UploadRequestData*
   }
 }
 
+// optional .DeleteRequest deleteRequest = 5;
+inline bool RequestPacket::has_deleterequest() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void RequestPacket::set_has_deleterequest() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void RequestPacket::clear_has_deleterequest() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void RequestPacket::clear_deleterequest() {
+  if (deleterequest_ != NULL) deleterequest_->::DeleteRequest::Clear();
+  clear_has_deleterequest();
+}
+inline const ::DeleteRequest& RequestPacket::deleterequest() const {
+  return deleterequest_ != NULL ? *deleterequest_ : *default_instance_->deleterequest_;
+}
+inline ::DeleteRequest* RequestPacket::mutable_deleterequest() {
+  set_has_deleterequest();
+  if (deleterequest_ == NULL) deleterequest_ = new ::DeleteRequest;
+  return deleterequest_;
+}
+inline ::DeleteRequest* RequestPacket::release_deleterequest() {
+  clear_has_deleterequest();
+  ::DeleteRequest* temp = deleterequest_;
+  deleterequest_ = NULL;
+  return temp;
+}
+inline void RequestPacket::set_allocated_deleterequest(::DeleteRequest* deleterequest) {
+  delete deleterequest_;
+  deleterequest_ = deleterequest;
+  if (deleterequest) {
+    set_has_deleterequest();
+  } else {
+    clear_has_deleterequest();
+  }
+}
+
+// optional .BatchStatRequest batchStatRequest = 6;
+inline bool RequestPacket::has_batchstatrequest() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void RequestPacket::set_has_batchstatrequest() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void RequestPacket::clear_has_batchstatrequest() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void RequestPacket::clear_batchstatrequest() {
+  if (batchstatrequest_ != NULL) batchstatrequest_->::BatchStatRequest::Clear();
+  clear_has_batchstatrequest();
+}
+inline const ::BatchStatRequest& RequestPacket::batchstatrequest() const {
+  return batchstatrequest_ != NULL ? *batchstatrequest_ : *default_instance_->batchstatrequest_;
+}
+inline ::BatchStatRequest* RequestPacket::mutable_batchstatrequest() {
+  set_has_batchstatrequest();
+  if (batchstatrequest_ == NULL) batchstatrequest_ = new ::BatchStatRequest;
+  return batchstatrequest_;
+}
+inline ::BatchStatRequest* RequestPacket::release_batchstatrequest() {
+  clear_has_batchstatrequest();
+  ::BatchStatRequest* temp = batchstatrequest_;
+  batchstatrequest_ = NULL;
+  return temp;
+}
+inline void RequestPacket::set_allocated_batchstatrequest(::BatchStatRequest* batchstatrequest) {
+  delete batchstatrequest_;
+  batchstatrequest_ = batchstatrequest;
+  if (batchstatrequest) {
+    set_has_batchstatrequest();
+  } else {
+    clear_has_batchstatrequest();
+  }
+}
+
+// optional .CopyRequest copyRequest = 7;
+inline bool RequestPacket::has_copyrequest() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void RequestPacket::set_has_copyrequest() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void RequestPacket::clear_has_copyrequest() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void RequestPacket::clear_copyrequest() {
+  if (copyrequest_ != NULL) copyrequest_->::CopyRequest::Clear();
+  clear_has_copyrequest();
+}
+inline const ::CopyRequest& RequestPacket::copyrequest() const {
+  return copyrequest_ != NULL ? *copyrequest_ : *default_instance_->copyrequest_;
+}
+inline ::CopyRequest* RequestPacket::mutable_copyrequest() {
+  set_has_copyrequest();
+  if (copyrequest_ == NULL) copyrequest_ = new ::CopyRequest;
+  return copyrequest_;
+}
+inline ::CopyRequest* RequestPacket::release_copyrequest() {
+  clear_has_copyrequest();
+  ::CopyRequest* temp = copyrequest_;
+  copyrequest_ = NULL;
+  return temp;
+}
+inline void RequestPacket::set_allocated_copyrequest(::CopyRequest* copyrequest) {
+  delete copyrequest_;
+  copyrequest_ = copyrequest;
+  if (copyrequest) {
+    set_has_copyrequest();
+  } else {
+    clear_has_copyrequest();
+  }
+}
+
 // -------------------------------------------------------------------
 
 // FolderStructureRequest
@@ -1156,6 +1720,301 @@ inline void FolderStructureRequest::set_level(::google::protobuf::uint32 value)
   level_ = value;
 }
 
+// optional string namePattern = 5;
+inline bool FolderStructureRequest::has_namepattern() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void FolderStructureRequest::set_has_namepattern() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void FolderStructureRequest::clear_has_namepattern() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void FolderStructureRequest::clear_namepattern() {
+  if (namepattern_ != &::google::protobuf::internal::kEmptyString) {
+    namepattern_->clear();
+  }
+  clear_has_namepattern();
+}
+inline const ::std::string& FolderStructureRequest::namepattern() const {
+  return *namepattern_;
+}
+inline void FolderStructureRequest::set_namepattern(const ::std::string& value) {
+  set_has_namepattern();
+  if (namepattern_ == &::google::protobuf::internal::kEmptyString) {
+    namepattern_ = new ::std::string;
+  }
+  namepattern_->assign(value);
+}
+inline void FolderStructureRequest::set_namepattern(const char* value) {
+  set_has_namepattern();
+  if (namepattern_ == &::google::protobuf::internal::kEmptyString) {
+    namepattern_ = new ::std::string;
+  }
+  namepattern_->assign(value);
+}
+inline void FolderStructureRequest::set_namepattern(const char* value, size_t size) {
+  set_has_namepattern();
+  if (namepattern_ == &::google::protobuf::internal::kEmptyString) {
+    namepattern_ = new ::std::string;
+  }
+  namepattern_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* FolderStructureRequest::mutable_namepattern() {
+  set_has_namepattern();
+  if (namepattern_ == &::google::protobuf::internal::kEmptyString) {
+    namepattern_ = new ::std::string;
+  }
+  return namepattern_;
+}
+inline ::std::string* FolderStructureRequest::release_namepattern() {
+  clear_has_namepattern();
+  if (namepattern_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = namepattern_;
+    namepattern_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void FolderStructureRequest::set_allocated_namepattern(::std::string* namepattern) {
+  if (namepattern_ != &::google::protobuf::internal::kEmptyString) {
+    delete namepattern_;
+  }
+  if (namepattern) {
+    set_has_namepattern();
+    namepattern_ = namepattern;
+  } else {
+    clear_has_namepattern();
+    namepattern_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string namePrefix = 6;
+inline bool FolderStructureRequest::has_nameprefix() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void FolderStructureRequest::set_has_nameprefix() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void FolderStructureRequest::clear_has_nameprefix() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void FolderStructureRequest::clear_nameprefix() {
+  if (nameprefix_ != &::google::protobuf::internal::kEmptyString) {
+    nameprefix_->clear();
+  }
+  clear_has_nameprefix();
+}
+inline const ::std::string& FolderStructureRequest::nameprefix() const {
+  return *nameprefix_;
+}
+inline void FolderStructureRequest::set_nameprefix(const ::std::string& value) {
+  set_has_nameprefix();
+  if (nameprefix_ == &::google::protobuf::internal::kEmptyString) {
+    nameprefix_ = new ::std::string;
+  }
+  nameprefix_->assign(value);
+}
+inline void FolderStructureRequest::set_nameprefix(const char* value) {
+  set_has_nameprefix();
+  if (nameprefix_ == &::google::protobuf::internal::kEmptyString) {
+    nameprefix_ = new ::std::string;
+  }
+  nameprefix_->assign(value);
+}
+inline void FolderStructureRequest::set_nameprefix(const char* value, size_t size) {
+  set_has_nameprefix();
+  if (nameprefix_ == &::google::protobuf::internal::kEmptyString) {
+    nameprefix_ = new ::std::string;
+  }
+  nameprefix_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* FolderStructureRequest::mutable_nameprefix() {
+  set_has_nameprefix();
+  if (nameprefix_ == &::google::protobuf::internal::kEmptyString) {
+    nameprefix_ = new ::std::string;
+  }
+  return nameprefix_;
+}
+inline ::std::string* FolderStructureRequest::release_nameprefix() {
+  clear_has_nameprefix();
+  if (nameprefix_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = nameprefix_;
+    nameprefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void FolderStructureRequest::set_allocated_nameprefix(::std::string* nameprefix) {
+  if (nameprefix_ != &::google::protobuf::internal::kEmptyString) {
+    delete nameprefix_;
+  }
+  if (nameprefix) {
+    set_has_nameprefix();
+    nameprefix_ = nameprefix;
+  } else {
+    clear_has_nameprefix();
+    nameprefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional uint64 minModifiedTime = 7;
+inline bool FolderStructureRequest::has_minmodifiedtime() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void FolderStructureRequest::set_has_minmodifiedtime() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void FolderStructureRequest::clear_has_minmodifiedtime() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void FolderStructureRequest::clear_minmodifiedtime() {
+  minmodifiedtime_ = GOOGLE_ULONGLONG(0);
+  clear_has_minmodifiedtime();
+}
+inline ::google::protobuf::uint64 FolderStructureRequest::minmodifiedtime() const {
+  return minmodifiedtime_;
+}
+inline void FolderStructureRequest::set_minmodifiedtime(::google::protobuf::uint64 value) {
+  set_has_minmodifiedtime();
+  minmodifiedtime_ = value;
+}
+
+// optional uint64 maxModifiedTime = 8;
+inline bool FolderStructureRequest::has_maxmodifiedtime() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void FolderStructureRequest::set_has_maxmodifiedtime() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void FolderStructureRequest::clear_has_maxmodifiedtime() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void FolderStructureRequest::clear_maxmodifiedtime() {
+  maxmodifiedtime_ = GOOGLE_ULONGLONG(0);
+  clear_has_maxmodifiedtime();
+}
+inline ::google::protobuf::uint64 FolderStructureRequest::maxmodifiedtime() const {
+  return maxmodifiedtime_;
+}
+inline void FolderStructureRequest::set_maxmodifiedtime(::google::protobuf::uint64 value) {
+  set_has_maxmodifiedtime();
+  maxmodifiedtime_ = value;
+}
+
+// optional uint64 minSize = 9;
+inline bool FolderStructureRequest::has_minsize() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void FolderStructureRequest::set_has_minsize() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void FolderStructureRequest::clear_has_minsize() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void FolderStructureRequest::clear_minsize() {
+  minsize_ = GOOGLE_ULONGLONG(0);
+  clear_has_minsize();
+}
+inline ::google::protobuf::uint64 FolderStructureRequest::minsize() const {
+  return minsize_;
+}
+inline void FolderStructureRequest::set_minsize(::google::protobuf::uint64 value) {
+  set_has_minsize();
+  minsize_ = value;
+}
+
+// optional uint64 maxSize = 10;
+inline bool FolderStructureRequest::has_maxsize() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void FolderStructureRequest::set_has_maxsize() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void FolderStructureRequest::clear_has_maxsize() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void FolderStructureRequest::clear_maxsize() {
+  maxsize_ = GOOGLE_ULONGLONG(0);
+  clear_has_maxsize();
+}
+inline ::google::protobuf::uint64 FolderStructureRequest::maxsize() const {
+  return maxsize_;
+}
+inline void FolderStructureRequest::set_maxsize(::google::protobuf::uint64 value) {
+  set_has_maxsize();
+  maxsize_ = value;
+}
+
+// optional .SortKey sortBy = 11;
+inline bool FolderStructureRequest::has_sortby() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void FolderStructureRequest::set_has_sortby() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void FolderStructureRequest::clear_has_sortby() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void FolderStructureRequest::clear_sortby() {
+  sortby_ = 0;
+  clear_has_sortby();
+}
+inline ::SortKey FolderStructureRequest::sortby() const {
+  return static_cast< ::SortKey >(sortby_);
+}
+inline void FolderStructureRequest::set_sortby(::SortKey value) {
+  assert(::SortKey_IsValid(value));
+  set_has_sortby();
+  sortby_ = value;
+}
+
+// optional bool descending = 12;
+inline bool FolderStructureRequest::has_descending() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void FolderStructureRequest::set_has_descending() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void FolderStructureRequest::clear_has_descending() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void FolderStructureRequest::clear_descending() {
+  descending_ = false;
+  clear_has_descending();
+}
+inline bool FolderStructureRequest::descending() const {
+  return descending_;
+}
+inline void FolderStructureRequest::set_descending(bool value) {
+  set_has_descending();
+  descending_ = value;
+}
+
+// optional uint32 limit = 13;
+inline bool FolderStructureRequest::has_limit() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void FolderStructureRequest::set_has_limit() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void FolderStructureRequest::clear_has_limit() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void FolderStructureRequest::clear_limit() {
+  limit_ = 0u;
+  clear_has_limit();
+}
+inline ::google::protobuf::uint32 FolderStructureRequest::limit() const {
+  return limit_;
+}
+inline void FolderStructureRequest::set_limit(::google::protobuf::uint32 value) {
+  set_has_limit();
+  limit_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // RangeDownloadRequest
@@ -1300,6 +2159,220 @@ inline void UploadRequestData::set_allocated_data(::std::string* data) {
   }
 }
 
+// optional bool last = 2;
+inline bool UploadRequestData::has_last() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void UploadRequestData::set_has_last() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void UploadRequestData::clear_has_last() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void UploadRequestData::clear_last() {
+  last_ = false;
+  clear_has_last();
+}
+inline bool UploadRequestData::last() const {
+  return last_;
+}
+inline void UploadRequestData::set_last(bool value) {
+  set_has_last();
+  last_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// DeleteRequest
+
+// optional bool progress = 1;
+inline bool DeleteRequest::has_progress() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void DeleteRequest::set_has_progress() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void DeleteRequest::clear_has_progress() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void DeleteRequest::clear_progress() {
+  progress_ = false;
+  clear_has_progress();
+}
+inline bool DeleteRequest::progress() const {
+  return progress_;
+}
+inline void DeleteRequest::set_progress(bool value) {
+  set_has_progress();
+  progress_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// BatchStatRequest
+
+// repeated string paths = 1;
+inline int BatchStatRequest::paths_size() const {
+  return paths_.size();
+}
+inline void BatchStatRequest::clear_paths() {
+  paths_.Clear();
+}
+inline const ::std::string& BatchStatRequest::paths(int index) const {
+  return paths_.Get(index);
+}
+inline ::std::string* BatchStatRequest::mutable_paths(int index) {
+  return paths_.Mutable(index);
+}
+inline void BatchStatRequest::set_paths(int index, const ::std::string& value) {
+  paths_.Mutable(index)->assign(value);
+}
+inline void BatchStatRequest::set_paths(int index, const char* value) {
+  paths_.Mutable(index)->assign(value);
+}
+inline void BatchStatRequest::set_paths(int index, const char* value, size_t size) {
+  paths_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* BatchStatRequest::add_paths() {
+  return paths_.Add();
+}
+inline void BatchStatRequest::add_paths(const ::std::string& value) {
+  paths_.Add()->assign(value);
+}
+inline void BatchStatRequest::add_paths(const char* value) {
+  paths_.Add()->assign(value);
+}
+inline void BatchStatRequest::add_paths(const char* value, size_t size) {
+  paths_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+BatchStatRequest::paths() const {
+  return paths_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+BatchStatRequest::mutable_paths() {
+  return &paths_;
+}
+
+// -------------------------------------------------------------------
+
+// CopyRequest
+
+// required string destination = 1;
+inline bool CopyRequest::has_destination() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CopyRequest::set_has_destination() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CopyRequest::clear_has_destination() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CopyRequest::clear_destination() {
+  if (destination_ != &::google::protobuf::internal::kEmptyString) {
+    destination_->clear();
+  }
+  clear_has_destination();
+}
+inline const ::std::string& CopyRequest::destination() const {
+  return *destination_;
+}
+inline void CopyRequest::set_destination(const ::std::string& value) {
+  set_has_destination();
+  if (destination_ == &::google::protobuf::internal::kEmptyString) {
+    destination_ = new ::std::string;
+  }
+  destination_->assign(value);
+}
+inline void CopyRequest::set_destination(const char* value) {
+  set_has_destination();
+  if (destination_ == &::google::protobuf::internal::kEmptyString) {
+    destination_ = new ::std::string;
+  }
+  destination_->assign(value);
+}
+inline void CopyRequest::set_destination(const char* value, size_t size) {
+  set_has_destination();
+  if (destination_ == &::google::protobuf::internal::kEmptyString) {
+    destination_ = new ::std::string;
+  }
+  destination_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CopyRequest::mutable_destination() {
+  set_has_destination();
+  if (destination_ == &::google::protobuf::internal::kEmptyString) {
+    destination_ = new ::std::string;
+  }
+  return destination_;
+}
+inline ::std::string* CopyRequest::release_destination() {
+  clear_has_destination();
+  if (destination_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = destination_;
+    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CopyRequest::set_allocated_destination(::std::string* destination) {
+  if (destination_ != &::google::protobuf::internal::kEmptyString) {
+    delete destination_;
+  }
+  if (destination) {
+    set_has_destination();
+    destination_ = destination;
+  } else {
+    clear_has_destination();
+    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional bool overwrite = 2;
+inline bool CopyRequest::has_overwrite() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CopyRequest::set_has_overwrite() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CopyRequest::clear_has_overwrite() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CopyRequest::clear_overwrite() {
+  overwrite_ = false;
+  clear_has_overwrite();
+}
+inline bool CopyRequest::overwrite() const {
+  return overwrite_;
+}
+inline void CopyRequest::set_overwrite(bool value) {
+  set_has_overwrite();
+  overwrite_ = value;
+}
+
+// optional bool progress = 3;
+inline bool CopyRequest::has_progress() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void CopyRequest::set_has_progress() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void CopyRequest::clear_has_progress() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void CopyRequest::clear_progress() {
+  progress_ = false;
+  clear_has_progress();
+}
+inline bool CopyRequest::progress() const {
+  return progress_;
+}
+inline void CopyRequest::set_progress(bool value) {
+  set_has_progress();
+  progress_ = value;
+}
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1307,6 +2380,10 @@ inline void UploadRequestData::set_allocated_data(::std::string* data) {
 namespace google {
 namespace protobuf {
 
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::SortKey>() {
+  return ::SortKey_descriptor();
+}
 
 }  // namespace google
 }  // namespace protobuf
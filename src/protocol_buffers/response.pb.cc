@@ -42,6 +42,27 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* DeleteResourceResponse_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   DeleteResourceResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* DeleteProgressResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  DeleteProgressResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* DeleteFailureEntry_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  DeleteFailureEntry_reflection_ = NULL;
+const ::google::protobuf::Descriptor* BatchStatResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  BatchStatResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* BatchStatEntry_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  BatchStatEntry_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CopyResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CopyResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CopyProgressResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CopyProgressResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* StatsResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  StatsResponse_reflection_ = NULL;
 
 }  // namespace
 
@@ -53,13 +74,18 @@ void protobuf_AssignDesc_response_2eproto() {
       "response.proto");
   GOOGLE_CHECK(file != NULL);
   ResponsePacket_descriptor_ = file->message_type(0);
-  static const int ResponsePacket_offsets_[6] = {
+  static const int ResponsePacket_offsets_[11] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, folderstructureresponse_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, downloadinitresponse_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, downloaddataresponse_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, testconnectionresponse_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, addfolderresponse_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, deleteresourceresponse_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, statsresponse_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, deleteprogressresponse_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, batchstatresponse_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, copyresponse_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResponsePacket, copyprogressresponse_),
   };
   ResponsePacket_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -182,6 +208,121 @@ void protobuf_AssignDesc_response_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(DeleteResourceResponse));
+  DeleteProgressResponse_descriptor_ = file->message_type(8);
+  static const int DeleteProgressResponse_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, files_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, folders_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, failed_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, summary_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, failures_),
+  };
+  DeleteProgressResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      DeleteProgressResponse_descriptor_,
+      DeleteProgressResponse::default_instance_,
+      DeleteProgressResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteProgressResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(DeleteProgressResponse));
+  DeleteFailureEntry_descriptor_ = file->message_type(9);
+  static const int DeleteFailureEntry_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteFailureEntry, name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteFailureEntry, code_),
+  };
+  DeleteFailureEntry_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      DeleteFailureEntry_descriptor_,
+      DeleteFailureEntry::default_instance_,
+      DeleteFailureEntry_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteFailureEntry, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeleteFailureEntry, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(DeleteFailureEntry));
+  BatchStatResponse_descriptor_ = file->message_type(10);
+  static const int BatchStatResponse_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatResponse, entries_),
+  };
+  BatchStatResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      BatchStatResponse_descriptor_,
+      BatchStatResponse::default_instance_,
+      BatchStatResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(BatchStatResponse));
+  BatchStatEntry_descriptor_ = file->message_type(11);
+  static const int BatchStatEntry_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatEntry, index_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatEntry, code_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatEntry, fileinformation_),
+  };
+  BatchStatEntry_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      BatchStatEntry_descriptor_,
+      BatchStatEntry::default_instance_,
+      BatchStatEntry_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatEntry, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchStatEntry, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(BatchStatEntry));
+  CopyResponse_descriptor_ = file->message_type(12);
+  static const int CopyResponse_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyResponse, fileinformation_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyResponse, serverside_),
+  };
+  CopyResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CopyResponse_descriptor_,
+      CopyResponse::default_instance_,
+      CopyResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CopyResponse));
+  CopyProgressResponse_descriptor_ = file->message_type(13);
+  static const int CopyProgressResponse_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyProgressResponse, bytes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyProgressResponse, total_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyProgressResponse, serverside_),
+  };
+  CopyProgressResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CopyProgressResponse_descriptor_,
+      CopyProgressResponse::default_instance_,
+      CopyProgressResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyProgressResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CopyProgressResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CopyProgressResponse));
+  StatsResponse_descriptor_ = file->message_type(14);
+  static const int StatsResponse_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatsResponse, stats_),
+  };
+  StatsResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      StatsResponse_descriptor_,
+      StatsResponse::default_instance_,
+      StatsResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatsResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatsResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(StatsResponse));
 }
 
 namespace {
@@ -210,6 +351,20 @@ void protobuf_RegisterTypes(const ::std::string&) {
     AddFolderResponse_descriptor_, &AddFolderResponse::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     DeleteResourceResponse_descriptor_, &DeleteResourceResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    DeleteProgressResponse_descriptor_, &DeleteProgressResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    DeleteFailureEntry_descriptor_, &DeleteFailureEntry::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    BatchStatResponse_descriptor_, &BatchStatResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    BatchStatEntry_descriptor_, &BatchStatEntry::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CopyResponse_descriptor_, &CopyResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CopyProgressResponse_descriptor_, &CopyProgressResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    StatsResponse_descriptor_, &StatsResponse::default_instance());
 }
 
 }  // namespace
@@ -231,6 +386,20 @@ void protobuf_ShutdownFile_response_2eproto() {
   delete AddFolderResponse_reflection_;
   delete DeleteResourceResponse::default_instance_;
   delete DeleteResourceResponse_reflection_;
+  delete DeleteProgressResponse::default_instance_;
+  delete DeleteProgressResponse_reflection_;
+  delete DeleteFailureEntry::default_instance_;
+  delete DeleteFailureEntry_reflection_;
+  delete BatchStatResponse::default_instance_;
+  delete BatchStatResponse_reflection_;
+  delete BatchStatEntry::default_instance_;
+  delete BatchStatEntry_reflection_;
+  delete CopyResponse::default_instance_;
+  delete CopyResponse_reflection_;
+  delete CopyProgressResponse::default_instance_;
+  delete CopyProgressResponse_reflection_;
+  delete StatsResponse::default_instance_;
+  delete StatsResponse_reflection_;
 }
 
 void protobuf_AddDesc_response_2eproto() {
@@ -240,7 +409,7 @@ void protobuf_AddDesc_response_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\016response.proto\"\326\002\n\016ResponsePacket\0229\n\027f"
+    "\n\016response.proto\"\277\004\n\016ResponsePacket\0229\n\027f"
     "olderStructureResponse\030\001 \001(\0132\030.FolderStr"
     "uctureResponse\0223\n\024downloadInitResponse\030\002"
     " \001(\0132\025.DownloadInitResponse\0223\n\024downloadD"
@@ -249,19 +418,38 @@ void protobuf_AddDesc_response_2eproto() {
     "onnectionResponse\022-\n\021addFolderResponse\030\005"
     " \001(\0132\022.AddFolderResponse\0227\n\026deleteResour"
     "ceResponse\030\006 \001(\0132\027.DeleteResourceRespons"
-    "e\"D\n\027FolderStructureResponse\022)\n\017fileInfo"
-    "rmation\030\001 \003(\0132\020.FileInformation\"\202\001\n\017File"
-    "Information\022\014\n\004name\030\001 \001(\t\022\024\n\014resourceTyp"
-    "e\030\002 \001(\r\022\014\n\004size\030\003 \001(\004\022\022\n\ncreateTime\030\004 \001("
-    "\004\022\024\n\014modifiedTime\030\005 \001(\004\022\023\n\013isDirectory\030\006"
-    " \001(\010\"A\n\024DownloadInitResponse\022)\n\017fileInfo"
-    "rmation\030\001 \002(\0132\020.FileInformation\"$\n\024Downl"
-    "oadDataResponse\022\014\n\004data\030\001 \002(\014\"C\n\026TestCon"
-    "nectionResponse\022)\n\017fileInformation\030\001 \002(\013"
-    "2\020.FileInformation\">\n\021AddFolderResponse\022"
-    ")\n\017fileInformation\030\001 \002(\0132\020.FileInformati"
-    "on\"C\n\026DeleteResourceResponse\022)\n\017fileInfo"
-    "rmation\030\001 \002(\0132\020.FileInformation", 871);
+    "e\022%\n\rstatsResponse\030\007 \001(\0132\016.StatsResponse"
+    "\0227\n\026deleteProgressResponse\030\010 \001(\0132\027.Delet"
+    "eProgressResponse\022-\n\021batchStatResponse\030\t"
+    " \001(\0132\022.BatchStatResponse\022#\n\014copyResponse"
+    "\030\n \001(\0132\r.CopyResponse\0223\n\024copyProgressRes"
+    "ponse\030\013 \001(\0132\025.CopyProgressResponse\"D\n\027Fo"
+    "lderStructureResponse\022)\n\017fileInformation"
+    "\030\001 \003(\0132\020.FileInformation\"\202\001\n\017FileInforma"
+    "tion\022\014\n\004name\030\001 \001(\t\022\024\n\014resourceType\030\002 \001(\r"
+    "\022\014\n\004size\030\003 \001(\004\022\022\n\ncreateTime\030\004 \001(\004\022\024\n\014mo"
+    "difiedTime\030\005 \001(\004\022\023\n\013isDirectory\030\006 \001(\010\"A\n"
+    "\024DownloadInitResponse\022)\n\017fileInformation"
+    "\030\001 \002(\0132\020.FileInformation\"$\n\024DownloadData"
+    "Response\022\014\n\004data\030\001 \002(\014\"C\n\026TestConnection"
+    "Response\022)\n\017fileInformation\030\001 \002(\0132\020.File"
+    "Information\">\n\021AddFolderResponse\022)\n\017file"
+    "Information\030\001 \002(\0132\020.FileInformation\"C\n\026D"
+    "eleteResourceResponse\022)\n\017fileInformation"
+    "\030\001 \002(\0132\020.FileInformation\"\200\001\n\026DeleteProgr"
+    "essResponse\022\r\n\005files\030\001 \002(\004\022\017\n\007folders\030\002 "
+    "\002(\004\022\016\n\006failed\030\003 \002(\004\022\017\n\007summary\030\004 \001(\010\022%\n\010"
+    "failures\030\005 \003(\0132\023.DeleteFailureEntry\"0\n\022D"
+    "eleteFailureEntry\022\014\n\004name\030\001 \002(\t\022\014\n\004code\030"
+    "\002 \002(\005\"5\n\021BatchStatResponse\022 \n\007entries\030\001 "
+    "\003(\0132\017.BatchStatEntry\"X\n\016BatchStatEntry\022\r"
+    "\n\005index\030\001 \002(\r\022\014\n\004code\030\002 \002(\005\022)\n\017fileInfor"
+    "mation\030\003 \001(\0132\020.FileInformation\"M\n\014CopyRe"
+    "sponse\022)\n\017fileInformation\030\001 \002(\0132\020.FileIn"
+    "formation\022\022\n\nserverSide\030\002 \001(\010\"H\n\024CopyPro"
+    "gressResponse\022\r\n\005bytes\030\001 \002(\004\022\r\n\005total\030\002 "
+    "\002(\004\022\022\n\nserverSide\030\003 \001(\010\"\036\n\rStatsResponse"
+    "\022\r\n\005stats\030\001 \002(\t", 1615);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "response.proto", &protobuf_RegisterTypes);
   ResponsePacket::default_instance_ = new ResponsePacket();
@@ -272,6 +460,13 @@ void protobuf_AddDesc_response_2eproto() {
   TestConnectionResponse::default_instance_ = new TestConnectionResponse();
   AddFolderResponse::default_instance_ = new AddFolderResponse();
   DeleteResourceResponse::default_instance_ = new DeleteResourceResponse();
+  DeleteProgressResponse::default_instance_ = new DeleteProgressResponse();
+  DeleteFailureEntry::default_instance_ = new DeleteFailureEntry();
+  BatchStatResponse::default_instance_ = new BatchStatResponse();
+  BatchStatEntry::default_instance_ = new BatchStatEntry();
+  CopyResponse::default_instance_ = new CopyResponse();
+  CopyProgressResponse::default_instance_ = new CopyProgressResponse();
+  StatsResponse::default_instance_ = new StatsResponse();
   ResponsePacket::default_instance_->InitAsDefaultInstance();
   FolderStructureResponse::default_instance_->InitAsDefaultInstance();
   FileInformation::default_instance_->InitAsDefaultInstance();
@@ -280,6 +475,13 @@ void protobuf_AddDesc_response_2eproto() {
   TestConnectionResponse::default_instance_->InitAsDefaultInstance();
   AddFolderResponse::default_instance_->InitAsDefaultInstance();
   DeleteResourceResponse::default_instance_->InitAsDefaultInstance();
+  DeleteProgressResponse::default_instance_->InitAsDefaultInstance();
+  DeleteFailureEntry::default_instance_->InitAsDefaultInstance();
+  BatchStatResponse::default_instance_->InitAsDefaultInstance();
+  BatchStatEntry::default_instance_->InitAsDefaultInstance();
+  CopyResponse::default_instance_->InitAsDefaultInstance();
+  CopyProgressResponse::default_instance_->InitAsDefaultInstance();
+  StatsResponse::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_response_2eproto);
 }
 
@@ -299,6 +501,11 @@ const int ResponsePacket::kDownloadDataResponseFieldNumber;
 const int ResponsePacket::kTestConnectionResponseFieldNumber;
 const int ResponsePacket::kAddFolderResponseFieldNumber;
 const int ResponsePacket::kDeleteResourceResponseFieldNumber;
+const int ResponsePacket::kStatsResponseFieldNumber;
+const int ResponsePacket::kDeleteProgressResponseFieldNumber;
+const int ResponsePacket::kBatchStatResponseFieldNumber;
+const int ResponsePacket::kCopyResponseFieldNumber;
+const int ResponsePacket::kCopyProgressResponseFieldNumber;
 #endif  // !_MSC_VER
 
 ResponsePacket::ResponsePacket()
@@ -313,6 +520,11 @@ void ResponsePacket::InitAsDefaultInstance() {
   testconnectionresponse_ = const_cast< ::TestConnectionResponse*>(&::TestConnectionResponse::default_instance());
   addfolderresponse_ = const_cast< ::AddFolderResponse*>(&::AddFolderResponse::default_instance());
   deleteresourceresponse_ = const_cast< ::DeleteResourceResponse*>(&::DeleteResourceResponse::default_instance());
+  statsresponse_ = const_cast< ::StatsResponse*>(&::StatsResponse::default_instance());
+  deleteprogressresponse_ = const_cast< ::DeleteProgressResponse*>(&::DeleteProgressResponse::default_instance());
+  batchstatresponse_ = const_cast< ::BatchStatResponse*>(&::BatchStatResponse::default_instance());
+  copyresponse_ = const_cast< ::CopyResponse*>(&::CopyResponse::default_instance());
+  copyprogressresponse_ = const_cast< ::CopyProgressResponse*>(&::CopyProgressResponse::default_instance());
 }
 
 ResponsePacket::ResponsePacket(const ResponsePacket& from)
@@ -329,6 +541,11 @@ void ResponsePacket::SharedCtor() {
   testconnectionresponse_ = NULL;
   addfolderresponse_ = NULL;
   deleteresourceresponse_ = NULL;
+  statsresponse_ = NULL;
+  deleteprogressresponse_ = NULL;
+  batchstatresponse_ = NULL;
+  copyresponse_ = NULL;
+  copyprogressresponse_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -344,6 +561,11 @@ void ResponsePacket::SharedDtor() {
     delete testconnectionresponse_;
     delete addfolderresponse_;
     delete deleteresourceresponse_;
+    delete statsresponse_;
+    delete deleteprogressresponse_;
+    delete batchstatresponse_;
+    delete copyresponse_;
+    delete copyprogressresponse_;
   }
 }
 
@@ -388,6 +610,23 @@ void ResponsePacket::Clear() {
     if (has_deleteresourceresponse()) {
       if (deleteresourceresponse_ != NULL) deleteresourceresponse_->::DeleteResourceResponse::Clear();
     }
+    if (has_statsresponse()) {
+      if (statsresponse_ != NULL) statsresponse_->::StatsResponse::Clear();
+    }
+    if (has_deleteprogressresponse()) {
+      if (deleteprogressresponse_ != NULL) deleteprogressresponse_->::DeleteProgressResponse::Clear();
+    }
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (has_batchstatresponse()) {
+      if (batchstatresponse_ != NULL) batchstatresponse_->::BatchStatResponse::Clear();
+    }
+    if (has_copyresponse()) {
+      if (copyresponse_ != NULL) copyresponse_->::CopyResponse::Clear();
+    }
+    if (has_copyprogressresponse()) {
+      if (copyprogressresponse_ != NULL) copyprogressresponse_->::CopyProgressResponse::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -478,6 +717,76 @@ bool ResponsePacket::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(58)) goto parse_statsResponse;
+        break;
+      }
+
+      // optional .StatsResponse statsResponse = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_statsResponse:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_statsresponse()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(66)) goto parse_deleteProgressResponse;
+        break;
+      }
+
+      // optional .DeleteProgressResponse deleteProgressResponse = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_deleteProgressResponse:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_deleteprogressresponse()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(74)) goto parse_batchStatResponse;
+        break;
+      }
+
+      // optional .BatchStatResponse batchStatResponse = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_batchStatResponse:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_batchstatresponse()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(82)) goto parse_copyResponse;
+        break;
+      }
+
+      // optional .CopyResponse copyResponse = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_copyResponse:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_copyresponse()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(90)) goto parse_copyProgressResponse;
+        break;
+      }
+
+      // optional .CopyProgressResponse copyProgressResponse = 11;
+      case 11: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_copyProgressResponse:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_copyprogressresponse()));
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -536,6 +845,36 @@ void ResponsePacket::SerializeWithCachedSizes(
       6, this->deleteresourceresponse(), output);
   }
 
+  // optional .StatsResponse statsResponse = 7;
+  if (has_statsresponse()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->statsresponse(), output);
+  }
+
+  // optional .DeleteProgressResponse deleteProgressResponse = 8;
+  if (has_deleteprogressresponse()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->deleteprogressresponse(), output);
+  }
+
+  // optional .BatchStatResponse batchStatResponse = 9;
+  if (has_batchstatresponse()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      9, this->batchstatresponse(), output);
+  }
+
+  // optional .CopyResponse copyResponse = 10;
+  if (has_copyresponse()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, this->copyresponse(), output);
+  }
+
+  // optional .CopyProgressResponse copyProgressResponse = 11;
+  if (has_copyprogressresponse()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, this->copyprogressresponse(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -586,6 +925,41 @@ void ResponsePacket::SerializeWithCachedSizes(
         6, this->deleteresourceresponse(), target);
   }
 
+  // optional .StatsResponse statsResponse = 7;
+  if (has_statsresponse()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->statsresponse(), target);
+  }
+
+  // optional .DeleteProgressResponse deleteProgressResponse = 8;
+  if (has_deleteprogressresponse()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->deleteprogressresponse(), target);
+  }
+
+  // optional .BatchStatResponse batchStatResponse = 9;
+  if (has_batchstatresponse()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        9, this->batchstatresponse(), target);
+  }
+
+  // optional .CopyResponse copyResponse = 10;
+  if (has_copyresponse()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        10, this->copyresponse(), target);
+  }
+
+  // optional .CopyProgressResponse copyProgressResponse = 11;
+  if (has_copyprogressresponse()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        11, this->copyprogressresponse(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -639,6 +1013,43 @@ int ResponsePacket::ByteSize() const {
           this->deleteresourceresponse());
     }
 
+    // optional .StatsResponse statsResponse = 7;
+    if (has_statsresponse()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->statsresponse());
+    }
+
+    // optional .DeleteProgressResponse deleteProgressResponse = 8;
+    if (has_deleteprogressresponse()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->deleteprogressresponse());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional .BatchStatResponse batchStatResponse = 9;
+    if (has_batchstatresponse()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->batchstatresponse());
+    }
+
+    // optional .CopyResponse copyResponse = 10;
+    if (has_copyresponse()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->copyresponse());
+    }
+
+    // optional .CopyProgressResponse copyProgressResponse = 11;
+    if (has_copyprogressresponse()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->copyprogressresponse());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -684,6 +1095,23 @@ void ResponsePacket::MergeFrom(const ResponsePacket& from) {
     if (from.has_deleteresourceresponse()) {
       mutable_deleteresourceresponse()->::DeleteResourceResponse::MergeFrom(from.deleteresourceresponse());
     }
+    if (from.has_statsresponse()) {
+      mutable_statsresponse()->::StatsResponse::MergeFrom(from.statsresponse());
+    }
+    if (from.has_deleteprogressresponse()) {
+      mutable_deleteprogressresponse()->::DeleteProgressResponse::MergeFrom(from.deleteprogressresponse());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_batchstatresponse()) {
+      mutable_batchstatresponse()->::BatchStatResponse::MergeFrom(from.batchstatresponse());
+    }
+    if (from.has_copyresponse()) {
+      mutable_copyresponse()->::CopyResponse::MergeFrom(from.copyresponse());
+    }
+    if (from.has_copyprogressresponse()) {
+      mutable_copyprogressresponse()->::CopyProgressResponse::MergeFrom(from.copyprogressresponse());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -717,6 +1145,21 @@ bool ResponsePacket::IsInitialized() const {
   if (has_deleteresourceresponse()) {
     if (!this->deleteresourceresponse().IsInitialized()) return false;
   }
+  if (has_statsresponse()) {
+    if (!this->statsresponse().IsInitialized()) return false;
+  }
+  if (has_deleteprogressresponse()) {
+    if (!this->deleteprogressresponse().IsInitialized()) return false;
+  }
+  if (has_batchstatresponse()) {
+    if (!this->batchstatresponse().IsInitialized()) return false;
+  }
+  if (has_copyresponse()) {
+    if (!this->copyresponse().IsInitialized()) return false;
+  }
+  if (has_copyprogressresponse()) {
+    if (!this->copyprogressresponse().IsInitialized()) return false;
+  }
   return true;
 }
 
@@ -728,6 +1171,11 @@ void ResponsePacket::Swap(ResponsePacket* other) {
     std::swap(testconnectionresponse_, other->testconnectionresponse_);
     std::swap(addfolderresponse_, other->addfolderresponse_);
     std::swap(deleteresourceresponse_, other->deleteresourceresponse_);
+    std::swap(statsresponse_, other->statsresponse_);
+    std::swap(deleteprogressresponse_, other->deleteprogressresponse_);
+    std::swap(batchstatresponse_, other->batchstatresponse_);
+    std::swap(copyresponse_, other->copyresponse_);
+    std::swap(copyprogressresponse_, other->copyprogressresponse_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -2442,6 +2890,1907 @@ void DeleteResourceResponse::Swap(DeleteResourceResponse* other) {
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int DeleteProgressResponse::kFilesFieldNumber;
+const int DeleteProgressResponse::kFoldersFieldNumber;
+const int DeleteProgressResponse::kFailedFieldNumber;
+const int DeleteProgressResponse::kSummaryFieldNumber;
+const int DeleteProgressResponse::kFailuresFieldNumber;
+#endif  // !_MSC_VER
+
+DeleteProgressResponse::DeleteProgressResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void DeleteProgressResponse::InitAsDefaultInstance() {
+}
+
+DeleteProgressResponse::DeleteProgressResponse(const DeleteProgressResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void DeleteProgressResponse::SharedCtor() {
+  _cached_size_ = 0;
+  files_ = GOOGLE_ULONGLONG(0);
+  folders_ = GOOGLE_ULONGLONG(0);
+  failed_ = GOOGLE_ULONGLONG(0);
+  summary_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+DeleteProgressResponse::~DeleteProgressResponse() {
+  SharedDtor();
+}
+
+void DeleteProgressResponse::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void DeleteProgressResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DeleteProgressResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return DeleteProgressResponse_descriptor_;
+}
+
+const DeleteProgressResponse& DeleteProgressResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+DeleteProgressResponse* DeleteProgressResponse::default_instance_ = NULL;
+
+DeleteProgressResponse* DeleteProgressResponse::New() const {
+  return new DeleteProgressResponse;
+}
+
+void DeleteProgressResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    files_ = GOOGLE_ULONGLONG(0);
+    folders_ = GOOGLE_ULONGLONG(0);
+    failed_ = GOOGLE_ULONGLONG(0);
+    summary_ = false;
+  }
+  failures_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool DeleteProgressResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 files = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &files_)));
+          set_has_files();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_folders;
+        break;
+      }
+
+      // required uint64 folders = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_folders:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &folders_)));
+          set_has_folders();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_failed;
+        break;
+      }
+
+      // required uint64 failed = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_failed:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &failed_)));
+          set_has_failed();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_summary;
+        break;
+      }
+
+      // optional bool summary = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_summary:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &summary_)));
+          set_has_summary();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_failures;
+        break;
+      }
+
+      // repeated .DeleteFailureEntry failures = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_failures:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_failures()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_failures;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void DeleteProgressResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint64 files = 1;
+  if (has_files()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->files(), output);
+  }
+
+  // required uint64 folders = 2;
+  if (has_folders()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->folders(), output);
+  }
+
+  // required uint64 failed = 3;
+  if (has_failed()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->failed(), output);
+  }
+
+  // optional bool summary = 4;
+  if (has_summary()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->summary(), output);
+  }
+
+  // repeated .DeleteFailureEntry failures = 5;
+  for (int i = 0; i < this->failures_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->failures(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* DeleteProgressResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint64 files = 1;
+  if (has_files()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->files(), target);
+  }
+
+  // required uint64 folders = 2;
+  if (has_folders()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->folders(), target);
+  }
+
+  // required uint64 failed = 3;
+  if (has_failed()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->failed(), target);
+  }
+
+  // optional bool summary = 4;
+  if (has_summary()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->summary(), target);
+  }
+
+  // repeated .DeleteFailureEntry failures = 5;
+  for (int i = 0; i < this->failures_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->failures(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int DeleteProgressResponse::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 files = 1;
+    if (has_files()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->files());
+    }
+
+    // required uint64 folders = 2;
+    if (has_folders()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->folders());
+    }
+
+    // required uint64 failed = 3;
+    if (has_failed()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->failed());
+    }
+
+    // optional bool summary = 4;
+    if (has_summary()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  // repeated .DeleteFailureEntry failures = 5;
+  total_size += 1 * this->failures_size();
+  for (int i = 0; i < this->failures_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->failures(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DeleteProgressResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const DeleteProgressResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const DeleteProgressResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void DeleteProgressResponse::MergeFrom(const DeleteProgressResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  failures_.MergeFrom(from.failures_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_files()) {
+      set_files(from.files());
+    }
+    if (from.has_folders()) {
+      set_folders(from.folders());
+    }
+    if (from.has_failed()) {
+      set_failed(from.failed());
+    }
+    if (from.has_summary()) {
+      set_summary(from.summary());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void DeleteProgressResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DeleteProgressResponse::CopyFrom(const DeleteProgressResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteProgressResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+
+  for (int i = 0; i < failures_size(); i++) {
+    if (!this->failures(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void DeleteProgressResponse::Swap(DeleteProgressResponse* other) {
+  if (other != this) {
+    std::swap(files_, other->files_);
+    std::swap(folders_, other->folders_);
+    std::swap(failed_, other->failed_);
+    std::swap(summary_, other->summary_);
+    failures_.Swap(&other->failures_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata DeleteProgressResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = DeleteProgressResponse_descriptor_;
+  metadata.reflection = DeleteProgressResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int DeleteFailureEntry::kNameFieldNumber;
+const int DeleteFailureEntry::kCodeFieldNumber;
+#endif  // !_MSC_VER
+
+DeleteFailureEntry::DeleteFailureEntry()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void DeleteFailureEntry::InitAsDefaultInstance() {
+}
+
+DeleteFailureEntry::DeleteFailureEntry(const DeleteFailureEntry& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void DeleteFailureEntry::SharedCtor() {
+  _cached_size_ = 0;
+  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  code_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+DeleteFailureEntry::~DeleteFailureEntry() {
+  SharedDtor();
+}
+
+void DeleteFailureEntry::SharedDtor() {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    delete name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void DeleteFailureEntry::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DeleteFailureEntry::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return DeleteFailureEntry_descriptor_;
+}
+
+const DeleteFailureEntry& DeleteFailureEntry::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+DeleteFailureEntry* DeleteFailureEntry::default_instance_ = NULL;
+
+DeleteFailureEntry* DeleteFailureEntry::New() const {
+  return new DeleteFailureEntry;
+}
+
+void DeleteFailureEntry::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_name()) {
+      if (name_ != &::google::protobuf::internal::kEmptyString) {
+        name_->clear();
+      }
+    }
+    code_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool DeleteFailureEntry::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string name = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_code;
+        break;
+      }
+
+      // required int32 code = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_code:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &code_)));
+          set_has_code();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void DeleteFailureEntry::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string name = 1;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->name(), output);
+  }
+
+  // required int32 code = 2;
+  if (has_code()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->code(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* DeleteFailureEntry::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string name = 1;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // required int32 code = 2;
+  if (has_code()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->code(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int DeleteFailureEntry::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string name = 1;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+    // required int32 code = 2;
+    if (has_code()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->code());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DeleteFailureEntry::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const DeleteFailureEntry* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const DeleteFailureEntry*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void DeleteFailureEntry::MergeFrom(const DeleteFailureEntry& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_name()) {
+      set_name(from.name());
+    }
+    if (from.has_code()) {
+      set_code(from.code());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void DeleteFailureEntry::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DeleteFailureEntry::CopyFrom(const DeleteFailureEntry& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteFailureEntry::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void DeleteFailureEntry::Swap(DeleteFailureEntry* other) {
+  if (other != this) {
+    std::swap(name_, other->name_);
+    std::swap(code_, other->code_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata DeleteFailureEntry::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = DeleteFailureEntry_descriptor_;
+  metadata.reflection = DeleteFailureEntry_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int BatchStatResponse::kEntriesFieldNumber;
+#endif  // !_MSC_VER
+
+BatchStatResponse::BatchStatResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void BatchStatResponse::InitAsDefaultInstance() {
+}
+
+BatchStatResponse::BatchStatResponse(const BatchStatResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void BatchStatResponse::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+BatchStatResponse::~BatchStatResponse() {
+  SharedDtor();
+}
+
+void BatchStatResponse::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void BatchStatResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* BatchStatResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return BatchStatResponse_descriptor_;
+}
+
+const BatchStatResponse& BatchStatResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+BatchStatResponse* BatchStatResponse::default_instance_ = NULL;
+
+BatchStatResponse* BatchStatResponse::New() const {
+  return new BatchStatResponse;
+}
+
+void BatchStatResponse::Clear() {
+  entries_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool BatchStatResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .BatchStatEntry entries = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_entries:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_entries()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(10)) goto parse_entries;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void BatchStatResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated .BatchStatEntry entries = 1;
+  for (int i = 0; i < this->entries_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->entries(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* BatchStatResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated .BatchStatEntry entries = 1;
+  for (int i = 0; i < this->entries_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->entries(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int BatchStatResponse::ByteSize() const {
+  int total_size = 0;
+
+  // repeated .BatchStatEntry entries = 1;
+  total_size += 1 * this->entries_size();
+  for (int i = 0; i < this->entries_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->entries(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchStatResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const BatchStatResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BatchStatResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void BatchStatResponse::MergeFrom(const BatchStatResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  entries_.MergeFrom(from.entries_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void BatchStatResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchStatResponse::CopyFrom(const BatchStatResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchStatResponse::IsInitialized() const {
+
+  for (int i = 0; i < entries_size(); i++) {
+    if (!this->entries(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void BatchStatResponse::Swap(BatchStatResponse* other) {
+  if (other != this) {
+    entries_.Swap(&other->entries_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata BatchStatResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = BatchStatResponse_descriptor_;
+  metadata.reflection = BatchStatResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int BatchStatEntry::kIndexFieldNumber;
+const int BatchStatEntry::kCodeFieldNumber;
+const int BatchStatEntry::kFileInformationFieldNumber;
+#endif  // !_MSC_VER
+
+BatchStatEntry::BatchStatEntry()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void BatchStatEntry::InitAsDefaultInstance() {
+  fileinformation_ = const_cast< ::FileInformation*>(&::FileInformation::default_instance());
+}
+
+BatchStatEntry::BatchStatEntry(const BatchStatEntry& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void BatchStatEntry::SharedCtor() {
+  _cached_size_ = 0;
+  index_ = 0u;
+  code_ = 0;
+  fileinformation_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+BatchStatEntry::~BatchStatEntry() {
+  SharedDtor();
+}
+
+void BatchStatEntry::SharedDtor() {
+  if (this != default_instance_) {
+    delete fileinformation_;
+  }
+}
+
+void BatchStatEntry::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* BatchStatEntry::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return BatchStatEntry_descriptor_;
+}
+
+const BatchStatEntry& BatchStatEntry::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+BatchStatEntry* BatchStatEntry::default_instance_ = NULL;
+
+BatchStatEntry* BatchStatEntry::New() const {
+  return new BatchStatEntry;
+}
+
+void BatchStatEntry::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    index_ = 0u;
+    code_ = 0;
+    if (has_fileinformation()) {
+      if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool BatchStatEntry::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint32 index = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &index_)));
+          set_has_index();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_code;
+        break;
+      }
+
+      // required int32 code = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_code:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &code_)));
+          set_has_code();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_fileInformation;
+        break;
+      }
+
+      // optional .FileInformation fileInformation = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_fileInformation:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_fileinformation()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void BatchStatEntry::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint32 index = 1;
+  if (has_index()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->index(), output);
+  }
+
+  // required int32 code = 2;
+  if (has_code()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->code(), output);
+  }
+
+  // optional .FileInformation fileInformation = 3;
+  if (has_fileinformation()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->fileinformation(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* BatchStatEntry::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint32 index = 1;
+  if (has_index()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->index(), target);
+  }
+
+  // required int32 code = 2;
+  if (has_code()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->code(), target);
+  }
+
+  // optional .FileInformation fileInformation = 3;
+  if (has_fileinformation()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->fileinformation(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int BatchStatEntry::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint32 index = 1;
+    if (has_index()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->index());
+    }
+
+    // required int32 code = 2;
+    if (has_code()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->code());
+    }
+
+    // optional .FileInformation fileInformation = 3;
+    if (has_fileinformation()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->fileinformation());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchStatEntry::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const BatchStatEntry* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BatchStatEntry*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void BatchStatEntry::MergeFrom(const BatchStatEntry& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_index()) {
+      set_index(from.index());
+    }
+    if (from.has_code()) {
+      set_code(from.code());
+    }
+    if (from.has_fileinformation()) {
+      mutable_fileinformation()->::FileInformation::MergeFrom(from.fileinformation());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void BatchStatEntry::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchStatEntry::CopyFrom(const BatchStatEntry& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchStatEntry::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void BatchStatEntry::Swap(BatchStatEntry* other) {
+  if (other != this) {
+    std::swap(index_, other->index_);
+    std::swap(code_, other->code_);
+    std::swap(fileinformation_, other->fileinformation_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata BatchStatEntry::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = BatchStatEntry_descriptor_;
+  metadata.reflection = BatchStatEntry_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CopyResponse::kFileInformationFieldNumber;
+const int CopyResponse::kServerSideFieldNumber;
+#endif  // !_MSC_VER
+
+CopyResponse::CopyResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CopyResponse::InitAsDefaultInstance() {
+  fileinformation_ = const_cast< ::FileInformation*>(&::FileInformation::default_instance());
+}
+
+CopyResponse::CopyResponse(const CopyResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CopyResponse::SharedCtor() {
+  _cached_size_ = 0;
+  fileinformation_ = NULL;
+  serverside_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CopyResponse::~CopyResponse() {
+  SharedDtor();
+}
+
+void CopyResponse::SharedDtor() {
+  if (this != default_instance_) {
+    delete fileinformation_;
+  }
+}
+
+void CopyResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CopyResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CopyResponse_descriptor_;
+}
+
+const CopyResponse& CopyResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+CopyResponse* CopyResponse::default_instance_ = NULL;
+
+CopyResponse* CopyResponse::New() const {
+  return new CopyResponse;
+}
+
+void CopyResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_fileinformation()) {
+      if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
+    }
+    serverside_ = false;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CopyResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .FileInformation fileInformation = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_fileinformation()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_serverSide;
+        break;
+      }
+
+      // optional bool serverSide = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_serverSide:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &serverside_)));
+          set_has_serverside();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CopyResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required .FileInformation fileInformation = 1;
+  if (has_fileinformation()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->fileinformation(), output);
+  }
+
+  // optional bool serverSide = 2;
+  if (has_serverside()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->serverside(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CopyResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required .FileInformation fileInformation = 1;
+  if (has_fileinformation()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->fileinformation(), target);
+  }
+
+  // optional bool serverSide = 2;
+  if (has_serverside()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->serverside(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CopyResponse::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .FileInformation fileInformation = 1;
+    if (has_fileinformation()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->fileinformation());
+    }
+
+    // optional bool serverSide = 2;
+    if (has_serverside()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CopyResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CopyResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CopyResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CopyResponse::MergeFrom(const CopyResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_fileinformation()) {
+      mutable_fileinformation()->::FileInformation::MergeFrom(from.fileinformation());
+    }
+    if (from.has_serverside()) {
+      set_serverside(from.serverside());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CopyResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CopyResponse::CopyFrom(const CopyResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CopyResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  return true;
+}
+
+void CopyResponse::Swap(CopyResponse* other) {
+  if (other != this) {
+    std::swap(fileinformation_, other->fileinformation_);
+    std::swap(serverside_, other->serverside_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CopyResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CopyResponse_descriptor_;
+  metadata.reflection = CopyResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CopyProgressResponse::kBytesFieldNumber;
+const int CopyProgressResponse::kTotalFieldNumber;
+const int CopyProgressResponse::kServerSideFieldNumber;
+#endif  // !_MSC_VER
+
+CopyProgressResponse::CopyProgressResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CopyProgressResponse::InitAsDefaultInstance() {
+}
+
+CopyProgressResponse::CopyProgressResponse(const CopyProgressResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CopyProgressResponse::SharedCtor() {
+  _cached_size_ = 0;
+  bytes_ = GOOGLE_ULONGLONG(0);
+  total_ = GOOGLE_ULONGLONG(0);
+  serverside_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CopyProgressResponse::~CopyProgressResponse() {
+  SharedDtor();
+}
+
+void CopyProgressResponse::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void CopyProgressResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CopyProgressResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CopyProgressResponse_descriptor_;
+}
+
+const CopyProgressResponse& CopyProgressResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+CopyProgressResponse* CopyProgressResponse::default_instance_ = NULL;
+
+CopyProgressResponse* CopyProgressResponse::New() const {
+  return new CopyProgressResponse;
+}
+
+void CopyProgressResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    bytes_ = GOOGLE_ULONGLONG(0);
+    total_ = GOOGLE_ULONGLONG(0);
+    serverside_ = false;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CopyProgressResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 bytes = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &bytes_)));
+          set_has_bytes();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_total;
+        break;
+      }
+
+      // required uint64 total = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_total:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &total_)));
+          set_has_total();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_serverSide;
+        break;
+      }
+
+      // optional bool serverSide = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_serverSide:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &serverside_)));
+          set_has_serverside();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CopyProgressResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint64 bytes = 1;
+  if (has_bytes()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->bytes(), output);
+  }
+
+  // required uint64 total = 2;
+  if (has_total()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->total(), output);
+  }
+
+  // optional bool serverSide = 3;
+  if (has_serverside()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->serverside(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CopyProgressResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint64 bytes = 1;
+  if (has_bytes()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->bytes(), target);
+  }
+
+  // required uint64 total = 2;
+  if (has_total()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->total(), target);
+  }
+
+  // optional bool serverSide = 3;
+  if (has_serverside()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->serverside(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CopyProgressResponse::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 bytes = 1;
+    if (has_bytes()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->bytes());
+    }
+
+    // required uint64 total = 2;
+    if (has_total()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->total());
+    }
+
+    // optional bool serverSide = 3;
+    if (has_serverside()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CopyProgressResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CopyProgressResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CopyProgressResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CopyProgressResponse::MergeFrom(const CopyProgressResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_bytes()) {
+      set_bytes(from.bytes());
+    }
+    if (from.has_total()) {
+      set_total(from.total());
+    }
+    if (from.has_serverside()) {
+      set_serverside(from.serverside());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CopyProgressResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CopyProgressResponse::CopyFrom(const CopyProgressResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CopyProgressResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void CopyProgressResponse::Swap(CopyProgressResponse* other) {
+  if (other != this) {
+    std::swap(bytes_, other->bytes_);
+    std::swap(total_, other->total_);
+    std::swap(serverside_, other->serverside_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CopyProgressResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CopyProgressResponse_descriptor_;
+  metadata.reflection = CopyProgressResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int StatsResponse::kStatsFieldNumber;
+#endif  // !_MSC_VER
+
+StatsResponse::StatsResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StatsResponse::InitAsDefaultInstance() {
+}
+
+StatsResponse::StatsResponse(const StatsResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StatsResponse::SharedCtor() {
+  _cached_size_ = 0;
+  stats_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+StatsResponse::~StatsResponse() {
+  SharedDtor();
+}
+
+void StatsResponse::SharedDtor() {
+  if (stats_ != &::google::protobuf::internal::kEmptyString) {
+    delete stats_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void StatsResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* StatsResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return StatsResponse_descriptor_;
+}
+
+const StatsResponse& StatsResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_response_2eproto();
+  return *default_instance_;
+}
+
+StatsResponse* StatsResponse::default_instance_ = NULL;
+
+StatsResponse* StatsResponse::New() const {
+  return new StatsResponse;
+}
+
+void StatsResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_stats()) {
+      if (stats_ != &::google::protobuf::internal::kEmptyString) {
+        stats_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool StatsResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string stats = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_stats()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->stats().data(), this->stats().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void StatsResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string stats = 1;
+  if (has_stats()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->stats().data(), this->stats().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->stats(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* StatsResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string stats = 1;
+  if (has_stats()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->stats().data(), this->stats().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->stats(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int StatsResponse::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string stats = 1;
+    if (has_stats()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->stats());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void StatsResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const StatsResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StatsResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void StatsResponse::MergeFrom(const StatsResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_stats()) {
+      set_stats(from.stats());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void StatsResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StatsResponse::CopyFrom(const StatsResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  return true;
+}
+
+void StatsResponse::Swap(StatsResponse* other) {
+  if (other != this) {
+    std::swap(stats_, other->stats_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata StatsResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = StatsResponse_descriptor_;
+  metadata.reflection = StatsResponse_reflection_;
+  return metadata;
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 
 // @@protoc_insertion_point(global_scope)
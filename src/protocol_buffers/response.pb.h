@@ -39,6 +39,13 @@ class DownloadDataResponse;
 class TestConnectionResponse;
 class AddFolderResponse;
 class DeleteResourceResponse;
+class DeleteProgressResponse;
+class DeleteFailureEntry;
+class BatchStatResponse;
+class BatchStatEntry;
+class CopyResponse;
+class CopyProgressResponse;
+class StatsResponse;
 
 // ===================================================================
 
@@ -150,6 +157,51 @@ class ResponsePacket : public ::google::protobuf::Message {
   inline ::DeleteResourceResponse* release_deleteresourceresponse();
   inline void set_allocated_deleteresourceresponse(::DeleteResourceResponse* deleteresourceresponse);
 
+  // optional .StatsResponse statsResponse = 7;
+  inline bool has_statsresponse() const;
+  inline void clear_statsresponse();
+  static const int kStatsResponseFieldNumber = 7;
+  inline const ::StatsResponse& statsresponse() const;
+  inline ::StatsResponse* mutable_statsresponse();
+  inline ::StatsResponse* release_statsresponse();
+  inline void set_allocated_statsresponse(::StatsResponse* statsresponse);
+
+  // optional .DeleteProgressResponse deleteProgressResponse = 8;
+  inline bool has_deleteprogressresponse() const;
+  inline void clear_deleteprogressresponse();
+  static const int kDeleteProgressResponseFieldNumber = 8;
+  inline const ::DeleteProgressResponse& deleteprogressresponse() const;
+  inline ::DeleteProgressResponse* mutable_deleteprogressresponse();
+  inline ::DeleteProgressResponse* release_deleteprogressresponse();
+  inline void set_allocated_deleteprogressresponse(::DeleteProgressResponse* deleteprogressresponse);
+
+  // optional .BatchStatResponse batchStatResponse = 9;
+  inline bool has_batchstatresponse() const;
+  inline void clear_batchstatresponse();
+  static const int kBatchStatResponseFieldNumber = 9;
+  inline const ::BatchStatResponse& batchstatresponse() const;
+  inline ::BatchStatResponse* mutable_batchstatresponse();
+  inline ::BatchStatResponse* release_batchstatresponse();
+  inline void set_allocated_batchstatresponse(::BatchStatResponse* batchstatresponse);
+
+  // optional .CopyResponse copyResponse = 10;
+  inline bool has_copyresponse() const;
+  inline void clear_copyresponse();
+  static const int kCopyResponseFieldNumber = 10;
+  inline const ::CopyResponse& copyresponse() const;
+  inline ::CopyResponse* mutable_copyresponse();
+  inline ::CopyResponse* release_copyresponse();
+  inline void set_allocated_copyresponse(::CopyResponse* copyresponse);
+
+  // optional .CopyProgressResponse copyProgressResponse = 11;
+  inline bool has_copyprogressresponse() const;
+  inline void clear_copyprogressresponse();
+  static const int kCopyProgressResponseFieldNumber = 11;
+  inline const ::CopyProgressResponse& copyprogressresponse() const;
+  inline ::CopyProgressResponse* mutable_copyprogressresponse();
+  inline ::CopyProgressResponse* release_copyprogressresponse();
+  inline void set_allocated_copyprogressresponse(::CopyProgressResponse* copyprogressresponse);
+
   // @@protoc_insertion_point(class_scope:ResponsePacket)
  private:
   inline void set_has_folderstructureresponse();
@@ -164,6 +216,16 @@ class ResponsePacket : public ::google::protobuf::Message {
   inline void clear_has_addfolderresponse();
   inline void set_has_deleteresourceresponse();
   inline void clear_has_deleteresourceresponse();
+  inline void set_has_statsresponse();
+  inline void clear_has_statsresponse();
+  inline void set_has_deleteprogressresponse();
+  inline void clear_has_deleteprogressresponse();
+  inline void set_has_batchstatresponse();
+  inline void clear_has_batchstatresponse();
+  inline void set_has_copyresponse();
+  inline void clear_has_copyresponse();
+  inline void set_has_copyprogressresponse();
+  inline void clear_has_copyprogressresponse();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -173,9 +235,14 @@ class ResponsePacket : public ::google::protobuf::Message {
   ::TestConnectionResponse* testconnectionresponse_;
   ::AddFolderResponse* addfolderresponse_;
   ::DeleteResourceResponse* deleteresourceresponse_;
+  ::StatsResponse* statsresponse_;
+  ::DeleteProgressResponse* deleteprogressresponse_;
+  ::BatchStatResponse* batchstatresponse_;
+  ::CopyResponse* copyresponse_;
+  ::CopyProgressResponse* copyprogressresponse_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(11 + 31) / 32];
 
   friend void  protobuf_AddDesc_response_2eproto();
   friend void protobuf_AssignDesc_response_2eproto();
@@ -829,603 +896,1899 @@ class DeleteResourceResponse : public ::google::protobuf::Message {
   void InitAsDefaultInstance();
   static DeleteResourceResponse* default_instance_;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class DeleteProgressResponse : public ::google::protobuf::Message {
+ public:
+  DeleteProgressResponse();
+  virtual ~DeleteProgressResponse();
 
-// ResponsePacket
+  DeleteProgressResponse(const DeleteProgressResponse& from);
 
-// optional .FolderStructureResponse folderStructureResponse = 1;
-inline bool ResponsePacket::has_folderstructureresponse() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ResponsePacket::set_has_folderstructureresponse() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ResponsePacket::clear_has_folderstructureresponse() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ResponsePacket::clear_folderstructureresponse() {
-  if (folderstructureresponse_ != NULL) folderstructureresponse_->::FolderStructureResponse::Clear();
-  clear_has_folderstructureresponse();
-}
-inline const ::FolderStructureResponse& ResponsePacket::folderstructureresponse() const {
-  return folderstructureresponse_ != NULL ? *folderstructureresponse_ : *default_instance_->folderstructureresponse_;
-}
-inline ::FolderStructureResponse* ResponsePacket::mutable_folderstructureresponse() {
-  set_has_folderstructureresponse();
-  if (folderstructureresponse_ == NULL) folderstructureresponse_ = new ::FolderStructureResponse;
-  return folderstructureresponse_;
-}
-inline ::FolderStructureResponse* ResponsePacket::release_folderstructureresponse() {
-  clear_has_folderstructureresponse();
-  ::FolderStructureResponse* temp = folderstructureresponse_;
-  folderstructureresponse_ = NULL;
-  return temp;
-}
-inline void ResponsePacket::set_allocated_folderstructureresponse(::FolderStructureResponse* folderstructureresponse) {
-  delete folderstructureresponse_;
-  folderstructureresponse_ = folderstructureresponse;
-  if (folderstructureresponse) {
-    set_has_folderstructureresponse();
-  } else {
-    clear_has_folderstructureresponse();
+  inline DeleteProgressResponse& operator=(const DeleteProgressResponse& from) {
+    CopyFrom(from);
+    return *this;
   }
-}
 
-// optional .DownloadInitResponse downloadInitResponse = 2;
-inline bool ResponsePacket::has_downloadinitresponse() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ResponsePacket::set_has_downloadinitresponse() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ResponsePacket::clear_has_downloadinitresponse() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ResponsePacket::clear_downloadinitresponse() {
-  if (downloadinitresponse_ != NULL) downloadinitresponse_->::DownloadInitResponse::Clear();
-  clear_has_downloadinitresponse();
-}
-inline const ::DownloadInitResponse& ResponsePacket::downloadinitresponse() const {
-  return downloadinitresponse_ != NULL ? *downloadinitresponse_ : *default_instance_->downloadinitresponse_;
-}
-inline ::DownloadInitResponse* ResponsePacket::mutable_downloadinitresponse() {
-  set_has_downloadinitresponse();
-  if (downloadinitresponse_ == NULL) downloadinitresponse_ = new ::DownloadInitResponse;
-  return downloadinitresponse_;
-}
-inline ::DownloadInitResponse* ResponsePacket::release_downloadinitresponse() {
-  clear_has_downloadinitresponse();
-  ::DownloadInitResponse* temp = downloadinitresponse_;
-  downloadinitresponse_ = NULL;
-  return temp;
-}
-inline void ResponsePacket::set_allocated_downloadinitresponse(::DownloadInitResponse* downloadinitresponse) {
-  delete downloadinitresponse_;
-  downloadinitresponse_ = downloadinitresponse;
-  if (downloadinitresponse) {
-    set_has_downloadinitresponse();
-  } else {
-    clear_has_downloadinitresponse();
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
   }
-}
 
-// optional .DownloadDataResponse downloadDataResponse = 3;
-inline bool ResponsePacket::has_downloaddataresponse() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ResponsePacket::set_has_downloaddataresponse() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ResponsePacket::clear_has_downloaddataresponse() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ResponsePacket::clear_downloaddataresponse() {
-  if (downloaddataresponse_ != NULL) downloaddataresponse_->::DownloadDataResponse::Clear();
-  clear_has_downloaddataresponse();
-}
-inline const ::DownloadDataResponse& ResponsePacket::downloaddataresponse() const {
-  return downloaddataresponse_ != NULL ? *downloaddataresponse_ : *default_instance_->downloaddataresponse_;
-}
-inline ::DownloadDataResponse* ResponsePacket::mutable_downloaddataresponse() {
-  set_has_downloaddataresponse();
-  if (downloaddataresponse_ == NULL) downloaddataresponse_ = new ::DownloadDataResponse;
-  return downloaddataresponse_;
-}
-inline ::DownloadDataResponse* ResponsePacket::release_downloaddataresponse() {
-  clear_has_downloaddataresponse();
-  ::DownloadDataResponse* temp = downloaddataresponse_;
-  downloaddataresponse_ = NULL;
-  return temp;
-}
-inline void ResponsePacket::set_allocated_downloaddataresponse(::DownloadDataResponse* downloaddataresponse) {
-  delete downloaddataresponse_;
-  downloaddataresponse_ = downloaddataresponse;
-  if (downloaddataresponse) {
-    set_has_downloaddataresponse();
-  } else {
-    clear_has_downloaddataresponse();
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
   }
-}
 
-// optional .TestConnectionResponse testConnectionResponse = 4;
-inline bool ResponsePacket::has_testconnectionresponse() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void ResponsePacket::set_has_testconnectionresponse() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void ResponsePacket::clear_has_testconnectionresponse() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void ResponsePacket::clear_testconnectionresponse() {
-  if (testconnectionresponse_ != NULL) testconnectionresponse_->::TestConnectionResponse::Clear();
-  clear_has_testconnectionresponse();
-}
-inline const ::TestConnectionResponse& ResponsePacket::testconnectionresponse() const {
-  return testconnectionresponse_ != NULL ? *testconnectionresponse_ : *default_instance_->testconnectionresponse_;
-}
-inline ::TestConnectionResponse* ResponsePacket::mutable_testconnectionresponse() {
-  set_has_testconnectionresponse();
-  if (testconnectionresponse_ == NULL) testconnectionresponse_ = new ::TestConnectionResponse;
-  return testconnectionresponse_;
-}
-inline ::TestConnectionResponse* ResponsePacket::release_testconnectionresponse() {
-  clear_has_testconnectionresponse();
-  ::TestConnectionResponse* temp = testconnectionresponse_;
-  testconnectionresponse_ = NULL;
-  return temp;
-}
-inline void ResponsePacket::set_allocated_testconnectionresponse(::TestConnectionResponse* testconnectionresponse) {
-  delete testconnectionresponse_;
-  testconnectionresponse_ = testconnectionresponse;
-  if (testconnectionresponse) {
-    set_has_testconnectionresponse();
-  } else {
-    clear_has_testconnectionresponse();
-  }
-}
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DeleteProgressResponse& default_instance();
 
-// optional .AddFolderResponse addFolderResponse = 5;
-inline bool ResponsePacket::has_addfolderresponse() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void ResponsePacket::set_has_addfolderresponse() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void ResponsePacket::clear_has_addfolderresponse() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void ResponsePacket::clear_addfolderresponse() {
-  if (addfolderresponse_ != NULL) addfolderresponse_->::AddFolderResponse::Clear();
-  clear_has_addfolderresponse();
-}
-inline const ::AddFolderResponse& ResponsePacket::addfolderresponse() const {
-  return addfolderresponse_ != NULL ? *addfolderresponse_ : *default_instance_->addfolderresponse_;
-}
-inline ::AddFolderResponse* ResponsePacket::mutable_addfolderresponse() {
-  set_has_addfolderresponse();
-  if (addfolderresponse_ == NULL) addfolderresponse_ = new ::AddFolderResponse;
-  return addfolderresponse_;
-}
-inline ::AddFolderResponse* ResponsePacket::release_addfolderresponse() {
-  clear_has_addfolderresponse();
-  ::AddFolderResponse* temp = addfolderresponse_;
-  addfolderresponse_ = NULL;
-  return temp;
-}
-inline void ResponsePacket::set_allocated_addfolderresponse(::AddFolderResponse* addfolderresponse) {
-  delete addfolderresponse_;
-  addfolderresponse_ = addfolderresponse;
-  if (addfolderresponse) {
-    set_has_addfolderresponse();
-  } else {
-    clear_has_addfolderresponse();
-  }
-}
+  void Swap(DeleteProgressResponse* other);
 
-// optional .DeleteResourceResponse deleteResourceResponse = 6;
-inline bool ResponsePacket::has_deleteresourceresponse() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void ResponsePacket::set_has_deleteresourceresponse() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void ResponsePacket::clear_has_deleteresourceresponse() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void ResponsePacket::clear_deleteresourceresponse() {
-  if (deleteresourceresponse_ != NULL) deleteresourceresponse_->::DeleteResourceResponse::Clear();
-  clear_has_deleteresourceresponse();
-}
-inline const ::DeleteResourceResponse& ResponsePacket::deleteresourceresponse() const {
-  return deleteresourceresponse_ != NULL ? *deleteresourceresponse_ : *default_instance_->deleteresourceresponse_;
-}
-inline ::DeleteResourceResponse* ResponsePacket::mutable_deleteresourceresponse() {
-  set_has_deleteresourceresponse();
-  if (deleteresourceresponse_ == NULL) deleteresourceresponse_ = new ::DeleteResourceResponse;
-  return deleteresourceresponse_;
-}
-inline ::DeleteResourceResponse* ResponsePacket::release_deleteresourceresponse() {
-  clear_has_deleteresourceresponse();
-  ::DeleteResourceResponse* temp = deleteresourceresponse_;
-  deleteresourceresponse_ = NULL;
-  return temp;
-}
-inline void ResponsePacket::set_allocated_deleteresourceresponse(::DeleteResourceResponse* deleteresourceresponse) {
-  delete deleteresourceresponse_;
-  deleteresourceresponse_ = deleteresourceresponse;
-  if (deleteresourceresponse) {
-    set_has_deleteresourceresponse();
-  } else {
-    clear_has_deleteresourceresponse();
-  }
-}
+  // implements Message ----------------------------------------------
 
-// -------------------------------------------------------------------
+  DeleteProgressResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const DeleteProgressResponse& from);
+  void MergeFrom(const DeleteProgressResponse& from);
+  void Clear();
+  bool IsInitialized() const;
 
-// FolderStructureResponse
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
 
-// repeated .FileInformation fileInformation = 1;
-inline int FolderStructureResponse::fileinformation_size() const {
-  return fileinformation_.size();
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint64 files = 1;
+  inline bool has_files() const;
+  inline void clear_files();
+  static const int kFilesFieldNumber = 1;
+  inline ::google::protobuf::uint64 files() const;
+  inline void set_files(::google::protobuf::uint64 value);
+
+  // required uint64 folders = 2;
+  inline bool has_folders() const;
+  inline void clear_folders();
+  static const int kFoldersFieldNumber = 2;
+  inline ::google::protobuf::uint64 folders() const;
+  inline void set_folders(::google::protobuf::uint64 value);
+
+  // required uint64 failed = 3;
+  inline bool has_failed() const;
+  inline void clear_failed();
+  static const int kFailedFieldNumber = 3;
+  inline ::google::protobuf::uint64 failed() const;
+  inline void set_failed(::google::protobuf::uint64 value);
+
+  // optional bool summary = 4;
+  inline bool has_summary() const;
+  inline void clear_summary();
+  static const int kSummaryFieldNumber = 4;
+  inline bool summary() const;
+  inline void set_summary(bool value);
+
+  // repeated .DeleteFailureEntry failures = 5;
+  inline int failures_size() const;
+  inline void clear_failures();
+  static const int kFailuresFieldNumber = 5;
+  inline const ::DeleteFailureEntry& failures(int index) const;
+  inline ::DeleteFailureEntry* mutable_failures(int index);
+  inline ::DeleteFailureEntry* add_failures();
+  inline const ::google::protobuf::RepeatedPtrField< ::DeleteFailureEntry >&
+      failures() const;
+  inline ::google::protobuf::RepeatedPtrField< ::DeleteFailureEntry >*
+      mutable_failures();
+
+  // @@protoc_insertion_point(class_scope:DeleteProgressResponse)
+ private:
+  inline void set_has_files();
+  inline void clear_has_files();
+  inline void set_has_folders();
+  inline void clear_has_folders();
+  inline void set_has_failed();
+  inline void clear_has_failed();
+  inline void set_has_summary();
+  inline void clear_has_summary();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint64 files_;
+  ::google::protobuf::uint64 folders_;
+  ::google::protobuf::uint64 failed_;
+  ::google::protobuf::RepeatedPtrField< ::DeleteFailureEntry > failures_;
+  bool summary_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static DeleteProgressResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class DeleteFailureEntry : public ::google::protobuf::Message {
+ public:
+  DeleteFailureEntry();
+  virtual ~DeleteFailureEntry();
+
+  DeleteFailureEntry(const DeleteFailureEntry& from);
+
+  inline DeleteFailureEntry& operator=(const DeleteFailureEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DeleteFailureEntry& default_instance();
+
+  void Swap(DeleteFailureEntry* other);
+
+  // implements Message ----------------------------------------------
+
+  DeleteFailureEntry* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const DeleteFailureEntry& from);
+  void MergeFrom(const DeleteFailureEntry& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string name = 1;
+  inline bool has_name() const;
+  inline void clear_name();
+  static const int kNameFieldNumber = 1;
+  inline const ::std::string& name() const;
+  inline void set_name(const ::std::string& value);
+  inline void set_name(const char* value);
+  inline void set_name(const char* value, size_t size);
+  inline ::std::string* mutable_name();
+  inline ::std::string* release_name();
+  inline void set_allocated_name(::std::string* name);
+
+  // required int32 code = 2;
+  inline bool has_code() const;
+  inline void clear_code();
+  static const int kCodeFieldNumber = 2;
+  inline ::google::protobuf::int32 code() const;
+  inline void set_code(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:DeleteFailureEntry)
+ private:
+  inline void set_has_name();
+  inline void clear_has_name();
+  inline void set_has_code();
+  inline void clear_has_code();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* name_;
+  ::google::protobuf::int32 code_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static DeleteFailureEntry* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class BatchStatResponse : public ::google::protobuf::Message {
+ public:
+  BatchStatResponse();
+  virtual ~BatchStatResponse();
+
+  BatchStatResponse(const BatchStatResponse& from);
+
+  inline BatchStatResponse& operator=(const BatchStatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BatchStatResponse& default_instance();
+
+  void Swap(BatchStatResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  BatchStatResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const BatchStatResponse& from);
+  void MergeFrom(const BatchStatResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .BatchStatEntry entries = 1;
+  inline int entries_size() const;
+  inline void clear_entries();
+  static const int kEntriesFieldNumber = 1;
+  inline const ::BatchStatEntry& entries(int index) const;
+  inline ::BatchStatEntry* mutable_entries(int index);
+  inline ::BatchStatEntry* add_entries();
+  inline const ::google::protobuf::RepeatedPtrField< ::BatchStatEntry >&
+      entries() const;
+  inline ::google::protobuf::RepeatedPtrField< ::BatchStatEntry >*
+      mutable_entries();
+
+  // @@protoc_insertion_point(class_scope:BatchStatResponse)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::RepeatedPtrField< ::BatchStatEntry > entries_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static BatchStatResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class BatchStatEntry : public ::google::protobuf::Message {
+ public:
+  BatchStatEntry();
+  virtual ~BatchStatEntry();
+
+  BatchStatEntry(const BatchStatEntry& from);
+
+  inline BatchStatEntry& operator=(const BatchStatEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BatchStatEntry& default_instance();
+
+  void Swap(BatchStatEntry* other);
+
+  // implements Message ----------------------------------------------
+
+  BatchStatEntry* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const BatchStatEntry& from);
+  void MergeFrom(const BatchStatEntry& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 index = 1;
+  inline bool has_index() const;
+  inline void clear_index();
+  static const int kIndexFieldNumber = 1;
+  inline ::google::protobuf::uint32 index() const;
+  inline void set_index(::google::protobuf::uint32 value);
+
+  // required int32 code = 2;
+  inline bool has_code() const;
+  inline void clear_code();
+  static const int kCodeFieldNumber = 2;
+  inline ::google::protobuf::int32 code() const;
+  inline void set_code(::google::protobuf::int32 value);
+
+  // optional .FileInformation fileInformation = 3;
+  inline bool has_fileinformation() const;
+  inline void clear_fileinformation();
+  static const int kFileInformationFieldNumber = 3;
+  inline const ::FileInformation& fileinformation() const;
+  inline ::FileInformation* mutable_fileinformation();
+  inline ::FileInformation* release_fileinformation();
+  inline void set_allocated_fileinformation(::FileInformation* fileinformation);
+
+  // @@protoc_insertion_point(class_scope:BatchStatEntry)
+ private:
+  inline void set_has_index();
+  inline void clear_has_index();
+  inline void set_has_code();
+  inline void clear_has_code();
+  inline void set_has_fileinformation();
+  inline void clear_has_fileinformation();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 index_;
+  ::google::protobuf::int32 code_;
+  ::FileInformation* fileinformation_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static BatchStatEntry* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CopyResponse : public ::google::protobuf::Message {
+ public:
+  CopyResponse();
+  virtual ~CopyResponse();
+
+  CopyResponse(const CopyResponse& from);
+
+  inline CopyResponse& operator=(const CopyResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CopyResponse& default_instance();
+
+  void Swap(CopyResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  CopyResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CopyResponse& from);
+  void MergeFrom(const CopyResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required .FileInformation fileInformation = 1;
+  inline bool has_fileinformation() const;
+  inline void clear_fileinformation();
+  static const int kFileInformationFieldNumber = 1;
+  inline const ::FileInformation& fileinformation() const;
+  inline ::FileInformation* mutable_fileinformation();
+  inline ::FileInformation* release_fileinformation();
+  inline void set_allocated_fileinformation(::FileInformation* fileinformation);
+
+  // optional bool serverSide = 2;
+  inline bool has_serverside() const;
+  inline void clear_serverside();
+  static const int kServerSideFieldNumber = 2;
+  inline bool serverside() const;
+  inline void set_serverside(bool value);
+
+  // @@protoc_insertion_point(class_scope:CopyResponse)
+ private:
+  inline void set_has_fileinformation();
+  inline void clear_has_fileinformation();
+  inline void set_has_serverside();
+  inline void clear_has_serverside();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::FileInformation* fileinformation_;
+  bool serverside_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static CopyResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CopyProgressResponse : public ::google::protobuf::Message {
+ public:
+  CopyProgressResponse();
+  virtual ~CopyProgressResponse();
+
+  CopyProgressResponse(const CopyProgressResponse& from);
+
+  inline CopyProgressResponse& operator=(const CopyProgressResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CopyProgressResponse& default_instance();
+
+  void Swap(CopyProgressResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  CopyProgressResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CopyProgressResponse& from);
+  void MergeFrom(const CopyProgressResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint64 bytes = 1;
+  inline bool has_bytes() const;
+  inline void clear_bytes();
+  static const int kBytesFieldNumber = 1;
+  inline ::google::protobuf::uint64 bytes() const;
+  inline void set_bytes(::google::protobuf::uint64 value);
+
+  // required uint64 total = 2;
+  inline bool has_total() const;
+  inline void clear_total();
+  static const int kTotalFieldNumber = 2;
+  inline ::google::protobuf::uint64 total() const;
+  inline void set_total(::google::protobuf::uint64 value);
+
+  // optional bool serverSide = 3;
+  inline bool has_serverside() const;
+  inline void clear_serverside();
+  static const int kServerSideFieldNumber = 3;
+  inline bool serverside() const;
+  inline void set_serverside(bool value);
+
+  // @@protoc_insertion_point(class_scope:CopyProgressResponse)
+ private:
+  inline void set_has_bytes();
+  inline void clear_has_bytes();
+  inline void set_has_total();
+  inline void clear_has_total();
+  inline void set_has_serverside();
+  inline void clear_has_serverside();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint64 bytes_;
+  ::google::protobuf::uint64 total_;
+  bool serverside_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static CopyProgressResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class StatsResponse : public ::google::protobuf::Message {
+ public:
+  StatsResponse();
+  virtual ~StatsResponse();
+
+  StatsResponse(const StatsResponse& from);
+
+  inline StatsResponse& operator=(const StatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const StatsResponse& default_instance();
+
+  void Swap(StatsResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  StatsResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const StatsResponse& from);
+  void MergeFrom(const StatsResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string stats = 1;
+  inline bool has_stats() const;
+  inline void clear_stats();
+  static const int kStatsFieldNumber = 1;
+  inline const ::std::string& stats() const;
+  inline void set_stats(const ::std::string& value);
+  inline void set_stats(const char* value);
+  inline void set_stats(const char* value, size_t size);
+  inline ::std::string* mutable_stats();
+  inline ::std::string* release_stats();
+  inline void set_allocated_stats(::std::string* stats);
+
+  // @@protoc_insertion_point(class_scope:StatsResponse)
+ private:
+  inline void set_has_stats();
+  inline void clear_has_stats();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* stats_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_response_2eproto();
+  friend void protobuf_AssignDesc_response_2eproto();
+  friend void protobuf_ShutdownFile_response_2eproto();
+
+  void InitAsDefaultInstance();
+  static StatsResponse* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// ResponsePacket
+
+// optional .FolderStructureResponse folderStructureResponse = 1;
+inline bool ResponsePacket::has_folderstructureresponse() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ResponsePacket::set_has_folderstructureresponse() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ResponsePacket::clear_has_folderstructureresponse() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void ResponsePacket::clear_folderstructureresponse() {
+  if (folderstructureresponse_ != NULL) folderstructureresponse_->::FolderStructureResponse::Clear();
+  clear_has_folderstructureresponse();
+}
+inline const ::FolderStructureResponse& ResponsePacket::folderstructureresponse() const {
+  return folderstructureresponse_ != NULL ? *folderstructureresponse_ : *default_instance_->folderstructureresponse_;
+}
+inline ::FolderStructureResponse* ResponsePacket::mutable_folderstructureresponse() {
+  set_has_folderstructureresponse();
+  if (folderstructureresponse_ == NULL) folderstructureresponse_ = new ::FolderStructureResponse;
+  return folderstructureresponse_;
+}
+inline ::FolderStructureResponse* ResponsePacket::release_folderstructureresponse() {
+  clear_has_folderstructureresponse();
+  ::FolderStructureResponse* temp = folderstructureresponse_;
+  folderstructureresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_folderstructureresponse(::FolderStructureResponse* folderstructureresponse) {
+  delete folderstructureresponse_;
+  folderstructureresponse_ = folderstructureresponse;
+  if (folderstructureresponse) {
+    set_has_folderstructureresponse();
+  } else {
+    clear_has_folderstructureresponse();
+  }
+}
+
+// optional .DownloadInitResponse downloadInitResponse = 2;
+inline bool ResponsePacket::has_downloadinitresponse() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ResponsePacket::set_has_downloadinitresponse() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ResponsePacket::clear_has_downloadinitresponse() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ResponsePacket::clear_downloadinitresponse() {
+  if (downloadinitresponse_ != NULL) downloadinitresponse_->::DownloadInitResponse::Clear();
+  clear_has_downloadinitresponse();
+}
+inline const ::DownloadInitResponse& ResponsePacket::downloadinitresponse() const {
+  return downloadinitresponse_ != NULL ? *downloadinitresponse_ : *default_instance_->downloadinitresponse_;
+}
+inline ::DownloadInitResponse* ResponsePacket::mutable_downloadinitresponse() {
+  set_has_downloadinitresponse();
+  if (downloadinitresponse_ == NULL) downloadinitresponse_ = new ::DownloadInitResponse;
+  return downloadinitresponse_;
+}
+inline ::DownloadInitResponse* ResponsePacket::release_downloadinitresponse() {
+  clear_has_downloadinitresponse();
+  ::DownloadInitResponse* temp = downloadinitresponse_;
+  downloadinitresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_downloadinitresponse(::DownloadInitResponse* downloadinitresponse) {
+  delete downloadinitresponse_;
+  downloadinitresponse_ = downloadinitresponse;
+  if (downloadinitresponse) {
+    set_has_downloadinitresponse();
+  } else {
+    clear_has_downloadinitresponse();
+  }
+}
+
+// optional .DownloadDataResponse downloadDataResponse = 3;
+inline bool ResponsePacket::has_downloaddataresponse() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ResponsePacket::set_has_downloaddataresponse() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ResponsePacket::clear_has_downloaddataresponse() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ResponsePacket::clear_downloaddataresponse() {
+  if (downloaddataresponse_ != NULL) downloaddataresponse_->::DownloadDataResponse::Clear();
+  clear_has_downloaddataresponse();
+}
+inline const ::DownloadDataResponse& ResponsePacket::downloaddataresponse() const {
+  return downloaddataresponse_ != NULL ? *downloaddataresponse_ : *default_instance_->downloaddataresponse_;
+}
+inline ::DownloadDataResponse* ResponsePacket::mutable_downloaddataresponse() {
+  set_has_downloaddataresponse();
+  if (downloaddataresponse_ == NULL) downloaddataresponse_ = new ::DownloadDataResponse;
+  return downloaddataresponse_;
+}
+inline ::DownloadDataResponse* ResponsePacket::release_downloaddataresponse() {
+  clear_has_downloaddataresponse();
+  ::DownloadDataResponse* temp = downloaddataresponse_;
+  downloaddataresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_downloaddataresponse(::DownloadDataResponse* downloaddataresponse) {
+  delete downloaddataresponse_;
+  downloaddataresponse_ = downloaddataresponse;
+  if (downloaddataresponse) {
+    set_has_downloaddataresponse();
+  } else {
+    clear_has_downloaddataresponse();
+  }
+}
+
+// optional .TestConnectionResponse testConnectionResponse = 4;
+inline bool ResponsePacket::has_testconnectionresponse() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void ResponsePacket::set_has_testconnectionresponse() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void ResponsePacket::clear_has_testconnectionresponse() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void ResponsePacket::clear_testconnectionresponse() {
+  if (testconnectionresponse_ != NULL) testconnectionresponse_->::TestConnectionResponse::Clear();
+  clear_has_testconnectionresponse();
+}
+inline const ::TestConnectionResponse& ResponsePacket::testconnectionresponse() const {
+  return testconnectionresponse_ != NULL ? *testconnectionresponse_ : *default_instance_->testconnectionresponse_;
+}
+inline ::TestConnectionResponse* ResponsePacket::mutable_testconnectionresponse() {
+  set_has_testconnectionresponse();
+  if (testconnectionresponse_ == NULL) testconnectionresponse_ = new ::TestConnectionResponse;
+  return testconnectionresponse_;
+}
+inline ::TestConnectionResponse* ResponsePacket::release_testconnectionresponse() {
+  clear_has_testconnectionresponse();
+  ::TestConnectionResponse* temp = testconnectionresponse_;
+  testconnectionresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_testconnectionresponse(::TestConnectionResponse* testconnectionresponse) {
+  delete testconnectionresponse_;
+  testconnectionresponse_ = testconnectionresponse;
+  if (testconnectionresponse) {
+    set_has_testconnectionresponse();
+  } else {
+    clear_has_testconnectionresponse();
+  }
+}
+
+// optional .AddFolderResponse addFolderResponse = 5;
+inline bool ResponsePacket::has_addfolderresponse() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void ResponsePacket::set_has_addfolderresponse() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void ResponsePacket::clear_has_addfolderresponse() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void ResponsePacket::clear_addfolderresponse() {
+  if (addfolderresponse_ != NULL) addfolderresponse_->::AddFolderResponse::Clear();
+  clear_has_addfolderresponse();
+}
+inline const ::AddFolderResponse& ResponsePacket::addfolderresponse() const {
+  return addfolderresponse_ != NULL ? *addfolderresponse_ : *default_instance_->addfolderresponse_;
+}
+inline ::AddFolderResponse* ResponsePacket::mutable_addfolderresponse() {
+  set_has_addfolderresponse();
+  if (addfolderresponse_ == NULL) addfolderresponse_ = new ::AddFolderResponse;
+  return addfolderresponse_;
+}
+inline ::AddFolderResponse* ResponsePacket::release_addfolderresponse() {
+  clear_has_addfolderresponse();
+  ::AddFolderResponse* temp = addfolderresponse_;
+  addfolderresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_addfolderresponse(::AddFolderResponse* addfolderresponse) {
+  delete addfolderresponse_;
+  addfolderresponse_ = addfolderresponse;
+  if (addfolderresponse) {
+    set_has_addfolderresponse();
+  } else {
+    clear_has_addfolderresponse();
+  }
+}
+
+// optional .DeleteResourceResponse deleteResourceResponse = 6;
+inline bool ResponsePacket::has_deleteresourceresponse() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void ResponsePacket::set_has_deleteresourceresponse() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void ResponsePacket::clear_has_deleteresourceresponse() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void ResponsePacket::clear_deleteresourceresponse() {
+  if (deleteresourceresponse_ != NULL) deleteresourceresponse_->::DeleteResourceResponse::Clear();
+  clear_has_deleteresourceresponse();
+}
+inline const ::DeleteResourceResponse& ResponsePacket::deleteresourceresponse() const {
+  return deleteresourceresponse_ != NULL ? *deleteresourceresponse_ : *default_instance_->deleteresourceresponse_;
+}
+inline ::DeleteResourceResponse* ResponsePacket::mutable_deleteresourceresponse() {
+  set_has_deleteresourceresponse();
+  if (deleteresourceresponse_ == NULL) deleteresourceresponse_ = new ::DeleteResourceResponse;
+  return deleteresourceresponse_;
+}
+inline ::DeleteResourceResponse* ResponsePacket::release_deleteresourceresponse() {
+  clear_has_deleteresourceresponse();
+  ::DeleteResourceResponse* temp = deleteresourceresponse_;
+  deleteresourceresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_deleteresourceresponse(::DeleteResourceResponse* deleteresourceresponse) {
+  delete deleteresourceresponse_;
+  deleteresourceresponse_ = deleteresourceresponse;
+  if (deleteresourceresponse) {
+    set_has_deleteresourceresponse();
+  } else {
+    clear_has_deleteresourceresponse();
+  }
+}
+
+// optional .StatsResponse statsResponse = 7;
+inline bool ResponsePacket::has_statsresponse() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void ResponsePacket::set_has_statsresponse() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void ResponsePacket::clear_has_statsresponse() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void ResponsePacket::clear_statsresponse() {
+  if (statsresponse_ != NULL) statsresponse_->::StatsResponse::Clear();
+  clear_has_statsresponse();
+}
+inline const ::StatsResponse& ResponsePacket::statsresponse() const {
+  return statsresponse_ != NULL ? *statsresponse_ : *default_instance_->statsresponse_;
+}
+inline ::StatsResponse* ResponsePacket::mutable_statsresponse() {
+  set_has_statsresponse();
+  if (statsresponse_ == NULL) statsresponse_ = new ::StatsResponse;
+  return statsresponse_;
+}
+inline ::StatsResponse* ResponsePacket::release_statsresponse() {
+  clear_has_statsresponse();
+  ::StatsResponse* temp = statsresponse_;
+  statsresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_statsresponse(::StatsResponse* statsresponse) {
+  delete statsresponse_;
+  statsresponse_ = statsresponse;
+  if (statsresponse) {
+    set_has_statsresponse();
+  } else {
+    clear_has_statsresponse();
+  }
+}
+
+// optional .DeleteProgressResponse deleteProgressResponse = 8;
+inline bool ResponsePacket::has_deleteprogressresponse() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void ResponsePacket::set_has_deleteprogressresponse() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void ResponsePacket::clear_has_deleteprogressresponse() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void ResponsePacket::clear_deleteprogressresponse() {
+  if (deleteprogressresponse_ != NULL) deleteprogressresponse_->::DeleteProgressResponse::Clear();
+  clear_has_deleteprogressresponse();
+}
+inline const ::DeleteProgressResponse& ResponsePacket::deleteprogressresponse() const {
+  return deleteprogressresponse_ != NULL ? *deleteprogressresponse_ : *default_instance_->deleteprogressresponse_;
+}
+inline ::DeleteProgressResponse* ResponsePacket::mutable_deleteprogressresponse() {
+  set_has_deleteprogressresponse();
+  if (deleteprogressresponse_ == NULL) deleteprogressresponse_ = new ::DeleteProgressResponse;
+  return deleteprogressresponse_;
+}
+inline ::DeleteProgressResponse* ResponsePacket::release_deleteprogressresponse() {
+  clear_has_deleteprogressresponse();
+  ::DeleteProgressResponse* temp = deleteprogressresponse_;
+  deleteprogressresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_deleteprogressresponse(::DeleteProgressResponse* deleteprogressresponse) {
+  delete deleteprogressresponse_;
+  deleteprogressresponse_ = deleteprogressresponse;
+  if (deleteprogressresponse) {
+    set_has_deleteprogressresponse();
+  } else {
+    clear_has_deleteprogressresponse();
+  }
+}
+
+// optional .BatchStatResponse batchStatResponse = 9;
+inline bool ResponsePacket::has_batchstatresponse() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void ResponsePacket::set_has_batchstatresponse() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void ResponsePacket::clear_has_batchstatresponse() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void ResponsePacket::clear_batchstatresponse() {
+  if (batchstatresponse_ != NULL) batchstatresponse_->::BatchStatResponse::Clear();
+  clear_has_batchstatresponse();
+}
+inline const ::BatchStatResponse& ResponsePacket::batchstatresponse() const {
+  return batchstatresponse_ != NULL ? *batchstatresponse_ : *default_instance_->batchstatresponse_;
+}
+inline ::BatchStatResponse* ResponsePacket::mutable_batchstatresponse() {
+  set_has_batchstatresponse();
+  if (batchstatresponse_ == NULL) batchstatresponse_ = new ::BatchStatResponse;
+  return batchstatresponse_;
+}
+inline ::BatchStatResponse* ResponsePacket::release_batchstatresponse() {
+  clear_has_batchstatresponse();
+  ::BatchStatResponse* temp = batchstatresponse_;
+  batchstatresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_batchstatresponse(::BatchStatResponse* batchstatresponse) {
+  delete batchstatresponse_;
+  batchstatresponse_ = batchstatresponse;
+  if (batchstatresponse) {
+    set_has_batchstatresponse();
+  } else {
+    clear_has_batchstatresponse();
+  }
+}
+
+// optional .CopyResponse copyResponse = 10;
+inline bool ResponsePacket::has_copyresponse() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void ResponsePacket::set_has_copyresponse() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void ResponsePacket::clear_has_copyresponse() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void ResponsePacket::clear_copyresponse() {
+  if (copyresponse_ != NULL) copyresponse_->::CopyResponse::Clear();
+  clear_has_copyresponse();
+}
+inline const ::CopyResponse& ResponsePacket::copyresponse() const {
+  return copyresponse_ != NULL ? *copyresponse_ : *default_instance_->copyresponse_;
+}
+inline ::CopyResponse* ResponsePacket::mutable_copyresponse() {
+  set_has_copyresponse();
+  if (copyresponse_ == NULL) copyresponse_ = new ::CopyResponse;
+  return copyresponse_;
+}
+inline ::CopyResponse* ResponsePacket::release_copyresponse() {
+  clear_has_copyresponse();
+  ::CopyResponse* temp = copyresponse_;
+  copyresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_copyresponse(::CopyResponse* copyresponse) {
+  delete copyresponse_;
+  copyresponse_ = copyresponse;
+  if (copyresponse) {
+    set_has_copyresponse();
+  } else {
+    clear_has_copyresponse();
+  }
+}
+
+// optional .CopyProgressResponse copyProgressResponse = 11;
+inline bool ResponsePacket::has_copyprogressresponse() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void ResponsePacket::set_has_copyprogressresponse() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void ResponsePacket::clear_has_copyprogressresponse() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void ResponsePacket::clear_copyprogressresponse() {
+  if (copyprogressresponse_ != NULL) copyprogressresponse_->::CopyProgressResponse::Clear();
+  clear_has_copyprogressresponse();
+}
+inline const ::CopyProgressResponse& ResponsePacket::copyprogressresponse() const {
+  return copyprogressresponse_ != NULL ? *copyprogressresponse_ : *default_instance_->copyprogressresponse_;
+}
+inline ::CopyProgressResponse* ResponsePacket::mutable_copyprogressresponse() {
+  set_has_copyprogressresponse();
+  if (copyprogressresponse_ == NULL) copyprogressresponse_ = new ::CopyProgressResponse;
+  return copyprogressresponse_;
+}
+inline ::CopyProgressResponse* ResponsePacket::release_copyprogressresponse() {
+  clear_has_copyprogressresponse();
+  ::CopyProgressResponse* temp = copyprogressresponse_;
+  copyprogressresponse_ = NULL;
+  return temp;
+}
+inline void ResponsePacket::set_allocated_copyprogressresponse(::CopyProgressResponse* copyprogressresponse) {
+  delete copyprogressresponse_;
+  copyprogressresponse_ = copyprogressresponse;
+  if (copyprogressresponse) {
+    set_has_copyprogressresponse();
+  } else {
+    clear_has_copyprogressresponse();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// FolderStructureResponse
+
+// repeated .FileInformation fileInformation = 1;
+inline int FolderStructureResponse::fileinformation_size() const {
+  return fileinformation_.size();
+}
+inline void FolderStructureResponse::clear_fileinformation() {
+  fileinformation_.Clear();
+}
+inline const ::FileInformation& FolderStructureResponse::fileinformation(int index) const {
+  return fileinformation_.Get(index);
+}
+inline ::FileInformation* FolderStructureResponse::mutable_fileinformation(int index) {
+  return fileinformation_.Mutable(index);
+}
+inline ::FileInformation* FolderStructureResponse::add_fileinformation() {
+  return fileinformation_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::FileInformation >&
+FolderStructureResponse::fileinformation() const {
+  return fileinformation_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::FileInformation >*
+FolderStructureResponse::mutable_fileinformation() {
+  return &fileinformation_;
+}
+
+// -------------------------------------------------------------------
+
+// FileInformation
+
+// optional string name = 1;
+inline bool FileInformation::has_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void FileInformation::set_has_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void FileInformation::clear_has_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void FileInformation::clear_name() {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    name_->clear();
+  }
+  clear_has_name();
+}
+inline const ::std::string& FileInformation::name() const {
+  return *name_;
+}
+inline void FileInformation::set_name(const ::std::string& value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  name_->assign(value);
+}
+inline void FileInformation::set_name(const char* value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  name_->assign(value);
+}
+inline void FileInformation::set_name(const char* value, size_t size) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* FileInformation::mutable_name() {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  return name_;
+}
+inline ::std::string* FileInformation::release_name() {
+  clear_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = name_;
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void FileInformation::set_allocated_name(::std::string* name) {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    delete name_;
+  }
+  if (name) {
+    set_has_name();
+    name_ = name;
+  } else {
+    clear_has_name();
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional uint32 resourceType = 2;
+inline bool FileInformation::has_resourcetype() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void FileInformation::set_has_resourcetype() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void FileInformation::clear_has_resourcetype() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void FileInformation::clear_resourcetype() {
+  resourcetype_ = 0u;
+  clear_has_resourcetype();
+}
+inline ::google::protobuf::uint32 FileInformation::resourcetype() const {
+  return resourcetype_;
+}
+inline void FileInformation::set_resourcetype(::google::protobuf::uint32 value) {
+  set_has_resourcetype();
+  resourcetype_ = value;
+}
+
+// optional uint64 size = 3;
+inline bool FileInformation::has_size() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void FileInformation::set_has_size() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void FileInformation::clear_has_size() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void FileInformation::clear_size() {
+  size_ = GOOGLE_ULONGLONG(0);
+  clear_has_size();
+}
+inline ::google::protobuf::uint64 FileInformation::size() const {
+  return size_;
+}
+inline void FileInformation::set_size(::google::protobuf::uint64 value) {
+  set_has_size();
+  size_ = value;
+}
+
+// optional uint64 createTime = 4;
+inline bool FileInformation::has_createtime() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void FileInformation::set_has_createtime() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void FileInformation::clear_has_createtime() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void FileInformation::clear_createtime() {
+  createtime_ = GOOGLE_ULONGLONG(0);
+  clear_has_createtime();
+}
+inline ::google::protobuf::uint64 FileInformation::createtime() const {
+  return createtime_;
+}
+inline void FileInformation::set_createtime(::google::protobuf::uint64 value) {
+  set_has_createtime();
+  createtime_ = value;
+}
+
+// optional uint64 modifiedTime = 5;
+inline bool FileInformation::has_modifiedtime() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void FileInformation::set_has_modifiedtime() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void FileInformation::clear_has_modifiedtime() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void FileInformation::clear_modifiedtime() {
+  modifiedtime_ = GOOGLE_ULONGLONG(0);
+  clear_has_modifiedtime();
+}
+inline ::google::protobuf::uint64 FileInformation::modifiedtime() const {
+  return modifiedtime_;
+}
+inline void FileInformation::set_modifiedtime(::google::protobuf::uint64 value) {
+  set_has_modifiedtime();
+  modifiedtime_ = value;
+}
+
+// optional bool isDirectory = 6;
+inline bool FileInformation::has_isdirectory() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void FileInformation::set_has_isdirectory() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void FileInformation::clear_has_isdirectory() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void FileInformation::clear_isdirectory() {
+  isdirectory_ = false;
+  clear_has_isdirectory();
+}
+inline bool FileInformation::isdirectory() const {
+  return isdirectory_;
+}
+inline void FileInformation::set_isdirectory(bool value) {
+  set_has_isdirectory();
+  isdirectory_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// DownloadInitResponse
+
+// required .FileInformation fileInformation = 1;
+inline bool DownloadInitResponse::has_fileinformation() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void DownloadInitResponse::set_has_fileinformation() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void DownloadInitResponse::clear_has_fileinformation() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void DownloadInitResponse::clear_fileinformation() {
+  if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
+  clear_has_fileinformation();
+}
+inline const ::FileInformation& DownloadInitResponse::fileinformation() const {
+  return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
+}
+inline ::FileInformation* DownloadInitResponse::mutable_fileinformation() {
+  set_has_fileinformation();
+  if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
+  return fileinformation_;
+}
+inline ::FileInformation* DownloadInitResponse::release_fileinformation() {
+  clear_has_fileinformation();
+  ::FileInformation* temp = fileinformation_;
+  fileinformation_ = NULL;
+  return temp;
+}
+inline void DownloadInitResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
+  delete fileinformation_;
+  fileinformation_ = fileinformation;
+  if (fileinformation) {
+    set_has_fileinformation();
+  } else {
+    clear_has_fileinformation();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// DownloadDataResponse
+
+// required bytes data = 1;
+inline bool DownloadDataResponse::has_data() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void DownloadDataResponse::set_has_data() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void DownloadDataResponse::clear_has_data() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void DownloadDataResponse::clear_data() {
+  if (data_ != &::google::protobuf::internal::kEmptyString) {
+    data_->clear();
+  }
+  clear_has_data();
+}
+inline const ::std::string& DownloadDataResponse::data() const {
+  return *data_;
+}
+inline void DownloadDataResponse::set_data(const ::std::string& value) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+}
+inline void DownloadDataResponse::set_data(const char* value) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+}
+inline void DownloadDataResponse::set_data(const void* value, size_t size) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  data_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* DownloadDataResponse::mutable_data() {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  return data_;
+}
+inline ::std::string* DownloadDataResponse::release_data() {
+  clear_has_data();
+  if (data_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = data_;
+    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void DownloadDataResponse::set_allocated_data(::std::string* data) {
+  if (data_ != &::google::protobuf::internal::kEmptyString) {
+    delete data_;
+  }
+  if (data) {
+    set_has_data();
+    data_ = data;
+  } else {
+    clear_has_data();
+    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
-inline void FolderStructureResponse::clear_fileinformation() {
-  fileinformation_.Clear();
+
+// -------------------------------------------------------------------
+
+// TestConnectionResponse
+
+// required .FileInformation fileInformation = 1;
+inline bool TestConnectionResponse::has_fileinformation() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline const ::FileInformation& FolderStructureResponse::fileinformation(int index) const {
-  return fileinformation_.Get(index);
+inline void TestConnectionResponse::set_has_fileinformation() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline ::FileInformation* FolderStructureResponse::mutable_fileinformation(int index) {
-  return fileinformation_.Mutable(index);
+inline void TestConnectionResponse::clear_has_fileinformation() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline ::FileInformation* FolderStructureResponse::add_fileinformation() {
-  return fileinformation_.Add();
+inline void TestConnectionResponse::clear_fileinformation() {
+  if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
+  clear_has_fileinformation();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::FileInformation >&
-FolderStructureResponse::fileinformation() const {
+inline const ::FileInformation& TestConnectionResponse::fileinformation() const {
+  return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
+}
+inline ::FileInformation* TestConnectionResponse::mutable_fileinformation() {
+  set_has_fileinformation();
+  if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
   return fileinformation_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::FileInformation >*
-FolderStructureResponse::mutable_fileinformation() {
-  return &fileinformation_;
+inline ::FileInformation* TestConnectionResponse::release_fileinformation() {
+  clear_has_fileinformation();
+  ::FileInformation* temp = fileinformation_;
+  fileinformation_ = NULL;
+  return temp;
+}
+inline void TestConnectionResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
+  delete fileinformation_;
+  fileinformation_ = fileinformation;
+  if (fileinformation) {
+    set_has_fileinformation();
+  } else {
+    clear_has_fileinformation();
+  }
 }
 
 // -------------------------------------------------------------------
 
-// FileInformation
+// AddFolderResponse
 
-// optional string name = 1;
-inline bool FileInformation::has_name() const {
+// required .FileInformation fileInformation = 1;
+inline bool AddFolderResponse::has_fileinformation() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void FileInformation::set_has_name() {
+inline void AddFolderResponse::set_has_fileinformation() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void FileInformation::clear_has_name() {
+inline void AddFolderResponse::clear_has_fileinformation() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void FileInformation::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& FileInformation::name() const {
-  return *name_;
-}
-inline void FileInformation::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void FileInformation::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void AddFolderResponse::clear_fileinformation() {
+  if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
+  clear_has_fileinformation();
 }
-inline void FileInformation::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+inline const ::FileInformation& AddFolderResponse::fileinformation() const {
+  return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
 }
-inline ::std::string* FileInformation::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline ::FileInformation* AddFolderResponse::mutable_fileinformation() {
+  set_has_fileinformation();
+  if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
+  return fileinformation_;
 }
-inline ::std::string* FileInformation::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::FileInformation* AddFolderResponse::release_fileinformation() {
+  clear_has_fileinformation();
+  ::FileInformation* temp = fileinformation_;
+  fileinformation_ = NULL;
+  return temp;
 }
-inline void FileInformation::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
+inline void AddFolderResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
+  delete fileinformation_;
+  fileinformation_ = fileinformation;
+  if (fileinformation) {
+    set_has_fileinformation();
   } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_fileinformation();
   }
 }
 
-// optional uint32 resourceType = 2;
-inline bool FileInformation::has_resourcetype() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// -------------------------------------------------------------------
+
+// DeleteResourceResponse
+
+// required .FileInformation fileInformation = 1;
+inline bool DeleteResourceResponse::has_fileinformation() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void FileInformation::set_has_resourcetype() {
-  _has_bits_[0] |= 0x00000002u;
+inline void DeleteResourceResponse::set_has_fileinformation() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void FileInformation::clear_has_resourcetype() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void DeleteResourceResponse::clear_has_fileinformation() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void FileInformation::clear_resourcetype() {
-  resourcetype_ = 0u;
-  clear_has_resourcetype();
+inline void DeleteResourceResponse::clear_fileinformation() {
+  if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
+  clear_has_fileinformation();
 }
-inline ::google::protobuf::uint32 FileInformation::resourcetype() const {
-  return resourcetype_;
+inline const ::FileInformation& DeleteResourceResponse::fileinformation() const {
+  return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
 }
-inline void FileInformation::set_resourcetype(::google::protobuf::uint32 value) {
-  set_has_resourcetype();
-  resourcetype_ = value;
+inline ::FileInformation* DeleteResourceResponse::mutable_fileinformation() {
+  set_has_fileinformation();
+  if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
+  return fileinformation_;
+}
+inline ::FileInformation* DeleteResourceResponse::release_fileinformation() {
+  clear_has_fileinformation();
+  ::FileInformation* temp = fileinformation_;
+  fileinformation_ = NULL;
+  return temp;
+}
+inline void DeleteResourceResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
+  delete fileinformation_;
+  fileinformation_ = fileinformation;
+  if (fileinformation) {
+    set_has_fileinformation();
+  } else {
+    clear_has_fileinformation();
+  }
 }
 
-// optional uint64 size = 3;
-inline bool FileInformation::has_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// DeleteProgressResponse
+
+// required uint64 files = 1;
+inline bool DeleteProgressResponse::has_files() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void FileInformation::set_has_size() {
-  _has_bits_[0] |= 0x00000004u;
+inline void DeleteProgressResponse::set_has_files() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void FileInformation::clear_has_size() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void DeleteProgressResponse::clear_has_files() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void FileInformation::clear_size() {
-  size_ = GOOGLE_ULONGLONG(0);
-  clear_has_size();
+inline void DeleteProgressResponse::clear_files() {
+  files_ = GOOGLE_ULONGLONG(0);
+  clear_has_files();
 }
-inline ::google::protobuf::uint64 FileInformation::size() const {
-  return size_;
+inline ::google::protobuf::uint64 DeleteProgressResponse::files() const {
+  return files_;
 }
-inline void FileInformation::set_size(::google::protobuf::uint64 value) {
-  set_has_size();
-  size_ = value;
+inline void DeleteProgressResponse::set_files(::google::protobuf::uint64 value) {
+  set_has_files();
+  files_ = value;
 }
 
-// optional uint64 createTime = 4;
-inline bool FileInformation::has_createtime() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// required uint64 folders = 2;
+inline bool DeleteProgressResponse::has_folders() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void FileInformation::set_has_createtime() {
-  _has_bits_[0] |= 0x00000008u;
+inline void DeleteProgressResponse::set_has_folders() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void FileInformation::clear_has_createtime() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void DeleteProgressResponse::clear_has_folders() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void FileInformation::clear_createtime() {
-  createtime_ = GOOGLE_ULONGLONG(0);
-  clear_has_createtime();
+inline void DeleteProgressResponse::clear_folders() {
+  folders_ = GOOGLE_ULONGLONG(0);
+  clear_has_folders();
 }
-inline ::google::protobuf::uint64 FileInformation::createtime() const {
-  return createtime_;
+inline ::google::protobuf::uint64 DeleteProgressResponse::folders() const {
+  return folders_;
 }
-inline void FileInformation::set_createtime(::google::protobuf::uint64 value) {
-  set_has_createtime();
-  createtime_ = value;
+inline void DeleteProgressResponse::set_folders(::google::protobuf::uint64 value) {
+  set_has_folders();
+  folders_ = value;
 }
 
-// optional uint64 modifiedTime = 5;
-inline bool FileInformation::has_modifiedtime() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// required uint64 failed = 3;
+inline bool DeleteProgressResponse::has_failed() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void FileInformation::set_has_modifiedtime() {
-  _has_bits_[0] |= 0x00000010u;
+inline void DeleteProgressResponse::set_has_failed() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void FileInformation::clear_has_modifiedtime() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void DeleteProgressResponse::clear_has_failed() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void FileInformation::clear_modifiedtime() {
-  modifiedtime_ = GOOGLE_ULONGLONG(0);
-  clear_has_modifiedtime();
+inline void DeleteProgressResponse::clear_failed() {
+  failed_ = GOOGLE_ULONGLONG(0);
+  clear_has_failed();
 }
-inline ::google::protobuf::uint64 FileInformation::modifiedtime() const {
-  return modifiedtime_;
+inline ::google::protobuf::uint64 DeleteProgressResponse::failed() const {
+  return failed_;
 }
-inline void FileInformation::set_modifiedtime(::google::protobuf::uint64 value) {
-  set_has_modifiedtime();
-  modifiedtime_ = value;
+inline void DeleteProgressResponse::set_failed(::google::protobuf::uint64 value) {
+  set_has_failed();
+  failed_ = value;
 }
 
-// optional bool isDirectory = 6;
-inline bool FileInformation::has_isdirectory() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void FileInformation::set_has_isdirectory() {
-  _has_bits_[0] |= 0x00000020u;
+// optional bool summary = 4;
+inline bool DeleteProgressResponse::has_summary() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void FileInformation::clear_has_isdirectory() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void DeleteProgressResponse::set_has_summary() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline void FileInformation::clear_isdirectory() {
-  isdirectory_ = false;
-  clear_has_isdirectory();
+inline void DeleteProgressResponse::clear_has_summary() {
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline bool FileInformation::isdirectory() const {
-  return isdirectory_;
+inline void DeleteProgressResponse::clear_summary() {
+  summary_ = false;
+  clear_has_summary();
 }
-inline void FileInformation::set_isdirectory(bool value) {
-  set_has_isdirectory();
-  isdirectory_ = value;
+inline bool DeleteProgressResponse::summary() const {
+  return summary_;
 }
-
-// -------------------------------------------------------------------
-
-// DownloadInitResponse
-
-// required .FileInformation fileInformation = 1;
-inline bool DownloadInitResponse::has_fileinformation() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline void DeleteProgressResponse::set_summary(bool value) {
+  set_has_summary();
+  summary_ = value;
 }
-inline void DownloadInitResponse::set_has_fileinformation() {
-  _has_bits_[0] |= 0x00000001u;
+
+// repeated .DeleteFailureEntry failures = 5;
+inline int DeleteProgressResponse::failures_size() const {
+  return failures_.size();
 }
-inline void DownloadInitResponse::clear_has_fileinformation() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void DeleteProgressResponse::clear_failures() {
+  failures_.Clear();
 }
-inline void DownloadInitResponse::clear_fileinformation() {
-  if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
-  clear_has_fileinformation();
+inline const ::DeleteFailureEntry& DeleteProgressResponse::failures(int index) const {
+  return failures_.Get(index);
 }
-inline const ::FileInformation& DownloadInitResponse::fileinformation() const {
-  return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
+inline ::DeleteFailureEntry* DeleteProgressResponse::mutable_failures(int index) {
+  return failures_.Mutable(index);
 }
-inline ::FileInformation* DownloadInitResponse::mutable_fileinformation() {
-  set_has_fileinformation();
-  if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
-  return fileinformation_;
+inline ::DeleteFailureEntry* DeleteProgressResponse::add_failures() {
+  return failures_.Add();
 }
-inline ::FileInformation* DownloadInitResponse::release_fileinformation() {
-  clear_has_fileinformation();
-  ::FileInformation* temp = fileinformation_;
-  fileinformation_ = NULL;
-  return temp;
+inline const ::google::protobuf::RepeatedPtrField< ::DeleteFailureEntry >&
+DeleteProgressResponse::failures() const {
+  return failures_;
 }
-inline void DownloadInitResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
-  delete fileinformation_;
-  fileinformation_ = fileinformation;
-  if (fileinformation) {
-    set_has_fileinformation();
-  } else {
-    clear_has_fileinformation();
-  }
+inline ::google::protobuf::RepeatedPtrField< ::DeleteFailureEntry >*
+DeleteProgressResponse::mutable_failures() {
+  return &failures_;
 }
 
 // -------------------------------------------------------------------
 
-// DownloadDataResponse
+// DeleteFailureEntry
 
-// required bytes data = 1;
-inline bool DownloadDataResponse::has_data() const {
+// required string name = 1;
+inline bool DeleteFailureEntry::has_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void DownloadDataResponse::set_has_data() {
+inline void DeleteFailureEntry::set_has_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void DownloadDataResponse::clear_has_data() {
+inline void DeleteFailureEntry::clear_has_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void DownloadDataResponse::clear_data() {
-  if (data_ != &::google::protobuf::internal::kEmptyString) {
-    data_->clear();
+inline void DeleteFailureEntry::clear_name() {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    name_->clear();
   }
-  clear_has_data();
+  clear_has_name();
 }
-inline const ::std::string& DownloadDataResponse::data() const {
-  return *data_;
+inline const ::std::string& DeleteFailureEntry::name() const {
+  return *name_;
 }
-inline void DownloadDataResponse::set_data(const ::std::string& value) {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::kEmptyString) {
-    data_ = new ::std::string;
+inline void DeleteFailureEntry::set_name(const ::std::string& value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
   }
-  data_->assign(value);
+  name_->assign(value);
 }
-inline void DownloadDataResponse::set_data(const char* value) {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::kEmptyString) {
-    data_ = new ::std::string;
+inline void DeleteFailureEntry::set_name(const char* value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
   }
-  data_->assign(value);
+  name_->assign(value);
 }
-inline void DownloadDataResponse::set_data(const void* value, size_t size) {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::kEmptyString) {
-    data_ = new ::std::string;
+inline void DeleteFailureEntry::set_name(const char* value, size_t size) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
   }
-  data_->assign(reinterpret_cast<const char*>(value), size);
+  name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* DownloadDataResponse::mutable_data() {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::kEmptyString) {
-    data_ = new ::std::string;
+inline ::std::string* DeleteFailureEntry::mutable_name() {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
   }
-  return data_;
+  return name_;
 }
-inline ::std::string* DownloadDataResponse::release_data() {
-  clear_has_data();
-  if (data_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* DeleteFailureEntry::release_name() {
+  clear_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = data_;
-    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = name_;
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void DownloadDataResponse::set_allocated_data(::std::string* data) {
-  if (data_ != &::google::protobuf::internal::kEmptyString) {
-    delete data_;
+inline void DeleteFailureEntry::set_allocated_name(::std::string* name) {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    delete name_;
   }
-  if (data) {
-    set_has_data();
-    data_ = data;
+  if (name) {
+    set_has_name();
+    name_ = name;
   } else {
-    clear_has_data();
-    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_name();
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
+// required int32 code = 2;
+inline bool DeleteFailureEntry::has_code() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void DeleteFailureEntry::set_has_code() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void DeleteFailureEntry::clear_has_code() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void DeleteFailureEntry::clear_code() {
+  code_ = 0;
+  clear_has_code();
+}
+inline ::google::protobuf::int32 DeleteFailureEntry::code() const {
+  return code_;
+}
+inline void DeleteFailureEntry::set_code(::google::protobuf::int32 value) {
+  set_has_code();
+  code_ = value;
+}
+
 // -------------------------------------------------------------------
 
-// TestConnectionResponse
+// BatchStatResponse
 
-// required .FileInformation fileInformation = 1;
-inline bool TestConnectionResponse::has_fileinformation() const {
+// repeated .BatchStatEntry entries = 1;
+inline int BatchStatResponse::entries_size() const {
+  return entries_.size();
+}
+inline void BatchStatResponse::clear_entries() {
+  entries_.Clear();
+}
+inline const ::BatchStatEntry& BatchStatResponse::entries(int index) const {
+  return entries_.Get(index);
+}
+inline ::BatchStatEntry* BatchStatResponse::mutable_entries(int index) {
+  return entries_.Mutable(index);
+}
+inline ::BatchStatEntry* BatchStatResponse::add_entries() {
+  return entries_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::BatchStatEntry >&
+BatchStatResponse::entries() const {
+  return entries_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::BatchStatEntry >*
+BatchStatResponse::mutable_entries() {
+  return &entries_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchStatEntry
+
+// required uint32 index = 1;
+inline bool BatchStatEntry::has_index() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void TestConnectionResponse::set_has_fileinformation() {
+inline void BatchStatEntry::set_has_index() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void TestConnectionResponse::clear_has_fileinformation() {
+inline void BatchStatEntry::clear_has_index() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void TestConnectionResponse::clear_fileinformation() {
+inline void BatchStatEntry::clear_index() {
+  index_ = 0u;
+  clear_has_index();
+}
+inline ::google::protobuf::uint32 BatchStatEntry::index() const {
+  return index_;
+}
+inline void BatchStatEntry::set_index(::google::protobuf::uint32 value) {
+  set_has_index();
+  index_ = value;
+}
+
+// required int32 code = 2;
+inline bool BatchStatEntry::has_code() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void BatchStatEntry::set_has_code() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void BatchStatEntry::clear_has_code() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void BatchStatEntry::clear_code() {
+  code_ = 0;
+  clear_has_code();
+}
+inline ::google::protobuf::int32 BatchStatEntry::code() const {
+  return code_;
+}
+inline void BatchStatEntry::set_code(::google::protobuf::int32 value) {
+  set_has_code();
+  code_ = value;
+}
+
+// optional .FileInformation fileInformation = 3;
+inline bool BatchStatEntry::has_fileinformation() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void BatchStatEntry::set_has_fileinformation() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void BatchStatEntry::clear_has_fileinformation() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void BatchStatEntry::clear_fileinformation() {
   if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
   clear_has_fileinformation();
 }
-inline const ::FileInformation& TestConnectionResponse::fileinformation() const {
+inline const ::FileInformation& BatchStatEntry::fileinformation() const {
   return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
 }
-inline ::FileInformation* TestConnectionResponse::mutable_fileinformation() {
+inline ::FileInformation* BatchStatEntry::mutable_fileinformation() {
   set_has_fileinformation();
   if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
   return fileinformation_;
 }
-inline ::FileInformation* TestConnectionResponse::release_fileinformation() {
+inline ::FileInformation* BatchStatEntry::release_fileinformation() {
   clear_has_fileinformation();
   ::FileInformation* temp = fileinformation_;
   fileinformation_ = NULL;
   return temp;
 }
-inline void TestConnectionResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
+inline void BatchStatEntry::set_allocated_fileinformation(::FileInformation* fileinformation) {
   delete fileinformation_;
   fileinformation_ = fileinformation;
   if (fileinformation) {
@@ -1437,37 +2800,37 @@ inline void TestConnectionResponse::set_allocated_fileinformation(::FileInformat
 
 // -------------------------------------------------------------------
 
-// AddFolderResponse
+// CopyResponse
 
 // required .FileInformation fileInformation = 1;
-inline bool AddFolderResponse::has_fileinformation() const {
+inline bool CopyResponse::has_fileinformation() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void AddFolderResponse::set_has_fileinformation() {
+inline void CopyResponse::set_has_fileinformation() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void AddFolderResponse::clear_has_fileinformation() {
+inline void CopyResponse::clear_has_fileinformation() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void AddFolderResponse::clear_fileinformation() {
+inline void CopyResponse::clear_fileinformation() {
   if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
   clear_has_fileinformation();
 }
-inline const ::FileInformation& AddFolderResponse::fileinformation() const {
+inline const ::FileInformation& CopyResponse::fileinformation() const {
   return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
 }
-inline ::FileInformation* AddFolderResponse::mutable_fileinformation() {
+inline ::FileInformation* CopyResponse::mutable_fileinformation() {
   set_has_fileinformation();
   if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
   return fileinformation_;
 }
-inline ::FileInformation* AddFolderResponse::release_fileinformation() {
+inline ::FileInformation* CopyResponse::release_fileinformation() {
   clear_has_fileinformation();
   ::FileInformation* temp = fileinformation_;
   fileinformation_ = NULL;
   return temp;
 }
-inline void AddFolderResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
+inline void CopyResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
   delete fileinformation_;
   fileinformation_ = fileinformation;
   if (fileinformation) {
@@ -1477,45 +2840,169 @@ inline void AddFolderResponse::set_allocated_fileinformation(::FileInformation*
   }
 }
 
+// optional bool serverSide = 2;
+inline bool CopyResponse::has_serverside() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CopyResponse::set_has_serverside() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CopyResponse::clear_has_serverside() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CopyResponse::clear_serverside() {
+  serverside_ = false;
+  clear_has_serverside();
+}
+inline bool CopyResponse::serverside() const {
+  return serverside_;
+}
+inline void CopyResponse::set_serverside(bool value) {
+  set_has_serverside();
+  serverside_ = value;
+}
+
 // -------------------------------------------------------------------
 
-// DeleteResourceResponse
+// CopyProgressResponse
 
-// required .FileInformation fileInformation = 1;
-inline bool DeleteResourceResponse::has_fileinformation() const {
+// required uint64 bytes = 1;
+inline bool CopyProgressResponse::has_bytes() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void DeleteResourceResponse::set_has_fileinformation() {
+inline void CopyProgressResponse::set_has_bytes() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void DeleteResourceResponse::clear_has_fileinformation() {
+inline void CopyProgressResponse::clear_has_bytes() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void DeleteResourceResponse::clear_fileinformation() {
-  if (fileinformation_ != NULL) fileinformation_->::FileInformation::Clear();
-  clear_has_fileinformation();
+inline void CopyProgressResponse::clear_bytes() {
+  bytes_ = GOOGLE_ULONGLONG(0);
+  clear_has_bytes();
 }
-inline const ::FileInformation& DeleteResourceResponse::fileinformation() const {
-  return fileinformation_ != NULL ? *fileinformation_ : *default_instance_->fileinformation_;
+inline ::google::protobuf::uint64 CopyProgressResponse::bytes() const {
+  return bytes_;
 }
-inline ::FileInformation* DeleteResourceResponse::mutable_fileinformation() {
-  set_has_fileinformation();
-  if (fileinformation_ == NULL) fileinformation_ = new ::FileInformation;
-  return fileinformation_;
+inline void CopyProgressResponse::set_bytes(::google::protobuf::uint64 value) {
+  set_has_bytes();
+  bytes_ = value;
 }
-inline ::FileInformation* DeleteResourceResponse::release_fileinformation() {
-  clear_has_fileinformation();
-  ::FileInformation* temp = fileinformation_;
-  fileinformation_ = NULL;
-  return temp;
+
+// required uint64 total = 2;
+inline bool CopyProgressResponse::has_total() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void DeleteResourceResponse::set_allocated_fileinformation(::FileInformation* fileinformation) {
-  delete fileinformation_;
-  fileinformation_ = fileinformation;
-  if (fileinformation) {
-    set_has_fileinformation();
+inline void CopyProgressResponse::set_has_total() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CopyProgressResponse::clear_has_total() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CopyProgressResponse::clear_total() {
+  total_ = GOOGLE_ULONGLONG(0);
+  clear_has_total();
+}
+inline ::google::protobuf::uint64 CopyProgressResponse::total() const {
+  return total_;
+}
+inline void CopyProgressResponse::set_total(::google::protobuf::uint64 value) {
+  set_has_total();
+  total_ = value;
+}
+
+// optional bool serverSide = 3;
+inline bool CopyProgressResponse::has_serverside() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void CopyProgressResponse::set_has_serverside() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void CopyProgressResponse::clear_has_serverside() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void CopyProgressResponse::clear_serverside() {
+  serverside_ = false;
+  clear_has_serverside();
+}
+inline bool CopyProgressResponse::serverside() const {
+  return serverside_;
+}
+inline void CopyProgressResponse::set_serverside(bool value) {
+  set_has_serverside();
+  serverside_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// StatsResponse
+
+// required string stats = 1;
+inline bool StatsResponse::has_stats() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void StatsResponse::set_has_stats() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void StatsResponse::clear_has_stats() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void StatsResponse::clear_stats() {
+  if (stats_ != &::google::protobuf::internal::kEmptyString) {
+    stats_->clear();
+  }
+  clear_has_stats();
+}
+inline const ::std::string& StatsResponse::stats() const {
+  return *stats_;
+}
+inline void StatsResponse::set_stats(const ::std::string& value) {
+  set_has_stats();
+  if (stats_ == &::google::protobuf::internal::kEmptyString) {
+    stats_ = new ::std::string;
+  }
+  stats_->assign(value);
+}
+inline void StatsResponse::set_stats(const char* value) {
+  set_has_stats();
+  if (stats_ == &::google::protobuf::internal::kEmptyString) {
+    stats_ = new ::std::string;
+  }
+  stats_->assign(value);
+}
+inline void StatsResponse::set_stats(const char* value, size_t size) {
+  set_has_stats();
+  if (stats_ == &::google::protobuf::internal::kEmptyString) {
+    stats_ = new ::std::string;
+  }
+  stats_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* StatsResponse::mutable_stats() {
+  set_has_stats();
+  if (stats_ == &::google::protobuf::internal::kEmptyString) {
+    stats_ = new ::std::string;
+  }
+  return stats_;
+}
+inline ::std::string* StatsResponse::release_stats() {
+  clear_has_stats();
+  if (stats_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_fileinformation();
+    ::std::string* temp = stats_;
+    stats_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void StatsResponse::set_allocated_stats(::std::string* stats) {
+  if (stats_ != &::google::protobuf::internal::kEmptyString) {
+    delete stats_;
+  }
+  if (stats) {
+    set_has_stats();
+    stats_ = stats;
+  } else {
+    clear_has_stats();
+    stats_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
@@ -0,0 +1,396 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "FileCopier.h"
+#include "base/Common.h"
+#include "base/Error.h"
+#include "base/Log.h"
+#include "base/Metrics.h"
+
+static std::atomic<unsigned long> copies(0);
+
+/*!
+ * Constructor
+ */
+CopyProgress::CopyProgress() : _bytes(0), _total(0), _server_side(false)
+{
+}
+
+/*!
+ * Constructor
+ * @param backend - storage backend
+ * @param from - server/share/path of the file to be copied
+ * @param to - server/share/path of the copy
+ */
+FileCopier::FileCopier(IStorageBackend *backend, const std::string &from, const std::string &to)
+    : _backend(backend), _from("smb://" + from), _to("smb://" + to), _eof(false), _stop(false), _read_error(0),
+      _progress_time(0), _last_progress(0), _callback(NULL)
+{
+    _tmp = _to + "." + std::to_string((unsigned long) getpid()) + "-" + std::to_string(copies++) + ".smbconnector";
+}
+
+/*!
+ * Destructor
+ */
+FileCopier::~FileCopier()
+{
+}
+
+/*!
+ * Progress of server side copy, called by the backend
+ * @param bytes - bytes copied so far
+ * @param priv - FileCopier
+ * @return
+ * 1 - continue copy
+ */
+int FileCopier::splice_progress(off_t bytes, void *priv)
+{
+    static_cast<FileCopier *>(priv)->report(bytes);
+    return 1;
+}
+
+/*!
+ * Record bytes copied, progress callback is called every _progress_time
+ * @param bytes - bytes copied so far
+ */
+void FileCopier::report(uint64_t bytes)
+{
+    _progress._bytes = bytes;
+    if (_progress_time == 0 || _callback == NULL || !*_callback)
+    {
+        return;
+    }
+    uint64_t now = Metrics::Now();
+    if (now - _last_progress < _progress_time)
+    {
+        return;
+    }
+    _last_progress = now;
+    (*_callback)(_progress);
+}
+
+/*!
+ * Write whole buffer
+ * @param dst - destination handle
+ * @param buffer - data
+ * @param len - length of data
+ * @return
+ * SMB_SUCCESS - written
+ * Otherwise - failure, errno set
+ */
+int FileCopier::write(StorageFile *dst, const char *buffer, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t ret = _backend->Write(dst, buffer, len);
+        if (ret <= 0)
+        {
+            if (ret == 0)
+            {
+                errno = EIO;
+            }
+            return SMB_ERROR;
+        }
+        buffer += ret;
+        len -= ret;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Copy data, by the server when supported otherwise through the connector
+ * @param src - source handle at offset 0
+ * @param dst - destination handle at offset 0
+ * @return
+ * SMB_SUCCESS - copied
+ * Otherwise - failure, errno set
+ */
+int FileCopier::copy(StorageFile *src, StorageFile *dst)
+{
+    if (_progress._total == 0)
+    {
+        return SMB_SUCCESS;
+    }
+
+    _progress._server_side = true;
+    off_t copied = _backend->Splice(src, dst, _progress._total, &FileCopier::splice_progress, this);
+    if (copied >= 0)
+    {
+        _progress._bytes = copied;
+        return SMB_SUCCESS;
+    }
+
+    int err = errno;
+    _progress._server_side = false;
+    if (err != ENOTSUP && err != EOPNOTSUPP && err != ENOSYS && err != EXDEV)
+    {
+        errno = err;
+        return SMB_ERROR;
+    }
+    DEBUG_LOG("FileCopier::copy server side copy not available (%d), copying %s through the connector", err,
+              _from.c_str());
+    if (_backend->Lseek(src, 0, SEEK_SET) < 0 || _backend->Lseek(dst, 0, SEEK_SET) < 0)
+    {
+        return SMB_ERROR;
+    }
+    _progress._bytes = 0;
+    return pipeline(src, dst);
+}
+
+/*!
+ * Reader of the pipeline, reads chunks till end of file while the queue has room
+ * @param backend - storage context of the reader
+ * @param src - source handle of the context
+ */
+void FileCopier::read_chunks(IStorageBackend *backend, StorageFile *src)
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _cv.wait(lock, [this] { return _chunks.size() < COPY_QUEUE_CHUNKS || _stop; });
+            if (_stop)
+            {
+                return;
+            }
+        }
+
+        std::vector<char> chunk(COPY_CHUNK_SIZE);
+        ssize_t len = backend->Read(src, chunk.data(), chunk.size());
+        int err = errno;
+
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (len <= 0)
+        {
+            _read_error = len < 0 ? (err ? err : EIO) : 0;
+            _eof = true;
+            _cv.notify_all();
+            return;
+        }
+        chunk.resize(len);
+        _chunks.push_back(std::move(chunk));
+        _cv.notify_all();
+    }
+}
+
+/*!
+ * Copy through the connector, chunks are read by another thread (with a forked
+ * storage context) while the calling thread writes the chunks read before
+ * @param src - source handle, read when no reader can be started
+ * @param dst - destination handle
+ * @return
+ * SMB_SUCCESS - copied
+ * Otherwise - failure, errno set
+ */
+int FileCopier::pipeline(StorageFile *src, StorageFile *dst)
+{
+    IStorageBackend *context = _backend->Fork();
+    if (context == NULL)
+    {
+        WARNING_LOG("FileCopier::pipeline no context for reader, copying sequentially");
+        return sequential(src, dst);
+    }
+    StorageFile *handle = context == _backend ? src : context->Open(_from, O_RDONLY, 0);
+    if (handle == NULL)
+    {
+        int err = errno;
+        FREE(context);
+        errno = err;
+        return SMB_ERROR;
+    }
+
+    _chunks.clear();
+    _eof = false;
+    _stop = false;
+    _read_error = 0;
+    std::thread *reader = ALLOCATE(std::thread, &FileCopier::read_chunks, this, context, handle);
+    if (!ALLOCATED(reader))
+    {
+        WARNING_LOG("FileCopier::pipeline allocation failed, copying sequentially");
+        if (context != _backend)
+        {
+            context->Close(handle);
+            FREE(context);
+        }
+        return sequential(src, dst);
+    }
+
+    int ret = SMB_SUCCESS;
+    int err = 0;
+    uint64_t written = 0;
+    while (true)
+    {
+        std::vector<char> chunk;
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _cv.wait(lock, [this] { return !_chunks.empty() || _eof; });
+            if (_chunks.empty())
+            {
+                if (_read_error != 0)
+                {
+                    ret = SMB_ERROR;
+                    err = _read_error;
+                }
+                break;
+            }
+            chunk = std::move(_chunks.front());
+            _chunks.pop_front();
+            _cv.notify_all();
+        }
+        if (write(dst, chunk.data(), chunk.size()) != SMB_SUCCESS)
+        {
+            ret = SMB_ERROR;
+            err = errno;
+            break;
+        }
+        written += chunk.size();
+        report(written);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+        _chunks.clear();
+        _cv.notify_all();
+    }
+    reader->join();
+    FREE(reader);
+    if (context != _backend)
+    {
+        context->Close(handle);
+        FREE(context);
+    }
+    errno = err;
+    return ret;
+}
+
+/*!
+ * Copy through the connector, read and write alternate on the calling thread
+ * @param src - source handle
+ * @param dst - destination handle
+ * @return
+ * SMB_SUCCESS - copied
+ * Otherwise - failure, errno set
+ */
+int FileCopier::sequential(StorageFile *src, StorageFile *dst)
+{
+    std::vector<char> buffer(COPY_CHUNK_SIZE);
+    uint64_t written = 0;
+    while (true)
+    {
+        ssize_t len = _backend->Read(src, buffer.data(), buffer.size());
+        if (len < 0)
+        {
+            return SMB_ERROR;
+        }
+        if (len == 0)
+        {
+            return SMB_SUCCESS;
+        }
+        if (write(dst, buffer.data(), len) != SMB_SUCCESS)
+        {
+            return SMB_ERROR;
+        }
+        written += len;
+        report(written);
+    }
+}
+
+/*!
+ * Copy the file, the destination is replaced only once the copy is complete
+ * @param overwrite - replace an existing destination
+ * @param progress_time - progress is reported every progress_time micro-seconds, 0 - off
+ * @param progress - progress callback, called on the calling thread
+ * @return
+ * SMB_SUCCESS - file copied
+ * Otherwise - failure, errno set (EISDIR - source is a directory, EEXIST - destination exists)
+ */
+int FileCopier::Run(bool overwrite, uint64_t progress_time, const CopyProgressCallback &progress)
+{
+    DEBUG_LOG("FileCopier::Run copying %s to %s", _from.c_str(), _to.c_str());
+    _progress_time = progress_time;
+    _callback = &progress;
+    _last_progress = Metrics::Now();
+
+    struct stat st;
+    if (_backend->Stat(_from, &st) != 0)
+    {
+        return SMB_ERROR;
+    }
+    if (S_ISDIR(st.st_mode))
+    {
+        errno = EISDIR;
+        return SMB_ERROR;
+    }
+    if (!overwrite)
+    {
+        struct stat existing;
+        if (_backend->Stat(_to, &existing) == 0)
+        {
+            errno = EEXIST;
+            return SMB_ERROR;
+        }
+    }
+    _progress._total = st.st_size;
+
+    StorageFile *src = _backend->Open(_from, O_RDONLY, 0);
+    if (src == NULL)
+    {
+        return SMB_ERROR;
+    }
+    StorageFile *dst = _backend->Open(_tmp, O_CREAT | O_RDWR | O_TRUNC, 0);
+    if (dst == NULL)
+    {
+        int err = errno;
+        _backend->Close(src);
+        errno = err;
+        return SMB_ERROR;
+    }
+
+    int ret = copy(src, dst);
+    int err = errno;
+    _backend->Close(src);
+    if (_backend->Close(dst) != 0 && ret == SMB_SUCCESS)
+    {
+        ret = SMB_ERROR;
+        err = errno;
+    }
+    if (ret == SMB_SUCCESS && _backend->Rename(_tmp, _to) != 0)
+    {
+        ret = SMB_ERROR;
+        err = errno;
+    }
+    _callback = NULL;
+
+    if (ret != SMB_SUCCESS)
+    {
+        WARNING_LOG("FileCopier::Run copying %s failed, error: %d, error-string: %s", _from.c_str(), err,
+                    strerror(err));
+        _backend->Unlink(_tmp);
+        errno = err;
+        return SMB_ERROR;
+    }
+    INFO_LOG("FileCopier::Run %s copied to %s: %lu bytes%s", _from.c_str(), _to.c_str(),
+             (unsigned long) _progress._bytes, _progress._server_side ? " by the server" : "");
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Progress of the copy, final once Run returned
+ * @return
+ * progress
+ */
+const CopyProgress &FileCopier::Progress() const
+{
+    return _progress;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef FILE_COPIER_H_
+#define FILE_COPIER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/IStorageBackend.h"
+
+#define COPY_CHUNK_SIZE         (1024 * 1024)   //bytes per read/write when the server does not copy
+#define COPY_QUEUE_CHUNKS       4               //chunks read ahead of the writer
+
+/*
+ * Progress of a file copy
+ */
+struct CopyProgress
+{
+    uint64_t _bytes;        //bytes copied
+    uint64_t _total;        //size of the source
+    bool _server_side;      //data is copied by the server
+
+    CopyProgress();
+};
+
+typedef std::function<void(const CopyProgress &progress)> CopyProgressCallback;
+
+/*
+ * Copies a file. The server copies the data (SMB2 server side copy) when the backend
+ * supports it, otherwise a reader with its own storage context fills a bounded queue
+ * of chunks the calling thread writes, so reads and writes overlap. The copy is written
+ * next to the destination and renamed over it once complete.
+ */
+class FileCopier
+{
+private:
+    IStorageBackend *_backend;
+    std::string _from;                  //smb://server/share/path of the source
+    std::string _to;                    //smb://server/share/path of the destination
+    std::string _tmp;                   //destination while data is copied
+
+    /* read/write pipeline */
+    std::mutex _mtx;
+    std::condition_variable _cv;
+    std::deque<std::vector<char> > _chunks;    //read, not written yet
+    bool _eof;                          //reader done, _read_error set on failure
+    bool _stop;                         //writer done, reader stops
+    int _read_error;
+
+    CopyProgress _progress;
+    uint64_t _progress_time;            //micro-seconds, 0 - off
+    uint64_t _last_progress;
+    const CopyProgressCallback *_callback;
+
+    FileCopier(const FileCopier &instance);
+    FileCopier &operator=(const FileCopier &instance);
+
+    static int splice_progress(off_t bytes, void *priv);
+    void report(uint64_t bytes);
+    int copy(StorageFile *src, StorageFile *dst);
+    int pipeline(StorageFile *src, StorageFile *dst);
+    int sequential(StorageFile *src, StorageFile *dst);
+    int write(StorageFile *dst, const char *buffer, size_t len);
+    void read_chunks(IStorageBackend *backend, StorageFile *src);
+
+public:
+    FileCopier(IStorageBackend *backend, const std::string &from, const std::string &to);
+    ~FileCopier();
+
+    int Run(bool overwrite, uint64_t progress_time, const CopyProgressCallback &progress);
+    const CopyProgress &Progress() const;
+};
+
+#endif //FILE_COPIER_H_
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <functional>
+#include <string.h>
+
+#include "ListCache.h"
+#include "base/Configuration.h"
+#include "base/Log.h"
+#include "base/Metrics.h"
+#include "storage/IStorageBackend.h"
+
+ListCache ListCache::instance;
+
+/*!
+ * Constructor
+ */
+ListEntry::ListEntry() : _name()
+{
+    memset(&_info, 0, sizeof(_info));
+}
+
+/*!
+ * Copy of entry returned by readdirplus
+ * @param info - entry, valid till next readdirplus only
+ */
+ListEntry::ListEntry(const struct libsmb_file_info *info) : _info(*info), _name(info->name ? info->name : "")
+{
+    _info.name = NULL;
+    _info.short_name = NULL;
+}
+
+/*!
+ * Memory held by entry
+ * @return
+ * bytes
+ */
+size_t ListEntry::Bytes() const
+{
+    return sizeof(ListEntry) + _name.size();
+}
+
+/*!
+ * Constructor
+ */
+ListCache::ListCache() : _bytes(0)
+{
+}
+
+/*!
+ * Cache key of a directory, password is only kept as a hash
+ * @param url - server/share/path, smb:// scheme optional
+ * @param workgroup - workgroup
+ * @param user - user name
+ * @param password - password
+ * @return
+ * key
+ */
+std::string ListCache::Key(const std::string &url, const std::string &workgroup, const std::string &user,
+                           const std::string &password)
+{
+    std::string path = IStorageBackend::Path(url);
+    std::string key;
+    key.reserve(path.size() + workgroup.size() + user.size() + 24);
+    for (size_t i = 0; i < path.size(); i++)
+    {
+        if (path[i] != '/' || key.empty() || key[key.size() - 1] != '/')
+        {
+            key += path[i];
+        }
+    }
+    key += '\0';
+    key += workgroup + '\\' + user + '\0';
+    key += std::to_string(std::hash<std::string>()(password));
+    return key;
+}
+
+/*!
+ * Configured cache size
+ * @return
+ * bytes, 0 - cache off
+ */
+size_t ListCache::Limit()
+{
+    return Configuration::GetInstance().Snapshot().list_cache_size;
+}
+
+/*!
+ * Remove item, must be called with _mtx held
+ * @param iter - index entry of item
+ */
+void ListCache::erase(std::map<std::string, std::list<ListCacheItem>::iterator>::iterator iter)
+{
+    _bytes -= iter->second->_bytes;
+    _lru.erase(iter->second);
+    _index.erase(iter);
+}
+
+/*!
+ * Cached listing of directory, stale listings (ttl expired or directory changed) are dropped
+ * @param key - as returned by Key()
+ * @param mtime - current mtime of directory
+ * @return
+ * entries - cached listing
+ * empty - not cached
+ */
+std::shared_ptr<const ListEntries> ListCache::Lookup(const std::string &key, const struct timespec &mtime)
+{
+    uint64_t ttl = (uint64_t) Configuration::GetInstance().Snapshot().list_cache_ttl * 1000000;
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::map<std::string, std::list<ListCacheItem>::iterator>::iterator iter = _index.find(key);
+    if (iter == _index.end())
+    {
+        return std::shared_ptr<const ListEntries>();
+    }
+
+    const ListCacheItem &item = *iter->second;
+    if (Metrics::Now() - item._stored > ttl || item._mtime.tv_sec != mtime.tv_sec
+        || item._mtime.tv_nsec != mtime.tv_nsec)
+    {
+        DEBUG_LOG("ListCache::Lookup stale listing dropped");
+        erase(iter);
+        return std::shared_ptr<const ListEntries>();
+    }
+    _lru.splice(_lru.begin(), _lru, iter->second);
+    return item._entries;
+}
+
+/*!
+ * Cache listing, least recently used listings are evicted to stay within list_cache_size
+ * @param key - as returned by Key()
+ * @param mtime - mtime of directory before it was listed
+ * @param entries - complete listing
+ * @param bytes - memory held by entries
+ */
+void ListCache::Store(const std::string &key, const struct timespec &mtime, std::shared_ptr<const ListEntries> entries,
+                      size_t bytes)
+{
+    size_t limit = Limit();
+    bytes += sizeof(ListCacheItem) + key.size();
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::map<std::string, std::list<ListCacheItem>::iterator>::iterator iter = _index.find(key);
+    if (iter != _index.end())
+    {
+        erase(iter);
+    }
+    if (bytes > limit)
+    {
+        return;
+    }
+    while (!_lru.empty() && _bytes + bytes > limit)
+    {
+        erase(_index.find(_lru.back()._key));
+    }
+
+    ListCacheItem item;
+    item._key = key;
+    item._mtime = mtime;
+    item._stored = Metrics::Now();
+    item._bytes = bytes;
+    item._entries = entries;
+    _lru.push_front(item);
+    _index[key] = _lru.begin();
+    _bytes += bytes;
+}
+
+/*!
+ * Drop cached listing of directory
+ * @param key - as returned by Key()
+ */
+void ListCache::Invalidate(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::map<std::string, std::list<ListCacheItem>::iterator>::iterator iter = _index.find(key);
+    if (iter != _index.end())
+    {
+        erase(iter);
+    }
+}
+
+/*!
+ * Drop all cached listings
+ */
+void ListCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _lru.clear();
+    _index.clear();
+    _bytes = 0;
+}
+
+/*!
+ * Memory held by cached listings
+ * @return
+ * bytes
+ */
+size_t ListCache::Bytes()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _bytes;
+}
+
+/*!
+ * Number of cached listings
+ * @return
+ * listings
+ */
+size_t ListCache::Count()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _lru.size();
+}
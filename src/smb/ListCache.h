@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef LIST_CACHE_H_
+#define LIST_CACHE_H_
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <time.h>
+
+#include "libsmbclient.h"
+
+/*
+ * Directory entry as read from the server,
+ * _info.name points into _name once handed out
+ */
+struct ListEntry
+{
+    struct libsmb_file_info _info;
+    std::string _name;
+
+    ListEntry();
+    explicit ListEntry(const struct libsmb_file_info *info);
+
+    size_t Bytes() const;
+};
+
+typedef std::vector<ListEntry> ListEntries;
+
+/*
+ * Cached listing of one directory
+ */
+struct ListCacheItem
+{
+    std::string _key;
+    struct timespec _mtime;     //directory mtime the listing was read at
+    uint64_t _stored;           //Metrics::Now() when stored
+    size_t _bytes;
+    std::shared_ptr<const ListEntries> _entries;
+};
+
+/*
+ * Per process cache of directory listings, keyed by url and credentials.
+ * Entries are served only while the directory mtime is unchanged and
+ * younger than list_cache_ttl, least recently used listings are evicted
+ * once list_cache_size bytes are cached.
+ */
+class ListCache
+{
+private:
+    static ListCache instance;
+
+    std::mutex _mtx;
+    std::list<ListCacheItem> _lru;      //most recently used first
+    std::map<std::string, std::list<ListCacheItem>::iterator> _index;
+    size_t _bytes;
+
+    ListCache();
+    ListCache(ListCache &instance);
+    ListCache &operator=(ListCache &instance);
+
+    void erase(std::map<std::string, std::list<ListCacheItem>::iterator>::iterator iter);
+
+public:
+    static ListCache &GetInstance()
+    {
+        return instance;
+    }
+
+    static std::string Key(const std::string &url, const std::string &workgroup, const std::string &user,
+                           const std::string &password);
+    static size_t Limit();
+
+    std::shared_ptr<const ListEntries> Lookup(const std::string &key, const struct timespec &mtime);
+    void Store(const std::string &key, const struct timespec &mtime, std::shared_ptr<const ListEntries> entries,
+               size_t bytes);
+    void Invalidate(const std::string &key);
+    void Clear();
+    size_t Bytes();
+    size_t Count();
+};
+
+#endif //LIST_CACHE_H_
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <fnmatch.h>
+#include <string.h>
+#include <strings.h>
+
+#include "ListFilter.h"
+#include "base/Common.h"
+#include "base/Constants.h"
+
+/*!
+ * Constructor, matches every entry in directory order
+ */
+ListFilter::ListFilter()
+    : _min_mtime(0), _max_mtime(UINT64_MAX), _min_size(0), _max_size(UINT64_MAX), _sort(LIST_SORT_NONE),
+      _descending(false), _limit(0)
+{
+}
+
+/*!
+ * Modified time of entry as sent to the client
+ * @param info - entry
+ * @return
+ * ms since epoch
+ */
+uint64_t ListFilter::ModifiedTime(const struct libsmb_file_info *info)
+{
+    return info->mtime_ts.tv_sec * SEC_TO_MS + info->mtime_ts.tv_nsec * NANO_TO_MS;
+}
+
+/*!
+ * Check entry against name, modified time and size filter,
+ * size range applies to files only
+ * @param info - entry, name may carry the relative path of a recursive listing
+ * @return
+ * true - entry is listed
+ * false - entry is filtered
+ */
+bool ListFilter::Match(const struct libsmb_file_info *info) const
+{
+    if (!(info->attrs & FILE_ATTRIBUTE_DIRECTORY) && (info->size < _min_size || info->size > _max_size))
+    {
+        return false;
+    }
+    if (_min_mtime > 0 || _max_mtime < UINT64_MAX)
+    {
+        uint64_t mtime = ModifiedTime(info);
+        if (mtime < _min_mtime || mtime > _max_mtime)
+        {
+            return false;
+        }
+    }
+
+    const char *base = strrchr(info->name, '/');
+    base = base ? base + 1 : info->name;
+    if (!_prefix.empty() && strncasecmp(base, _prefix.c_str(), _prefix.size()) != 0)
+    {
+        return false;
+    }
+    return _pattern.empty() || fnmatch(_pattern.c_str(), base, FNM_CASEFOLD) == 0;
+}
+
+/*!
+ * Sort order of entries, ties are ordered by name
+ * @param a - entry
+ * @param b - entry
+ * @return
+ * true - a is sent before b
+ * false - otherwise
+ */
+bool ListFilter::Before(const ListEntry &a, const ListEntry &b) const
+{
+    int order = 0;
+    switch (_sort)
+    {
+        case LIST_SORT_MODIFIED_TIME:
+            if (a._info.mtime_ts.tv_sec != b._info.mtime_ts.tv_sec)
+            {
+                order = a._info.mtime_ts.tv_sec < b._info.mtime_ts.tv_sec ? -1 : 1;
+            }
+            else if (a._info.mtime_ts.tv_nsec != b._info.mtime_ts.tv_nsec)
+            {
+                order = a._info.mtime_ts.tv_nsec < b._info.mtime_ts.tv_nsec ? -1 : 1;
+            }
+            break;
+        case LIST_SORT_SIZE:
+            if (a._info.size != b._info.size)
+            {
+                order = a._info.size < b._info.size ? -1 : 1;
+            }
+            break;
+        case LIST_SORT_NAME:
+            order = strcasecmp(a._name.c_str(), b._name.c_str());
+            break;
+        default:
+            break;
+    }
+    if (order == 0)
+    {
+        return a._name < b._name;
+    }
+    return _descending ? order > 0 : order < 0;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef LIST_FILTER_H_
+#define LIST_FILTER_H_
+
+#include <stdint.h>
+#include <string>
+
+#include "ListCache.h"
+
+enum ListSortKey
+{
+    LIST_SORT_NONE,
+    LIST_SORT_NAME,
+    LIST_SORT_MODIFIED_TIME,
+    LIST_SORT_SIZE
+};
+
+/*
+ * Name, modified time and size filter of a listing with sort order and limit,
+ * evaluated by the connector while the directory is read. Names are matched
+ * without their relative path in recursive listings.
+ */
+struct ListFilter
+{
+    std::string _pattern;       //glob, case-insensitive, empty - any name
+    std::string _prefix;        //case-insensitive, empty - any name
+    uint64_t _min_mtime;        //ms since epoch, inclusive
+    uint64_t _max_mtime;
+    uint64_t _min_size;         //bytes, inclusive, directories are not filtered by size
+    uint64_t _max_size;
+    ListSortKey _sort;
+    bool _descending;
+    uint32_t _limit;            //entries sent, 0 - all
+
+    ListFilter();
+
+    bool Match(const struct libsmb_file_info *info) const;
+    bool Before(const ListEntry &a, const ListEntry &b) const;
+    static uint64_t ModifiedTime(const struct libsmb_file_info *info);
+};
+
+#endif //LIST_FILTER_H_
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "SmbBackend.h"
+#include "SmbClient.h"
+#include "base/Common.h"
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Log.h"
+
+/*!
+ * Constructor
+ */
+SmbBackend::SmbBackend() : _ctx(NULL), _kerberos(false)
+{
+}
+
+/*!
+ * Destructor
+ */
+SmbBackend::~SmbBackend()
+{
+    Quit();
+}
+
+const char *SmbBackend::Name() const
+{
+    return STORAGE_BACKEND_SMB;
+}
+
+/*!
+ * Convert log level from smb-connector to that
+ * of libsmbclient log level and set the same
+ * for libsmbclient
+ */
+void SmbBackend::set_log_level()
+{
+    extern int logLevel;
+
+    if (logLevel == LOG_LVL_ERROR)
+    {
+        smbc_setDebug(_ctx, SAMBA_DBG_ERR);
+    }
+    else if (logLevel == LOG_LVL_WARNING)
+    {
+        smbc_setDebug(_ctx, SAMBA_DBG_WARNING);
+    }
+    else if (logLevel == LOG_LVL_INFO)
+    {
+        smbc_setDebug(_ctx, SAMBA_DBG_INFO);
+    }
+    else if (logLevel == LOG_LVL_DEBUG)
+    {
+        smbc_setDebug(_ctx, SAMBA_DBG_DEBUG);
+    }
+    else
+    {
+        smbc_setDebug(_ctx, SAMBA_DBG_ERR);
+    }
+}
+
+/*!
+ * Unwrap libsmbclient handle
+ * @param file - handle returned by Open/OpenDir
+ * @return
+ * SMBCFILE
+ */
+SMBCFILE *SmbBackend::file(StorageFile *file)
+{
+    assert(file != NULL);
+    return static_cast<SmbFile *>(file)->_file;
+}
+
+/*!
+ * Wrap libsmbclient handle
+ * @param file - libsmbclient handle
+ * @return
+ * handle - successful
+ * NULL - file is NULL or allocation failure
+ */
+StorageFile *SmbBackend::wrap(SMBCFILE *file)
+{
+    if (file == NULL)
+    {
+        return NULL;
+    }
+
+    SmbFile *handle = ALLOCATE(SmbFile, file);
+    if (!ALLOCATED(handle))
+    {
+        smbc_getFunctionClose(_ctx)(_ctx, file);
+        errno = ENOMEM;
+        return NULL;
+    }
+    return handle;
+}
+
+/*!
+ * Initialise the libsmbclient library objects
+ * @param kerberos to enable/disable
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      SMB_ALLOCATION_FAILED - Context allocation failed
+ *      SMB_INIT_FAILED - ctx init failed
+ */
+int SmbBackend::Init(bool kerberos)
+{
+    DEBUG_LOG("SmbBackend::Init, log_level %d", logLevel);
+    Configuration &c = Configuration::GetInstance();
+    _ctx = smbc_new_context();
+
+    if (_ctx == NULL)
+    {
+        DEBUG_LOG("SmbBackend::Init smbc_new_context failed");
+        return SMB_ALLOCATION_FAILED;
+    }
+    set_log_level();
+    smbc_setLogCallback(_ctx, NULL, Log_smbclient);
+    smbc_setConfiguration(_ctx, c[C_SMB_CONF]);
+    if (kerberos)
+    {
+        DEBUG_LOG("SmbBackend::Init Setting Kerberos Authentication");
+        smbc_setOptionUseKerberos(_ctx, 1);
+    }
+    SMBCCTX *tmp = smbc_init_context(_ctx);
+
+    if (_ctx != tmp)
+    {
+        DEBUG_LOG("SmbBackend::Init smbc_init_context failed");
+        return SMB_INIT_FAILED;
+    }
+
+    smbc_setFunctionAuthData(_ctx, SmbClient::AuthCallback);
+    _kerberos = kerberos;
+    return SMB_SUCCESS;
+}
+
+/*!
+ * De-initialise the libsmbclient library
+ * @return
+ *      SMB_SUCCESS - Success
+ */
+int SmbBackend::Quit()
+{
+    if (_ctx == NULL)
+    {
+        return SMB_SUCCESS;
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        if (smbc_free_context(_ctx, 1) == 0)
+        {
+            break;
+        }
+    }
+    _ctx = NULL;
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Workgroup from smb.conf
+ * @return
+ * workgroup
+ */
+std::string SmbBackend::DefaultWorkGroup()
+{
+    const char *work_group = smbc_getWorkgroup(_ctx);
+    return work_group ? work_group : "";
+}
+
+/*!
+ * libsmbclient context must not be used by several threads,
+ * other threads get a context of their own (own connection to the server)
+ * @return
+ * new initialised backend, NULL on failure
+ */
+IStorageBackend *SmbBackend::Fork()
+{
+    SmbBackend *backend = ALLOCATE(SmbBackend);
+    if (!ALLOCATED(backend))
+    {
+        return NULL;
+    }
+    backend->SetLatency(_latency);
+    backend->SetBandwidth(_bandwidth);
+    if (backend->Init(_kerberos) != SMB_SUCCESS)
+    {
+        WARNING_LOG("SmbBackend::Fork context init failed");
+        FREE(backend);
+        return NULL;
+    }
+    return backend;
+}
+
+StorageFile *SmbBackend::Open(const std::string &url, int flags, mode_t mode)
+{
+    return wrap(smbc_getFunctionOpen(_ctx)(_ctx, url.c_str(), flags, mode));
+}
+
+ssize_t SmbBackend::Read(StorageFile *handle, void *buffer, size_t len)
+{
+    return smbc_getFunctionRead(_ctx)(_ctx, file(handle), buffer, len);
+}
+
+ssize_t SmbBackend::Write(StorageFile *handle, const void *buffer, size_t len)
+{
+    return smbc_getFunctionWrite(_ctx)(_ctx, file(handle), buffer, len);
+}
+
+off_t SmbBackend::Lseek(StorageFile *handle, off_t offset, int whence)
+{
+    return smbc_getFunctionLseek(_ctx)(_ctx, file(handle), offset, whence);
+}
+
+int SmbBackend::Fstat(StorageFile *handle, struct stat *st)
+{
+    return smbc_getFunctionFstat(_ctx)(_ctx, file(handle), st);
+}
+
+int SmbBackend::Close(StorageFile *handle)
+{
+    int ret = smbc_getFunctionClose(_ctx)(_ctx, file(handle));
+    FREE(handle);
+    return ret;
+}
+
+/*!
+ * Server side copy, SMB2 COPYCHUNK (libsmbclient falls back to read/write itself for SMB1)
+ */
+off_t SmbBackend::Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv),
+                         void *priv)
+{
+    smbc_splice_fn splice = smbc_getFunctionSplice(_ctx);
+    if (splice == NULL)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+    return splice(_ctx, file(from), file(to), count, progress, priv);
+}
+
+StorageFile *SmbBackend::OpenDir(const std::string &url)
+{
+    return wrap(smbc_getFunctionOpendir(_ctx)(_ctx, url.c_str()));
+}
+
+struct smbc_dirent *SmbBackend::ReadDir(StorageFile *dir)
+{
+    return smbc_getFunctionReaddir(_ctx)(_ctx, file(dir));
+}
+
+const struct libsmb_file_info *SmbBackend::ReadDirPlus(StorageFile *dir)
+{
+    return smbc_getFunctionReaddirPlus(_ctx)(_ctx, file(dir));
+}
+
+int SmbBackend::CloseDir(StorageFile *dir)
+{
+    int ret = smbc_getFunctionClosedir(_ctx)(_ctx, file(dir));
+    FREE(dir);
+    return ret;
+}
+
+int SmbBackend::Stat(const std::string &url, struct stat *st)
+{
+    return smbc_getFunctionStat(_ctx)(_ctx, url.c_str(), st);
+}
+
+int SmbBackend::Mkdir(const std::string &url, mode_t mode)
+{
+    return smbc_getFunctionMkdir(_ctx)(_ctx, url.c_str(), mode);
+}
+
+int SmbBackend::Unlink(const std::string &url)
+{
+    return smbc_getFunctionUnlink(_ctx)(_ctx, url.c_str());
+}
+
+int SmbBackend::Rename(const std::string &from, const std::string &to)
+{
+    return smbc_getFunctionRename(_ctx)(_ctx, from.c_str(), _ctx, to.c_str());
+}
+
+int SmbBackend::Rmdir(const std::string &url)
+{
+    return smbc_getFunctionRmdir(_ctx)(_ctx, url.c_str());
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef SMB_BACKEND_H_
+#define SMB_BACKEND_H_
+
+#include "storage/IStorageBackend.h"
+
+/*
+ * libsmbclient file/directory handle
+ */
+class SmbFile : public StorageFile
+{
+public:
+    SMBCFILE *_file;
+
+    SmbFile(SMBCFILE *file) : _file(file) {}
+};
+
+/*
+ * Storage backend talking to SMB server through libsmbclient
+ */
+class SmbBackend : public IStorageBackend
+{
+private:
+    SMBCCTX *_ctx;
+    bool _kerberos;
+
+    SmbBackend(const SmbBackend &instance);
+    SmbBackend &operator=(const SmbBackend &instance);
+
+    void set_log_level();
+    SMBCFILE *file(StorageFile *file);
+    StorageFile *wrap(SMBCFILE *file);
+
+public:
+    SmbBackend();
+    ~SmbBackend();
+
+    const char *Name() const;
+    int Init(bool kerberos);
+    int Quit();
+    std::string DefaultWorkGroup();
+    IStorageBackend *Fork();
+
+    StorageFile *Open(const std::string &url, int flags, mode_t mode);
+    ssize_t Read(StorageFile *file, void *buffer, size_t len);
+    ssize_t Write(StorageFile *file, const void *buffer, size_t len);
+    off_t Lseek(StorageFile *file, off_t offset, int whence);
+    int Fstat(StorageFile *file, struct stat *st);
+    int Close(StorageFile *file);
+    off_t Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv), void *priv);
+
+    StorageFile *OpenDir(const std::string &url);
+    struct smbc_dirent *ReadDir(StorageFile *dir);
+    const struct libsmb_file_info *ReadDirPlus(StorageFile *dir);
+    int CloseDir(StorageFile *dir);
+
+    int Stat(const std::string &url, struct stat *st);
+    int Mkdir(const std::string &url, mode_t mode);
+    int Unlink(const std::string &url);
+    int Rename(const std::string &from, const std::string &to);
+    int Rmdir(const std::string &url);
+};
+
+#endif //SMB_BACKEND_H_
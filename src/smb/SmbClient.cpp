@@ -11,94 +11,14 @@
 #include "base/Log.h"
 #include "base/Error.h"
 #include "base/Configuration.h"
+#include "base/Metrics.h"
+#include "base/Trace.h"
+#include "storage/InstrumentedBackend.h"
 
 SmbClient *SmbClient::_instance = NULL;
 
 extern int should_exit;
 
-/*!
- * Performs a recursive delete for a directory
- * @param file - base directory
- * @param base_url - path to base directory
- * @return
- * SMB_SUCCESS - success
- * Otherwise - Failure
- */
-int SmbClient::recursive_delete(SMBCFILE *file, std::string base_url)
-{
-    struct smbc_dirent *dirent = NULL;
-
-    while ((dirent = get_next_dirent(file)) != NULL)
-    {
-        if (strcasecmp(dirent->name, ".") != 0 && strcasecmp(dirent->name, "..") != 0)
-        {
-            std::string b_url = base_url + "/" + std::string(dirent->name, dirent->namelen);
-            if (dirent->smbc_type & SMBC_DIR)
-            {
-                SMBCFILE *file_r = open_dir(b_url);
-                if (file_r != NULL)
-                {
-                    recursive_delete(file_r, b_url);
-                }
-                else
-                {
-                    WARNING_LOG("SmbClient::recursive_delete opening '%s' file failed, error: %d, error-string: %s",
-                                b_url.c_str(), errno, strerror(errno));
-                }
-            }
-
-            DEBUG_LOG("SmbClient::recursive_delete Deleting '%s' file", b_url.c_str());
-            std::string url = "smb://" + b_url;
-            if (smbc_getFunctionUnlink(_ctx)(_ctx, url.c_str()) != SMB_SUCCESS)
-            {
-                WARNING_LOG("SmbClient::recursive_delete Deleting '%s' file failed, error: %d, error-string: %s",
-                            b_url.c_str(), errno, strerror(errno));
-            }
-
-        }
-    }
-
-    return SMB_SUCCESS;
-}
-
-/*!
- * OpenDir for given path
- * @param server - path to file to open
- * @return
- * SMBCFILE - Success
- * NULL - Failure
- */
-SMBCFILE *SmbClient::open_dir(std::string server)
-{
-    DEBUG_LOG("SmbClient::open_dir(string, string");
-    std::string url = "smb://" + server;
-
-    SMBCFILE *file = smbc_getFunctionOpendir(_ctx)(_ctx, url.c_str());
-
-    if (file == NULL)
-    {
-        DEBUG_LOG("SmbClient::open_dir failed");
-        return NULL;
-    }
-
-    return file;
-}
-
-/*!
- * Get the list of file inside a directory
- * @param file - directory to be traversed
- * @return
- * smbc_dirent - entry from list
- * NULL - when list traversal is finished
- */
-struct smbc_dirent *SmbClient::get_next_dirent(SMBCFILE *file)
-{
-
-    DEBUG_LOG("SmbClient::get_next_dirent(file)");
-    assert(file != NULL);
-    return smbc_getFunctionReaddir(_ctx)(_ctx, file);
-}
-
 /*!
  * get instance
  * @return
@@ -149,43 +69,59 @@ void SmbClient::AuthCallback(const char *srv, const char *shr, char *wg, int wgl
 }
 
 /*!
- *
- * Initialise the libsmbclient library objects
+ * Initialise the storage backend, created from
+ * configuration on first use unless set by SetBackend.
+ * Already initialised backend (previous operation of the session) is kept
+ * as long as kerberos setting is same.
  * @param kerberos to enable/disable
  * @return
  *      SMB_SUCCESS - Successful
- *      SMB_ALLOCATION_FAILED - Context allocation failed
- *      SMB_INIT_FAILED - ctx init failed
+ *      SMB_ALLOCATION_FAILED - backend allocation failed
+ *      SMB_INIT_FAILED - backend init failed
  */
 int SmbClient::Init(bool &kerberos)
 {
-    DEBUG_LOG("SmbClient::Init, log_level %d", logLevel);
-    Configuration &c = Configuration::GetInstance();
-    _ctx = smbc_new_context();
-
-    if (_ctx == NULL)
+    DEBUG_LOG("SmbClient::Init");
+    if (_initialised)
     {
-        DEBUG_LOG("SmbClient::Init smbc_new_context failed");
-        return SMB_ALLOCATION_FAILED;
+        if (_kerberos == kerberos)
+        {
+            DEBUG_LOG("SmbClient::Init reusing storage context");
+            return SMB_SUCCESS;
+        }
+        Quit();
     }
-    SetLogLevel();
-    smbc_setLogCallback(_ctx, NULL, Log_smbclient);
-    smbc_setConfiguration(_ctx, c[C_SMB_CONF]);
-   if(kerberos)
+    if (_backend == NULL)
     {
-        DEBUG_LOG("SmbClient::Init Setting Kerberos Authentication");
-        smbc_setOptionUseKerberos(_ctx, 1);
+        const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+        IStorageBackend *backend = IStorageBackend::Create(c.storage_backend, c.storage_root);
+        if (backend == NULL)
+        {
+            DEBUG_LOG("SmbClient::Init storage backend creation failed");
+            return SMB_ALLOCATION_FAILED;
+        }
+        backend->SetLatency(c.storage_latency);
+        backend->SetBandwidth(c.storage_bandwidth);
+
+        /* every storage call is timed */
+        _backend = ALLOCATE(InstrumentedBackend, backend, c.storage_slow_call);
+        if (!ALLOCATED(_backend))
+        {
+            DEBUG_LOG("SmbClient::Init instrumented backend allocation failed");
+            FREE(backend);
+            return SMB_ALLOCATION_FAILED;
+        }
+        INFO_LOG("SmbClient::Init using %s storage backend", _backend->Name());
     }
-    SMBCCTX *tmp = smbc_init_context(_ctx);
 
-    if (_ctx != tmp)
+    int ret = _backend->Init(kerberos);
+    if (ret == SMB_SUCCESS)
     {
-        DEBUG_LOG("SmbClient::Init smbc_init_context failed");
-        return SMB_INIT_FAILED;
+        _initialised = true;
+        _kerberos = kerberos;
+        _auth_key.clear();
     }
-
-    smbc_setFunctionAuthData(_ctx, AuthCallback);
-    return SMB_SUCCESS;
+    return ret;
 }
 
 /*!
@@ -202,15 +138,36 @@ int SmbClient::Init(bool &kerberos)
 int SmbClient::CredentialsInit(std::string &server, std::string &workgroup, std::string &un, std::string &pass)
 {
     DEBUG_LOG("SmbClient::CredentialsInit");
+    TRACE_SPAN("CredentialsInit");
     INFO_LOG("%s %s %s", server.c_str(), workgroup.c_str(), un.c_str());
     _server = server;
     _work_group = workgroup;
     _username = un;
     _password = pass;
 
+    /*
+     * context caches authenticated server connections, a later operation
+     * of the session with other credentials must not reuse them
+     */
+    std::string auth_key = workgroup + '\0' + un + '\0' + pass;
+    if (!_auth_key.empty() && _auth_key != auth_key)
+    {
+        INFO_LOG("SmbClient::CredentialsInit credentials changed, new storage context");
+        Reset();
+        _known_dirs.clear();
+        _backend->Quit();
+        int ret = _backend->Init(_kerberos);
+        if (ret != SMB_SUCCESS)
+        {
+            _initialised = false;
+            return ret;
+        }
+    }
+    _auth_key = auth_key;
+
     if(_work_group.length() == 0)
     {
-        _work_group = smbc_getWorkgroup(_ctx);
+        _work_group = _backend->DefaultWorkGroup();
         INFO_LOG("Empty workgroup, picked up from smb.conf file, new workgroup:%s", _work_group.c_str());
     }
 
@@ -218,34 +175,31 @@ int SmbClient::CredentialsInit(std::string &server, std::string &workgroup, std:
 }
 
 /*!
- * Convert log level from smb-connector to that
- * of libsmbclient log level and set the same
- * for libsmbclient
+ * Replace the storage backend, previous backend is released
+ * @param backend - backend to be used, owned by SmbClient
  */
-void SmbClient::SetLogLevel()
+void SmbClient::SetBackend(IStorageBackend *backend)
 {
-    extern int logLevel;
-
-    if (logLevel == LOG_LVL_ERROR)
-    {
-        smbc_setDebug(_ctx, SAMBA_DBG_ERR);
-    }
-    else if (logLevel == LOG_LVL_WARNING)
-    {
-        smbc_setDebug(_ctx, SAMBA_DBG_WARNING);
-    }
-    else if (logLevel == LOG_LVL_INFO)
-    {
-        smbc_setDebug(_ctx, SAMBA_DBG_INFO);
-    }
-    else if (logLevel == LOG_LVL_DEBUG)
+    if (_backend != NULL && _backend != backend)
     {
-        smbc_setDebug(_ctx, SAMBA_DBG_DEBUG);
-    }
-    else
-    {
-        smbc_setDebug(_ctx, SAMBA_DBG_ERR);
+        _backend->Quit();
+        FREE(_backend);
     }
+    _backend = backend;
+    _file = NULL;
+    _initialised = false;
+    _auth_key.clear();
+    _known_dirs.clear();
+}
+
+/*!
+ * Get the storage backend
+ * @return
+ * backend, NULL before Init
+ */
+IStorageBackend *SmbClient::Backend()
+{
+    return _backend;
 }
 
 /*!
@@ -265,9 +219,11 @@ void SmbClient::SetLogLevel()
 int SmbClient::OpenDir()
 {
     DEBUG_LOG("SmbClient::OpenDir");
+    TRACE_SPAN("OpenDir");
     std::string url = "smb://" + _server;
 
-    _file = smbc_getFunctionOpendir(_ctx)(_ctx, url.c_str());
+    _file = _backend->OpenDir(url);
+    _is_dir = true;
 
     if (_file == NULL)
     {
@@ -284,7 +240,7 @@ int SmbClient::OpenDir()
  *
  * @return
  *      libsmb_file_info - Structure containing file information
- *      NULL - Whole list is traversed
+ *      NULL - Whole list is traversed (errno 0) or failure (errno set)
  */
 const struct libsmb_file_info *SmbClient::GetNextFileInfo()
 {
@@ -292,9 +248,11 @@ const struct libsmb_file_info *SmbClient::GetNextFileInfo()
     if (_file == NULL)
     {
         ERROR_LOG("SmbClient::GetNextFileInfo failed");
+        errno = EBADF;
         return NULL;
     }
-    return smbc_getFunctionReaddirPlus(_ctx)(_ctx, _file);
+    errno = 0;
+    return _backend->ReadDirPlus(_file);
 }
 
 /*!
@@ -309,7 +267,7 @@ struct smbc_dirent *SmbClient::GetNextDirent()
 {
     DEBUG_LOG("SmbClient::GetNextDirent");
     assert(_file != NULL);
-    return smbc_getFunctionReaddir(_ctx)(_ctx, _file);
+    return _backend->ReadDir(_file);
 }
 
 /*!
@@ -324,7 +282,7 @@ int SmbClient::CloseDir()
     int ret = -1;
     if (_file != NULL)
     {
-        ret = smbc_getFunctionClosedir(_ctx)(_ctx, _file);
+        ret = _backend->CloseDir(_file);
     }
     _file = NULL;
     return ret;
@@ -340,7 +298,8 @@ int SmbClient::CloseDir()
 int SmbClient::OpenFile(int mode)
 {
     DEBUG_LOG("SmbClient::OpenFile");
-    assert(_ctx != NULL);
+    TRACE_SPAN("OpenFile");
+    assert(_backend != NULL);
     assert(_file == NULL);
 
     assert(_server != "");
@@ -352,7 +311,8 @@ int SmbClient::OpenFile(int mode)
 
     std::string url = "smb://" + _server;
 
-    _file = smbc_getFunctionOpen(_ctx)(_ctx, url.c_str(), mode, 0);
+    _file = _backend->Open(url, mode, 0);
+    _is_dir = false;
 
     if (_file == NULL)
     {
@@ -361,7 +321,7 @@ int SmbClient::OpenFile(int mode)
     }
 
     /* store file stat */
-    ret = smbc_getFunctionFstat(_ctx)(_ctx, _file, &_stat);
+    ret = _backend->Fstat(_file, &_stat);
 
     if (ret != 0)
     {
@@ -383,6 +343,43 @@ struct stat *SmbClient::FileStat()
     return &_stat;
 }
 
+/*!
+ * get the attributes of file/directory without opening it
+ * @param st - attributes (out)
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure, errno set
+ */
+int SmbClient::Stat(struct stat *st)
+{
+    DEBUG_LOG("SmbClient::Stat");
+    TRACE_SPAN("Stat");
+    assert(_backend != NULL);
+
+    std::string url = "smb://" + _server;
+    if (_backend->Stat(url, st) != 0)
+    {
+        int err = errno;
+        WARNING_LOG("SmbClient::Stat failed, errno %d", err);
+        errno = err;
+        return SMB_ERROR;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * get the type and attributes of file/directory with a single stat, no handle is opened.
+ * Attributes are returned by FileStat() afterwards
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure, errno set
+ */
+int SmbClient::Probe()
+{
+    DEBUG_LOG("SmbClient::Probe");
+    return Stat(&_stat);
+}
+
 /*!
  * set the start, end_offset for download operation
  * @param start_offset
@@ -401,7 +398,7 @@ int SmbClient::SetOffset(unsigned int start_offset, unsigned int end_offset)
     /* set the offset */
     if (_start_offset > 0)
     {
-        ret = smbc_getFunctionLseek(_ctx)(_ctx, _file, _start_offset, SEEK_SET);
+        ret = _backend->Lseek(_file, _start_offset, SEEK_SET);
         if (ret < 0)
         {
             ERROR_LOG("SmbClient::SetOffset lseek failed");
@@ -423,16 +420,17 @@ int SmbClient::SetOffset(unsigned int start_offset, unsigned int end_offset)
  */
 ssize_t SmbClient::Read(char *buffer, size_t len)
 {
-    DEBUG_LOG("SmbClient::Read");
+    DEBUG_LOG_RATE_LIMITED("SmbClient::Read");
+    TraceSpan span("SmbRead");
     ssize_t ret;
-    assert(_ctx != NULL);
+    assert(_backend != NULL);
     assert(_file != NULL);
     if ((_end_offset - _read_bytes) < 0)
     {
         DEBUG_LOG("SmbClient::Read All bytes read");
         return SMB_SUCCESS;
     }
-    ret = smbc_getFunctionRead(_ctx)(_ctx, _file, buffer, len);
+    ret = _backend->Read(_file, buffer, len);
 
     if (ret < 0)
     {
@@ -450,6 +448,7 @@ ssize_t SmbClient::Read(char *buffer, size_t len)
         _read_bytes += (_end_offset - _read_bytes) + 1;
     }
 
+    span.SetBytes(ret);
     return ret;
 }
 
@@ -462,21 +461,23 @@ ssize_t SmbClient::Read(char *buffer, size_t len)
  */
 int SmbClient::Write(char *buffer, size_t len)
 {
-    DEBUG_LOG("SmbClient::Write");
+    DEBUG_LOG_RATE_LIMITED("SmbClient::Write");
     int ret;
 
-    if (_ctx == NULL || _file == NULL)
+    if (_backend == NULL || _file == NULL)
     {
         WARNING_LOG("SmbClient::Write, File already closed");
         return SMB_SUCCESS;
     }
 
-    ret = smbc_getFunctionWrite(_ctx)(_ctx, _file, buffer, len);
+    TraceSpan span("SmbWrite");
+    ret = _backend->Write(_file, buffer, len);
 
     if (ret < 0)
     {
         ERROR_LOG("SmbClient::Write Write error");
     }
+    span.SetBytes(ret);
 
     return ret;
 }
@@ -490,13 +491,13 @@ int SmbClient::Write(char *buffer, size_t len)
 int SmbClient::CloseFile()
 {
     DEBUG_LOG("SmbClient::CloseFile");
-    if (_ctx == NULL || _file == NULL)
+    if (_backend == NULL || _file == NULL)
     {
         DEBUG_LOG("CloseFile, File already closed");
         return SMB_SUCCESS;
     }
 
-    int ret = smbc_getFunctionClose(_ctx)(_ctx, _file);
+    int ret = _backend->Close(_file);
 
     if (ret != 0)
     {
@@ -518,7 +519,7 @@ int SmbClient::CreateDirectory()
     DEBUG_LOG("SmbClient::CreateDirectory");
     std::string url = "smb://" + _server;
 
-    int ret = smbc_getFunctionMkdir(_ctx)(_ctx, url.c_str(), S_IRWXU | S_IRWXG | S_IRWXO); //default mode
+    int ret = _backend->Mkdir(url, S_IRWXU | S_IRWXG | S_IRWXO); //default mode
 
     if (ret != SMB_SUCCESS)
     {
@@ -526,19 +527,22 @@ int SmbClient::CreateDirectory()
         return ret;
     }
 
-    ret = smbc_getFunctionStat(_ctx)(_ctx, url.c_str(), &_stat);
+    add_known_dir(url);
+    ret = _backend->Stat(url, &_stat);
 
     return ret;
 }
 
 /*!
- * Deletes a file/folder
+ * Deletes a file/folder, folders are deleted with all their content
  * @param isDirectory - sets to true accordingly
+ * @param summary - filled with counts and failures of a folder delete, may be NULL
+ * @param progress - called with progress of a folder delete every delete_progress_time
  * @return
  *      SMB_SUCCESS - Successful
  *      Otherwise - failure
  */
-int SmbClient::Delete(bool &isDirectory)
+int SmbClient::Delete(bool &isDirectory, DeleteProgress *summary, const DeleteProgressCallback &progress)
 {
     DEBUG_LOG("SmbClient::Delete");
     std::string url = "smb://" + _server;
@@ -553,26 +557,27 @@ int SmbClient::Delete(bool &isDirectory)
     {
         /*
          * definitely a directory
-         * Lets remove content recusively
-         * We will ignore error from recursive delete
-         * There might be permission issue when all files cannot be deleted
+         * Lets remove content recusively, entries that can not be deleted
+         * (e.g. permission issue) are reported in the summary and keep the directory
          */
         isDirectory = true;
-        recursive_delete(_file, _server);
+        CloseDir();
+        forget_known_dirs(url);
 
-        ret = smbc_getFunctionRmdir(_ctx)(_ctx, url.c_str());
-        if (ret != SMB_SUCCESS)
-        {
-            return SMB_ERROR;
-        }
-        else
+        const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+        TreeDeleter deleter(_backend, _server);
+        ret = deleter.Run(c.delete_workers, c.delete_progress_time, progress);
+        int err = errno;
+        if (summary != NULL)
         {
-            return ret;
+            *summary = deleter.Progress();
         }
+        errno = err;
+        return ret;
     }
 
     /* try to remove it as file */
-    ret = smbc_getFunctionUnlink(_ctx)(_ctx, url.c_str());
+    ret = _backend->Unlink(url);
 
     if (ret == SMB_SUCCESS)
     {
@@ -588,6 +593,97 @@ int SmbClient::Delete(bool &isDirectory)
     return SMB_SUCCESS;
 }
 
+/*!
+ * Copy file, by the server when it supports server side copy
+ * @param destination - server/share/path of the copy
+ * @param overwrite - replace an existing destination
+ * @param summary - filled with bytes copied and whether the server copied them (may be NULL)
+ * @param progress - called every copy_progress_time while data is copied
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      Otherwise - failure, errno set
+ */
+int SmbClient::Copy(const std::string &destination, bool overwrite, CopyProgress *summary,
+                    const CopyProgressCallback &progress)
+{
+    DEBUG_LOG("SmbClient::Copy %s to %s", _server.c_str(), destination.c_str());
+    TRACE_SPAN("Copy");
+    assert(_backend != NULL);
+
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
+    FileCopier copier(_backend, _server, destination);
+    int ret = copier.Run(overwrite, c.copy_progress_time, progress);
+    int err = errno;
+    if (summary != NULL)
+    {
+        *summary = copier.Progress();
+    }
+    errno = err;
+    return ret;
+}
+
+/*!
+ * Move file or folder by renaming it. A file the server can not rename to the
+ * destination (other share or server) is copied and the source deleted
+ * @param destination - server/share/path the source is moved to
+ * @param overwrite - replace an existing destination
+ * @param summary - filled with bytes copied when the file was copied (may be NULL)
+ * @param progress - called every copy_progress_time while data is copied
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      Otherwise - failure, errno set
+ */
+int SmbClient::Move(const std::string &destination, bool overwrite, CopyProgress *summary,
+                    const CopyProgressCallback &progress)
+{
+    DEBUG_LOG("SmbClient::Move %s to %s", _server.c_str(), destination.c_str());
+    TRACE_SPAN("Move");
+    assert(_backend != NULL);
+
+    std::string from = "smb://" + _server;
+    std::string to = "smb://" + destination;
+    struct stat st;
+    if (!overwrite && _backend->Stat(to, &st) == 0)
+    {
+        errno = EEXIST;
+        return SMB_ERROR;
+    }
+
+    if (_backend->Rename(from, to) == 0)
+    {
+        forget_known_dirs(from);
+        return SMB_SUCCESS;
+    }
+    if (errno != EXDEV)
+    {
+        return SMB_ERROR;
+    }
+
+    if (Stat(&st) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+    if (S_ISDIR(st.st_mode))
+    {
+        errno = EXDEV;
+        return SMB_ERROR;
+    }
+    INFO_LOG("SmbClient::Move %s can not be renamed to %s, copying", _server.c_str(), destination.c_str());
+    int ret = Copy(destination, overwrite, summary, progress);
+    if (ret != SMB_SUCCESS)
+    {
+        return ret;
+    }
+    if (_backend->Unlink(from) != 0)
+    {
+        int err = errno;
+        WARNING_LOG("SmbClient::Move %s copied, deleting source failed, errno %d", _server.c_str(), err);
+        errno = err;
+        return SMB_ERROR;
+    }
+    return SMB_SUCCESS;
+}
+
 /*!
  * initialise download module variables and
  * open the file for download in RD_ONLY mode
@@ -619,9 +715,15 @@ int SmbClient::create_directory(std::string path)
      * If it fails with error ENOENT, we try to create parent folder
      * and then try to create child folder again
      * If that also fails, we bail out and propagate the error to caller
+     * Directories created or found earlier in the session are not created again
      */
+    if (known_dir(path))
+    {
+        DEBUG_LOG("SmbClient::create_directory Directory %s known to exist", path.c_str());
+        return SMB_SUCCESS;
+    }
 
-    int ret = smbc_getFunctionMkdir(_ctx)(_ctx, path.c_str(), 0);
+    int ret = _backend->Mkdir(path, 0);
     if(ret != SMB_SUCCESS && errno == ENOENT)
     {
         //Child folder creation failed since parent folder is not created
@@ -642,9 +744,10 @@ int SmbClient::create_directory(std::string path)
 
         //Parent folder is created
         // lets try to create the child folder again now
-        if (smbc_getFunctionMkdir(_ctx)(_ctx, path.c_str(), 0) == SMB_SUCCESS)
+        if (_backend->Mkdir(path, 0) == SMB_SUCCESS)
         {
             DEBUG_LOG("Smbclient::create_directory Directory %s created", path.c_str());
+            add_known_dir(path);
             return SMB_SUCCESS;
         }
         else
@@ -656,11 +759,13 @@ int SmbClient::create_directory(std::string path)
     else if(ret != SMB_SUCCESS && errno == EEXIST) //Child folder already exists, we can break out here
     {
         DEBUG_LOG("SmbClient::create_directory Directory already exists %s", path.c_str());
+        add_known_dir(path);
         return SMB_SUCCESS;
     }
     else if(ret == SMB_SUCCESS) //Child folder is created in recursive call, we can break out here
     {
         DEBUG_LOG("Smbclient::create_directory Directory %s created", path.c_str());
+        add_known_dir(path);
         return SMB_SUCCESS;
     }
     else //Some unknown error occurred, propagate the error to caller
@@ -673,6 +778,71 @@ int SmbClient::create_directory(std::string path)
 
 }
 
+/*!
+ * Check whether directory was created or found earlier in the session
+ * @param url - smb://server/share/path
+ * @return
+ * true - directory exists, no need to create it
+ * false - unknown
+ */
+bool SmbClient::known_dir(const std::string &url) const
+{
+    return Configuration::GetInstance().Snapshot().known_dirs > 0 && _known_dirs.find(url) != _known_dirs.end();
+}
+
+/*!
+ * Remember directory along with its parents, servers and shares are not recorded.
+ * All directories are forgotten once known_dirs of them are recorded
+ * @param url - smb://server/share/path
+ */
+void SmbClient::add_known_dir(std::string url)
+{
+    size_t limit = Configuration::GetInstance().Snapshot().known_dirs;
+    if (limit == 0)
+    {
+        return;
+    }
+    if (_known_dirs.size() >= limit)
+    {
+        DEBUG_LOG("SmbClient::add_known_dir %lu directories known, forgetting them", (unsigned long) limit);
+        _known_dirs.clear();
+    }
+
+    while (url.size() > 1 && url[url.size() - 1] == '/')
+    {
+        url.erase(url.size() - 1);
+    }
+    size_t share_end = url.find('/', url.find('/', url.find("://") + 3) + 1);
+    while (share_end != std::string::npos && url.size() > share_end && _known_dirs.insert(url).second)
+    {
+        url.erase(url.find_last_of('/'));
+    }
+}
+
+/*!
+ * Forget directory and everything below it, removed or found missing
+ * @param url - smb://server/share/path
+ */
+void SmbClient::forget_known_dirs(std::string url)
+{
+    while (url.size() > 1 && url[url.size() - 1] == '/')
+    {
+        url.erase(url.size() - 1);
+    }
+    std::set<std::string>::iterator it = _known_dirs.lower_bound(url);
+    while (it != _known_dirs.end() && it->compare(0, url.size(), url) == 0)
+    {
+        if (it->size() == url.size() || (*it)[url.size()] == '/')
+        {
+            it = _known_dirs.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 /*!
  * Initialises upload module variables and
  * creates, truncates and open file for upload
@@ -683,30 +853,47 @@ int SmbClient::create_directory(std::string path)
 int SmbClient::UploadInit(const std::string &uid)
 {
     DEBUG_LOG("SmbClient::UploadInit");
-    Configuration &c = Configuration::GetInstance();
+    const ConfigSnapshot &c = Configuration::GetInstance().Snapshot();
 
     /*
      * Create directory recursively if it doesn't exists
      */
 
+    std::string parent;
+    bool known = false;
     if(_server.find_last_of('/') != std::string::npos)
     {
-        if (create_directory("smb://" + _server.substr(0, _server.find_last_of('/'))) == SMB_SUCCESS)
+        parent = "smb://" + _server.substr(0, _server.find_last_of('/'));
+        known = known_dir(parent);
+        Metrics::GetInstance().Count(METRIC_OP_UPLOAD, known ? METRIC_CACHE_HITS : METRIC_CACHE_MISSES);
+        if (create_directory(parent) == SMB_SUCCESS)
         {
             DEBUG_LOG("SmbClient::UploadInit Recursive folder exists/created for %s", _server.c_str());
         }
         else
         {
             WARNING_LOG("SmbClient::UploadInit Recursive folder create failed for %s", _server.c_str());
+            forget_known_dirs(parent);
         }
     }
 
-    if(!atoi(c[C_FILE_UPLOAD_MODE]))
+    if(!c.file_upload_mode)
     {
     _server += "." + uid;
     _server += ".smbconnector";
     }
-    return OpenFile(O_CREAT | O_RDWR | O_TRUNC);
+    int ret = OpenFile(O_CREAT | O_RDWR | O_TRUNC);
+    if (ret != SMB_SUCCESS && known && _file == NULL)
+    {
+        /* folder was removed since it was created or found, create it again */
+        INFO_LOG("SmbClient::UploadInit create failed in known folder, creating folder again for %s", _server.c_str());
+        forget_known_dirs(parent);
+        if (create_directory(parent) == SMB_SUCCESS)
+        {
+            ret = OpenFile(O_CREAT | O_RDWR | O_TRUNC);
+        }
+    }
+    return ret;
 }
 
 /*!
@@ -722,7 +909,7 @@ int SmbClient::RestoreTmpFile(const std::string &uid)
     std::string furl = "smb://" + _server;
     std::string burl = furl.substr(0, furl.find_last_of(uid) - uid.length());
 
-    int ret = smbc_getFunctionRename(_ctx)(_ctx, furl.c_str(), _ctx, burl.c_str());
+    int ret = _backend->Rename(furl, burl);
 
     DEBUG_LOG("SmbClient::RestoreTmpFile File restored returns %d", ret);
     return SMB_SUCCESS;
@@ -737,7 +924,7 @@ int SmbClient::RestoreTmpFile(const std::string &uid)
 int SmbClient::DelTmpFile()
 {
     DEBUG_LOG("SmbClient::DelTmpFile %s", _server.c_str());
-    if (_ctx == NULL || _file == NULL)
+    if (_backend == NULL || _file == NULL)
     {
         DEBUG_LOG("DelTmpFile, File already deleted");
         return SMB_SUCCESS;
@@ -748,7 +935,7 @@ int SmbClient::DelTmpFile()
         WARNING_LOG("SmbClient::DelTmpFile File close failed");
         return SMB_ERROR;
     }
-    int ret = smbc_getFunctionUnlink(_ctx)(_ctx, url.c_str());
+    int ret = _backend->Unlink(url);
     if (ret != SMB_SUCCESS)
     {
         int err = errno;
@@ -760,28 +947,52 @@ int SmbClient::DelTmpFile()
 
 /*!
  *
- * De-initialise the libsmbclient library
+ * Close file/directory left open by an operation,
+ * storage context and credentials are kept for next operation of the session
  *
  * @return
  *      SMB_SUCCESS - Success
  */
-int SmbClient::Quit()
+int SmbClient::Reset()
 {
-    DEBUG_LOG("SmbClient::Quit");
-    int ret = 0;
-    for (int i = 0; i < 10; ++i)
+    DEBUG_LOG("SmbClient::Reset");
+    if (_backend != NULL && _file != NULL)
     {
-        ret = smbc_free_context(_ctx, 1);
-        if (ret == 0)
+        if (_is_dir)
+        {
+            CloseDir();
+        }
+        else
         {
-            break;
+            CloseFile();
         }
     }
-    _ctx = NULL;
     _file = NULL;
     return SMB_SUCCESS;
 }
 
+/*!
+ *
+ * De-initialise the storage backend, backend object is kept
+ * so that in-memory content survives across requests
+ *
+ * @return
+ *      SMB_SUCCESS - Success
+ */
+int SmbClient::Quit()
+{
+    DEBUG_LOG("SmbClient::Quit");
+    Reset();
+    if (_backend != NULL)
+    {
+        _backend->Quit();
+    }
+    _initialised = false;
+    _auth_key.clear();
+    _known_dirs.clear();
+    return SMB_SUCCESS;
+}
+
 /*!
  *
  * Get the Workgroup
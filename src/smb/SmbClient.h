@@ -10,23 +10,32 @@
 
 #include <iostream>
 #include <map>
+#include <set>
 #include <string>
 
 #include "libsmbclient.h"
-
+#include "FileCopier.h"
+#include "TreeDeleter.h"
+#include "storage/IStorageBackend.h"
 
 class SmbClient
 {
 private:
-    SmbClient() : _ctx(NULL), _file(NULL) {}
+    SmbClient() : _backend(NULL), _file(NULL), _is_dir(false), _initialised(false), _kerberos(false) {}
     SmbClient(const SmbClient &instance);
     SmbClient &operator=(const SmbClient &instance);
 
     static SmbClient *_instance;
 
-    /*SMB objects */
-    SMBCCTX *_ctx;
-    SMBCFILE *_file;
+    /* storage objects */
+    IStorageBackend *_backend;
+    StorageFile *_file;
+    bool _is_dir;
+
+    /* backend context is kept across operations of a keep-alive session */
+    bool _initialised;
+    bool _kerberos;
+    std::string _auth_key;  //workgroup, user and password the context was authenticated with
 
     std::string _server;
     std::string _work_group;
@@ -38,11 +47,13 @@ private:
     unsigned int _end_offset;
     size_t _read_bytes;
 
-    int recursive_delete(SMBCFILE *file, std::string base_url);
-    SMBCFILE *open_dir(std::string server);
-    struct smbc_dirent *get_next_dirent(SMBCFILE *file);
+    /* directories created or found by uploads of the session, parents are not created again */
+    std::set<std::string> _known_dirs;
 
     int create_directory(std::string path);
+    bool known_dir(const std::string &url) const;
+    void add_known_dir(std::string url);
+    void forget_known_dirs(std::string url);
 
 public:
     static SmbClient *GetInstance();
@@ -52,7 +63,8 @@ public:
     int Init(bool &kerberos);
     int CredentialsInit(std::string &server, std::string &workgroup, std::string &un, std::string &pass);
 
-    void SetLogLevel();
+    void SetBackend(IStorageBackend *backend);
+    IStorageBackend *Backend();
 
     int OpenDir();
     const struct libsmb_file_info *GetNextFileInfo();
@@ -61,13 +73,20 @@ public:
 
     int OpenFile(int mode);
     struct stat *FileStat();
+    int Stat(struct stat *st);
+    int Probe();
     int SetOffset(unsigned int start_offset, unsigned int end_offset);
     ssize_t Read(char *buffer, size_t len);
     int Write(char *buffer, size_t len);
     int CloseFile();
 
     int CreateDirectory();
-    int Delete(bool &isDirectory);
+    int Delete(bool &isDirectory, DeleteProgress *summary = NULL,
+               const DeleteProgressCallback &progress = DeleteProgressCallback());
+    int Copy(const std::string &destination, bool overwrite, CopyProgress *summary = NULL,
+             const CopyProgressCallback &progress = CopyProgressCallback());
+    int Move(const std::string &destination, bool overwrite, CopyProgress *summary = NULL,
+             const CopyProgressCallback &progress = CopyProgressCallback());
 
     int DownloadInit();
     int UploadInit(const std::string &uid);
@@ -75,6 +94,7 @@ public:
     int RestoreTmpFile(const std::string &uid);
     int DelTmpFile();
 
+    int Reset();
     int Quit();
 
     std::string &WorkGroup();
@@ -0,0 +1,396 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <chrono>
+#include <errno.h>
+#include <string.h>
+
+#include "TreeDeleter.h"
+#include "base/Common.h"
+#include "base/Error.h"
+#include "base/Log.h"
+
+/*!
+ * Constructor
+ */
+DeleteProgress::DeleteProgress() : _files(0), _folders(0), _failed(0), _done(false)
+{
+}
+
+/*!
+ * Constructor
+ * @param path - path relative to the deleted directory
+ * @param parent - parent directory, NULL for the deleted directory
+ */
+TreeDeleter::Dir::Dir(const std::string &path, Dir *parent)
+    : _path(path), _parent(parent), _pending(1), _failed(false), _error(0)
+{
+}
+
+/*!
+ * Constructor
+ * @param type - task type
+ * @param dir - directory the task works on
+ */
+TreeDeleter::Task::Task(TaskType type, Dir *dir) : _type(type), _dir(dir)
+{
+}
+
+/*!
+ * Constructor
+ * @param backend - storage backend, used by the first worker
+ * @param url - server/share/path of the directory to be deleted
+ */
+TreeDeleter::TreeDeleter(IStorageBackend *backend, const std::string &url)
+    : _backend(backend), _url("smb://" + url), _error(0)
+{
+    while (_url.size() > 1 && _url[_url.size() - 1] == '/')
+    {
+        _url.erase(_url.size() - 1);
+    }
+}
+
+/*!
+ * Destructor
+ */
+TreeDeleter::~TreeDeleter()
+{
+}
+
+/*!
+ * Url of entry
+ * @param path - path relative to the deleted directory
+ * @return
+ * smb://server/share/path
+ */
+std::string TreeDeleter::url(const std::string &path) const
+{
+    return path.empty() ? _url : _url + '/' + path;
+}
+
+/*!
+ * Queue task for the workers, must be called with _mtx held
+ * @param task - task, moved into the queue
+ */
+void TreeDeleter::push(Task &task)
+{
+    task._dir->_pending++;
+    _tasks.push_back(std::move(task));
+    _cv.notify_all();
+}
+
+/*!
+ * Task or subdirectory of dir finished, the directory is removed once nothing is pending.
+ * Must be called with _mtx held
+ * @param dir - directory
+ */
+void TreeDeleter::release(Dir *dir)
+{
+    if (--dir->_pending == 0)
+    {
+        _tasks.push_back(Task(TASK_RMDIR, dir));
+        _cv.notify_all();
+    }
+}
+
+/*!
+ * Record failure, must be called with _mtx held
+ * @param name - path relative to the deleted directory
+ * @param error - errno
+ */
+void TreeDeleter::fail(const std::string &name, int error)
+{
+    WARNING_LOG("TreeDeleter deleting '%s' failed, error: %d, error-string: %s", url(name).c_str(), error,
+                strerror(error));
+    _progress._failed++;
+    if (_progress._failures.size() < DELETE_MAX_FAILURES)
+    {
+        DeleteFailure failure;
+        failure._name = name;
+        failure._error = error;
+        _progress._failures.push_back(failure);
+    }
+}
+
+/*!
+ * Worker, runs queued tasks till the deleted directory is done
+ * @param backend - storage context of this worker
+ */
+void TreeDeleter::work(IStorageBackend *backend)
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (true)
+    {
+        _cv.wait(lock, [this] { return !_tasks.empty() || _progress._done; });
+        if (_tasks.empty())
+        {
+            return;
+        }
+        Task task = std::move(_tasks.front());
+        _tasks.pop_front();
+        lock.unlock();
+
+        switch (task._type)
+        {
+            case TASK_LIST:
+                list_dir(backend, task._dir);
+                break;
+            case TASK_UNLINK:
+                unlink_files(backend, task);
+                break;
+            case TASK_RMDIR:
+                remove_dir(backend, task._dir);
+                break;
+        }
+        lock.lock();
+    }
+}
+
+/*!
+ * List directory, subdirectories are queued to be listed and files to be unlinked
+ * in batches of DELETE_BATCH. The directory handle is closed before returning
+ * @param backend - storage context of this worker
+ * @param dir - directory
+ */
+void TreeDeleter::list_dir(IStorageBackend *backend, Dir *dir)
+{
+    StorageFile *handle = backend->OpenDir(url(dir->_path));
+    if (handle == NULL)
+    {
+        int err = errno;
+        std::lock_guard<std::mutex> lock(_mtx);
+        fail(dir->_path, err);
+        dir->_failed = true;
+        dir->_error = err;
+        release(dir);
+        return;
+    }
+
+    Task files(TASK_UNLINK, dir);
+    while (true)
+    {
+        errno = 0;
+        struct smbc_dirent *dirent = backend->ReadDir(handle);
+        if (dirent == NULL)
+        {
+            break;
+        }
+        std::string name(dirent->name, dirent->namelen);
+        if (strcasecmp(name.c_str(), ".") == 0 || strcasecmp(name.c_str(), "..") == 0)
+        {
+            continue;
+        }
+        std::string path = dir->_path.empty() ? name : dir->_path + '/' + name;
+        if (dirent->smbc_type == SMBC_DIR)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _dirs.push_back(Dir(path, dir));
+            Task list(TASK_LIST, &_dirs.back());
+            dir->_pending++;
+            _tasks.push_back(std::move(list));
+            _cv.notify_all();
+        }
+        else
+        {
+            files._names.push_back(path);
+            if (files._names.size() == DELETE_BATCH)
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                push(files);
+                files = Task(TASK_UNLINK, dir);
+            }
+        }
+    }
+    int err = errno;
+    backend->CloseDir(handle);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (!files._names.empty())
+    {
+        push(files);
+    }
+    if (err != 0)
+    {
+        /* entries not read can not be deleted, the directory stays */
+        fail(dir->_path, err);
+        dir->_failed = true;
+        dir->_error = err;
+    }
+    release(dir);
+}
+
+/*!
+ * Unlink a batch of files
+ * @param backend - storage context of this worker
+ * @param task - TASK_UNLINK task
+ */
+void TreeDeleter::unlink_files(IStorageBackend *backend, Task &task)
+{
+    uint64_t deleted = 0;
+    for (size_t i = 0; i < task._names.size(); i++)
+    {
+        DEBUG_LOG("TreeDeleter::unlink_files Deleting '%s' file", task._names[i].c_str());
+        if (backend->Unlink(url(task._names[i])) != 0)
+        {
+            int err = errno;
+            std::lock_guard<std::mutex> lock(_mtx);
+            fail(task._names[i], err);
+            task._dir->_failed = true;
+            continue;
+        }
+        deleted++;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _progress._files += deleted;
+    release(task._dir);
+}
+
+/*!
+ * Remove directory once its entries are gone, a directory left with entries
+ * (failed child) keeps its parents as well
+ * @param backend - storage context of this worker
+ * @param dir - directory
+ */
+void TreeDeleter::remove_dir(IStorageBackend *backend, Dir *dir)
+{
+    int err = 0;
+    if (!dir->_failed && backend->Rmdir(url(dir->_path)) != 0)
+    {
+        err = errno;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (err != 0)
+    {
+        fail(dir->_path, err);
+        dir->_failed = true;
+        dir->_error = err;
+    }
+    if (!dir->_failed)
+    {
+        _progress._folders++;
+    }
+
+    if (dir->_parent != NULL)
+    {
+        if (dir->_failed)
+        {
+            dir->_parent->_failed = true;
+        }
+        release(dir->_parent);
+        return;
+    }
+
+    /* deleted directory, all done */
+    if (dir->_failed)
+    {
+        _error = dir->_error ? dir->_error : ENOTEMPTY;
+    }
+    _progress._done = true;
+    _cv.notify_all();
+}
+
+/*!
+ * Delete the directory with all its content
+ * @param workers - concurrent workers, every worker but the first gets a forked storage context
+ * @param progress_time - progress is reported every progress_time micro-seconds, 0 - off
+ * @param progress - progress callback, called on the calling thread
+ * @return
+ * SMB_SUCCESS - directory deleted
+ * Otherwise - failure, errno set (ENOTEMPTY when content could not be deleted)
+ */
+int TreeDeleter::Run(unsigned int workers, uint64_t progress_time, const DeleteProgressCallback &progress)
+{
+    DEBUG_LOG("TreeDeleter::Run deleting %s with %u workers", _url.c_str(), workers);
+    _dirs.push_back(Dir("", NULL));
+    _tasks.push_back(Task(TASK_LIST, &_dirs.back()));
+
+    std::vector<std::thread *> threads;
+    std::vector<IStorageBackend *> contexts;
+    for (unsigned int i = 0; i == 0 || i < workers; i++)
+    {
+        IStorageBackend *context = i == 0 ? _backend : _backend->Fork();
+        if (context == NULL)
+        {
+            WARNING_LOG("TreeDeleter::Run no context for worker %u, deleting with %u workers", i, i);
+            break;
+        }
+        std::thread *thread = ALLOCATE(std::thread, &TreeDeleter::work, this, context);
+        if (!ALLOCATED(thread))
+        {
+            WARNING_LOG("TreeDeleter::Run allocation failed, deleting with %u workers", i);
+            if (context != _backend)
+            {
+                FREE(context);
+            }
+            break;
+        }
+        threads.push_back(thread);
+        if (context != _backend)
+        {
+            contexts.push_back(context);
+        }
+    }
+
+    if (threads.empty())
+    {
+        work(_backend);
+    }
+    else
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        while (!_progress._done)
+        {
+            if (progress_time == 0 || !progress)
+            {
+                _cv.wait(lock, [this] { return _progress._done; });
+                break;
+            }
+            if (_cv.wait_for(lock, std::chrono::microseconds(progress_time), [this] { return _progress._done; }))
+            {
+                break;
+            }
+            DeleteProgress current;
+            current._files = _progress._files;
+            current._folders = _progress._folders;
+            current._failed = _progress._failed;
+            lock.unlock();
+            progress(current);
+            lock.lock();
+        }
+    }
+
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i]->join();
+        FREE(threads[i]);
+    }
+    for (size_t i = 0; i < contexts.size(); i++)
+    {
+        FREE(contexts[i]);
+    }
+
+    INFO_LOG("TreeDeleter::Run %s: %lu files, %lu folders deleted, %lu failed", _url.c_str(),
+             (unsigned long) _progress._files, (unsigned long) _progress._folders, (unsigned long) _progress._failed);
+    if (_error != 0)
+    {
+        errno = _error;
+        return SMB_ERROR;
+    }
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Progress of the delete, summary once Run returned
+ * @return
+ * progress
+ */
+const DeleteProgress &TreeDeleter::Progress() const
+{
+    return _progress;
+}
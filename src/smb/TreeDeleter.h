@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef TREE_DELETER_H_
+#define TREE_DELETER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/IStorageBackend.h"
+
+#define DELETE_BATCH            64      //files unlinked per task
+#define DELETE_MAX_FAILURES     100     //failures kept for the summary, all of them are counted
+
+/*
+ * Entry that could not be listed or deleted
+ */
+struct DeleteFailure
+{
+    std::string _name;      //path relative to the deleted directory, empty for the directory itself
+    int _error;             //errno
+};
+
+/*
+ * Progress of a recursive delete
+ */
+struct DeleteProgress
+{
+    uint64_t _files;        //files deleted
+    uint64_t _folders;      //folders deleted, the deleted directory included
+    uint64_t _failed;       //entries that could not be listed or deleted
+    std::vector<DeleteFailure> _failures;   //first DELETE_MAX_FAILURES failures
+    bool _done;             //delete finished, progress is the summary
+
+    DeleteProgress();
+};
+
+typedef std::function<void(const DeleteProgress &progress)> DeleteProgressCallback;
+
+/*
+ * Deletes a directory tree. Directories are listed from a work queue, their files are
+ * unlinked in batches by a bounded set of workers (each with its own storage context)
+ * and every directory is removed once all its entries are gone, the deleted directory last.
+ * Failures do not stop the delete, they are counted and reported in the summary.
+ */
+class TreeDeleter
+{
+private:
+    enum TaskType
+    {
+        TASK_LIST,
+        TASK_UNLINK,
+        TASK_RMDIR
+    };
+
+    struct Dir
+    {
+        std::string _path;      //relative to the deleted directory
+        Dir *_parent;
+        size_t _pending;        //tasks and subdirectories left before the directory can be removed
+        bool _failed;           //directory can not be removed
+        int _error;             //errno of the directory itself
+
+        Dir(const std::string &path, Dir *parent);
+    };
+
+    struct Task
+    {
+        TaskType _type;
+        Dir *_dir;
+        std::vector<std::string> _names;    //files of TASK_UNLINK
+
+        Task(TaskType type, Dir *dir);
+    };
+
+    IStorageBackend *_backend;
+    std::string _url;                   //smb://server/share/path of the deleted directory
+
+    std::mutex _mtx;
+    std::condition_variable _cv;
+    std::deque<Task> _tasks;
+    std::deque<Dir> _dirs;              //references stay valid while directories are added
+    DeleteProgress _progress;
+    int _error;                         //errno the deleted directory was not removed with
+
+    TreeDeleter(const TreeDeleter &instance);
+    TreeDeleter &operator=(const TreeDeleter &instance);
+
+    std::string url(const std::string &path) const;
+    void work(IStorageBackend *backend);
+    void list_dir(IStorageBackend *backend, Dir *dir);
+    void unlink_files(IStorageBackend *backend, Task &task);
+    void remove_dir(IStorageBackend *backend, Dir *dir);
+    void push(Task &task);
+    void release(Dir *dir);
+    void fail(const std::string &name, int error);
+
+public:
+    TreeDeleter(IStorageBackend *backend, const std::string &url);
+    ~TreeDeleter();
+
+    int Run(unsigned int workers, uint64_t progress_time, const DeleteProgressCallback &progress);
+    const DeleteProgress &Progress() const;
+};
+
+#endif //TREE_DELETER_H_
@@ -284,7 +284,7 @@ int UnixDomainSocket::Read(char *buffer, int maxlen)
     {
         if (errno == EAGAIN || errno == EINPROGRESS)
         {
-            DEBUG_LOG("Read errno=%d (%s)", errno, strerror(errno));
+            DEBUG_LOG_RATE_LIMITED("Read errno=%d (%s)", errno, strerror(errno));
             return SMB_AGAIN;
         }
         else
@@ -307,7 +307,7 @@ int UnixDomainSocket::Read(char *buffer, int maxlen)
         return SMB_EOF;
     }
 
-    DEBUG_LOG("Received %ld bytes", ret);
+    DEBUG_LOG_RATE_LIMITED("Received %ld bytes", ret);
     return static_cast<int>(ret);
 }
 
@@ -319,7 +319,7 @@ int UnixDomainSocket::Send(const char *buffer, int len)
     {
         if (errno == EAGAIN || errno == EINPROGRESS)
         {
-            DEBUG_LOG("Send returns %ld, errno=%d (%s)", ret, errno, strerror(errno));
+            DEBUG_LOG_RATE_LIMITED("Send returns %ld, errno=%d (%s)", ret, errno, strerror(errno));
             return SMB_AGAIN;
         }
         else if (errno == EPIPE)
@@ -338,7 +338,7 @@ int UnixDomainSocket::Send(const char *buffer, int len)
         }
     }
 
-    DEBUG_LOG("UnixDomainSocket %ld bytes sent", ret);
+    DEBUG_LOG_RATE_LIMITED("UnixDomainSocket %ld bytes sent", ret);
     return static_cast<int>(ret);
 }
 
@@ -350,7 +350,7 @@ int UnixDomainSocket::Peek(char *buffer, int maxlen)
     {
         if (errno == EAGAIN || errno == EINPROGRESS)
         {
-            DEBUG_LOG("Read errno=%d (%s)", errno, strerror(errno));
+            DEBUG_LOG_RATE_LIMITED("Read errno=%d (%s)", errno, strerror(errno));
             return SMB_AGAIN;
         }
         else
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include <chrono>
+#include <errno.h>
+#include <thread>
+
+#include "IStorageBackend.h"
+#include "MemoryBackend.h"
+#include "PosixBackend.h"
+#include "base/Common.h"
+#include "base/Constants.h"
+#include "base/Log.h"
+#include "smb/SmbBackend.h"
+
+/*!
+ * Constructor
+ */
+StorageDir::StorageDir()
+{
+    memset(&_info, 0, sizeof(_info));
+}
+
+/*!
+ * Fill directory entry
+ * @param name - entry name
+ * @param type - SMBC_DIR or SMBC_FILE
+ * @return
+ * directory entry
+ */
+struct smbc_dirent *StorageDir::SetDirent(const std::string &name, unsigned int type)
+{
+    _dirent.assign(sizeof(struct smbc_dirent) + name.length() + 1, 0);
+    struct smbc_dirent *dirent = (struct smbc_dirent *) _dirent.data();
+    dirent->smbc_type = type;
+    dirent->dirlen = _dirent.size();
+    dirent->commentlen = 0;
+    dirent->comment = dirent->name + name.length();
+    dirent->namelen = name.length();
+    memcpy(dirent->name, name.c_str(), name.length());
+    return dirent;
+}
+
+/*!
+ * Fill file info of directory entry
+ * @param name - entry name
+ * @param st - entry attributes
+ * @return
+ * file info
+ */
+const struct libsmb_file_info *StorageDir::SetFileInfo(const std::string &name, const struct stat &st)
+{
+    _name = name;
+    memset(&_info, 0, sizeof(_info));
+    _info.name = (char *) _name.c_str();
+    _info.short_name = _info.name;
+    _info.size = S_ISDIR(st.st_mode) ? 0 : st.st_size;
+    _info.uid = st.st_uid;
+    _info.gid = st.st_gid;
+    _info.btime_ts = st.st_ctim;
+    _info.mtime_ts = st.st_mtim;
+    _info.atime_ts = st.st_atim;
+    _info.ctime_ts = st.st_ctim;
+
+    _info.attrs = S_ISDIR(st.st_mode) ? FILE_ATTRIBUTE_DIRECTORY : 0;
+    if (!name.empty() && name[0] == '.' && name != "." && name != "..")
+    {
+        _info.attrs |= FILE_ATTRIBUTE_HIDDEN;
+    }
+    if (!(st.st_mode & S_IWUSR))
+    {
+        _info.attrs |= FILE_ATTRIBUTE_READONLY;
+    }
+    if (_info.attrs == 0)
+    {
+        _info.attrs = FILE_ATTRIBUTE_NORMAL;
+    }
+    return &_info;
+}
+
+/*!
+ * Constructor
+ */
+IStorageBackend::IStorageBackend() : _latency(0), _bandwidth(0)
+{
+}
+
+/*!
+ * Destructor
+ */
+IStorageBackend::~IStorageBackend()
+{
+    //Destructor
+}
+
+/*!
+ * Create backend by name
+ * @param type - smb, memory or posix
+ * @param root - root directory for posix backend
+ * @return
+ * backend - successful
+ * NULL - unknown type or allocation failure
+ */
+IStorageBackend *IStorageBackend::Create(const std::string &type, const std::string &root)
+{
+    if (type == STORAGE_BACKEND_SMB)
+    {
+        return ALLOCATE(SmbBackend);
+    }
+    else if (type == STORAGE_BACKEND_MEMORY)
+    {
+        return ALLOCATE(MemoryBackend);
+    }
+    else if (type == STORAGE_BACKEND_POSIX)
+    {
+        return ALLOCATE(PosixBackend, root);
+    }
+
+    ERROR_LOG("IStorageBackend::Create unknown storage backend %s", type.c_str());
+    return NULL;
+}
+
+/*!
+ * Strip smb:// scheme and trailing '/' from url
+ * @param url - smb://server/share/path
+ * @return
+ * server/share/path
+ */
+std::string IStorageBackend::Path(const std::string &url)
+{
+    std::string path = url;
+    if (path.compare(0, 6, "smb://") == 0)
+    {
+        path = path.substr(6);
+    }
+    while (!path.empty() && path[path.length() - 1] == '/')
+    {
+        path.erase(path.length() - 1);
+    }
+    return path;
+}
+
+/*!
+ * Check path does not escape the backend root
+ * @param path - path as returned by Path()
+ * @return
+ * true - valid
+ * false - path contains '..' component
+ */
+bool IStorageBackend::ValidPath(const std::string &path)
+{
+    size_t start = 0;
+    while (start <= path.length())
+    {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos)
+        {
+            end = path.length();
+        }
+        if (path.compare(start, end - start, "..") == 0 && end - start == 2)
+        {
+            return false;
+        }
+        start = end + 1;
+    }
+    return true;
+}
+
+/*!
+ * Set latency added to every call
+ * @param latency - micro-seconds
+ */
+void IStorageBackend::SetLatency(long latency)
+{
+    _latency = latency;
+}
+
+/*!
+ * Set bandwidth limit for read/write calls
+ * @param bandwidth - bytes per second, 0 for unlimited
+ */
+void IStorageBackend::SetBandwidth(unsigned long bandwidth)
+{
+    _bandwidth = bandwidth;
+}
+
+/*!
+ * Sleep for configured latency plus transfer time of bytes
+ * @param bytes - bytes transferred by the call
+ */
+void IStorageBackend::inject(size_t bytes) const
+{
+    long delay = _latency;
+    if (_bandwidth > 0)
+    {
+        delay += (long) ((double) bytes * 1000000.0 / _bandwidth);
+    }
+    if (delay > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(delay));
+    }
+}
+
+/*!
+ * Workgroup to be used when request does not carry one
+ * @return
+ * workgroup
+ */
+std::string IStorageBackend::DefaultWorkGroup()
+{
+    return "";
+}
+
+/*!
+ * Backend for another thread working on the same storage concurrently,
+ * calls of this backend on separate handles are thread safe
+ * @return
+ * this - backend is shared, must not be released by the caller
+ * Otherwise - new initialised context, released by the caller (NULL on failure)
+ */
+IStorageBackend *IStorageBackend::Fork()
+{
+    return this;
+}
+
+/*!
+ * Copy count bytes from the offset of from to the offset of to on the server,
+ * data does not pass through the connector. Offsets of both handles advance
+ * @param from - source, opened for reading
+ * @param to - destination, opened for writing
+ * @param count - bytes to be copied
+ * @param progress - called with the bytes copied so far, zero return aborts the copy (may be NULL)
+ * @param priv - passed to progress
+ * @return
+ * bytes copied - successful
+ * -1 - failure, errno set (ENOTSUP - not supported by the backend or server)
+ */
+off_t IStorageBackend::Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv),
+                              void *priv)
+{
+    errno = ENOTSUP;
+    return -1;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef I_STORAGE_BACKEND_H_
+#define I_STORAGE_BACKEND_H_
+
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "libsmbclient.h"
+
+#define STORAGE_BACKEND_SMB     "smb"
+#define STORAGE_BACKEND_MEMORY  "memory"
+#define STORAGE_BACKEND_POSIX   "posix"
+
+/*
+ * Open file or directory handle, owned by the backend that returned it
+ * and released by Close/CloseDir
+ */
+class StorageFile
+{
+public:
+    virtual ~StorageFile() {}
+};
+
+/*
+ * Open directory handle, keeps storage for the entry last returned
+ * by ReadDir/ReadDirPlus (valid till the next call)
+ */
+class StorageDir : public StorageFile
+{
+public:
+    std::vector<char> _dirent;
+    struct libsmb_file_info _info;
+    std::string _name;
+
+    StorageDir();
+
+    struct smbc_dirent *SetDirent(const std::string &name, unsigned int type);
+    const struct libsmb_file_info *SetFileInfo(const std::string &name, const struct stat &st);
+};
+
+/*
+ * Storage primitives used by SmbClient.
+ * Calls follow libsmbclient semantics: urls are smb://server/share/path,
+ * failures return -1 (NULL for handles) and set errno.
+ */
+class IStorageBackend
+{
+protected:
+    long _latency;          //injected per call latency, micro-seconds
+    unsigned long _bandwidth; //injected bandwidth limit, bytes per second (0 - unlimited)
+
+    void inject(size_t bytes) const;
+
+public:
+    IStorageBackend();
+    virtual ~IStorageBackend();
+
+    static IStorageBackend *Create(const std::string &type, const std::string &root);
+    static std::string Path(const std::string &url);
+    static bool ValidPath(const std::string &path);
+
+    void SetLatency(long latency);
+    void SetBandwidth(unsigned long bandwidth);
+
+    virtual const char *Name() const = 0;
+    virtual int Init(bool kerberos) = 0;
+    virtual int Quit() = 0;
+    virtual std::string DefaultWorkGroup();
+    virtual IStorageBackend *Fork();
+
+    virtual StorageFile *Open(const std::string &url, int flags, mode_t mode) = 0;
+    virtual ssize_t Read(StorageFile *file, void *buffer, size_t len) = 0;
+    virtual ssize_t Write(StorageFile *file, const void *buffer, size_t len) = 0;
+    virtual off_t Lseek(StorageFile *file, off_t offset, int whence) = 0;
+    virtual int Fstat(StorageFile *file, struct stat *st) = 0;
+    virtual int Close(StorageFile *file) = 0;
+    virtual off_t Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv),
+                         void *priv);
+
+    virtual StorageFile *OpenDir(const std::string &url) = 0;
+    virtual struct smbc_dirent *ReadDir(StorageFile *dir) = 0;
+    virtual const struct libsmb_file_info *ReadDirPlus(StorageFile *dir) = 0;
+    virtual int CloseDir(StorageFile *dir) = 0;
+
+    virtual int Stat(const std::string &url, struct stat *st) = 0;
+    virtual int Mkdir(const std::string &url, mode_t mode) = 0;
+    virtual int Unlink(const std::string &url) = 0;
+    virtual int Rename(const std::string &from, const std::string &to) = 0;
+    virtual int Rmdir(const std::string &url) = 0;
+};
+
+#endif //I_STORAGE_BACKEND_H_
@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "InstrumentedBackend.h"
+#include "base/Common.h"
+#include "base/Log.h"
+
+/*!
+ * Constructor
+ * @param backend - backend to be timed, owned by InstrumentedBackend
+ * @param slow_call - calls taking longer (micro-seconds) are logged, 0 - off
+ */
+InstrumentedBackend::InstrumentedBackend(IStorageBackend *backend, long slow_call)
+    : _backend(backend), _slow_call(slow_call > 0 ? (uint64_t) slow_call : 0)
+{
+}
+
+/*!
+ * Destructor
+ */
+InstrumentedBackend::~InstrumentedBackend()
+{
+    FREE(_backend);
+}
+
+/*!
+ * Statistics of server/share of url
+ * @param url - smb://server/share/path
+ * @return
+ * share statistics, NULL if no more shares are tracked
+ */
+ShareStats *InstrumentedBackend::share(const std::string &url)
+{
+    std::string path = Path(url);
+    size_t end = path.find('/');
+    if (end != std::string::npos)
+    {
+        end = path.find('/', end + 1);
+    }
+    return Metrics::GetInstance().Share(end == std::string::npos ? path : path.substr(0, end));
+}
+
+/*!
+ * Record call from start till now, errno is preserved for the caller
+ * @param call - storage call
+ * @param share - server/share statistics, may be NULL
+ * @param start - start time as returned by Metrics::Now()
+ * @param bytes - bytes transferred
+ * @param failed - call failed, errno set by inner backend
+ */
+void InstrumentedBackend::record(MetricCall call, ShareStats *share, uint64_t start, uint64_t bytes,
+                                 bool failed) const
+{
+    int saved = errno;
+    int err = failed ? (saved ? saved : EIO) : 0;
+    uint64_t now = Metrics::Now();
+    uint64_t usec = now > start ? now - start : 0;
+    bool slow = _slow_call && usec >= _slow_call;
+
+    Metrics::GetInstance().RecordCall(call, share, usec, bytes, err, slow);
+    if (slow)
+    {
+        WARNING_LOG("InstrumentedBackend slow %s on %s took %lu us", Metrics::CallName(call),
+                    share ? share->_name.c_str() : "-", (unsigned long) usec);
+    }
+    errno = failed ? err : saved;
+}
+
+/*!
+ * Wrap handle of inner backend
+ * @param file - inner handle, NULL on failure
+ * @param share - server/share statistics
+ * @return
+ * wrapped handle, NULL if file is NULL or allocation failed (file closed)
+ */
+StorageFile *InstrumentedBackend::wrap(StorageFile *file, ShareStats *share)
+{
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    InstrumentedFile *wrapped = ALLOCATE(InstrumentedFile, file, share);
+    if (!ALLOCATED(wrapped))
+    {
+        ERROR_LOG("InstrumentedBackend::wrap allocation failed");
+        _backend->Close(file);
+        errno = ENOMEM;
+        return NULL;
+    }
+    return wrapped;
+}
+
+StorageFile *InstrumentedBackend::unwrap(StorageFile *file, ShareStats *&share) const
+{
+    if (file == NULL)
+    {
+        share = NULL;
+        return NULL;
+    }
+    InstrumentedFile *wrapped = static_cast<InstrumentedFile *>(file);
+    share = wrapped->_share;
+    return wrapped->_file;
+}
+
+/*!
+ * Backend being timed
+ * @return
+ * inner backend
+ */
+IStorageBackend *InstrumentedBackend::Inner()
+{
+    return _backend;
+}
+
+const char *InstrumentedBackend::Name() const
+{
+    return _backend->Name();
+}
+
+int InstrumentedBackend::Init(bool kerberos)
+{
+    return _backend->Init(kerberos);
+}
+
+int InstrumentedBackend::Quit()
+{
+    return _backend->Quit();
+}
+
+std::string InstrumentedBackend::DefaultWorkGroup()
+{
+    return _backend->DefaultWorkGroup();
+}
+
+/*!
+ * Forked inner backend, timed as well
+ * @return
+ * this - inner backend is shared
+ * Otherwise - new context, NULL on failure
+ */
+IStorageBackend *InstrumentedBackend::Fork()
+{
+    IStorageBackend *inner = _backend->Fork();
+    if (inner == _backend)
+    {
+        return this;
+    }
+    if (inner == NULL)
+    {
+        return NULL;
+    }
+    IStorageBackend *forked = ALLOCATE(InstrumentedBackend, inner, (long) _slow_call);
+    if (!ALLOCATED(forked))
+    {
+        FREE(inner);
+        return NULL;
+    }
+    return forked;
+}
+
+StorageFile *InstrumentedBackend::Open(const std::string &url, int flags, mode_t mode)
+{
+    ShareStats *stats = share(url);
+    uint64_t start = Metrics::Now();
+    StorageFile *file = _backend->Open(url, flags, mode);
+    record(METRIC_CALL_OPEN, stats, start, 0, file == NULL);
+    return wrap(file, stats);
+}
+
+ssize_t InstrumentedBackend::Read(StorageFile *file, void *buffer, size_t len)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(file, stats);
+    uint64_t start = Metrics::Now();
+    ssize_t ret = _backend->Read(inner, buffer, len);
+    record(METRIC_CALL_READ, stats, start, ret > 0 ? ret : 0, ret < 0);
+    return ret;
+}
+
+ssize_t InstrumentedBackend::Write(StorageFile *file, const void *buffer, size_t len)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(file, stats);
+    uint64_t start = Metrics::Now();
+    ssize_t ret = _backend->Write(inner, buffer, len);
+    record(METRIC_CALL_WRITE, stats, start, ret > 0 ? ret : 0, ret < 0);
+    return ret;
+}
+
+off_t InstrumentedBackend::Lseek(StorageFile *file, off_t offset, int whence)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(file, stats);
+    uint64_t start = Metrics::Now();
+    off_t ret = _backend->Lseek(inner, offset, whence);
+    record(METRIC_CALL_LSEEK, stats, start, 0, ret < 0);
+    return ret;
+}
+
+int InstrumentedBackend::Fstat(StorageFile *file, struct stat *st)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(file, stats);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Fstat(inner, st);
+    record(METRIC_CALL_FSTAT, stats, start, 0, ret < 0);
+    return ret;
+}
+
+int InstrumentedBackend::Close(StorageFile *file)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(file, stats);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Close(inner);
+    record(METRIC_CALL_CLOSE, stats, start, 0, ret < 0);
+    FREE(file);
+    return ret;
+}
+
+off_t InstrumentedBackend::Splice(StorageFile *from, StorageFile *to, off_t count,
+                                  int (*progress)(off_t bytes, void *priv), void *priv)
+{
+    ShareStats *stats;
+    StorageFile *inner_from = unwrap(from, stats);
+    StorageFile *inner_to = unwrap(to, stats);
+    uint64_t start = Metrics::Now();
+    off_t ret = _backend->Splice(inner_from, inner_to, count, progress, priv);
+    record(METRIC_CALL_SPLICE, stats, start, ret > 0 ? ret : 0, ret < 0);
+    return ret;
+}
+
+StorageFile *InstrumentedBackend::OpenDir(const std::string &url)
+{
+    ShareStats *stats = share(url);
+    uint64_t start = Metrics::Now();
+    StorageFile *dir = _backend->OpenDir(url);
+    record(METRIC_CALL_OPENDIR, stats, start, 0, dir == NULL);
+    return wrap(dir, stats);
+}
+
+/*
+ * NULL from ReadDir/ReadDirPlus marks the end of the listing, it is not counted as an error
+ */
+struct smbc_dirent *InstrumentedBackend::ReadDir(StorageFile *dir)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(dir, stats);
+    uint64_t start = Metrics::Now();
+    struct smbc_dirent *dirent = _backend->ReadDir(inner);
+    record(METRIC_CALL_READDIR, stats, start, 0, false);
+    return dirent;
+}
+
+const struct libsmb_file_info *InstrumentedBackend::ReadDirPlus(StorageFile *dir)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(dir, stats);
+    uint64_t start = Metrics::Now();
+    const struct libsmb_file_info *info = _backend->ReadDirPlus(inner);
+    record(METRIC_CALL_READDIRPLUS, stats, start, 0, false);
+    return info;
+}
+
+int InstrumentedBackend::CloseDir(StorageFile *dir)
+{
+    ShareStats *stats;
+    StorageFile *inner = unwrap(dir, stats);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->CloseDir(inner);
+    record(METRIC_CALL_CLOSEDIR, stats, start, 0, ret < 0);
+    FREE(dir);
+    return ret;
+}
+
+int InstrumentedBackend::Stat(const std::string &url, struct stat *st)
+{
+    ShareStats *stats = share(url);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Stat(url, st);
+    record(METRIC_CALL_STAT, stats, start, 0, ret < 0);
+    return ret;
+}
+
+int InstrumentedBackend::Mkdir(const std::string &url, mode_t mode)
+{
+    ShareStats *stats = share(url);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Mkdir(url, mode);
+    record(METRIC_CALL_MKDIR, stats, start, 0, ret < 0);
+    return ret;
+}
+
+int InstrumentedBackend::Unlink(const std::string &url)
+{
+    ShareStats *stats = share(url);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Unlink(url);
+    record(METRIC_CALL_UNLINK, stats, start, 0, ret < 0);
+    return ret;
+}
+
+int InstrumentedBackend::Rename(const std::string &from, const std::string &to)
+{
+    ShareStats *stats = share(from);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Rename(from, to);
+    record(METRIC_CALL_RENAME, stats, start, 0, ret < 0);
+    return ret;
+}
+
+int InstrumentedBackend::Rmdir(const std::string &url)
+{
+    ShareStats *stats = share(url);
+    uint64_t start = Metrics::Now();
+    int ret = _backend->Rmdir(url);
+    record(METRIC_CALL_RMDIR, stats, start, 0, ret < 0);
+    return ret;
+}
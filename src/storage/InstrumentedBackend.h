@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef INSTRUMENTED_BACKEND_H_
+#define INSTRUMENTED_BACKEND_H_
+
+#include "IStorageBackend.h"
+#include "base/Metrics.h"
+
+/*
+ * Handle returned by InstrumentedBackend, wraps the handle of the inner
+ * backend and remembers the server/share it belongs to
+ */
+class InstrumentedFile : public StorageFile
+{
+public:
+    StorageFile *_file;
+    ShareStats *_share;
+
+    InstrumentedFile(StorageFile *file, ShareStats *share) : _file(file), _share(share) {}
+};
+
+/*
+ * Storage backend decorator, times every call of the inner backend and
+ * records count, bytes, errno and latency per call and per server/share
+ * in Metrics. Calls slower than the slow call threshold are logged.
+ */
+class InstrumentedBackend : public IStorageBackend
+{
+private:
+    IStorageBackend *_backend;
+    uint64_t _slow_call;    //micro-seconds, 0 - off
+
+    InstrumentedBackend(const InstrumentedBackend &instance);
+    InstrumentedBackend &operator=(const InstrumentedBackend &instance);
+
+    static ShareStats *share(const std::string &url);
+    void record(MetricCall call, ShareStats *share, uint64_t start, uint64_t bytes, bool failed) const;
+    StorageFile *wrap(StorageFile *file, ShareStats *share);
+    StorageFile *unwrap(StorageFile *file, ShareStats *&share) const;
+
+public:
+    InstrumentedBackend(IStorageBackend *backend, long slow_call);
+    ~InstrumentedBackend();
+
+    IStorageBackend *Inner();
+
+    const char *Name() const;
+    int Init(bool kerberos);
+    int Quit();
+    std::string DefaultWorkGroup();
+    IStorageBackend *Fork();
+
+    StorageFile *Open(const std::string &url, int flags, mode_t mode);
+    ssize_t Read(StorageFile *file, void *buffer, size_t len);
+    ssize_t Write(StorageFile *file, const void *buffer, size_t len);
+    off_t Lseek(StorageFile *file, off_t offset, int whence);
+    int Fstat(StorageFile *file, struct stat *st);
+    int Close(StorageFile *file);
+    off_t Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv), void *priv);
+
+    StorageFile *OpenDir(const std::string &url);
+    struct smbc_dirent *ReadDir(StorageFile *dir);
+    const struct libsmb_file_info *ReadDirPlus(StorageFile *dir);
+    int CloseDir(StorageFile *dir);
+
+    int Stat(const std::string &url, struct stat *st);
+    int Mkdir(const std::string &url, mode_t mode);
+    int Unlink(const std::string &url);
+    int Rename(const std::string &from, const std::string &to);
+    int Rmdir(const std::string &url);
+};
+
+#endif //INSTRUMENTED_BACKEND_H_
@@ -0,0 +1,677 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "MemoryBackend.h"
+#include "base/Common.h"
+#include "base/Error.h"
+#include "base/Log.h"
+
+/*!
+ * Constructor
+ */
+MemoryBackend::MemoryBackend() : _implicit(true)
+{
+}
+
+/*!
+ * Destructor
+ */
+MemoryBackend::~MemoryBackend()
+{
+    //Destructor
+}
+
+/*!
+ * Number of components in path
+ * @param path - server/share/path
+ * @return
+ * depth
+ */
+size_t MemoryBackend::depth(const std::string &path)
+{
+    if (path.empty())
+    {
+        return 0;
+    }
+    size_t count = 1;
+    for (size_t i = 0; i < path.length(); i++)
+    {
+        if (path[i] == '/')
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::string MemoryBackend::parent(const std::string &path)
+{
+    size_t pos = path.find_last_of('/');
+    return (pos == std::string::npos) ? "" : path.substr(0, pos);
+}
+
+/*!
+ * Share of path
+ * @param path - server/share/path
+ * @return
+ * server/share
+ */
+std::string MemoryBackend::share(const std::string &path)
+{
+    size_t pos = path.find('/');
+    pos = (pos == std::string::npos) ? pos : path.find('/', pos + 1);
+    return path.substr(0, pos);
+}
+
+void MemoryBackend::fill_stat(bool directory, const MemoryData &data, struct stat *st)
+{
+    memset(st, 0, sizeof(*st));
+    st->st_mode = directory ? (S_IFDIR | 0755) : (S_IFREG | 0644);
+    st->st_nlink = 1;
+    st->st_uid = getuid();
+    st->st_gid = getgid();
+    st->st_size = data._bytes.size();
+    st->st_ctim = data._btime;
+    st->st_mtim = data._mtime;
+    st->st_atim = data._mtime;
+}
+
+/*!
+ * Lookup node, must be called with _mtx held
+ * @param path - server/share/path
+ * @return
+ * node - exists
+ * NULL - does not exist
+ */
+const MemoryNode *MemoryBackend::find(const std::string &path) const
+{
+    std::map<std::string, MemoryNode>::const_iterator iter = _nodes.find(path);
+    if (iter != _nodes.end())
+    {
+        return &iter->second;
+    }
+    return (depth(path) <= 2) ? &_implicit : NULL;
+}
+
+/*!
+ * Check parent of path is an existing directory, must be called with _mtx held
+ * @param path - server/share/path
+ * @return
+ * 0 - parent exists
+ * Otherwise - errno
+ */
+int MemoryBackend::check_parent(const std::string &path) const
+{
+    if (depth(path) <= 2)
+    {
+        return EACCES;
+    }
+    const MemoryNode *node = find(parent(path));
+    if (node == NULL)
+    {
+        return ENOENT;
+    }
+    return node->_directory ? 0 : ENOTDIR;
+}
+
+bool MemoryBackend::has_children(const std::string &path) const
+{
+    std::string prefix = path.empty() ? path : path + "/";
+    std::map<std::string, MemoryNode>::const_iterator iter = _nodes.lower_bound(prefix);
+    return iter != _nodes.end() && iter->first.compare(0, prefix.length(), prefix) == 0;
+}
+
+/*!
+ * Update mtime of parent directory once an entry was added or removed,
+ * as SMB servers do, must be called with _mtx held
+ * @param path - server/share/path of entry
+ */
+void MemoryBackend::touch_parent(const std::string &path)
+{
+    const MemoryNode *node = find(parent(path));
+    if (node != NULL && node->_directory)
+    {
+        node->_data->Touch();
+    }
+}
+
+/*!
+ * Add file, creating missing parent directories
+ * @param url - smb://server/share/path
+ * @param data - file content
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int MemoryBackend::AddFile(const std::string &url, const std::string &data)
+{
+    std::string path = Path(url);
+    if (depth(path) <= 2 || AddDirectory(parent(path)) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::map<std::string, MemoryNode>::iterator iter = _nodes.find(path);
+    if (iter != _nodes.end() && iter->second._directory)
+    {
+        return SMB_ERROR;
+    }
+    MemoryNode node(false);
+    node._data->_bytes = data;
+    _nodes[path] = node;
+    touch_parent(path);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Add directory, creating missing parent directories
+ * @param url - smb://server/share/path
+ * @return
+ * SMB_SUCCESS - successful
+ * Otherwise - failure
+ */
+int MemoryBackend::AddDirectory(const std::string &url)
+{
+    std::string path = Path(url);
+    if (depth(path) <= 2)
+    {
+        return SMB_SUCCESS;
+    }
+    if (AddDirectory(parent(path)) != SMB_SUCCESS)
+    {
+        return SMB_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::map<std::string, MemoryNode>::iterator iter = _nodes.find(path);
+    if (iter != _nodes.end())
+    {
+        return iter->second._directory ? SMB_SUCCESS : SMB_ERROR;
+    }
+    _nodes[path] = MemoryNode(true);
+    touch_parent(path);
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Remove everything
+ */
+void MemoryBackend::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _nodes.clear();
+}
+
+const char *MemoryBackend::Name() const
+{
+    return STORAGE_BACKEND_MEMORY;
+}
+
+int MemoryBackend::Init(bool kerberos)
+{
+    (void) kerberos;
+    return SMB_SUCCESS;
+}
+
+/*!
+ * Nothing to release, content is kept till the backend is destroyed
+ * @return
+ * SMB_SUCCESS - Success
+ */
+int MemoryBackend::Quit()
+{
+    return SMB_SUCCESS;
+}
+
+StorageFile *MemoryBackend::Open(const std::string &url, int flags, mode_t mode)
+{
+    (void) mode;
+    inject(0);
+    std::string path = Path(url);
+    if (!ValidPath(path))
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    const MemoryNode *found = find(path);
+    if (found != NULL && found->_directory)
+    {
+        errno = EISDIR;
+        return NULL;
+    }
+    if (found != NULL && (flags & O_CREAT) && (flags & O_EXCL))
+    {
+        errno = EEXIST;
+        return NULL;
+    }
+    if (found == NULL)
+    {
+        if (!(flags & O_CREAT))
+        {
+            errno = ENOENT;
+            return NULL;
+        }
+        int err = check_parent(path);
+        if (err != 0)
+        {
+            errno = err;
+            return NULL;
+        }
+    }
+
+    MemoryFile *file = ALLOCATE(MemoryFile);
+    if (!ALLOCATED(file))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    if (found == NULL)
+    {
+        found = &(_nodes[path] = MemoryNode(false));
+        touch_parent(path);
+    }
+    else if ((flags & O_TRUNC) && (flags & O_ACCMODE) != O_RDONLY)
+    {
+        found->_data->_bytes.clear();
+        found->_data->Touch();
+    }
+
+    file->_data = found->_data;
+    file->_flags = flags;
+    file->_offset = 0;
+    return file;
+}
+
+ssize_t MemoryBackend::Read(StorageFile *handle, void *buffer, size_t len)
+{
+    MemoryFile *file = static_cast<MemoryFile *>(handle);
+    if ((file->_flags & O_ACCMODE) == O_WRONLY)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    ssize_t ret = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        const std::string &data = file->_data->_bytes;
+        if ((size_t) file->_offset < data.size())
+        {
+            ret = MIN(len, data.size() - file->_offset);
+            memcpy(buffer, data.data() + file->_offset, ret);
+            file->_offset += ret;
+        }
+    }
+    inject(ret);
+    return ret;
+}
+
+ssize_t MemoryBackend::Write(StorageFile *handle, const void *buffer, size_t len)
+{
+    MemoryFile *file = static_cast<MemoryFile *>(handle);
+    if ((file->_flags & O_ACCMODE) == O_RDONLY)
+    {
+        errno = EBADF;
+        return -1;
+    }
+    inject(len);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::string &data = file->_data->_bytes;
+    if (file->_flags & O_APPEND)
+    {
+        file->_offset = data.size();
+    }
+    if (data.size() < (size_t) file->_offset + len)
+    {
+        data.resize(file->_offset + len);
+    }
+    data.replace(file->_offset, len, (const char *) buffer, len);
+    file->_offset += len;
+    file->_data->Touch();
+    return len;
+}
+
+off_t MemoryBackend::Lseek(StorageFile *handle, off_t offset, int whence)
+{
+    MemoryFile *file = static_cast<MemoryFile *>(handle);
+    std::lock_guard<std::mutex> lock(_mtx);
+    off_t base = 0;
+    if (whence == SEEK_CUR)
+    {
+        base = file->_offset;
+    }
+    else if (whence == SEEK_END)
+    {
+        base = file->_data->_bytes.size();
+    }
+    else if (whence != SEEK_SET)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (base + offset < 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    file->_offset = base + offset;
+    return file->_offset;
+}
+
+int MemoryBackend::Fstat(StorageFile *handle, struct stat *st)
+{
+    MemoryFile *file = static_cast<MemoryFile *>(handle);
+    std::lock_guard<std::mutex> lock(_mtx);
+    fill_stat(false, *file->_data, st);
+    return 0;
+}
+
+int MemoryBackend::Close(StorageFile *handle)
+{
+    FREE(handle);
+    return 0;
+}
+
+/*!
+ * Server side copy, one call without transfer time
+ */
+off_t MemoryBackend::Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv),
+                            void *priv)
+{
+    MemoryFile *src = static_cast<MemoryFile *>(from);
+    MemoryFile *dst = static_cast<MemoryFile *>(to);
+    if ((src->_flags & O_ACCMODE) == O_WRONLY || (dst->_flags & O_ACCMODE) == O_RDONLY || count < 0)
+    {
+        errno = EBADF;
+        return -1;
+    }
+    inject(0);
+
+    off_t copied = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        const std::string &data = src->_data->_bytes;
+        if ((size_t) src->_offset < data.size())
+        {
+            copied = MIN((size_t) count, data.size() - src->_offset);
+        }
+        if (copied > 0)
+        {
+            std::string chunk = data.substr(src->_offset, copied);
+            std::string &out = dst->_data->_bytes;
+            if (out.size() < (size_t) dst->_offset + copied)
+            {
+                out.resize(dst->_offset + copied);
+            }
+            out.replace(dst->_offset, copied, chunk);
+            src->_offset += copied;
+            dst->_offset += copied;
+            dst->_data->Touch();
+        }
+    }
+    if (progress != NULL && copied > 0 && progress(copied, priv) == 0)
+    {
+        errno = ECANCELED;
+        return -1;
+    }
+    return copied;
+}
+
+StorageFile *MemoryBackend::OpenDir(const std::string &url)
+{
+    inject(0);
+    std::string path = Path(url);
+    if (!ValidPath(path))
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    const MemoryNode *found = find(path);
+    if (found == NULL)
+    {
+        errno = ENOENT;
+        return NULL;
+    }
+    if (!found->_directory)
+    {
+        errno = ENOTDIR;
+        return NULL;
+    }
+
+    MemoryDir *dir = ALLOCATE(MemoryDir);
+    if (!ALLOCATED(dir))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    dir->_entries.push_back(std::make_pair(std::string("."), *found));
+    dir->_entries.push_back(std::make_pair(std::string(".."), _implicit));
+
+    /*
+     * direct children, plus implicit (server/share) directories of deeper nodes,
+     * descendants of a child lie in [child/, child0) as '0' follows '/'
+     */
+    std::string prefix = path.empty() ? path : path + "/";
+    std::map<std::string, MemoryNode>::const_iterator iter = _nodes.lower_bound(prefix);
+    while (iter != _nodes.end() && iter->first.compare(0, prefix.length(), prefix) == 0)
+    {
+        size_t end = iter->first.find('/', prefix.length());
+        if (end == std::string::npos)
+        {
+            dir->_entries.push_back(std::make_pair(iter->first.substr(prefix.length()), iter->second));
+            ++iter;
+            continue;
+        }
+
+        std::string name = iter->first.substr(prefix.length(), end - prefix.length());
+        if (_nodes.find(prefix + name) == _nodes.end())
+        {
+            dir->_entries.push_back(std::make_pair(name, _implicit));
+        }
+        iter = _nodes.lower_bound(prefix + name + "0");
+    }
+    return dir;
+}
+
+struct smbc_dirent *MemoryBackend::ReadDir(StorageFile *handle)
+{
+    MemoryDir *dir = static_cast<MemoryDir *>(handle);
+    if (dir->_index >= dir->_entries.size())
+    {
+        return NULL;
+    }
+    const std::pair<std::string, MemoryNode> &entry = dir->_entries[dir->_index++];
+    return dir->SetDirent(entry.first, entry.second._directory ? SMBC_DIR : SMBC_FILE);
+}
+
+const struct libsmb_file_info *MemoryBackend::ReadDirPlus(StorageFile *handle)
+{
+    MemoryDir *dir = static_cast<MemoryDir *>(handle);
+    if (dir->_index >= dir->_entries.size())
+    {
+        return NULL;
+    }
+    const std::pair<std::string, MemoryNode> &entry = dir->_entries[dir->_index++];
+    struct stat st;
+    fill_stat(entry.second._directory, *entry.second._data, &st);
+    return dir->SetFileInfo(entry.first, st);
+}
+
+int MemoryBackend::CloseDir(StorageFile *handle)
+{
+    FREE(handle);
+    return 0;
+}
+
+int MemoryBackend::Stat(const std::string &url, struct stat *st)
+{
+    inject(0);
+    std::string path = Path(url);
+    std::lock_guard<std::mutex> lock(_mtx);
+    const MemoryNode *found = ValidPath(path) ? find(path) : NULL;
+    if (found == NULL)
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    fill_stat(found->_directory, *found->_data, st);
+    return 0;
+}
+
+int MemoryBackend::Mkdir(const std::string &url, mode_t mode)
+{
+    (void) mode;
+    inject(0);
+    std::string path = Path(url);
+    if (!ValidPath(path))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (find(path) != NULL)
+    {
+        errno = EEXIST;
+        return -1;
+    }
+    int err = check_parent(path);
+    if (err != 0)
+    {
+        errno = err;
+        return -1;
+    }
+
+    _nodes[path] = MemoryNode(true);
+    touch_parent(path);
+    return 0;
+}
+
+int MemoryBackend::Unlink(const std::string &url)
+{
+    inject(0);
+    std::string path = Path(url);
+    std::lock_guard<std::mutex> lock(_mtx);
+    const MemoryNode *found = ValidPath(path) ? find(path) : NULL;
+    if (found == NULL)
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    if (found->_directory)
+    {
+        errno = EISDIR;
+        return -1;
+    }
+    _nodes.erase(path);
+    touch_parent(path);
+    return 0;
+}
+
+int MemoryBackend::Rename(const std::string &from, const std::string &to)
+{
+    inject(0);
+    std::string src = Path(from);
+    std::string dst = Path(to);
+    if (!ValidPath(src) || !ValidPath(dst) || dst.compare(0, src.length() + 1, src + "/") == 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::map<std::string, MemoryNode>::iterator iter = _nodes.find(src);
+    if (iter == _nodes.end())
+    {
+        errno = (depth(src) <= 2) ? EACCES : ENOENT;
+        return -1;
+    }
+    if (src == dst)
+    {
+        return 0;
+    }
+    if (share(src) != share(dst))
+    {
+        /* like SMB, rename does not cross shares */
+        errno = EXDEV;
+        return -1;
+    }
+    int err = check_parent(dst);
+    if (err != 0)
+    {
+        errno = err;
+        return -1;
+    }
+
+    const MemoryNode *target = find(dst);
+    if (target != NULL)
+    {
+        if (target->_directory != iter->second._directory)
+        {
+            errno = target->_directory ? EISDIR : ENOTDIR;
+            return -1;
+        }
+        if (target->_directory && has_children(dst))
+        {
+            errno = ENOTEMPTY;
+            return -1;
+        }
+    }
+
+    _nodes[dst] = iter->second;
+    _nodes.erase(iter);
+
+    /* move descendants */
+    std::string prefix = src + "/";
+    iter = _nodes.lower_bound(prefix);
+    while (iter != _nodes.end() && iter->first.compare(0, prefix.length(), prefix) == 0)
+    {
+        _nodes[dst + iter->first.substr(src.length())] = iter->second;
+        iter = _nodes.erase(iter);
+    }
+    touch_parent(src);
+    touch_parent(dst);
+    return 0;
+}
+
+int MemoryBackend::Rmdir(const std::string &url)
+{
+    inject(0);
+    std::string path = Path(url);
+    std::lock_guard<std::mutex> lock(_mtx);
+    const MemoryNode *found = ValidPath(path) ? find(path) : NULL;
+    if (found == NULL)
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    if (!found->_directory)
+    {
+        errno = ENOTDIR;
+        return -1;
+    }
+    if (has_children(path))
+    {
+        errno = ENOTEMPTY;
+        return -1;
+    }
+    if (depth(path) <= 2)
+    {
+        errno = EACCES;
+        return -1;
+    }
+    _nodes.erase(path);
+    touch_parent(path);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef MEMORY_BACKEND_H_
+#define MEMORY_BACKEND_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <time.h>
+#include <vector>
+
+#include "IStorageBackend.h"
+
+/*
+ * Content and times of a file or directory, shared with open handles
+ */
+struct MemoryData
+{
+    std::string _bytes;
+    struct timespec _btime;
+    struct timespec _mtime;
+
+    MemoryData()
+    {
+        clock_gettime(CLOCK_REALTIME, &_btime);
+        _mtime = _btime;
+    }
+
+    void Touch()
+    {
+        clock_gettime(CLOCK_REALTIME, &_mtime);
+    }
+};
+
+/*
+ * File or directory kept in memory
+ */
+struct MemoryNode
+{
+    bool _directory;
+    std::shared_ptr<MemoryData> _data;
+
+    MemoryNode() : _directory(false) {}
+    MemoryNode(bool directory) : _directory(directory), _data(std::make_shared<MemoryData>()) {}
+};
+
+/*
+ * Open file handle
+ */
+class MemoryFile : public StorageFile
+{
+public:
+    std::shared_ptr<MemoryData> _data;
+    int _flags;
+    off_t _offset;
+
+    MemoryFile() : _flags(0), _offset(0) {}
+};
+
+/*
+ * Open directory handle, entries are a snapshot taken at OpenDir
+ */
+class MemoryDir : public StorageDir
+{
+public:
+    std::vector<std::pair<std::string, MemoryNode> > _entries;
+    size_t _index;
+
+    MemoryDir() : _index(0) {}
+};
+
+/*
+ * Storage backend keeping the whole tree in memory.
+ * Servers and shares (first two path components) always exist,
+ * used to run smb-connector without SMB server (tests, benchmarks).
+ */
+class MemoryBackend : public IStorageBackend
+{
+private:
+    std::map<std::string, MemoryNode> _nodes;
+    MemoryNode _implicit;   //servers and shares
+    std::mutex _mtx;
+
+    static size_t depth(const std::string &path);
+    static std::string parent(const std::string &path);
+    static std::string share(const std::string &path);
+    static void fill_stat(bool directory, const MemoryData &data, struct stat *st);
+
+    const MemoryNode *find(const std::string &path) const;
+    int check_parent(const std::string &path) const;
+    bool has_children(const std::string &path) const;
+    void touch_parent(const std::string &path);
+
+public:
+    MemoryBackend();
+    ~MemoryBackend();
+
+    int AddFile(const std::string &url, const std::string &data);
+    int AddDirectory(const std::string &url);
+    void Clear();
+
+    const char *Name() const;
+    int Init(bool kerberos);
+    int Quit();
+
+    StorageFile *Open(const std::string &url, int flags, mode_t mode);
+    ssize_t Read(StorageFile *file, void *buffer, size_t len);
+    ssize_t Write(StorageFile *file, const void *buffer, size_t len);
+    off_t Lseek(StorageFile *file, off_t offset, int whence);
+    int Fstat(StorageFile *file, struct stat *st);
+    int Close(StorageFile *file);
+    off_t Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv), void *priv);
+
+    StorageFile *OpenDir(const std::string &url);
+    struct smbc_dirent *ReadDir(StorageFile *dir);
+    const struct libsmb_file_info *ReadDirPlus(StorageFile *dir);
+    int CloseDir(StorageFile *dir);
+
+    int Stat(const std::string &url, struct stat *st);
+    int Mkdir(const std::string &url, mode_t mode);
+    int Unlink(const std::string &url);
+    int Rename(const std::string &from, const std::string &to);
+    int Rmdir(const std::string &url);
+};
+
+#endif //MEMORY_BACKEND_H_
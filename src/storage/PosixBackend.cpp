@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#include "PosixBackend.h"
+#include "base/Common.h"
+#include "base/Error.h"
+#include "base/Log.h"
+
+/*!
+ * Constructor
+ * @param root - local directory holding the servers
+ */
+PosixBackend::PosixBackend(const std::string &root) : _root(root)
+{
+}
+
+/*!
+ * Destructor
+ */
+PosixBackend::~PosixBackend()
+{
+    //Destructor
+}
+
+/*!
+ * Map url to local path
+ * @param url - smb://server/share/path
+ * @param path - <root>/server/share/path (out)
+ * @return
+ * true - successful
+ * false - url escapes root, errno set
+ */
+bool PosixBackend::local_path(const std::string &url, std::string &path) const
+{
+    std::string relative = Path(url);
+    if (!ValidPath(relative))
+    {
+        errno = EINVAL;
+        return false;
+    }
+    path = relative.empty() ? _root : _root + "/" + relative;
+    return true;
+}
+
+const char *PosixBackend::Name() const
+{
+    return STORAGE_BACKEND_POSIX;
+}
+
+/*!
+ * Create root directory
+ * @param kerberos - unused
+ * @return
+ * SMB_SUCCESS - Successful
+ * Otherwise - failure
+ */
+int PosixBackend::Init(bool kerberos)
+{
+    (void) kerberos;
+    std::string path;
+    for (size_t pos = _root.find('/', 1); ; pos = _root.find('/', pos + 1))
+    {
+        path = _root.substr(0, pos);
+        if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            ERROR_LOG("PosixBackend::Init creating %s failed, error: %s", path.c_str(), strerror(errno));
+            return SMB_INIT_FAILED;
+        }
+        if (pos == std::string::npos)
+        {
+            break;
+        }
+    }
+    return SMB_SUCCESS;
+}
+
+int PosixBackend::Quit()
+{
+    return SMB_SUCCESS;
+}
+
+StorageFile *PosixBackend::Open(const std::string &url, int flags, mode_t mode)
+{
+    inject(0);
+    std::string path;
+    if (!local_path(url, path))
+    {
+        return NULL;
+    }
+
+    int fd = open(path.c_str(), flags | O_CLOEXEC, mode ? mode : 0644);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISDIR(st.st_mode))
+    {
+        close(fd);
+        errno = EISDIR;
+        return NULL;
+    }
+
+    PosixFile *file = ALLOCATE(PosixFile, fd);
+    if (!ALLOCATED(file))
+    {
+        close(fd);
+        errno = ENOMEM;
+        return NULL;
+    }
+    return file;
+}
+
+ssize_t PosixBackend::Read(StorageFile *file, void *buffer, size_t len)
+{
+    ssize_t ret = read(static_cast<PosixFile *>(file)->_fd, buffer, len);
+    inject(ret > 0 ? ret : 0);
+    return ret;
+}
+
+ssize_t PosixBackend::Write(StorageFile *file, const void *buffer, size_t len)
+{
+    inject(len);
+    return write(static_cast<PosixFile *>(file)->_fd, buffer, len);
+}
+
+off_t PosixBackend::Lseek(StorageFile *file, off_t offset, int whence)
+{
+    return lseek(static_cast<PosixFile *>(file)->_fd, offset, whence);
+}
+
+int PosixBackend::Fstat(StorageFile *file, struct stat *st)
+{
+    return fstat(static_cast<PosixFile *>(file)->_fd, st);
+}
+
+int PosixBackend::Close(StorageFile *file)
+{
+    int ret = close(static_cast<PosixFile *>(file)->_fd);
+    FREE(file);
+    return ret;
+}
+
+StorageFile *PosixBackend::OpenDir(const std::string &url)
+{
+    inject(0);
+    std::string path;
+    if (!local_path(url, path))
+    {
+        return NULL;
+    }
+
+    DIR *stream = opendir(path.c_str());
+    if (stream == NULL)
+    {
+        return NULL;
+    }
+
+    PosixDir *dir = ALLOCATE(PosixDir, stream);
+    if (!ALLOCATED(dir))
+    {
+        closedir(stream);
+        errno = ENOMEM;
+        return NULL;
+    }
+    return dir;
+}
+
+/*!
+ * Next entry of directory with its attributes, entries
+ * which disappear while listing are skipped
+ * @param dir - directory
+ * @param st - attributes (out)
+ * @return
+ * entry - successful
+ * NULL - end of directory
+ */
+struct dirent *PosixBackend::next_entry(PosixDir *dir, struct stat &st)
+{
+    struct dirent *entry;
+    while ((entry = readdir(dir->_dir)) != NULL)
+    {
+        if (fstatat(dirfd(dir->_dir), entry->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+struct smbc_dirent *PosixBackend::ReadDir(StorageFile *handle)
+{
+    PosixDir *dir = static_cast<PosixDir *>(handle);
+    struct stat st;
+    struct dirent *entry = next_entry(dir, st);
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+    return dir->SetDirent(entry->d_name, S_ISDIR(st.st_mode) ? SMBC_DIR : SMBC_FILE);
+}
+
+const struct libsmb_file_info *PosixBackend::ReadDirPlus(StorageFile *handle)
+{
+    PosixDir *dir = static_cast<PosixDir *>(handle);
+    struct stat st;
+    struct dirent *entry = next_entry(dir, st);
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+    return dir->SetFileInfo(entry->d_name, st);
+}
+
+int PosixBackend::CloseDir(StorageFile *handle)
+{
+    int ret = closedir(static_cast<PosixDir *>(handle)->_dir);
+    FREE(handle);
+    return ret;
+}
+
+int PosixBackend::Stat(const std::string &url, struct stat *st)
+{
+    inject(0);
+    std::string path;
+    return local_path(url, path) ? stat(path.c_str(), st) : -1;
+}
+
+int PosixBackend::Mkdir(const std::string &url, mode_t mode)
+{
+    inject(0);
+    std::string path;
+    return local_path(url, path) ? mkdir(path.c_str(), mode ? mode : 0755) : -1;
+}
+
+int PosixBackend::Unlink(const std::string &url)
+{
+    inject(0);
+    std::string path;
+    return local_path(url, path) ? unlink(path.c_str()) : -1;
+}
+
+int PosixBackend::Rename(const std::string &from, const std::string &to)
+{
+    inject(0);
+    std::string src, dst;
+    if (!local_path(from, src) || !local_path(to, dst))
+    {
+        return -1;
+    }
+    return rename(src.c_str(), dst.c_str());
+}
+
+int PosixBackend::Rmdir(const std::string &url)
+{
+    inject(0);
+    std::string path;
+    return local_path(url, path) ? rmdir(path.c_str()) : -1;
+}
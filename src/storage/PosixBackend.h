@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef POSIX_BACKEND_H_
+#define POSIX_BACKEND_H_
+
+#include <dirent.h>
+
+#include "IStorageBackend.h"
+
+/*
+ * Open file descriptor
+ */
+class PosixFile : public StorageFile
+{
+public:
+    int _fd;
+
+    PosixFile(int fd) : _fd(fd) {}
+};
+
+/*
+ * Open directory stream
+ */
+class PosixDir : public StorageDir
+{
+public:
+    DIR *_dir;
+
+    PosixDir(DIR *dir) : _dir(dir) {}
+};
+
+/*
+ * Storage backend mapping smb://server/share/path to
+ * <root>/server/share/path on the local file-system
+ */
+class PosixBackend : public IStorageBackend
+{
+private:
+    std::string _root;
+
+    PosixBackend(const PosixBackend &instance);
+    PosixBackend &operator=(const PosixBackend &instance);
+
+    bool local_path(const std::string &url, std::string &path) const;
+    struct dirent *next_entry(PosixDir *dir, struct stat &st);
+
+public:
+    PosixBackend(const std::string &root);
+    ~PosixBackend();
+
+    const char *Name() const;
+    int Init(bool kerberos);
+    int Quit();
+
+    StorageFile *Open(const std::string &url, int flags, mode_t mode);
+    ssize_t Read(StorageFile *file, void *buffer, size_t len);
+    ssize_t Write(StorageFile *file, const void *buffer, size_t len);
+    off_t Lseek(StorageFile *file, off_t offset, int whence);
+    int Fstat(StorageFile *file, struct stat *st);
+    int Close(StorageFile *file);
+
+    StorageFile *OpenDir(const std::string &url);
+    struct smbc_dirent *ReadDir(StorageFile *dir);
+    const struct libsmb_file_info *ReadDirPlus(StorageFile *dir);
+    int CloseDir(StorageFile *dir);
+
+    int Stat(const std::string &url, struct stat *st);
+    int Mkdir(const std::string &url, mode_t mode);
+    int Unlink(const std::string &url);
+    int Rename(const std::string &from, const std::string &to);
+    int Rmdir(const std::string &url);
+};
+
+#endif //POSIX_BACKEND_H_
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <regex>
+#include "base/AsyncLogger.h"
+#include "base/Error.h"
+
+static std::string log_file = "/tmp/smbconnector_async_log_test.log";
+
+static int count_lines(const std::string &file_name, const char *pattern)
+{
+    std::ifstream file(file_name);
+    std::string line;
+    int count = 0;
+    while (std::getline(file, line))
+    {
+        if (line.find(pattern) != std::string::npos)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void cleanup()
+{
+    unlink(log_file.c_str());
+    for (int i = 1; i <= 3; i++)
+    {
+        unlink((log_file + "." + std::to_string(i)).c_str());
+    }
+}
+
+static void write_line(AsyncLogger *logger, const char *format, ...)
+{
+    va_list arg;
+    va_start(arg, format);
+    logger->Write("INFO", format, arg);
+    va_end(arg);
+}
+
+TEST(AsyncLogger, NotRunning)
+{
+    AsyncLogger logger;
+    write_line(&logger, "dropped %d", 1);
+    logger.Write("INFO", "dropped");
+    EXPECT_EQ(2u, logger.Dropped());
+}
+
+TEST(AsyncLogger, WriteAndFlush)
+{
+    cleanup();
+    AsyncLogger logger;
+    EXPECT_EQ(SMB_SUCCESS, logger.Init(log_file.c_str(), 0, 0, false));
+    write_line(&logger, "async test %d %s", 1, "hello");
+    logger.Write("WARN", "async smbclient msg\n");
+    logger.Flush();
+    EXPECT_EQ(1, count_lines(log_file, "INFO: async test 1 hello"));
+    EXPECT_EQ(1, count_lines(log_file, "WARN: async smbclient msg"));
+    EXPECT_EQ(SMB_SUCCESS, logger.Quit());
+    EXPECT_EQ(0u, logger.Dropped());
+    cleanup();
+}
+
+TEST(AsyncLogger, ConsoleLayout)
+{
+    cleanup();
+    std::string console_file = log_file + ".console";
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int fd = open(console_file.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    dup2(fd, STDOUT_FILENO);
+    close(fd);
+
+    AsyncLogger logger;
+    EXPECT_EQ(SMB_SUCCESS, logger.Init(log_file.c_str(), 0, 0, true));
+    write_line(&logger, "console line %d", 1);
+    logger.Flush();
+    EXPECT_EQ(SMB_SUCCESS, logger.Quit());
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    /* "%5r %t %5p" on console, date and time in the file */
+    std::ifstream file(console_file);
+    std::string line;
+    ASSERT_TRUE((bool) std::getline(file, line));
+    EXPECT_TRUE(std::regex_match(line, std::regex("\\[ID_NOT_SET\\] +[0-9]+ [0-9]+  INFO: console line 1")));
+    EXPECT_EQ(1, count_lines(log_file, "INFO: console line 1"));
+    EXPECT_EQ(1, count_lines(log_file, "-"));
+    unlink(console_file.c_str());
+    cleanup();
+}
+
+TEST(AsyncLogger, MultiThreaded)
+{
+    cleanup();
+    AsyncLogger logger;
+    EXPECT_EQ(SMB_SUCCESS, logger.Init(log_file.c_str(), 0, 0, false));
+
+    const int threads = 4;
+    const int lines = 2 * ASYNC_LOG_RING_SIZE;
+    std::vector<std::thread *> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.push_back(new std::thread([&logger, lines]()
+                                          {
+                                              for (int i = 0; i < lines; i++)
+                                              {
+                                                  write_line(&logger, "multi thread line %d", i);
+                                              }
+                                          }));
+    }
+    for (int t = 0; t < threads; t++)
+    {
+        workers[t]->join();
+        delete workers[t];
+    }
+    logger.Quit();
+
+    /* every line is either written or accounted as dropped */
+    EXPECT_EQ((unsigned long) threads * lines,
+              (unsigned long) count_lines(log_file, "multi thread line") + logger.Dropped());
+    if (logger.Dropped() > 0)
+    {
+        EXPECT_GE(count_lines(log_file, "log lines"), 1);
+    }
+    cleanup();
+}
+
+TEST(AsyncLogger, Rotation)
+{
+    cleanup();
+    AsyncLogger logger;
+    EXPECT_EQ(SMB_SUCCESS, logger.Init(log_file.c_str(), 1024, 2, false));
+    for (int i = 0; i < 200; i++)
+    {
+        write_line(&logger, "rotation line %d", i);
+        if (i % 10 == 0)
+        {
+            logger.Flush();
+        }
+    }
+    logger.Quit();
+
+    struct stat st;
+    EXPECT_EQ(0, stat(log_file.c_str(), &st));
+    EXPECT_EQ(0, stat((log_file + ".1").c_str(), &st));
+    EXPECT_EQ(0, stat((log_file + ".2").c_str(), &st));
+    EXPECT_NE(0, stat((log_file + ".3").c_str(), &st));
+    cleanup();
+}
+
+#endif //_DEBUG_
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <map>
+
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Protocol.h"
+#include "processor/BatchStatProcessor.h"
+#include "storage/MemoryBackend.h"
+#include "ProcessorHarness.h"
+
+/* stats paths relative to srv/share/base, returns entries by index and number of result pages */
+static std::map<uint32_t, BatchStatEntry> batch_stat(ProcessorHarness &harness, const std::vector<std::string> &paths,
+                                                      size_t &pages)
+{
+    std::map<uint32_t, BatchStatEntry> entries;
+    BatchStatProcessor *processor = ALLOCATE(BatchStatProcessor);
+    processor->SetPaths(paths);
+    EXPECT_EQ(SMB_SUCCESS, harness.Start(processor, "srv/share/base", BATCH_STAT_REQ));
+
+    pages = 0;
+    Packet *packet;
+    while ((packet = harness.PopResponse(true)) != NULL)
+    {
+        int cmd = packet->GetCMD();
+        if (cmd == BATCH_STAT_RESP)
+        {
+            const BatchStatResponse &resp = packet->_pb_msg->responsepacket().batchstatresponse();
+            for (int j = 0; j < resp.entries_size(); j++)
+            {
+                EXPECT_EQ(0u, entries.count(resp.entries(j).index()));
+                entries[resp.entries(j).index()] = resp.entries(j);
+            }
+            pages++;
+        }
+        FREE(packet);
+        if (cmd != BATCH_STAT_RESP)
+        {
+            EXPECT_EQ(BATCH_STAT_END_RESP, cmd);
+            break;
+        }
+    }
+
+    harness.Finish(processor);
+    return entries;
+}
+
+TEST(BatchStat, Paths)
+{
+    ProcessorHarness harness;
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    ASSERT_EQ(SMB_SUCCESS, harness.Init(backend));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/base/a.txt", "abc"));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/base/d/b", "12345"));
+
+    std::vector<std::string> paths = {"a.txt", "/d", "d/b", "missing", "../escape", ""};
+    size_t pages;
+    std::map<uint32_t, BatchStatEntry> entries = batch_stat(harness, paths, pages);
+    ASSERT_EQ(paths.size(), entries.size());
+    EXPECT_EQ(0, entries[0].code());
+    EXPECT_EQ("a.txt", entries[0].fileinformation().name());
+    EXPECT_EQ(3u, entries[0].fileinformation().size());
+    EXPECT_FALSE(entries[0].fileinformation().isdirectory());
+    EXPECT_EQ(0, entries[1].code());
+    EXPECT_TRUE(entries[1].fileinformation().isdirectory());
+    EXPECT_EQ(5u, entries[2].fileinformation().size());
+    EXPECT_EQ(ENOENT, entries[3].code());
+    EXPECT_FALSE(entries[3].has_fileinformation());
+    EXPECT_EQ(EINVAL, entries[4].code());
+    EXPECT_TRUE(entries[5].fileinformation().isdirectory());
+
+    /* more paths than a page, stat'ed by several workers */
+    paths.assign(BATCH_STAT_PAGE + 44, "d/b");
+    paths[BATCH_STAT_PAGE] = "a.txt";
+    entries = batch_stat(harness, paths, pages);
+    ASSERT_EQ(paths.size(), entries.size());
+    EXPECT_GE(pages, 2u);
+    EXPECT_EQ(3u, entries[BATCH_STAT_PAGE].fileinformation().size());
+    EXPECT_EQ(5u, entries[BATCH_STAT_PAGE + 43].fileinformation().size());
+
+    /* no paths, end of results only */
+    entries = batch_stat(harness, std::vector<std::string>(), pages);
+    EXPECT_TRUE(entries.empty());
+    EXPECT_EQ(0u, pages);
+
+    EXPECT_EQ(SMB_SUCCESS, harness.Quit());
+}
+
+#endif //_DEBUG_
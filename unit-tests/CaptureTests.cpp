@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "base/Error.h"
+#include "base/Protocol.h"
+#include "core/Capture.h"
+
+static std::string capture_path = "/tmp/smbconnector_capture_test.smbcap";
+
+/* packet as received from a client, upload data is parsed aliased */
+static Packet *inbound(const Message &msg)
+{
+    Packet *packet = ALLOCATE(Packet);
+    packet->_pb_msg = ALLOCATE(Message, msg);
+    packet->PutHeader();
+    packet->PutData();
+    FREE(packet->_pb_msg);
+    packet->ParseProtoBuffer();
+    return packet;
+}
+
+/* packet as sent to a client */
+static Packet *outbound(const Message &msg)
+{
+    Packet *packet = ALLOCATE(Packet);
+    packet->_pb_msg = ALLOCATE(Message, msg);
+    packet->PutHeader();
+    return packet;
+}
+
+static void capture_upload(int data_mode, std::vector<CaptureRecord *> &records)
+{
+    Message init, data, resp;
+    init.mutable_command()->set_requestid("1");
+    init.mutable_command()->set_cmd(UPLOAD_INIT_REQ);
+    SmbDetails *details = init.mutable_requestpacket()->mutable_smbdetails();
+    details->set_workgroup("WORKGROUP");
+    details->set_username("user");
+    details->set_password("secret");
+    details->set_url("smb://server/share/file");
+    data.mutable_command()->set_requestid("1");
+    data.mutable_command()->set_cmd(UPLOAD_DATA_REQ);
+    data.mutable_requestpacket()->mutable_uploadrequestdata()->set_data("0123456789");
+    resp.mutable_command()->set_requestid("1");
+    resp.mutable_command()->set_cmd(UPLOAD_INIT_RESP);
+
+    Capture &capture = Capture::GetInstance();
+    ASSERT_EQ(SMB_SUCCESS, capture.Open(capture_path, data_mode));
+    capture.BeginSession();
+
+    Packet *packet = inbound(init);
+    capture.Inbound(packet);
+    /* message handed to the processor is unchanged */
+    EXPECT_EQ("secret", packet->_pb_msg->requestpacket().smbdetails().password());
+    FREE(packet);
+
+    packet = outbound(resp);
+    capture.Outbound(packet);
+    FREE(packet);
+
+    packet = inbound(data);
+    capture.Inbound(packet);
+    EXPECT_EQ(10u, packet->_payload_len);
+    FREE(packet);
+
+    capture.EndSession();
+    capture.Quit();
+    EXPECT_FALSE(Capture::Enabled());
+
+    ASSERT_EQ(SMB_SUCCESS, Capture::Read(capture_path, records));
+    unlink(capture_path.c_str());
+}
+
+static void free_records(std::vector<CaptureRecord *> &records)
+{
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        FREE(records[i]);
+    }
+    records.clear();
+}
+
+TEST(Capture, RecordsSessionRedacted)
+{
+    std::vector<CaptureRecord *> records;
+    capture_upload(CAPTURE_DATA_HASH, records);
+    ASSERT_EQ(5u, records.size());
+
+    EXPECT_EQ(CAPTURE_SESSION_BEGIN, records[0]->_header.type);
+    EXPECT_EQ(CAPTURE_INBOUND, records[1]->_header.type);
+    EXPECT_EQ(CAPTURE_OUTBOUND, records[2]->_header.type);
+    EXPECT_EQ(CAPTURE_INBOUND, records[3]->_header.type);
+    EXPECT_EQ(CAPTURE_SESSION_END, records[4]->_header.type);
+    for (size_t i = 1; i < records.size(); i++)
+    {
+        EXPECT_EQ(records[0]->_header.session, records[i]->_header.session);
+        EXPECT_GE(records[i]->_header.timestamp, records[i - 1]->_header.timestamp);
+    }
+
+    const Message &init = records[1]->_msg;
+    EXPECT_EQ(UPLOAD_INIT_REQ, (int) init.command().cmd());
+    EXPECT_EQ(CAPTURE_REDACTED, init.requestpacket().smbdetails().password());
+    EXPECT_EQ("smb://server/share/file", init.requestpacket().smbdetails().url());
+    EXPECT_EQ(UPLOAD_INIT_RESP, (int) records[2]->_msg.command().cmd());
+
+    const CaptureRecord *data = records[3];
+    EXPECT_EQ(10u, data->_header.data_len);
+    EXPECT_EQ(Capture::Hash("0123456789", 10), data->_header.data_hash);
+    EXPECT_TRUE(data->_msg.requestpacket().uploadrequestdata().data().empty());
+    free_records(records);
+}
+
+TEST(Capture, FullDataMode)
+{
+    std::vector<CaptureRecord *> records;
+    capture_upload(CAPTURE_DATA_FULL, records);
+    ASSERT_EQ(5u, records.size());
+    EXPECT_EQ("0123456789", records[3]->_msg.requestpacket().uploadrequestdata().data());
+    EXPECT_EQ(0u, records[3]->_header.data_hash);
+    free_records(records);
+}
+
+TEST(Capture, ReadRejectsOtherFiles)
+{
+    std::vector<CaptureRecord *> records;
+    EXPECT_NE(SMB_SUCCESS, Capture::Read("/tmp/smbconnector_capture_missing.smbcap", records));
+    FILE *file = fopen(capture_path.c_str(), "wb");
+    fputs("not a capture", file);
+    fclose(file);
+    EXPECT_NE(SMB_SUCCESS, Capture::Read(capture_path, records));
+    EXPECT_TRUE(records.empty());
+    unlink(capture_path.c_str());
+}
+
+#endif
@@ -30,4 +30,32 @@ TEST(Configuration, ALLTests)
     c.Set("test", (const char*)NULL);
 }
 
+TEST(Configuration, Snapshot)
+{
+    Configuration &c = Configuration::GetInstance();
+    c.Reset();
+
+    const ConfigSnapshot &defaults = c.Snapshot();
+    EXPECT_EQ(atoi(DEFAULT_OP_MODE), defaults.op_mode);
+    EXPECT_EQ(atoi(DEFAULT_UNIX_SOCK_BUFFER), defaults.unix_sock_buffer);
+    EXPECT_EQ((unsigned int) atoi(DEFAULT_BUFFER_SIZE), defaults.buffer_size);
+    EXPECT_TRUE(defaults.show_hidden_files);
+    EXPECT_FALSE(defaults.is_kerberos);
+    EXPECT_EQ(std::string(DEFAULT_SOCK_NAME), defaults.sock_name);
+
+    c.Set(C_OP_MODE, 0);
+    c.Set(C_IS_KERBEROS, 1);
+    c.Set(C_URL, "smb://example.com/share");
+    EXPECT_EQ(0, c.Snapshot().op_mode);
+    EXPECT_TRUE(c.Snapshot().is_kerberos);
+    EXPECT_EQ(std::string("smb://example.com/share"), c.Snapshot().url);
+
+    /* previously published snapshot stays valid and unchanged */
+    EXPECT_EQ(atoi(DEFAULT_OP_MODE), defaults.op_mode);
+    EXPECT_FALSE(defaults.is_kerberos);
+
+    c.Reset();
+    EXPECT_EQ(atoi(DEFAULT_OP_MODE), c.Snapshot().op_mode);
+}
+
 #endif //_DEBUG_
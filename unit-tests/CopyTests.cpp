@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Protocol.h"
+#include "processor/CopyProcessor.h"
+#include "storage/MemoryBackend.h"
+#include "ProcessorHarness.h"
+
+/* memory backend without server side copy */
+class NoSpliceBackend : public MemoryBackend
+{
+public:
+    off_t Splice(StorageFile *from, StorageFile *to, off_t count, int (*progress)(off_t bytes, void *priv), void *priv)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+};
+
+/* outcome of a copy/move request */
+struct CopyOutcome
+{
+    int _cmd;               //last response
+    int _code;              //status code of error response
+    size_t _progress;       //progress responses
+    uint64_t _bytes;        //bytes of last progress
+    CopyResponse _resp;
+};
+
+/* copies/moves url to destination, returns the responses sent */
+static CopyOutcome copy(ProcessorHarness &harness, bool move, const std::string &url, const std::string &destination,
+                        bool overwrite, bool progress)
+{
+    CopyOutcome outcome;
+    outcome._cmd = 0;
+    outcome._code = 0;
+    outcome._progress = 0;
+    outcome._bytes = 0;
+
+    CopyProcessor *processor = ALLOCATE(CopyProcessor, move);
+    processor->SetDestination(destination);
+    processor->SetOverwrite(overwrite);
+    processor->SetProgress(progress);
+    harness.Start(processor, url, move ? MOVE_REQ : COPY_REQ);
+
+    Packet *packet;
+    while ((packet = harness.PopResponse()) != NULL)
+    {
+        outcome._cmd = packet->GetCMD();
+        if (outcome._cmd == processor->Command(COPY_PROGRESS_RESP))
+        {
+            const CopyProgressResponse &resp = packet->_pb_msg->responsepacket().copyprogressresponse();
+            EXPECT_GE(resp.bytes(), outcome._bytes);
+            outcome._bytes = resp.bytes();
+            outcome._progress++;
+        }
+        else if (outcome._cmd == processor->Command(COPY_RESP))
+        {
+            outcome._resp = packet->_pb_msg->responsepacket().copyresponse();
+        }
+        else if (outcome._cmd == processor->Command(COPY_ERROR_RESP))
+        {
+            outcome._code = packet->_pb_msg->status().code();
+        }
+        FREE(packet);
+    }
+
+    harness.Finish(processor);
+    return outcome;
+}
+
+/* content of file, "<missing>" when it can not be opened */
+static std::string content(IStorageBackend *backend, const std::string &url)
+{
+    StorageFile *file = backend->Open(url, O_RDONLY, 0);
+    if (file == NULL)
+    {
+        return "<missing>";
+    }
+    std::string data;
+    char buffer[4096];
+    ssize_t len;
+    while ((len = backend->Read(file, buffer, sizeof(buffer))) > 0)
+    {
+        data.append(buffer, len);
+    }
+    backend->Close(file);
+    return data;
+}
+
+/* entries of directory */
+static size_t entries(IStorageBackend *backend, const std::string &url)
+{
+    StorageFile *dir = backend->OpenDir(url);
+    if (dir == NULL)
+    {
+        return 0;
+    }
+    size_t count = 0;
+    struct smbc_dirent *dirent;
+    while ((dirent = backend->ReadDir(dir)) != NULL)
+    {
+        if (strcmp(dirent->name, ".") != 0 && strcmp(dirent->name, "..") != 0)
+        {
+            count++;
+        }
+    }
+    backend->CloseDir(dir);
+    return count;
+}
+
+TEST(Copy, ServerSide)
+{
+    ProcessorHarness harness;
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    ASSERT_EQ(SMB_SUCCESS, harness.Init(backend));
+    std::string data(3 * COPY_CHUNK_SIZE + 17, 'x');
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/a.bin", data));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/d/keep", "1"));
+
+    CopyOutcome outcome = copy(harness, false, "srv/share/a.bin", "srv/share/d/b.bin", false, false);
+    ASSERT_EQ(COPY_RESP, outcome._cmd);
+    EXPECT_TRUE(outcome._resp.serverside());
+    EXPECT_EQ(data.size(), outcome._resp.fileinformation().size());
+    EXPECT_EQ("srv/share/d/b.bin", outcome._resp.fileinformation().name());
+    EXPECT_EQ(0u, outcome._progress);
+    EXPECT_EQ(data, content(backend, "smb://srv/share/d/b.bin"));
+    EXPECT_EQ(data, content(backend, "smb://srv/share/a.bin"));
+    EXPECT_EQ(2u, entries(backend, "smb://srv/share/d"));
+
+    /* empty file */
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/empty", ""));
+    outcome = copy(harness, false, "srv/share/empty", "srv/share/d/empty", false, false);
+    ASSERT_EQ(COPY_RESP, outcome._cmd);
+    EXPECT_EQ("", content(backend, "smb://srv/share/d/empty"));
+
+    EXPECT_EQ(SMB_SUCCESS, harness.Quit());
+}
+
+TEST(Copy, Pipeline)
+{
+    Configuration &c = Configuration::GetInstance();
+    c.Set(C_COPY_PROGRESS_TIME, "1");
+    ProcessorHarness harness;
+    MemoryBackend *backend = ALLOCATE(NoSpliceBackend);
+    backend->SetLatency(100);
+    ASSERT_EQ(SMB_SUCCESS, harness.Init(backend));
+    std::string data;
+    for (size_t i = 0; i < (COPY_QUEUE_CHUNKS + 2) * COPY_CHUNK_SIZE + 5; i++)
+    {
+        data += (char) ('a' + i % 23);
+    }
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/a.bin", data));
+
+    CopyOutcome outcome = copy(harness, false, "srv/share/a.bin", "srv/share/b.bin", false, true);
+    ASSERT_EQ(COPY_RESP, outcome._cmd);
+    EXPECT_FALSE(outcome._resp.serverside());
+    EXPECT_EQ(data.size(), outcome._resp.fileinformation().size());
+    EXPECT_GE(outcome._progress, 2u);
+    EXPECT_EQ(data, content(backend, "smb://srv/share/b.bin"));
+
+    /* server side copy reports progress as well */
+    backend = ALLOCATE(MemoryBackend);
+    backend->SetLatency(100);
+    ASSERT_EQ(SMB_SUCCESS, harness.SetBackend(backend));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/a.bin", data));
+    outcome = copy(harness, false, "srv/share/a.bin", "srv/share/b.bin", false, true);
+    ASSERT_EQ(COPY_RESP, outcome._cmd);
+    EXPECT_TRUE(outcome._resp.serverside());
+    EXPECT_EQ(1u, outcome._progress);
+    EXPECT_EQ(data.size(), outcome._bytes);
+
+    c.Set(C_COPY_PROGRESS_TIME, DEFAULT_COPY_PROGRESS_TIME);
+    EXPECT_EQ(SMB_SUCCESS, harness.Quit());
+}
+
+TEST(Copy, Errors)
+{
+    ProcessorHarness harness;
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    ASSERT_EQ(SMB_SUCCESS, harness.Init(backend));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/d/a", "new"));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/d/b", "old"));
+
+    CopyOutcome outcome = copy(harness, false, "srv/share/d/a", "srv/share/d/b", false, false);
+    ASSERT_EQ(COPY_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(EEXIST, outcome._code);
+    EXPECT_EQ("old", content(backend, "smb://srv/share/d/b"));
+
+    outcome = copy(harness, false, "srv/share/d/a", "srv/share/d/b", true, false);
+    ASSERT_EQ(COPY_RESP, outcome._cmd);
+    EXPECT_EQ("new", content(backend, "smb://srv/share/d/b"));
+
+    outcome = copy(harness, false, "srv/share/d", "srv/share/e", false, false);
+    EXPECT_EQ(COPY_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(EISDIR, outcome._code);
+
+    outcome = copy(harness, false, "srv/share/d/missing", "srv/share/d/c", false, false);
+    EXPECT_EQ(COPY_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(ENOENT, outcome._code);
+
+    outcome = copy(harness, false, "srv/share/d/a", "srv/share/missing/c", false, false);
+    EXPECT_EQ(COPY_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(ENOENT, outcome._code);
+
+    outcome = copy(harness, false, "srv/share/d/a", "srv/share/../c", false, false);
+    EXPECT_EQ(COPY_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(EINVAL, outcome._code);
+
+    outcome = copy(harness, false, "srv/share/d/a", "", false, false);
+    EXPECT_EQ(COPY_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(EINVAL, outcome._code);
+
+    /* no partial copies left behind */
+    EXPECT_EQ(2u, entries(backend, "smb://srv/share/d"));
+
+    EXPECT_EQ(SMB_SUCCESS, harness.Quit());
+}
+
+TEST(Copy, Move)
+{
+    ProcessorHarness harness;
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    ASSERT_EQ(SMB_SUCCESS, harness.Init(backend));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/d/a", "abc"));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/share/d/b", "old"));
+    ASSERT_EQ(SMB_SUCCESS, backend->AddFile("smb://srv/other/keep", "1"));
+
+    /* rename within the share */
+    CopyOutcome outcome = copy(harness, true, "srv/share/d/a", "srv/share/d/b", false, false);
+    ASSERT_EQ(MOVE_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(EEXIST, outcome._code);
+
+    outcome = copy(harness, true, "srv/share/d/a", "srv/share/d/c", false, false);
+    ASSERT_EQ(MOVE_RESP, outcome._cmd);
+    EXPECT_FALSE(outcome._resp.serverside());
+    EXPECT_EQ(3u, outcome._resp.fileinformation().size());
+    EXPECT_EQ("<missing>", content(backend, "smb://srv/share/d/a"));
+    EXPECT_EQ("abc", content(backend, "smb://srv/share/d/c"));
+
+    outcome = copy(harness, true, "srv/share/d", "srv/share/e", false, false);
+    ASSERT_EQ(MOVE_RESP, outcome._cmd);
+    EXPECT_TRUE(outcome._resp.fileinformation().isdirectory());
+    EXPECT_EQ("abc", content(backend, "smb://srv/share/e/c"));
+
+    /* other share, file is copied and source deleted */
+    outcome = copy(harness, true, "srv/share/e/c", "srv/other/c", false, false);
+    ASSERT_EQ(MOVE_RESP, outcome._cmd);
+    EXPECT_TRUE(outcome._resp.serverside());
+    EXPECT_EQ("abc", content(backend, "smb://srv/other/c"));
+    EXPECT_EQ("<missing>", content(backend, "smb://srv/share/e/c"));
+
+    /* folders are not copied */
+    outcome = copy(harness, true, "srv/share/e", "srv/other/e", false, false);
+    ASSERT_EQ(MOVE_ERROR_RESP, outcome._cmd);
+    EXPECT_EQ(EXDEV, outcome._code);
+    EXPECT_EQ("old", content(backend, "smb://srv/share/e/b"));
+
+    EXPECT_EQ(SMB_SUCCESS, harness.Quit());
+}
+
+#endif //_DEBUG_
@@ -73,6 +73,24 @@ TEST(DownloadParser, ParsePacket)
     EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(packet));
 }
 
+TEST(DownloadParser, ParseSingleRoundTrip)
+{
+    Packet *packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_SUCCESS, creator->CreatePacket(packet, DOWNLOAD_INIT_REQ, NULL));
+    EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(packet));
+    EXPECT_FALSE(processor->SingleRoundTrip());
+
+    RangeDownloadRequest *range = packet->_pb_msg->mutable_requestpacket()->mutable_rangedownloadrequest();
+    range->set_start(0);
+    range->set_end(4095);
+    range->set_chunksize(1024);
+    EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(packet));
+    EXPECT_TRUE(processor->SingleRoundTrip());
+    EXPECT_EQ(4095u, processor->EndOffset());
+    processor->SetSingleRoundTrip(false);
+    FREE(packet);
+}
+
 TEST(DownloadParser, TearDown)
 {
     RequestProcessor::SetInstance(NULL);
@@ -0,0 +1,382 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+
+#include <algorithm>
+#include <atomic>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Metrics.h"
+#include "base/Protocol.h"
+#include "processor/OpenDirReqProcessor.h"
+#include "smb/ListCache.h"
+#include "smb/SmbClient.h"
+#include "storage/MemoryBackend.h"
+#include "ProcessorHarness.h"
+
+#define LIST_FILES  300
+#define LIST_PAGES  7   //300 files along with . and .. in pages of 50
+
+/* lists url (srv/share/dir), returns entry names in order and entries of every page */
+static std::vector<std::string> list(ProcessorHarness &harness, int page_size, std::vector<int> &pages,
+                                     const char *url = "srv/share/dir", unsigned int level = 0,
+                                     const ListFilter &filter = ListFilter())
+{
+    std::vector<std::string> names;
+    OpenDirReqProcessor *processor = ALLOCATE(OpenDirReqProcessor);
+    processor->SetPageSize(page_size);
+    processor->SetShowHiddenFiles(true);
+    processor->SetLevel(level);
+    processor->SetFilter(filter);
+    EXPECT_EQ(SMB_SUCCESS, harness.Start(processor, url, GET_STRUCTURE_INIT_REQ));
+
+    pages.clear();
+    Packet *packet;
+    while ((packet = harness.PopResponse(true)) != NULL)
+    {
+        int cmd = packet->GetCMD();
+        if (cmd == GET_STRUCTURE_INIT_RESP)
+        {
+            const FolderStructureResponse &page = packet->_pb_msg->responsepacket().folderstructureresponse();
+            for (int j = 0; j < page.fileinformation_size(); j++)
+            {
+                names.push_back(page.fileinformation(j).name());
+            }
+            pages.push_back(page.fileinformation_size());
+        }
+        FREE(packet);
+        if (cmd != GET_STRUCTURE_INIT_RESP)
+        {
+            EXPECT_EQ(GET_STRUCTURE_END_RESP, cmd);
+            break;
+        }
+    }
+
+    harness.Finish(processor);
+    return names;
+}
+
+/* counts the calls probing a url, files must be probed without opening them */
+class ProbeCountingBackend : public MemoryBackend
+{
+public:
+    std::atomic<int> _opens;
+    std::atomic<int> _open_dirs;
+    std::atomic<int> _stats;
+
+    ProbeCountingBackend() : _opens(0), _open_dirs(0), _stats(0) {}
+
+    StorageFile *Open(const std::string &url, int flags, mode_t mode)
+    {
+        _opens++;
+        return MemoryBackend::Open(url, flags, mode);
+    }
+
+    StorageFile *OpenDir(const std::string &url)
+    {
+        _open_dirs++;
+        return MemoryBackend::OpenDir(url);
+    }
+
+    int Stat(const std::string &url, struct stat *st)
+    {
+        _stats++;
+        return MemoryBackend::Stat(url, st);
+    }
+};
+
+static ProcessorHarness *harness = NULL;
+static ProbeCountingBackend *backend = NULL;
+
+TEST(List, Init)
+{
+    harness = ALLOCATE(ProcessorHarness);
+    backend = ALLOCATE(ProbeCountingBackend);
+    ASSERT_EQ(SMB_SUCCESS, harness->Init(backend));
+    /* every listing reads the directory, List.Cache turns the cache on */
+    Configuration::GetInstance().Set(C_LIST_CACHE_SIZE, "0");
+    ASSERT_EQ(0, backend->Mkdir("smb://srv/share/dir", 0755));
+    for (int i = 0; i < LIST_FILES; i++)
+    {
+        StorageFile *file = backend->Open("smb://srv/share/dir/file" + std::to_string(i), O_CREAT | O_WRONLY, 0644);
+        ASSERT_TRUE(file != NULL);
+        backend->Close(file);
+    }
+}
+
+TEST(List, PrefetchSameListing)
+{
+    Configuration &c = Configuration::GetInstance();
+    std::vector<int> pages;
+    c.Set(C_LIST_FIRST_PAGE, "0");
+    c.Set(C_LIST_PREFETCH_SIZE, "0");
+    std::vector<std::string> direct = list(*harness, 50, pages);
+    EXPECT_EQ((size_t) LIST_FILES + 2, direct.size());
+    EXPECT_EQ((size_t) LIST_PAGES, pages.size());
+
+    /* buffer smaller than a page, prefetch thread keeps waiting for the sender */
+    c.Set(C_LIST_PREFETCH_SIZE, "1024");
+    EXPECT_EQ(direct, list(*harness, 50, pages));
+    EXPECT_EQ((size_t) LIST_PAGES, pages.size());
+
+    c.Set(C_LIST_PREFETCH_SIZE, DEFAULT_LIST_PREFETCH_SIZE);
+    EXPECT_EQ(direct, list(*harness, 50, pages));
+    EXPECT_EQ((size_t) LIST_PAGES, pages.size());
+    c.Set(C_LIST_FIRST_PAGE, DEFAULT_LIST_FIRST_PAGE);
+}
+
+TEST(List, AdaptivePaging)
+{
+    Configuration &c = Configuration::GetInstance();
+    std::vector<int> pages;
+
+    /* small first page, doubled till page size */
+    EXPECT_EQ((size_t) LIST_FILES + 2, list(*harness, 100, pages).size());
+    EXPECT_EQ(std::vector<int>({16, 32, 64, 100, 90}), pages);
+
+    /* page size applies to the first page */
+    EXPECT_EQ((size_t) LIST_FILES + 2, list(*harness, 8, pages).size());
+    EXPECT_EQ(8, pages[0]);
+    EXPECT_EQ(8, pages[1]);
+
+    /* byte budget cuts pages before their entries, ~30 bytes per entry */
+    c.Set(C_LIST_PAGE_BYTES, "200");
+    EXPECT_EQ((size_t) LIST_FILES + 2, list(*harness, 1000, pages).size());
+    EXPECT_GT(pages.size(), (size_t) (LIST_FILES + 2) / 16);
+    for (size_t i = 0; i < pages.size(); i++)
+    {
+        EXPECT_LT(pages[i], 16);
+    }
+    c.Set(C_LIST_PAGE_BYTES, DEFAULT_LIST_PAGE_BYTES);
+}
+
+TEST(List, Cache)
+{
+    Configuration &c = Configuration::GetInstance();
+    Metrics &metrics = Metrics::GetInstance();
+    ListCache &cache = ListCache::GetInstance();
+    std::vector<int> pages;
+    c.Set(C_LIST_CACHE_SIZE, DEFAULT_LIST_CACHE_SIZE);
+    cache.Clear();
+    uint64_t hits = metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_HITS);
+    uint64_t misses = metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_MISSES);
+
+    /* first listing is read from the server and cached, second one is served from the cache */
+    std::vector<std::string> listed = list(*harness, 100, pages);
+    EXPECT_EQ((size_t) LIST_FILES + 2, listed.size());
+    EXPECT_EQ((size_t) 1, cache.Count());
+    EXPECT_EQ(listed, list(*harness, 100, pages));
+    EXPECT_EQ(std::vector<int>({16, 32, 64, 100, 90}), pages);
+    EXPECT_EQ(hits + 1, metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_HITS));
+    EXPECT_EQ(misses + 1, metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_MISSES));
+
+    /* new file changes the directory mtime, cached listing is dropped */
+    StorageFile *file = backend->Open("smb://srv/share/dir/new", O_CREAT | O_WRONLY, 0644);
+    ASSERT_TRUE(file != NULL);
+    backend->Close(file);
+    listed = list(*harness, 100, pages);
+    EXPECT_EQ((size_t) LIST_FILES + 3, listed.size());
+    EXPECT_EQ(listed, list(*harness, 100, pages));
+    EXPECT_EQ(hits + 2, metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_HITS));
+    EXPECT_EQ(misses + 2, metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_MISSES));
+
+    /* expired listing is read again */
+    c.Set(C_LIST_CACHE_TTL, "0");
+    usleep(1000);
+    EXPECT_EQ(listed, list(*harness, 100, pages));
+    EXPECT_EQ(misses + 3, metrics.Counter(METRIC_OP_LIST_DIR, METRIC_CACHE_MISSES));
+    c.Set(C_LIST_CACHE_TTL, DEFAULT_LIST_CACHE_TTL);
+
+    EXPECT_EQ(0, backend->Unlink("smb://srv/share/dir/new"));
+    cache.Clear();
+    c.Set(C_LIST_CACHE_SIZE, "0");
+}
+
+TEST(List, Recursive)
+{
+    Configuration &c = Configuration::GetInstance();
+    std::vector<int> pages;
+    const char *dirs[] = {"tree", "tree/a", "tree/a/b", "tree/a/b/c", "tree/d"};
+    for (size_t i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++)
+    {
+        ASSERT_EQ(0, backend->Mkdir(std::string("smb://srv/share/") + dirs[i], 0755));
+        StorageFile *file = backend->Open(std::string("smb://srv/share/") + dirs[i] + "/file", O_CREAT | O_WRONLY, 0644);
+        ASSERT_TRUE(file != NULL);
+        backend->Close(file);
+    }
+
+    /* level 0 and 1 list the directory only */
+    std::vector<std::string> level1 = {".", "..", "a", "d", "file"};
+    std::vector<std::string> names = list(*harness, 100, pages, "srv/share/tree", 1);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(level1, names);
+
+    std::vector<std::string> level2 = {".", "..", "a", "a/b", "a/file", "d", "d/file", "file"};
+    names = list(*harness, 100, pages, "srv/share/tree", 2);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(level2, names);
+
+    /* whole tree, in pages of 2 with a single worker and with a buffer of one entry */
+    std::vector<std::string> all = {".", "..", "a", "a/b", "a/b/c", "a/b/c/file", "a/b/file", "a/file", "d", "d/file",
+                                    "file"};
+    names = list(*harness, 100, pages, "srv/share/tree", UINT32_MAX);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(all, names);
+
+    c.Set(C_LIST_WORKERS, "1");
+    c.Set(C_LIST_PREFETCH_SIZE, "0");
+    names = list(*harness, 2, pages, "srv/share/tree/", UINT32_MAX);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(all, names);
+    c.Set(C_LIST_PREFETCH_SIZE, DEFAULT_LIST_PREFETCH_SIZE);
+    c.Set(C_LIST_WORKERS, DEFAULT_LIST_WORKERS);
+}
+
+TEST(List, Filter)
+{
+    std::vector<int> pages;
+    ASSERT_EQ(0, backend->Mkdir("smb://srv/share/filter", 0755));
+    /* doc<i>.txt of 10 * i bytes, modified one after another */
+    for (int i = 0; i < 10; i++)
+    {
+        StorageFile *file = backend->Open("smb://srv/share/filter/doc" + std::to_string(i) + ".txt",
+                                          O_CREAT | O_WRONLY, 0644);
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(10 * i, backend->Write(file, std::string(10 * i, 'x').c_str(), 10 * i));
+        backend->Close(file);
+        usleep(2000);
+    }
+    ASSERT_EQ(0, backend->Mkdir("smb://srv/share/filter/img.PNG", 0755));
+
+    ListFilter filter;
+    filter._pattern = "*.png";
+    EXPECT_EQ(std::vector<std::string>({"img.PNG"}), list(*harness, 100, pages, "srv/share/filter", 0, filter));
+
+    filter = ListFilter();
+    filter._prefix = "DOC";
+    filter._min_size = 20;
+    filter._max_size = 50;
+    std::vector<std::string> names = list(*harness, 100, pages, "srv/share/filter", 0, filter);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(std::vector<std::string>({"doc2.txt", "doc3.txt", "doc4.txt", "doc5.txt"}), names);
+
+    /* directories are not filtered by size */
+    filter._prefix.clear();
+    names = list(*harness, 100, pages, "srv/share/filter", 0, filter);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(std::vector<std::string>({".", "..", "doc2.txt", "doc3.txt", "doc4.txt", "doc5.txt", "img.PNG"}), names);
+
+    struct stat st;
+    ASSERT_EQ(0, backend->Stat("smb://srv/share/filter/doc7.txt", &st));
+    filter = ListFilter();
+    filter._pattern = "doc*";
+    filter._min_mtime = st.st_mtim.tv_sec * SEC_TO_MS + st.st_mtim.tv_nsec * NANO_TO_MS;
+    names = list(*harness, 100, pages, "srv/share/filter", 0, filter);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(std::vector<std::string>({"doc7.txt", "doc8.txt", "doc9.txt"}), names);
+
+    /* top-K in pages of 2 */
+    filter = ListFilter();
+    filter._sort = LIST_SORT_SIZE;
+    filter._descending = true;
+    filter._limit = 3;
+    EXPECT_EQ(std::vector<std::string>({"doc9.txt", "doc8.txt", "doc7.txt"}),
+              list(*harness, 2, pages, "srv/share/filter", 0, filter));
+    EXPECT_EQ(std::vector<int>({2, 1}), pages);
+
+    filter._sort = LIST_SORT_MODIFIED_TIME;
+    filter._pattern = "*.txt";
+    filter._limit = 2;
+    EXPECT_EQ(std::vector<std::string>({"doc9.txt", "doc8.txt"}), list(*harness, 100, pages, "srv/share/filter", 0, filter));
+
+    filter = ListFilter();
+    filter._sort = LIST_SORT_NAME;
+    filter._pattern = "doc?.*";
+    names = list(*harness, 100, pages, "srv/share/filter", 0, filter);
+    ASSERT_EQ(10u, names.size());
+    EXPECT_TRUE(std::is_sorted(names.begin(), names.end()));
+
+    /* limit without sort stops reading the directory */
+    filter = ListFilter();
+    filter._limit = 5;
+    EXPECT_EQ(5u, list(*harness, 2, pages, "srv/share/filter", 0, filter).size());
+}
+
+TEST(List, ProbeFile)
+{
+    std::vector<int> pages;
+    ASSERT_EQ(0, backend->AddFile("smb://srv/share/probe.bin", std::string(42, 'x')));
+    backend->_opens = 0;
+    backend->_open_dirs = 0;
+    backend->_stats = 0;
+
+    /* a file is answered from a single stat */
+    EXPECT_EQ(std::vector<std::string>({"probe.bin"}), list(*harness, 100, pages, "srv/share/probe.bin"));
+    EXPECT_EQ(std::vector<int>({1}), pages);
+    EXPECT_EQ(0, (int) backend->_opens);
+    EXPECT_EQ(0, (int) backend->_open_dirs);
+    EXPECT_EQ(1, (int) backend->_stats);
+    EXPECT_EQ(42, SmbClient::GetInstance()->FileStat()->st_size);
+
+    /* a directory is opened once its type is known */
+    EXPECT_EQ((size_t) LIST_FILES + 2, list(*harness, 1000, pages).size());
+    EXPECT_EQ(0, (int) backend->_opens);
+    EXPECT_EQ(1, (int) backend->_open_dirs);
+    EXPECT_EQ(2, (int) backend->_stats);
+    EXPECT_EQ(0, backend->Unlink("smb://srv/share/probe.bin"));
+}
+
+TEST(List, Quit)
+{
+    EXPECT_EQ(SMB_SUCCESS, harness->Quit());
+    FREE(harness);
+}
+
+TEST(ListCache, KeyAndEviction)
+{
+    Configuration &c = Configuration::GetInstance();
+    ListCache &cache = ListCache::GetInstance();
+    c.Set(C_LIST_CACHE_SIZE, DEFAULT_LIST_CACHE_SIZE);
+    cache.Clear();
+
+    std::string a = ListCache::Key("smb://srv/share//a", "WG", "user", "password");
+    EXPECT_EQ(a, ListCache::Key("srv/share/a", "WG", "user", "password"));
+    EXPECT_NE(a, ListCache::Key("srv/share/a", "WG", "user", "other"));
+    EXPECT_EQ(std::string::npos, a.find("password"));
+    std::string b = ListCache::Key("srv/share/b", "WG", "user", "password");
+    std::string d = ListCache::Key("srv/share/d", "WG", "user", "password");
+
+    std::shared_ptr<ListEntries> entries = std::make_shared<ListEntries>(1);
+    struct timespec mtime = {1, 0};
+    cache.Store(a, mtime, entries, entries->back().Bytes());
+    size_t item = cache.Bytes();
+
+    /* room for two listings, least recently used one is evicted */
+    c.Set(C_LIST_CACHE_SIZE, std::to_string(item * 2 + item / 2).c_str());
+    cache.Store(b, mtime, entries, entries->back().Bytes());
+    EXPECT_TRUE(cache.Lookup(a, mtime) != NULL);
+    cache.Store(d, mtime, entries, entries->back().Bytes());
+    EXPECT_EQ((size_t) 2, cache.Count());
+    EXPECT_TRUE(cache.Lookup(b, mtime) == NULL);
+    EXPECT_TRUE(cache.Lookup(a, mtime) != NULL);
+
+    /* directory changed */
+    struct timespec changed = {1, 1};
+    EXPECT_TRUE(cache.Lookup(d, changed) == NULL);
+    EXPECT_EQ((size_t) 1, cache.Count());
+    EXPECT_EQ(item, cache.Bytes());
+
+    cache.Clear();
+    c.Set(C_LIST_CACHE_SIZE, DEFAULT_LIST_CACHE_SIZE);
+}
+
+#endif
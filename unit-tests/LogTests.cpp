@@ -104,4 +104,26 @@ TEST(Log, ALLTests)
     Log_smbclient(NULL, LOG_LVL_ALWAYS, "test msg from smbclient");
 }
 
+TEST(Log, RateLimit)
+{
+    LogRateLimit rate_limit;
+    unsigned long suppressed = 0;
+    EXPECT_TRUE(rate_limit.Allow(50, suppressed));
+    EXPECT_EQ(0u, suppressed);
+    EXPECT_FALSE(rate_limit.Allow(50, suppressed));
+    EXPECT_FALSE(rate_limit.Allow(50, suppressed));
+    usleep(60 * 1000);
+    EXPECT_TRUE(rate_limit.Allow(50, suppressed));
+    EXPECT_EQ(2u, suppressed);
+
+    EXPECT_EQ(LOG_LVL_DUMP, LOG_LVL_COMPILED);
+    logLevel = LOG_LVL_DEBUG;
+    for (int i = 0; i < 100; i++)
+    {
+        DEBUG_LOG_RATE_LIMITED("rate limited test %d", i);
+        INFO_LOG_RATE_LIMITED("rate limited test %d", i);
+    }
+    logLevel = LOG_LVL_NONE;
+}
+
 #endif //_DEBUG_
\ No newline at end of file
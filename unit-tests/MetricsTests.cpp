@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+#include <gtest/gtest.h>
+#include "base/Metrics.h"
+
+TEST(Metrics, HistogramBuckets)
+{
+    for (uint64_t v = 0; v < HISTOGRAM_SUB_BUCKETS; v++)
+    {
+        EXPECT_EQ((int) v, Histogram::BucketIndex(v));
+        EXPECT_EQ(v, Histogram::BucketValue((int) v));
+    }
+
+    uint64_t values[] = {8, 9, 15, 16, 17, 100, 1000, 123456, 1ULL << 40, UINT64_MAX};
+    for (uint64_t v : values)
+    {
+        int index = Histogram::BucketIndex(v);
+        EXPECT_LT(index, HISTOGRAM_BUCKETS);
+        EXPECT_GE(Histogram::BucketValue(index), v);
+        /* relative error bounded by sub-bucket width */
+        EXPECT_LE(Histogram::BucketValue(index) - v, v / HISTOGRAM_SUB_BUCKETS);
+        if (index > 0)
+        {
+            EXPECT_LT(Histogram::BucketValue(index - 1), v);
+        }
+    }
+}
+
+TEST(Metrics, HistogramPercentile)
+{
+    Histogram h;
+    EXPECT_EQ(0u, h.Count());
+    EXPECT_EQ(0u, h.Percentile(50));
+    EXPECT_EQ(0u, h.Min());
+
+    for (uint64_t v = 1; v <= 1000; v++)
+    {
+        h.Record(v);
+    }
+    EXPECT_EQ(1000u, h.Count());
+    EXPECT_EQ(1u, h.Min());
+    EXPECT_EQ(1000u, h.Max());
+    EXPECT_EQ(500u, h.Mean());
+    EXPECT_NEAR(500.0, (double) h.Percentile(50), 500.0 / HISTOGRAM_SUB_BUCKETS);
+    EXPECT_NEAR(990.0, (double) h.Percentile(99), 990.0 / HISTOGRAM_SUB_BUCKETS);
+    EXPECT_EQ(1000u, h.Percentile(100));
+
+    h.Reset();
+    EXPECT_EQ(0u, h.Count());
+    EXPECT_EQ(0u, h.Max());
+}
+
+TEST(Metrics, CountersAndGauges)
+{
+    Metrics &metrics = Metrics::GetInstance();
+    metrics.Reset();
+
+    metrics.Count(METRIC_OP_DOWNLOAD, METRIC_REQUESTS);
+    metrics.Count(METRIC_OP_DOWNLOAD, METRIC_BYTES, 4096);
+    metrics.Count(METRIC_OP_DOWNLOAD, METRIC_BYTES, 1024);
+    metrics.Record(METRIC_OP_DOWNLOAD, METRIC_LAT_CHUNK, 250);
+    metrics.RecordSince(METRIC_OP_DOWNLOAD, METRIC_LAT_TOTAL, Metrics::Now());
+    metrics.SetGauge(METRIC_GAUGE_RESPONSE_QUEUE, 5);
+    metrics.SetGauge(METRIC_GAUGE_RESPONSE_QUEUE, 2);
+
+    EXPECT_EQ(1u, metrics.Counter(METRIC_OP_DOWNLOAD, METRIC_REQUESTS));
+    EXPECT_EQ(5120u, metrics.Counter(METRIC_OP_DOWNLOAD, METRIC_BYTES));
+    EXPECT_EQ(0u, metrics.Counter(METRIC_OP_UPLOAD, METRIC_BYTES));
+    EXPECT_EQ(1u, metrics.Latency(METRIC_OP_DOWNLOAD, METRIC_LAT_CHUNK).Count());
+    EXPECT_EQ(250u, metrics.Latency(METRIC_OP_DOWNLOAD, METRIC_LAT_CHUNK).Max());
+    EXPECT_EQ(1u, metrics.Latency(METRIC_OP_DOWNLOAD, METRIC_LAT_TOTAL).Count());
+    EXPECT_EQ(2, metrics.GetGauge(METRIC_GAUGE_RESPONSE_QUEUE).Value());
+    EXPECT_EQ(5, metrics.GetGauge(METRIC_GAUGE_RESPONSE_QUEUE).Max());
+
+    std::string dump;
+    metrics.Dump(dump);
+    EXPECT_EQ('{', dump[0]);
+    EXPECT_EQ('}', dump[dump.size() - 1]);
+    EXPECT_NE(std::string::npos, dump.find("\"download\":{\"requests\":1,\"bytes\":5120,"));
+    EXPECT_NE(std::string::npos, dump.find("\"p999\""));
+    EXPECT_NE(std::string::npos, dump.find("\"response_queue\":{\"current\":2,\"max\":5}"));
+
+    metrics.Reset();
+    EXPECT_EQ(0u, metrics.Counter(METRIC_OP_DOWNLOAD, METRIC_BYTES));
+}
+
+#endif //_DEBUG_
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "base/Error.h"
+#include "smb/SmbClient.h"
+#include "ProcessorHarness.h"
+
+#define HARNESS_POLL_US     1000
+#define HARNESS_POLLS       5000    //wait up to 5 sec for a response
+
+ProcessorHarness::ProcessorHarness() : _server(NULL)
+{
+}
+
+ProcessorHarness::~ProcessorHarness()
+{
+    Quit();
+}
+
+/*!
+ * Starts server and session manager, SmbClient uses backend
+ * @param backend - memory backend, owned by SmbClient afterwards
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      Otherwise - SmbClient init failed
+ */
+int ProcessorHarness::Init(MemoryBackend *backend)
+{
+    should_exit = 1;
+    _server = ALLOCATE(Server);
+    _server->GetSessionManager()->Init(_server);
+    return SetBackend(backend);
+}
+
+/*!
+ * Replaces backend of SmbClient, previous one is freed
+ * @param backend - memory backend, owned by SmbClient afterwards
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      Otherwise - SmbClient init failed
+ */
+int ProcessorHarness::SetBackend(MemoryBackend *backend)
+{
+    SmbClient *client = SmbClient::GetInstance();
+    client->SetBackend(NULL);
+    client->SetBackend(backend);
+    bool kerberos = false;
+    return client->Init(kerberos);
+}
+
+/*!
+ * Stops SmbClient and frees backend and server
+ * @return
+ *      SMB_SUCCESS - Successful
+ *      Otherwise - SmbClient quit failed
+ */
+int ProcessorHarness::Quit()
+{
+    if (IS_NULL(_server))
+    {
+        return SMB_SUCCESS;
+    }
+    SmbClient *client = SmbClient::GetInstance();
+    int ret = client->Quit();
+    client->SetBackend(NULL);
+    FREE(_server);
+    _server = NULL;
+    return ret;
+}
+
+/*!
+ * Sets up processor as the current request of the test user and creates its request packet
+ * Request specific settings of processor are to be set before
+ * @param processor - processor of the request
+ * @param url - url of the request
+ * @param cmd - request command
+ * @return request packet, to be passed to Process()
+ */
+Packet *ProcessorHarness::Request(RequestProcessor *processor, const std::string &url, int cmd)
+{
+    RequestProcessor::SetInstance(processor);
+    processor->SetSessionManager(_server->GetSessionManager());
+    processor->SetUrl(url);
+    processor->SetWorkGroup("WG");
+    processor->SetUserName("user");
+    processor->SetPassword("password");
+    std::string id = "test";
+    EXPECT_EQ(SMB_SUCCESS, processor->Init(id));
+
+    Packet *packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_SUCCESS, processor->PacketCreator()->CreatePacket(packet, cmd, NULL));
+    return packet;
+}
+
+/*!
+ * Processes request packet, packet is freed
+ * @param processor - processor of the request
+ * @param packet - packet returned by Request()
+ * @return result of RequestProcessor::ProcessRequest
+ */
+int ProcessorHarness::Process(RequestProcessor *processor, Packet *packet)
+{
+    int ret = processor->ProcessRequest(packet);
+    FREE(packet);
+    return ret;
+}
+
+/*!
+ * Request() and Process() without changes to the request packet
+ * @return result of RequestProcessor::ProcessRequest
+ */
+int ProcessorHarness::Start(RequestProcessor *processor, const std::string &url, int cmd)
+{
+    return Process(processor, Request(processor, url, cmd));
+}
+
+/*!
+ * Next queued response
+ * @param wait - wait up to 5 sec for a response of a processor thread
+ * @return response packet, to be freed by caller, NULL if none
+ */
+Packet *ProcessorHarness::PopResponse(bool wait)
+{
+    Packet *packet = _server->GetSessionManager()->PopResponse();
+    for (int i = 0; wait && packet == NULL && i < HARNESS_POLLS; i++)
+    {
+        usleep(HARNESS_POLL_US);
+        packet = _server->GetSessionManager()->PopResponse();
+    }
+    return packet;
+}
+
+/*!
+ * Stops and frees processor
+ * @param processor - processor of the request
+ */
+void ProcessorHarness::Finish(RequestProcessor *processor)
+{
+    processor->Quit();
+    RequestProcessor::SetInstance(NULL);
+    FREE(processor);
+}
+
+#endif //_DEBUG_
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifndef PROCESSOR_HARNESS_H_
+#define PROCESSOR_HARNESS_H_
+
+#ifdef _DEBUG_
+
+#include <string>
+
+#include "core/Server.h"
+#include "packet/Packet.h"
+#include "processor/RequestProcessor.h"
+#include "storage/MemoryBackend.h"
+
+/*
+ * Server and SmbClient on a memory backend, runs processors the way
+ * SessionManager does for a parsed request and collects their responses
+ */
+class ProcessorHarness
+{
+private:
+    Server *_server;
+
+public:
+    ProcessorHarness();
+    virtual ~ProcessorHarness();
+
+    int Init(MemoryBackend *backend);
+    int SetBackend(MemoryBackend *backend);
+    int Quit();
+
+    Packet *Request(RequestProcessor *processor, const std::string &url, int cmd);
+    int Process(RequestProcessor *processor, Packet *packet);
+    int Start(RequestProcessor *processor, const std::string &url, int cmd);
+    Packet *PopResponse(bool wait = false);
+    void Finish(RequestProcessor *processor);
+};
+
+#endif //_DEBUG_
+
+#endif //PROCESSOR_HARNESS_H_
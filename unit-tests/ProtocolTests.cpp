@@ -42,6 +42,22 @@ TEST(Protocol, ProtocolCommand)
     EXPECT_TRUE(strcmp(ProtocolCommand(TEST_CONNECTION_INIT_RESP), "TEST_CONNECTION_INIT_RESP") == 0);
     EXPECT_TRUE(strcmp(ProtocolCommand(TEST_CONNECTION_ERROR_RESP), "TEST_CONNECTION_ERROR_RESP") == 0);
 
+    EXPECT_TRUE(strcmp(ProtocolCommand(STATS_REQ), "STATS_REQ") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(STATS_RESP), "STATS_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(STATS_ERROR_RESP), "STATS_ERROR_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(BATCH_STAT_REQ), "BATCH_STAT_REQ") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(BATCH_STAT_RESP), "BATCH_STAT_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(BATCH_STAT_END_RESP), "BATCH_STAT_END_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(BATCH_STAT_ERROR_RESP), "BATCH_STAT_ERROR_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(COPY_REQ), "COPY_REQ") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(COPY_RESP), "COPY_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(COPY_ERROR_RESP), "COPY_ERROR_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(COPY_PROGRESS_RESP), "COPY_PROGRESS_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(MOVE_REQ), "MOVE_REQ") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(MOVE_RESP), "MOVE_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(MOVE_ERROR_RESP), "MOVE_ERROR_RESP") == 0);
+    EXPECT_TRUE(strcmp(ProtocolCommand(MOVE_PROGRESS_RESP), "MOVE_PROGRESS_RESP") == 0);
+
     EXPECT_TRUE(strcmp(ProtocolCommand(157), "INVALID_COMMAND") == 0);
 
 }
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+#include "base/Configuration.h"
+#include "base/Error.h"
+#include "base/Protocol.h"
+#include "processor/DownloadProcessor.h"
+#include "storage/MemoryBackend.h"
+#include "ProcessorHarness.h"
+
+static std::string content = "0123456789";
+
+/* starts a single round-trip download from offset 2 till past the end, responses stay queued */
+static DownloadProcessor *download(ProcessorHarness &harness, int chunk_size)
+{
+    DownloadProcessor *processor = ALLOCATE(DownloadProcessor);
+    Packet *packet = harness.Request(processor, "srv/share/small.txt", DOWNLOAD_INIT_REQ);
+    RangeDownloadRequest *range = packet->_pb_msg->mutable_requestpacket()->mutable_rangedownloadrequest();
+    range->set_start(2);
+    range->set_end(UINT32_MAX);
+    range->set_chunksize(chunk_size);
+    EXPECT_EQ(SMB_SUCCESS, harness.Process(processor, packet));
+    return processor;
+}
+
+static std::string pop_data(ProcessorHarness &harness, bool wait = false)
+{
+    Packet *packet = harness.PopResponse(wait);
+    if (packet == NULL || packet->GetCMD() != DOWNLOAD_DATA_RESP)
+    {
+        ADD_FAILURE() << "DOWNLOAD_DATA_RESP expected";
+        FREE(packet);
+        return "";
+    }
+    std::string data = packet->_pb_msg->responsepacket().downloaddataresponse().data();
+    FREE(packet);
+    return data;
+}
+
+static int pop_cmd(ProcessorHarness &harness, bool wait = false)
+{
+    Packet *packet = harness.PopResponse(wait);
+    int cmd = packet ? packet->GetCMD() : -1;
+    FREE(packet);
+    return cmd;
+}
+
+TEST(SmallFileDownload, QueuedWithEnd)
+{
+    ProcessorHarness harness;
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    ASSERT_EQ(SMB_SUCCESS, harness.Init(backend));
+    StorageFile *file = backend->Open("smb://srv/share/small.txt", O_CREAT | O_WRONLY, 0644);
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ((ssize_t) content.size(), backend->Write(file, content.data(), content.size()));
+    backend->Close(file);
+
+    /* range past the end is clipped, data and end are queued by the request itself */
+    Configuration &c = Configuration::GetInstance();
+    c.Set(C_SMALL_FILE_SIZE, "65536");
+    DownloadProcessor *processor = download(harness, 4);
+    EXPECT_EQ(DOWNLOAD_INIT_RESP, pop_cmd(harness));
+    EXPECT_EQ("2345", pop_data(harness));
+    EXPECT_EQ("6789", pop_data(harness));
+    EXPECT_EQ(DOWNLOAD_END_RESP, pop_cmd(harness));
+    EXPECT_EQ(-1, pop_cmd(harness));
+    harness.Finish(processor);
+
+    /* above threshold the file is streamed by the download thread */
+    c.Set(C_SMALL_FILE_SIZE, "4");
+    processor = download(harness, 1024);
+    EXPECT_EQ(DOWNLOAD_INIT_RESP, pop_cmd(harness));
+    EXPECT_EQ("23456789", pop_data(harness, true));
+    EXPECT_EQ(DOWNLOAD_END_RESP, pop_cmd(harness, true));
+    harness.Finish(processor);
+    EXPECT_EQ(-1, pop_cmd(harness));
+    c.Set(C_SMALL_FILE_SIZE, DEFAULT_SMALL_FILE_SIZE);
+
+    EXPECT_EQ(SMB_SUCCESS, harness.Quit());
+}
+
+#endif
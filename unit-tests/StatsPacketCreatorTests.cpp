@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+
+#include <gtest/gtest.h>
+#include "base/Error.h"
+#include "base/Protocol.h"
+#include "packet/StatsPacketCreator.h"
+
+static IPacketCreator *packetCreator = NULL;
+static RequestProcessor *processor = NULL;
+static std::string request_id="1234";
+TEST(StatsPacketCreator, Init)
+{
+    processor = ALLOCATE(StatsProcessor);
+    EXPECT_EQ(SMB_SUCCESS, processor->Init(request_id));
+    packetCreator = processor->PacketCreator();
+    EXPECT_TRUE(processor != NULL);
+    EXPECT_TRUE(packetCreator != NULL);
+}
+
+TEST(StatsPacketCreator, CreatePacket)
+{
+    RequestProcessor::SetInstance(NULL);
+    Packet *packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_ERROR, packetCreator->CreatePacket(NULL, STATS_REQ, NULL));
+    EXPECT_EQ(SMB_ERROR, packetCreator->CreatePacket(packet, STATS_REQ, NULL));
+    EXPECT_EQ(SMB_ERROR, packetCreator->CreatePacket(packet, STATS_RESP, NULL));
+    EXPECT_EQ(SMB_ERROR, packetCreator->CreatePacket(packet, STATS_ERROR_RESP, NULL));
+    RequestProcessor::SetInstance(processor);
+    EXPECT_EQ(SMB_SUCCESS, packetCreator->CreatePacket(packet, STATS_REQ, NULL));
+    FREE(packet);
+    packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_SUCCESS, packetCreator->CreatePacket(packet, STATS_RESP, NULL));
+    FREE(packet->_pb_msg);
+    packet->_pb_msg = NULL;
+    EXPECT_EQ(SMB_SUCCESS, packet->ParseProtoBuffer());
+    EXPECT_EQ(STATS_RESP, packet->GetCMD());
+    EXPECT_EQ('{', packet->_pb_msg->responsepacket().statsresponse().stats()[0]);
+    FREE(packet);
+    packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_ERROR, packetCreator->CreatePacket(packet, ADD_FOLDER_INIT_REQ, NULL));
+    RequestProcessor::SetInstance(NULL);
+    processor->Quit();
+    FREE(processor);
+}
+
+#endif
@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+#include <gtest/gtest.h>
+#include <set>
+
+#include "base/Configuration.h"
+#include "base/Constants.h"
+#include "base/Error.h"
+#include "base/Metrics.h"
+#include "smb/SmbClient.h"
+#include "storage/InstrumentedBackend.h"
+#include "storage/MemoryBackend.h"
+#include "storage/PosixBackend.h"
+
+static std::string posix_root = "/tmp/smbconnector_storage_test";
+
+static std::set<std::string> list(IStorageBackend *backend, const std::string &url)
+{
+    std::set<std::string> names;
+    StorageFile *dir = backend->OpenDir(url);
+    if (dir == NULL)
+    {
+        return names;
+    }
+    const struct libsmb_file_info *info;
+    while ((info = backend->ReadDirPlus(dir)) != NULL)
+    {
+        names.insert(std::string(info->name) + ((info->attrs & FILE_ATTRIBUTE_DIRECTORY) ? "/" : ""));
+    }
+    backend->CloseDir(dir);
+    return names;
+}
+
+static void write_file(IStorageBackend *backend, const std::string &url, const std::string &data)
+{
+    StorageFile *file = backend->Open(url, O_CREAT | O_RDWR | O_TRUNC, 0);
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ((ssize_t) data.length(), backend->Write(file, data.c_str(), data.length()));
+    EXPECT_EQ(0, backend->Close(file));
+}
+
+static std::string read_file(IStorageBackend *backend, const std::string &url)
+{
+    std::string data;
+    StorageFile *file = backend->Open(url, O_RDONLY, 0);
+    if (file == NULL)
+    {
+        return data;
+    }
+    char buffer[4];
+    ssize_t ret;
+    while ((ret = backend->Read(file, buffer, sizeof(buffer))) > 0)
+    {
+        data.append(buffer, ret);
+    }
+    backend->Close(file);
+    return data;
+}
+
+/* semantics every backend must provide */
+static void common_semantics(IStorageBackend *backend)
+{
+    EXPECT_EQ(0, backend->Mkdir("smb://srv/share/dir", 0));
+    EXPECT_EQ(-1, backend->Mkdir("smb://srv/share/dir", 0));
+    EXPECT_EQ(EEXIST, errno);
+    EXPECT_EQ(-1, backend->Mkdir("smb://srv/share/missing/dir", 0));
+    EXPECT_EQ(ENOENT, errno);
+
+    write_file(backend, "smb://srv/share/dir/file.txt", "hello storage");
+    write_file(backend, "smb://srv/share/dir/.hidden", "x");
+    EXPECT_EQ("hello storage", read_file(backend, "smb://srv/share/dir/file.txt"));
+    EXPECT_TRUE(backend->Open("smb://srv/share/dir/none", O_RDONLY, 0) == NULL);
+    EXPECT_EQ(ENOENT, errno);
+    EXPECT_TRUE(backend->Open("smb://srv/share/../escape", O_CREAT | O_RDWR, 0) == NULL);
+
+    struct stat st;
+    EXPECT_EQ(0, backend->Stat("smb://srv/share/dir/file.txt", &st));
+    EXPECT_TRUE(S_ISREG(st.st_mode));
+    EXPECT_EQ(13, st.st_size);
+    EXPECT_EQ(0, backend->Stat("smb://srv/share/dir", &st));
+    EXPECT_TRUE(S_ISDIR(st.st_mode));
+
+    /* seek and partial read */
+    StorageFile *file = backend->Open("smb://srv/share/dir/file.txt", O_RDONLY, 0);
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(6, backend->Lseek(file, 6, SEEK_SET));
+    char buffer[8] = {0};
+    EXPECT_EQ(7, backend->Read(file, buffer, sizeof(buffer)));
+    EXPECT_EQ(std::string("storage"), std::string(buffer, 7));
+    EXPECT_EQ(0, backend->Fstat(file, &st));
+    EXPECT_EQ(13, st.st_size);
+    EXPECT_EQ(0, backend->Close(file));
+
+    std::set<std::string> names = list(backend, "smb://srv/share/dir");
+    EXPECT_EQ(4u, names.size());
+    EXPECT_EQ(1u, names.count("./"));
+    EXPECT_EQ(1u, names.count("file.txt"));
+    EXPECT_EQ(1u, names.count(".hidden"));
+
+    StorageFile *dir = backend->OpenDir("smb://srv/share/dir");
+    ASSERT_TRUE(dir != NULL);
+    const struct libsmb_file_info *info;
+    while ((info = backend->ReadDirPlus(dir)) != NULL)
+    {
+        if (std::string(info->name) == ".hidden")
+        {
+            EXPECT_TRUE(info->attrs & FILE_ATTRIBUTE_HIDDEN);
+        }
+        else if (std::string(info->name) == "file.txt")
+        {
+            EXPECT_EQ(13u, info->size);
+            EXPECT_FALSE(info->attrs & FILE_ATTRIBUTE_DIRECTORY);
+        }
+    }
+    EXPECT_EQ(0, backend->CloseDir(dir));
+    EXPECT_TRUE(backend->OpenDir("smb://srv/share/dir/file.txt") == NULL);
+    EXPECT_EQ(ENOTDIR, errno);
+
+    /* rename file, directory with content */
+    EXPECT_EQ(0, backend->Rename("smb://srv/share/dir/file.txt", "smb://srv/share/dir/renamed.txt"));
+    EXPECT_EQ("hello storage", read_file(backend, "smb://srv/share/dir/renamed.txt"));
+    EXPECT_EQ(-1, backend->Stat("smb://srv/share/dir/file.txt", &st));
+    EXPECT_EQ(0, backend->Rename("smb://srv/share/dir", "smb://srv/share/moved"));
+    EXPECT_EQ("hello storage", read_file(backend, "smb://srv/share/moved/renamed.txt"));
+
+    /* rmdir/unlink */
+    EXPECT_EQ(-1, backend->Rmdir("smb://srv/share/moved"));
+    EXPECT_EQ(ENOTEMPTY, errno);
+    EXPECT_EQ(-1, backend->Unlink("smb://srv/share/moved"));
+    EXPECT_EQ(-1, backend->Rmdir("smb://srv/share/moved/renamed.txt"));
+    EXPECT_EQ(ENOTDIR, errno);
+    EXPECT_EQ(0, backend->Unlink("smb://srv/share/moved/renamed.txt"));
+    EXPECT_EQ(0, backend->Unlink("smb://srv/share/moved/.hidden"));
+    EXPECT_EQ(-1, backend->Unlink("smb://srv/share/moved/renamed.txt"));
+    EXPECT_EQ(ENOENT, errno);
+    EXPECT_EQ(0, backend->Rmdir("smb://srv/share/moved"));
+    EXPECT_EQ(-1, backend->Stat("smb://srv/share/moved", &st));
+}
+
+TEST(StorageBackend, Path)
+{
+    EXPECT_EQ("srv/share/dir", IStorageBackend::Path("smb://srv/share/dir/"));
+    EXPECT_EQ("srv/share", IStorageBackend::Path("srv/share"));
+    EXPECT_TRUE(IStorageBackend::ValidPath("srv/share/..dir/a..b"));
+    EXPECT_FALSE(IStorageBackend::ValidPath("srv/share/../other"));
+    EXPECT_FALSE(IStorageBackend::ValidPath(".."));
+    EXPECT_TRUE(IStorageBackend::Create("unknown", "") == NULL);
+}
+
+TEST(StorageBackend, Memory)
+{
+    MemoryBackend backend;
+    EXPECT_EQ(SMB_SUCCESS, backend.Init(false));
+    common_semantics(&backend);
+
+    /* servers and shares exist implicitly, deeper paths are listed through them */
+    EXPECT_EQ(SMB_SUCCESS, backend.AddFile("smb://srv/other/a/b/c.txt", "abc"));
+    struct stat st;
+    EXPECT_EQ(0, backend.Stat("smb://srv", &st));
+    EXPECT_TRUE(S_ISDIR(st.st_mode));
+    std::set<std::string> names = list(&backend, "smb://srv");
+    EXPECT_EQ(3u, names.size());
+    EXPECT_EQ(1u, names.count("other/"));
+    names = list(&backend, "smb://srv/other/a");
+    EXPECT_EQ(3u, names.size());
+    EXPECT_EQ(1u, names.count("b/"));
+    EXPECT_EQ(-1, backend.Rmdir("smb://srv/other"));
+
+    /* handle keeps data of unlinked file */
+    StorageFile *file = backend.Open("smb://srv/other/a/b/c.txt", O_RDONLY, 0);
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(0, backend.Unlink("smb://srv/other/a/b/c.txt"));
+    char buffer[3];
+    EXPECT_EQ(3, backend.Read(file, buffer, sizeof(buffer)));
+    EXPECT_EQ(-1, backend.Write(file, buffer, sizeof(buffer)));
+    EXPECT_EQ(EBADF, errno);
+    backend.Close(file);
+
+    /* O_EXCL, O_TRUNC */
+    EXPECT_EQ(SMB_SUCCESS, backend.AddFile("smb://srv/share/f", "0123456789"));
+    EXPECT_TRUE(backend.Open("smb://srv/share/f", O_CREAT | O_EXCL | O_RDWR, 0) == NULL);
+    EXPECT_EQ(EEXIST, errno);
+    write_file(&backend, "smb://srv/share/f", "new");
+    EXPECT_EQ("new", read_file(&backend, "smb://srv/share/f"));
+
+    backend.Clear();
+    EXPECT_EQ(-1, backend.Stat("smb://srv/share/f", &st));
+    EXPECT_EQ(SMB_SUCCESS, backend.Quit());
+}
+
+TEST(StorageBackend, Posix)
+{
+    system(("rm -rf " + posix_root).c_str());
+    PosixBackend backend(posix_root + "/root");
+    EXPECT_EQ(SMB_SUCCESS, backend.Init(false));
+    EXPECT_EQ(0, backend.Mkdir("smb://srv", 0));
+    EXPECT_EQ(0, backend.Mkdir("smb://srv/share", 0));
+    common_semantics(&backend);
+
+    struct stat st;
+    write_file(&backend, "smb://srv/share/local", "on disk");
+    EXPECT_EQ(0, stat((posix_root + "/root/srv/share/local").c_str(), &st));
+    EXPECT_EQ(7, st.st_size);
+    EXPECT_EQ(SMB_SUCCESS, backend.Quit());
+    system(("rm -rf " + posix_root).c_str());
+}
+
+TEST(StorageBackend, Instrumented)
+{
+    Metrics &metrics = Metrics::GetInstance();
+    metrics.Reset();
+
+    MemoryBackend *memory = ALLOCATE(MemoryBackend);
+    InstrumentedBackend backend(memory, 1000);
+    EXPECT_EQ(SMB_SUCCESS, backend.Init(false));
+    EXPECT_STREQ(STORAGE_BACKEND_MEMORY, backend.Name());
+    EXPECT_EQ(memory, backend.Inner());
+    common_semantics(&backend);
+
+    const CallStats &write = metrics.Call(METRIC_CALL_WRITE);
+    EXPECT_EQ(2u, write.Count());
+    EXPECT_EQ(14u, write.Bytes());
+    EXPECT_EQ(0u, write.Errors());
+    EXPECT_GT(metrics.Call(METRIC_CALL_READ).Bytes(), 0u);
+    EXPECT_EQ(3u, metrics.Call(METRIC_CALL_MKDIR).Count());
+    EXPECT_EQ(2u, metrics.Call(METRIC_CALL_MKDIR).Errors());
+    EXPECT_EQ(1u, metrics.CallErrno(METRIC_CALL_MKDIR, EEXIST));
+    EXPECT_EQ(1u, metrics.CallErrno(METRIC_CALL_MKDIR, ENOENT));
+    EXPECT_EQ(0u, metrics.Call(METRIC_CALL_READDIRPLUS).Errors());
+
+    /* per server/share */
+    ShareStats *share = metrics.Share("srv/share");
+    ASSERT_TRUE(share != NULL);
+    EXPECT_EQ(write.Count(), share->_calls[METRIC_CALL_WRITE].Count());
+    EXPECT_EQ(0u, metrics.Share("srv/other")->_calls[METRIC_CALL_WRITE].Count());
+
+    /* slow calls */
+    memory->AddFile("smb://srv/share/slow", "slow");
+    memory->SetLatency(2000);
+    struct stat st;
+    EXPECT_EQ(0, backend.Stat("smb://srv/share/slow", &st));
+    EXPECT_EQ(1u, metrics.Call(METRIC_CALL_STAT).Slow());
+    EXPECT_GE(metrics.Call(METRIC_CALL_STAT).Latency().Max(), 2000u);
+
+    std::string dump;
+    metrics.Dump(dump);
+    EXPECT_NE(std::string::npos, dump.find("\"storage_calls\":{\"open\":{"));
+    EXPECT_NE(std::string::npos, dump.find("\"mkdir:17\":1"));
+    EXPECT_NE(std::string::npos, dump.find("\"storage_shares\":{\"srv/other\":{},\"srv/share\":{"));
+
+    EXPECT_EQ(SMB_SUCCESS, backend.Quit());
+    metrics.Reset();
+}
+
+TEST(StorageBackend, InjectedLatency)
+{
+    MemoryBackend backend;
+    backend.AddFile("smb://srv/share/f", std::string(10000, 'x'));
+
+    backend.SetLatency(2000);
+    uint64_t start = Metrics::Now();
+    struct stat st;
+    backend.Stat("smb://srv/share/f", &st);
+    EXPECT_GE(Metrics::Now() - start, 2000u);
+
+    /* 10000 bytes at 1MB/s take 10ms */
+    backend.SetLatency(0);
+    backend.SetBandwidth(1000000);
+    start = Metrics::Now();
+    EXPECT_EQ(std::string(10000, 'x'), read_file(&backend, "smb://srv/share/f"));
+    EXPECT_GE(Metrics::Now() - start, 10000u);
+}
+
+TEST(StorageBackend, SmbClientOverMemory)
+{
+    SmbClient *client = SmbClient::GetInstance();
+    MemoryBackend *backend = ALLOCATE(MemoryBackend);
+    client->SetBackend(backend);
+    bool kerberos = false;
+    EXPECT_EQ(SMB_SUCCESS, client->Init(kerberos));
+    EXPECT_EQ(backend, client->Backend());
+
+    /* upload through tmp file, restore to final name */
+    std::string server = "srv/share/up/load/file.bin";
+    std::string workgroup = "WG", user = "user", password = "password";
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    Configuration::GetInstance().Set(C_FILE_UPLOAD_MODE, "0");
+    EXPECT_EQ(SMB_SUCCESS, client->UploadInit("uid1"));
+    char data[] = "uploaded content";
+    EXPECT_EQ((int) strlen(data), client->Write(data, strlen(data)));
+    EXPECT_EQ(SMB_SUCCESS, client->CloseFile());
+    EXPECT_EQ(SMB_SUCCESS, client->RestoreTmpFile("uid1"));
+    EXPECT_EQ("uploaded content", read_file(backend, "smb://srv/share/up/load/file.bin"));
+
+    /* download range */
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    EXPECT_EQ(SMB_SUCCESS, client->DownloadInit());
+    EXPECT_EQ(strlen(data), (size_t) client->FileStat()->st_size);
+    EXPECT_EQ(SMB_SUCCESS, client->SetOffset(9, 15));
+    char buffer[64];
+    EXPECT_EQ(7, client->Read(buffer, sizeof(buffer)));
+    EXPECT_EQ(std::string("content"), std::string(buffer, 7));
+    EXPECT_EQ(SMB_SUCCESS, client->CloseFile());
+
+    /* delete directory with content */
+    server = "srv/share/up/load";
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    bool directory = false;
+    EXPECT_EQ(SMB_SUCCESS, client->Delete(directory));
+    EXPECT_TRUE(directory);
+    client->CloseDir();
+    struct stat st;
+    EXPECT_EQ(-1, backend->Stat("smb://srv/share/up/load", &st));
+
+    EXPECT_EQ(SMB_SUCCESS, client->Quit());
+    client->SetBackend(NULL);
+}
+
+/* files named "locked" can not be deleted */
+class LockedBackend : public MemoryBackend
+{
+public:
+    int Unlink(const std::string &url)
+    {
+        if (url.size() >= 7 && url.compare(url.size() - 7, 7, "/locked") == 0)
+        {
+            errno = EACCES;
+            return -1;
+        }
+        return MemoryBackend::Unlink(url);
+    }
+};
+
+static void add_tree(MemoryBackend *backend, const std::string &root, bool locked)
+{
+    for (int i = 0; i < 150; i++)
+    {
+        backend->AddFile(root + "/f" + std::to_string(i), "x");
+    }
+    backend->AddFile(root + "/a/b/c/file", "x");
+    backend->AddFile(root + "/a/b/" + (locked ? "locked" : "file"), "x");
+    backend->AddFile(root + "/d/file", "x");
+    backend->AddDirectory(root + "/e");
+}
+
+TEST(StorageBackend, TreeDeleter)
+{
+    struct stat st;
+    for (unsigned int workers = 1; workers <= 8; workers += 7)
+    {
+        MemoryBackend backend;
+        add_tree(&backend, "smb://srv/share/tree", false);
+        TreeDeleter deleter(&backend, "srv/share/tree/");
+        EXPECT_EQ(SMB_SUCCESS, deleter.Run(workers, 1, [](const DeleteProgress &progress) {
+            EXPECT_FALSE(progress._done);
+            EXPECT_LE(progress._files, 153u);
+        }));
+        EXPECT_EQ(153u, deleter.Progress()._files);
+        EXPECT_EQ(6u, deleter.Progress()._folders);
+        EXPECT_EQ(0u, deleter.Progress()._failed);
+        EXPECT_TRUE(deleter.Progress()._done);
+        EXPECT_EQ(-1, backend.Stat("smb://srv/share/tree", &st));
+        EXPECT_EQ(0, backend.Stat("smb://srv/share", &st));
+    }
+
+    /* failure keeps its parents, everything else is deleted */
+    LockedBackend backend;
+    add_tree(&backend, "smb://srv/share/tree", true);
+    TreeDeleter deleter(&backend, "srv/share/tree");
+    EXPECT_EQ(SMB_ERROR, deleter.Run(4, 0, DeleteProgressCallback()));
+    EXPECT_EQ(ENOTEMPTY, errno);
+    EXPECT_EQ(152u, deleter.Progress()._files);
+    EXPECT_EQ(3u, deleter.Progress()._folders);
+    EXPECT_EQ(1u, deleter.Progress()._failed);
+    ASSERT_EQ(1u, deleter.Progress()._failures.size());
+    EXPECT_EQ("a/b/locked", deleter.Progress()._failures[0]._name);
+    EXPECT_EQ(EACCES, deleter.Progress()._failures[0]._error);
+    EXPECT_EQ(0, backend.Stat("smb://srv/share/tree/a/b/locked", &st));
+    EXPECT_EQ(-1, backend.Stat("smb://srv/share/tree/a/b/c", &st));
+    EXPECT_EQ(-1, backend.Stat("smb://srv/share/tree/d", &st));
+    EXPECT_EQ(-1, backend.Stat("smb://srv/share/tree/f0", &st));
+
+    /* missing directory */
+    TreeDeleter missing(&backend, "srv/share/missing");
+    EXPECT_EQ(SMB_ERROR, missing.Run(2, 0, DeleteProgressCallback()));
+    EXPECT_EQ(ENOENT, errno);
+}
+
+/* counts context (re)creations and folder creations */
+class CountingBackend : public MemoryBackend
+{
+public:
+    int _inits;
+    int _quits;
+    int _mkdirs;
+
+    CountingBackend() : _inits(0), _quits(0), _mkdirs(0) {}
+
+    int Init(bool kerberos)
+    {
+        _inits++;
+        return MemoryBackend::Init(kerberos);
+    }
+
+    int Quit()
+    {
+        _quits++;
+        return MemoryBackend::Quit();
+    }
+
+    int Mkdir(const std::string &url, mode_t mode)
+    {
+        _mkdirs++;
+        return MemoryBackend::Mkdir(url, mode);
+    }
+};
+
+TEST(StorageBackend, SmbClientKeepsContextAcrossOperations)
+{
+    SmbClient *client = SmbClient::GetInstance();
+    CountingBackend *backend = ALLOCATE(CountingBackend);
+    client->SetBackend(backend);
+    bool kerberos = false;
+    std::string server = "srv/share/keep", workgroup = "WG", user = "user", password = "password";
+
+    /* operations of a session with same credentials share the context */
+    EXPECT_EQ(SMB_SUCCESS, client->Init(kerberos));
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    EXPECT_EQ(SMB_SUCCESS, client->CreateDirectory());
+    EXPECT_EQ(SMB_SUCCESS, client->Reset());
+    EXPECT_EQ(SMB_SUCCESS, client->Init(kerberos));
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    EXPECT_EQ(SMB_SUCCESS, client->OpenDir());
+    EXPECT_EQ(SMB_SUCCESS, client->Reset());
+    EXPECT_EQ(1, backend->_inits);
+    EXPECT_EQ(0, backend->_quits);
+
+    /* other credentials never reuse the authenticated context */
+    std::string other = "other";
+    EXPECT_EQ(SMB_SUCCESS, client->Init(kerberos));
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, other, password));
+    EXPECT_EQ(2, backend->_inits);
+    EXPECT_EQ(1, backend->_quits);
+
+    EXPECT_EQ(SMB_SUCCESS, client->Quit());
+    EXPECT_EQ(2, backend->_quits);
+    client->SetBackend(NULL);
+}
+
+static void upload(SmbClient *client, std::string server)
+{
+    std::string workgroup = "WG", user = "user", password = "password";
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    EXPECT_EQ(SMB_SUCCESS, client->UploadInit("uid"));
+    EXPECT_EQ(SMB_SUCCESS, client->CloseFile());
+}
+
+TEST(StorageBackend, SmbClientKnownDirs)
+{
+    Configuration &c = Configuration::GetInstance();
+    SmbClient *client = SmbClient::GetInstance();
+    CountingBackend *backend = ALLOCATE(CountingBackend);
+    client->SetBackend(backend);
+    bool kerberos = false;
+    c.Set(C_FILE_UPLOAD_MODE, "1");
+    EXPECT_EQ(SMB_SUCCESS, client->Init(kerberos));
+
+    /* bulk, a and b are created by the first upload only */
+    for (int i = 0; i < 10; i++)
+    {
+        upload(client, "srv/share/bulk/a/b/file" + std::to_string(i));
+    }
+    EXPECT_EQ(5, backend->_mkdirs);
+    upload(client, "srv/share/bulk/a/c/file");
+    upload(client, "srv/share/bulk/file");
+    EXPECT_EQ(6, backend->_mkdirs);
+
+    /* deleted by the session, a and b are created again */
+    std::string server = "srv/share/bulk/a", workgroup = "WG", user = "user", password = "password";
+    EXPECT_EQ(SMB_SUCCESS, client->CredentialsInit(server, workgroup, user, password));
+    bool directory = false;
+    EXPECT_EQ(SMB_SUCCESS, client->Delete(directory));
+    client->CloseDir();
+    upload(client, "srv/share/bulk/a/b/file");
+    EXPECT_EQ(9, backend->_mkdirs);
+
+    /* removed behind the session, create fails and b is created again */
+    EXPECT_EQ(0, backend->Unlink("smb://srv/share/bulk/a/b/file"));
+    EXPECT_EQ(0, backend->Rmdir("smb://srv/share/bulk/a/b"));
+    upload(client, "srv/share/bulk/a/b/file");
+    EXPECT_EQ(10, backend->_mkdirs);
+    struct stat st;
+    EXPECT_EQ(0, backend->Stat("smb://srv/share/bulk/a/b/file", &st));
+
+    /* new session, nothing known */
+    EXPECT_EQ(SMB_SUCCESS, client->Quit());
+    EXPECT_EQ(SMB_SUCCESS, client->Init(kerberos));
+    upload(client, "srv/share/bulk/a/b/file");
+    upload(client, "srv/share/bulk/a/b/file");
+    EXPECT_EQ(11, backend->_mkdirs);
+
+    /* off */
+    c.Set(C_KNOWN_DIRS, "0");
+    upload(client, "srv/share/bulk/a/b/file");
+    upload(client, "srv/share/bulk/a/b/file");
+    EXPECT_EQ(13, backend->_mkdirs);
+
+    c.Set(C_KNOWN_DIRS, DEFAULT_KNOWN_DIRS);
+    c.Set(C_FILE_UPLOAD_MODE, DEFAULT_FILE_UPLOAD_MODE);
+    EXPECT_EQ(SMB_SUCCESS, client->Quit());
+    client->SetBackend(NULL);
+}
+
+#endif //_DEBUG_
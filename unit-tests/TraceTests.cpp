@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2017 VMware, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: GPL-3.0
+ *
+ */
+
+#ifdef _DEBUG_
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+#include "base/Error.h"
+#include "base/Trace.h"
+#include "processor/DownloadProcessor.h"
+
+TEST(Trace, DisabledRecordsNothing)
+{
+    Tracer &tracer = Tracer::GetInstance();
+    tracer.SetEnabled(false);
+    tracer.Reset();
+    {
+        TRACE_SPAN("Disabled");
+    }
+    std::string out;
+    EXPECT_EQ(0u, tracer.Dump(out));
+    EXPECT_EQ(std::string::npos, out.find("Disabled"));
+}
+
+TEST(Trace, SpanTaggedWithRequest)
+{
+    Tracer &tracer = Tracer::GetInstance();
+    tracer.Reset();
+    tracer.SetEnabled(true);
+
+    DownloadProcessor *processor = ALLOCATE(DownloadProcessor);
+    std::string id("trace-req");
+    processor->Init(id);
+    RequestProcessor::SetInstance(processor);
+    {
+        TraceSpan span("SmbRead");
+        span.SetBytes(4096);
+    }
+    RequestProcessor::SetInstance(NULL);
+    processor->Quit();
+    FREE(processor);
+    {
+        TRACE_SPAN("NoRequest");
+    }
+    tracer.SetEnabled(false);
+
+    std::string out;
+    EXPECT_EQ(2u, tracer.Dump(out));
+    EXPECT_NE(std::string::npos, out.find("\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, out.find("\"name\":\"SmbRead\",\"cat\":\"smb\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, out.find("\"requestId\":\"trace-req\",\"bytes\":4096"));
+
+    EXPECT_EQ(1u, tracer.Dump(out, "trace-req"));
+    EXPECT_EQ(std::string::npos, out.find("NoRequest"));
+    EXPECT_EQ(0u, tracer.Dump(out, "other"));
+    tracer.Reset();
+}
+
+TEST(Trace, CurrentRequestId)
+{
+    char id[IDENT_BUFFER_SIZE];
+    DownloadProcessor *processor = ALLOCATE(DownloadProcessor);
+    RequestProcessor::SetInstance(processor);
+    RequestProcessor::CurrentRequestId(id, sizeof(id));
+    EXPECT_STREQ("", id);
+
+    /* id set on the current instance, too long ones are truncated */
+    std::string req("current-req");
+    processor->Init(req);
+    RequestProcessor::CurrentRequestId(id, sizeof(id));
+    EXPECT_STREQ("current-req", id);
+    processor->SetRequestId(std::string(2 * IDENT_BUFFER_SIZE, 'x'));
+    RequestProcessor::CurrentRequestId(id, sizeof(id));
+    EXPECT_EQ(std::string(IDENT_BUFFER_SIZE - 1, 'x'), id);
+    RequestProcessor::CurrentRequestId(id, 4);
+    EXPECT_STREQ("xxx", id);
+
+    RequestProcessor::SetInstance(NULL);
+    RequestProcessor::CurrentRequestId(id, sizeof(id));
+    EXPECT_STREQ("", id);
+    processor->Quit();
+    FREE(processor);
+}
+
+TEST(Trace, RingOverwritesOldest)
+{
+    Tracer &tracer = Tracer::GetInstance();
+    tracer.Reset();
+    for (int i = 0; i < TRACE_RING_SIZE + 10; i++)
+    {
+        tracer.Record(i < 10 ? "Old" : "New", (uint64_t) i, 1);
+    }
+    std::string out;
+    EXPECT_EQ((size_t) TRACE_RING_SIZE, tracer.Dump(out));
+    EXPECT_EQ(std::string::npos, out.find("\"Old\""));
+    tracer.Reset();
+}
+
+TEST(Trace, WriteRequestFile)
+{
+    char dir[] = "/tmp/smb-trace-test-XXXXXX";
+    ASSERT_TRUE(mkdtemp(dir) != NULL);
+
+    Tracer &tracer = Tracer::GetInstance();
+    EXPECT_EQ(SMB_SUCCESS, tracer.Init(false, dir));
+    tracer.Reset();
+
+    DownloadProcessor *processor = ALLOCATE(DownloadProcessor);
+    std::string id("12/34");
+    processor->Init(id);
+    RequestProcessor::SetInstance(processor);
+    tracer.Record("OpenFile", 100, 20);
+    RequestProcessor::SetInstance(NULL);
+    processor->Quit();
+    FREE(processor);
+
+    EXPECT_EQ(SMB_SUCCESS, tracer.Write("12/34"));
+    std::string path = std::string(dir) + "/trace_12_34.json";
+    std::ifstream file(path.c_str());
+    ASSERT_TRUE(file.good());
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_NE(std::string::npos, content.str().find("\"name\":\"OpenFile\""));
+    EXPECT_NE(std::string::npos, content.str().find("\"ts\":100,\"dur\":20"));
+
+    /* nothing buffered for request, no file */
+    EXPECT_EQ(SMB_SUCCESS, tracer.Write("none"));
+    EXPECT_NE(0, access((std::string(dir) + "/trace_none.json").c_str(), F_OK));
+
+    unlink(path.c_str());
+    rmdir(dir);
+    tracer.Reset();
+}
+
+#endif
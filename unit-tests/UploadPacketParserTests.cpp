@@ -62,6 +62,78 @@ TEST(UploadParser, ParsePacket)
     EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(packet));
 }
 
+TEST(UploadParser, ParseAliasedPayload)
+{
+    packet_data data;
+    data.download_upload_data.payload = ALLOCATE_ARR(char, 100);
+    data.download_upload_data.payload_len = 100;
+    memset(data.download_upload_data.payload, 'a', 100);
+    Packet *packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_SUCCESS, creator->CreatePacket(packet, UPLOAD_DATA_REQ, &data));
+
+    /* simulate packet received from wire */
+    Packet *recv = ALLOCATE(Packet);
+    memcpy(recv->_header, packet->_header, HEADER_SIZE);
+    recv->_data = ALLOCATE_ARR(char, packet->GetLength());
+    memcpy(recv->_data, packet->_data, packet->GetLength());
+    EXPECT_EQ(SMB_SUCCESS, recv->ParseProtoBuffer());
+    EXPECT_EQ(UPLOAD_DATA_REQ, recv->GetCMD());
+    EXPECT_EQ(request_id, recv->GetID());
+    EXPECT_TRUE(recv->_payload >= recv->_data);
+    EXPECT_TRUE(recv->_payload + recv->_payload_len <= recv->_data + recv->GetLength());
+    EXPECT_EQ(100u, recv->_payload_len);
+    EXPECT_EQ(0, memcmp(recv->_payload, data.download_upload_data.payload, 100));
+    EXPECT_TRUE(recv->_pb_msg->requestpacket().uploadrequestdata().data().empty());
+    EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(recv));
+    EXPECT_EQ(100u, recv->_payload_len);
+
+    /* truncated payload must be rejected */
+    recv->Reset();
+    memcpy(recv->_header, packet->_header, HEADER_SIZE);
+    uint32_t n_len = htonl(packet->GetLength() - 1);
+    memcpy(recv->_header + LENGTH_OFFSET, &n_len, LEN_SIZE);
+    recv->_data = ALLOCATE_ARR(char, packet->GetLength());
+    memcpy(recv->_data, packet->_data, packet->GetLength());
+    EXPECT_NE(SMB_SUCCESS, recv->ParseProtoBuffer());
+    EXPECT_TRUE(recv->_payload == NULL);
+
+    /* locally created packet, payload taken from protobuf object */
+    EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(packet));
+    EXPECT_EQ(100u, packet->_payload_len);
+    EXPECT_EQ(0, memcmp(packet->_payload, data.download_upload_data.payload, 100));
+
+    FREE_ARR(data.download_upload_data.payload);
+    FREE(recv);
+    FREE(packet);
+}
+
+TEST(UploadParser, ParseInlineData)
+{
+    Packet *packet = ALLOCATE(Packet);
+    EXPECT_EQ(SMB_SUCCESS, creator->CreatePacket(packet, UPLOAD_INIT_REQ, NULL));
+    UploadRequestData *inline_data = packet->_pb_msg->mutable_requestpacket()->mutable_uploadrequestdata();
+    inline_data->set_data(std::string(10, 'i'));
+    inline_data->set_last(true);
+    std::string serialized = packet->_pb_msg->SerializeAsString();
+
+    /* simulate packet received from wire */
+    Packet *recv = ALLOCATE(Packet);
+    packet->PutHeader();
+    memcpy(recv->_header, packet->_header, HEADER_SIZE);
+    recv->_data = ALLOCATE_ARR(char, serialized.size());
+    memcpy(recv->_data, serialized.data(), serialized.size());
+    EXPECT_EQ(SMB_SUCCESS, recv->ParseProtoBuffer());
+    EXPECT_EQ(SMB_SUCCESS, parser->ParsePacket(recv));
+    EXPECT_EQ(UPLOAD_INIT_REQ, recv->GetCMD());
+    EXPECT_EQ(10u, recv->_payload_len);
+    EXPECT_EQ(0, memcmp(recv->_payload, "iiiiiiiiii", 10));
+    EXPECT_TRUE(recv->_pb_msg->requestpacket().uploadrequestdata().last());
+    EXPECT_EQ(server, recv->_pb_msg->requestpacket().smbdetails().url());
+
+    FREE(recv);
+    FREE(packet);
+}
+
 TEST(UploadParser, TearDown)
 {
     RequestProcessor::SetInstance(NULL);